@@ -103,6 +103,11 @@ void UREEngineConfiguration::ApplyToEngine(URECore* Engine) const
         CacheManager->SetMaxSizeMB(CacheManagerConfig.MaxMemoryMB);
     }
     
+    if (UREKnowledge* KnowledgeBase = Engine->GetKnowledgeBase())
+    {
+        KnowledgeBase->SetActivationDecayRate(KnowledgeBaseConfig.ActivationDecayRate);
+    }
+    
     // Register configured processors
     RegisterConfiguredProcessors(Engine);
     
@@ -352,6 +352,11 @@ void URECore::LoadConfiguration(UREEngineConfiguration* Config)
         CacheManager->SetMaxSizeMB(Config->CacheManagerConfig.MaxMemoryMB);
     }
     
+    if (KnowledgeBase)
+    {
+        KnowledgeBase->SetActivationDecayRate(Config->KnowledgeBaseConfig.ActivationDecayRate);
+    }
+    
     // Register configured processors
     Config->RegisterConfiguredProcessors(this);
     
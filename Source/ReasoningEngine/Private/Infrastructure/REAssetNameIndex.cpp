@@ -0,0 +1,280 @@
+// Source/ReasoningEngine/Private/Infrastructure/REAssetNameIndex.cpp
+#include "Infrastructure/REAssetNameIndex.h"
+#include "Infrastructure/RENormalizer.h"
+#include "Infrastructure/RETokenDictionary.h"
+#include "Infrastructure/RETokenizer.h"
+#include "Infrastructure/REWordSegmenter.h"
+#include "ReasoningEngine.h"
+#include "Async/ParallelFor.h"
+#include "Hash/CityHash.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "UObject/Class.h"
+
+namespace
+{
+    constexpr uint32 AssetIndexFileMagic = 0x49414552;  // "REAI"
+    
+    uint64 HashAssetName(const FString& Name)
+    {
+        return CityHash64(reinterpret_cast<const char*>(*Name), Name.Len() * sizeof(TCHAR));
+    }
+    
+    /** Everything TokenizeAnimationName output depends on besides the name */
+    uint64 HashTokenizerInputs()
+    {
+        FString ConfigText;
+        const FRETokenizerConfig Config = RETokenizer::GetAnimationNameConfig();
+        FRETokenizerConfig::StaticStruct()->ExportText(ConfigText, &Config, nullptr, nullptr, PPF_None, nullptr);
+        
+        const uint64 ConfigHash = CityHash64(reinterpret_cast<const char*>(*ConfigText), ConfigText.Len() * sizeof(TCHAR));
+        return CityHash128to64(Uint128_64(ConfigHash, FREWordSegmenter::GetDefault().GetVocabularyHash()));
+    }
+}
+
+FREAssetNameIndex::FBuildStats FREAssetNameIndex::Build(const TArray<FString>& InAssetPaths, const FString& CacheFilePath)
+{
+    FBuildStats Stats;
+    Stats.NumAssets = InAssetPaths.Num();
+    
+    AssetPaths = InAssetPaths;
+    AssetTokenIds.Reset();
+    Postings.Reset();
+    
+    const int32 NumAssets = AssetPaths.Num();
+    
+    TArray<FString> Names;
+    TArray<uint64> Keys;
+    Names.Reserve(NumAssets);
+    Keys.Reserve(NumAssets);
+    for (const FString& Path : AssetPaths)
+    {
+        Keys.Add(HashAssetName(Names.Add_GetRef(GetAssetName(Path))));
+    }
+    
+    // Reuse cached tokens for names seen before, unless the tokenizer changed since
+    const uint64 TokenizerHash = HashTokenizerInputs();
+    FCachedTokens Cache;
+    const bool bHasCacheFile = !CacheFilePath.IsEmpty() && LoadCache(CacheFilePath, TokenizerHash, Cache);
+    
+    TArray<TArray<FString>> NameTokens;
+    NameTokens.SetNum(NumAssets);
+    TArray<int32> Misses;
+    
+    for (int32 Asset = 0; Asset < NumAssets; Asset++)
+    {
+        const TPair<FString, TArray<FString>>* Cached = Cache.Find(Keys[Asset]);
+        if (Cached && Cached->Key.Equals(Names[Asset], ESearchCase::CaseSensitive))
+        {
+            NameTokens[Asset] = Cached->Value;
+            Stats.NumFromCache++;
+        }
+        else
+        {
+            Misses.Add(Asset);
+        }
+    }
+    
+    // Tokenize the delta in parallel
+    ParallelFor(Misses.Num(), [&](int32 Miss)
+    {
+        const int32 Asset = Misses[Miss];
+        const FRETokenStream Stream = RETokenizer::TokenizeAnimationName(Names[Asset]);
+        
+        TArray<FString>& Tokens = NameTokens[Asset];
+        Tokens.Reserve(Stream.Tokens.Num());
+        for (const FREToken& Token : Stream.Tokens)
+        {
+            Tokens.Add(Token.NormalizedText);
+        }
+    });
+    Stats.NumTokenized = Misses.Num();
+    
+    // Intern in parallel, then build postings in asset order so lists stay sorted
+    AssetTokenIds.SetNum(NumAssets);
+    ParallelFor(NumAssets, [&](int32 Asset)
+    {
+        FRETokenDictionary::Get().InternWords(NameTokens[Asset], AssetTokenIds[Asset]);
+    });
+    
+    for (int32 Asset = 0; Asset < NumAssets; Asset++)
+    {
+        for (uint32 Id : AssetTokenIds[Asset])
+        {
+            // Unknown tokens look up as InvalidId, so never post under it
+            if (Id == FRETokenDictionary::InvalidId)
+            {
+                continue;
+            }
+            
+            TArray<int32>& Assets = Postings.FindOrAdd(Id);
+            if (Assets.Num() == 0 || Assets.Last() != Asset)
+            {
+                Assets.Add(Asset);
+            }
+        }
+    }
+    
+    // Refresh the cache when anything was tokenized or entries went stale;
+    // repeated names share one entry, so compare against distinct names
+    bool bCacheStale = !bHasCacheFile || Misses.Num() > 0;
+    if (!bCacheStale && !CacheFilePath.IsEmpty())
+    {
+        bCacheStale = Cache.Num() != TSet<uint64>(Keys).Num();
+    }
+    
+    if (!CacheFilePath.IsEmpty() && bCacheStale)
+    {
+        FCachedTokens Updated;
+        Updated.Reserve(NumAssets);
+        for (int32 Asset = 0; Asset < NumAssets; Asset++)
+        {
+            Updated.Add(Keys[Asset], TPair<FString, TArray<FString>>(Names[Asset], NameTokens[Asset]));
+        }
+        Stats.bCacheWritten = SaveCache(CacheFilePath, TokenizerHash, Updated);
+    }
+    
+    UE_LOG(LogReasoningEngine, Verbose, TEXT("FREAssetNameIndex: %d assets, %d tokenized, %d from cache, %d tokens"),
+        Stats.NumAssets, Stats.NumTokenized, Stats.NumFromCache, Postings.Num());
+    
+    return Stats;
+}
+
+TArrayView<const int32> FREAssetNameIndex::FindAssets(const FString& Token) const
+{
+    const uint32 Id = FRETokenDictionary::Get().Find(RENormalizer::ToLowercase(Token));
+    if (const TArray<int32>* Assets = Postings.Find(Id))
+    {
+        return *Assets;
+    }
+    return TArrayView<const int32>();
+}
+
+TArray<int32> FREAssetNameIndex::FindAssetsWithAll(const TArray<FString>& Tokens) const
+{
+    TArray<TArrayView<const int32>> Lists;
+    for (const FString& Token : Tokens)
+    {
+        const TArrayView<const int32> Assets = FindAssets(Token);
+        if (Assets.Num() == 0)
+        {
+            return TArray<int32>();
+        }
+        Lists.Add(Assets);
+    }
+    
+    if (Lists.Num() == 0)
+    {
+        return TArray<int32>();
+    }
+    
+    // Intersect starting from the rarest token
+    Lists.Sort([](const TArrayView<const int32>& A, const TArrayView<const int32>& B) { return A.Num() < B.Num(); });
+    
+    TArray<int32> Result(Lists[0].GetData(), Lists[0].Num());
+    for (int32 List = 1; List < Lists.Num() && Result.Num() > 0; List++)
+    {
+        const TArrayView<const int32> Other = Lists[List];
+        int32 Write = 0;
+        int32 OtherIndex = 0;
+        for (int32 Read = 0; Read < Result.Num(); Read++)
+        {
+            while (OtherIndex < Other.Num() && Other[OtherIndex] < Result[Read])
+            {
+                OtherIndex++;
+            }
+            if (OtherIndex < Other.Num() && Other[OtherIndex] == Result[Read])
+            {
+                Result[Write++] = Result[Read];
+            }
+        }
+        Result.SetNum(Write, EAllowShrinking::No);
+    }
+    
+    return Result;
+}
+
+FString FREAssetNameIndex::GetAssetName(const FString& AssetPath)
+{
+    int32 Slash = INDEX_NONE;
+    if (!AssetPath.FindLastChar(TEXT('/'), Slash))
+    {
+        return AssetPath;
+    }
+    
+    // "/Game/A/MM_Walk.MM_Walk" - the object name follows the dot
+    FString Name = AssetPath.Mid(Slash + 1);
+    int32 Dot = INDEX_NONE;
+    if (Name.FindChar(TEXT('.'), Dot))
+    {
+        Name.RightChopInline(Dot + 1);
+    }
+    return Name;
+}
+
+bool FREAssetNameIndex::LoadCache(const FString& FilePath, uint64 TokenizerHash, FCachedTokens& OutEntries)
+{
+    TArray<uint8> Bytes;
+    if (!FFileHelper::LoadFileToArray(Bytes, *FilePath, FILEREAD_Silent))
+    {
+        return false;
+    }
+    
+    FMemoryReader Reader(Bytes);
+    uint32 Magic = 0;
+    int32 Version = 0;
+    uint64 FileTokenizerHash = 0;
+    int32 NumEntries = 0;
+    Reader << Magic << Version << FileTokenizerHash << NumEntries;
+    
+    if (Reader.IsError() || Magic != AssetIndexFileMagic || Version != CacheVersion
+        || FileTokenizerHash != TokenizerHash || NumEntries < 0)
+    {
+        // Stale format or tokenizer - rebuilt from scratch and overwritten
+        return false;
+    }
+    
+    OutEntries.Reserve(NumEntries);
+    for (int32 Index = 0; Index < NumEntries && !Reader.IsError(); Index++)
+    {
+        uint64 Key = 0;
+        TPair<FString, TArray<FString>> Entry;
+        Reader << Key << Entry.Key << Entry.Value;
+        OutEntries.Add(Key, MoveTemp(Entry));
+    }
+    
+    if (Reader.IsError())
+    {
+        UE_LOG(LogReasoningEngine, Warning, TEXT("FREAssetNameIndex: cache %s is truncated"), *FilePath);
+        OutEntries.Reset();
+        return false;
+    }
+    return true;
+}
+
+bool FREAssetNameIndex::SaveCache(const FString& FilePath, uint64 TokenizerHash, const FCachedTokens& Entries)
+{
+    TArray<uint8> Bytes;
+    FMemoryWriter Writer(Bytes);
+    
+    uint32 Magic = AssetIndexFileMagic;
+    int32 Version = CacheVersion;
+    int32 NumEntries = Entries.Num();
+    Writer << Magic << Version << TokenizerHash << NumEntries;
+    
+    for (const TPair<uint64, TPair<FString, TArray<FString>>>& Entry : Entries)
+    {
+        uint64 Key = Entry.Key;
+        FString Name = Entry.Value.Key;
+        TArray<FString> Tokens = Entry.Value.Value;
+        Writer << Key << Name << Tokens;
+    }
+    
+    if (!FFileHelper::SaveArrayToFile(Bytes, *FilePath))
+    {
+        UE_LOG(LogReasoningEngine, Warning, TEXT("FREAssetNameIndex: failed to write cache %s"), *FilePath);
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,289 @@
+// Source/ReasoningEngine/Private/Infrastructure/RECorpusStatistics.cpp
+#include "Infrastructure/RECorpusStatistics.h"
+#include "Infrastructure/RETokenDictionary.h"
+#include "Infrastructure/RETokenizer.h"
+#include "ReasoningEngine.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace
+{
+    constexpr uint32 CorpusFileMagic = 0x53434552;  // "RECS"
+    constexpr int32 CorpusFileVersion = 1;
+}
+
+FRECorpusStatistics::FRECorpusStatistics()
+    : NumDocuments(0)
+{
+    for (std::atomic<std::atomic<uint32>*>& Chunk : Chunks)
+    {
+        Chunk.store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+FRECorpusStatistics::~FRECorpusStatistics()
+{
+    Reset();
+}
+
+FRECorpusStatistics& FRECorpusStatistics::GetShared()
+{
+    static FRECorpusStatistics Shared;
+    return Shared;
+}
+
+// ========== INGESTION ==========
+
+void FRECorpusStatistics::AddDocument(TArrayView<const uint32> Ids)
+{
+    TArray<uint32> UniqueIds;
+    GetUniqueIds(Ids, UniqueIds);
+    
+    for (uint32 Id : UniqueIds)
+    {
+        if (std::atomic<uint32>* Counter = GetCounter(Id))
+        {
+            Counter->fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    NumDocuments.fetch_add(1, std::memory_order_relaxed);
+}
+
+void FRECorpusStatistics::AddDocument(const FRETokenStream& Stream)
+{
+    AddDocument(RETokenizer::GetTokenIds(Stream.Tokens));
+}
+
+void FRECorpusStatistics::RemoveDocument(TArrayView<const uint32> Ids)
+{
+    TArray<uint32> UniqueIds;
+    GetUniqueIds(Ids, UniqueIds);
+    
+    for (uint32 Id : UniqueIds)
+    {
+        // An id without a counter was never added, so there is nothing to remove
+        std::atomic<uint32>* Counter = FindCounter(Id);
+        if (!Counter)
+        {
+            continue;
+        }
+        
+        // Never wrap below zero on mismatched removes
+        uint32 Current = Counter->load(std::memory_order_relaxed);
+        while (Current > 0 && !Counter->compare_exchange_weak(Current, Current - 1, std::memory_order_relaxed))
+        {
+        }
+    }
+    
+    uint64 Current = NumDocuments.load(std::memory_order_relaxed);
+    while (Current > 0 && !NumDocuments.compare_exchange_weak(Current, Current - 1, std::memory_order_relaxed))
+    {
+    }
+}
+
+// ========== QUERIES ==========
+
+uint32 FRECorpusStatistics::GetDocumentFrequency(uint32 Id) const
+{
+    const std::atomic<uint32>* Counter = FindCounter(Id);
+    return Counter ? Counter->load(std::memory_order_relaxed) : 0;
+}
+
+float FRECorpusStatistics::GetIdf(uint32 Id) const
+{
+    const double Documents = static_cast<double>(GetNumDocuments());
+    const double Frequency = static_cast<double>(GetDocumentFrequency(Id));
+    return static_cast<float>(FMath::Loge((1.0 + Documents) / (1.0 + Frequency)) + 1.0);
+}
+
+void FRECorpusStatistics::BuildIdfTable(TArray<float>& OutIdf) const
+{
+    const int32 NumIds = FRETokenDictionary::Get().NumPublished();
+    const double LogDocuments = FMath::Loge(1.0 + static_cast<double>(GetNumDocuments()));
+    
+    OutIdf.SetNumUninitialized(NumIds);
+    for (int32 Id = 0; Id < NumIds; Id++)
+    {
+        const double Frequency = static_cast<double>(GetDocumentFrequency(Id));
+        OutIdf[Id] = static_cast<float>(LogDocuments - FMath::Loge(1.0 + Frequency) + 1.0);
+    }
+}
+
+// ========== PERSISTENCE ==========
+
+bool FRECorpusStatistics::SaveToFile(const FString& FilePath) const
+{
+    const FRETokenDictionary& Dictionary = FRETokenDictionary::Get();
+    
+    TArray<uint8> Bytes;
+    FMemoryWriter Writer(Bytes);
+    
+    uint32 Magic = CorpusFileMagic;
+    int32 Version = CorpusFileVersion;
+    uint64 Documents = GetNumDocuments();
+    Writer << Magic << Version << Documents;
+    
+    // Entry count is patched once known
+    const int64 CountOffset = Writer.Tell();
+    int32 NumEntries = 0;
+    Writer << NumEntries;
+    
+    const int32 NumIds = Dictionary.NumPublished();
+    for (int32 Id = 0; Id < NumIds; Id++)
+    {
+        uint32 Frequency = GetDocumentFrequency(Id);
+        if (Frequency > 0)
+        {
+            FString Text = Dictionary.Resolve(Id);
+            Writer << Text << Frequency;
+            NumEntries++;
+        }
+    }
+    
+    Writer.Seek(CountOffset);
+    Writer << NumEntries;
+    
+    if (!FFileHelper::SaveArrayToFile(Bytes, *FilePath))
+    {
+        UE_LOG(LogReasoningEngine, Warning, TEXT("FRECorpusStatistics: failed to write %s"), *FilePath);
+        return false;
+    }
+    return true;
+}
+
+bool FRECorpusStatistics::LoadFromFile(const FString& FilePath)
+{
+    TArray<uint8> Bytes;
+    if (!FFileHelper::LoadFileToArray(Bytes, *FilePath))
+    {
+        return false;
+    }
+    
+    FMemoryReader Reader(Bytes);
+    
+    uint32 Magic = 0;
+    int32 Version = 0;
+    uint64 Documents = 0;
+    int32 NumEntries = 0;
+    Reader << Magic << Version << Documents << NumEntries;
+    
+    if (Reader.IsError() || Magic != CorpusFileMagic || Version != CorpusFileVersion || NumEntries < 0)
+    {
+        UE_LOG(LogReasoningEngine, Warning, TEXT("FRECorpusStatistics: %s is not a corpus statistics file"), *FilePath);
+        return false;
+    }
+    
+    // Parse fully before touching the live counters
+    TArray<TPair<FString, uint32>> Entries;
+    Entries.Reserve(NumEntries);
+    for (int32 Index = 0; Index < NumEntries && !Reader.IsError(); Index++)
+    {
+        TPair<FString, uint32>& Entry = Entries.AddDefaulted_GetRef();
+        Reader << Entry.Key << Entry.Value;
+    }
+    
+    if (Reader.IsError())
+    {
+        UE_LOG(LogReasoningEngine, Warning, TEXT("FRECorpusStatistics: %s is truncated"), *FilePath);
+        return false;
+    }
+    
+    Reset();
+    
+    FRETokenDictionary& Dictionary = FRETokenDictionary::Get();
+    for (const TPair<FString, uint32>& Entry : Entries)
+    {
+        const uint32 Id = Dictionary.Intern(Entry.Key);
+        std::atomic<uint32>* Counter = Id != FRETokenDictionary::InvalidId ? GetCounter(Id) : nullptr;
+        if (Counter)
+        {
+            Counter->store(Entry.Value, std::memory_order_relaxed);
+        }
+    }
+    NumDocuments.store(Documents, std::memory_order_release);
+    
+    return true;
+}
+
+void FRECorpusStatistics::Reset()
+{
+    for (std::atomic<std::atomic<uint32>*>& Chunk : Chunks)
+    {
+        delete[] Chunk.exchange(nullptr, std::memory_order_acq_rel);
+    }
+    NumDocuments.store(0, std::memory_order_release);
+}
+
+// ========== INTERNAL ==========
+
+std::atomic<uint32>* FRECorpusStatistics::GetCounter(uint32 Id)
+{
+    const uint32 ChunkIndex = Id >> ChunkBits;
+    if (ChunkIndex >= MaxChunks)
+    {
+        // Report once rather than for every document that has such an id
+        static std::atomic<bool> bReported(false);
+        if (!bReported.exchange(true, std::memory_order_relaxed))
+        {
+            UE_LOG(LogReasoningEngine, Error, TEXT("FRECorpusStatistics: token id %u is past the %u counters; larger ids are not counted"),
+                   Id, MaxChunks * ChunkSize);
+        }
+        return nullptr;
+    }
+    
+    std::atomic<uint32>* Chunk = Chunks[ChunkIndex].load(std::memory_order_acquire);
+    if (!Chunk)
+    {
+        std::atomic<uint32>* NewChunk = new std::atomic<uint32>[ChunkSize];
+        for (uint32 Index = 0; Index < ChunkSize; Index++)
+        {
+            NewChunk[Index].store(0, std::memory_order_relaxed);
+        }
+        
+        // Lost the race - use the winner's chunk
+        if (Chunks[ChunkIndex].compare_exchange_strong(Chunk, NewChunk, std::memory_order_acq_rel))
+        {
+            Chunk = NewChunk;
+        }
+        else
+        {
+            delete[] NewChunk;
+        }
+    }
+    
+    return &Chunk[Id & ChunkMask];
+}
+
+const std::atomic<uint32>* FRECorpusStatistics::FindCounter(uint32 Id) const
+{
+    const uint32 ChunkIndex = Id >> ChunkBits;
+    if (ChunkIndex >= MaxChunks)
+    {
+        return nullptr;
+    }
+    
+    const std::atomic<uint32>* Chunk = Chunks[ChunkIndex].load(std::memory_order_acquire);
+    return Chunk ? &Chunk[Id & ChunkMask] : nullptr;
+}
+
+void FRECorpusStatistics::GetUniqueIds(TArrayView<const uint32> Ids, TArray<uint32>& OutUnique)
+{
+    OutUnique.Reset(Ids.Num());
+    OutUnique.Append(Ids.GetData(), Ids.Num());
+    OutUnique.Sort();
+    
+    int32 Write = 0;
+    for (int32 Read = 0; Read < OutUnique.Num(); Read++)
+    {
+        if (OutUnique[Read] == FRETokenDictionary::InvalidId)
+        {
+            continue;
+        }
+        if (Write == 0 || OutUnique[Write - 1] != OutUnique[Read])
+        {
+            OutUnique[Write++] = OutUnique[Read];
+        }
+    }
+    OutUnique.SetNum(Write, EAllowShrinking::No);
+}
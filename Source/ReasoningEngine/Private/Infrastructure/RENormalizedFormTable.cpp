@@ -0,0 +1,71 @@
+// Source/ReasoningEngine/Private/Infrastructure/RENormalizedFormTable.cpp
+#include "Infrastructure/RENormalizedFormTable.h"
+
+FRENormalizedFormTable::FRENormalizedFormTable(const FRENormalizationPlan& InPlan)
+    : Plan(InPlan)
+{
+}
+
+FRENormalizedHandle FRENormalizedFormTable::Intern(FStringView Raw)
+{
+    const uint32 Hash = FREStringPool::HashString(Raw);
+    FShard& Shard = Shards[Hash % NumShards];
+    
+    // Fast path - seen before
+    {
+        FReadScopeLock ReadLock(Shard.Lock);
+        if (const uint32* Found = Shard.RawToForm.FindByHash(Hash, Raw))
+        {
+            return FRENormalizedHandle{ *Found };
+        }
+    }
+    
+    // Normalize outside the lock; a racing thread produces the same form id
+    TStringBuilder<256> Normalized;
+    RENormalizer::NormalizeInto(Raw, Plan, Normalized);
+    const uint32 FormId = Forms.Intern(Normalized.ToView());
+    if (FormId == FREStringPool::InvalidId)
+    {
+        // Form pool is full - nothing to remember
+        return FRENormalizedHandle();
+    }
+    
+    FWriteScopeLock WriteLock(Shard.Lock);
+    if (!Shard.RawToForm.FindByHash(Hash, Raw))
+    {
+        Shard.RawToForm.AddByHash(Hash, FString(Raw), FormId);
+    }
+    
+    return FRENormalizedHandle{ FormId };
+}
+
+FRENormalizedHandle FRENormalizedFormTable::Find(FStringView Raw) const
+{
+    const uint32 Hash = FREStringPool::HashString(Raw);
+    const FShard& Shard = Shards[Hash % NumShards];
+    
+    FReadScopeLock ReadLock(Shard.Lock);
+    const uint32* Found = Shard.RawToForm.FindByHash(Hash, Raw);
+    return Found ? FRENormalizedHandle{ *Found } : FRENormalizedHandle();
+}
+
+int32 FRENormalizedFormTable::NumRaw() const
+{
+    int32 Count = 0;
+    for (const FShard& Shard : Shards)
+    {
+        FReadScopeLock ReadLock(Shard.Lock);
+        Count += Shard.RawToForm.Num();
+    }
+    return Count;
+}
+
+void FRENormalizedFormTable::Reset()
+{
+    for (FShard& Shard : Shards)
+    {
+        FWriteScopeLock WriteLock(Shard.Lock);
+        Shard.RawToForm.Empty();
+    }
+    Forms.Reset();
+}
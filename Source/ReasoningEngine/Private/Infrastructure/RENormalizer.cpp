@@ -1,15 +1,51 @@
 ﻿// Source/ReasoningEngine/Private/Infrastructure/RENormalizer.cpp
 #include "Infrastructure/RENormalizer.h"
+#include "Infrastructure/RENormalizedFormTable.h"
 #include "ReasoningEngine.h"
 #include "Internationalization/Regex.h"
+#include "Async/ParallelFor.h"
+#include "RETextSimd.h"
+#include "REUnicode.h"
+
+namespace
+{
+    /**
+     * Run a length-preserving-or-shrinking kernel into a fresh FString
+     * Kernel signature: int32(const TCHAR* Src, TCHAR* Dst, int32 Len) -> chars written
+     */
+    template<typename KernelType>
+    FString TransformToString(const FString& Text, KernelType&& Kernel)
+    {
+        FString Result;
+        const int32 Len = Text.Len();
+        if (Len == 0)
+        {
+            return Result;
+        }
+        
+        auto& Chars = Result.GetCharArray();
+        Chars.SetNumUninitialized(Len + 1);
+        const int32 Written = Kernel(*Text, Chars.GetData(), Len);
+        
+        if (Written == 0)
+        {
+            Result.Empty();
+            return Result;
+        }
+        
+        Chars[Written] = TEXT('\0');
+        Chars.SetNum(Written + 1, EAllowShrinking::No);
+        return Result;
+    }
+}
 
 // ========== PRIMARY NORMALIZATION ==========
 
 FString RENormalizer::NormalizeText(const FString& Text)
 {
-    // Default configuration
-    FRENormalizationConfig DefaultConfig;
-    return NormalizeTextWithConfig(Text, DefaultConfig);
+    // Default configuration, compiled once
+    static const FRENormalizationPlan DefaultPlan = CompilePlan(FRENormalizationConfig());
+    return NormalizeTextWithPlan(Text, DefaultPlan);
 }
 
 FString RENormalizer::NormalizeTextWithConfig(const FString& Text, const FRENormalizationConfig& Config)
@@ -19,91 +55,369 @@ FString RENormalizer::NormalizeTextWithConfig(const FString& Text, const FRENorm
         return Text;
     }
     
-    FString Result = Text;
+    return NormalizeTextWithPlan(Text, CompilePlan(Config));
+}
+
+FRENormalizationPlan RENormalizer::CompilePlan(const FRENormalizationConfig& Config)
+{
+    FRENormalizationPlan Plan;
     
-    // Apply normalization modes in specific order for best results
+    Plan.UnicodeForm = Config.UnicodeForm;
+    Plan.bLowercase = Config.HasMode(ERENormalizationMode::Lowercase);
+    Plan.bUppercase = !Plan.bLowercase && Config.HasMode(ERENormalizationMode::Uppercase);
+    Plan.bRemoveAccents = Config.HasMode(ERENormalizationMode::RemoveAccents);
+    Plan.bRemoveNumbers = Config.HasMode(ERENormalizationMode::RemoveNumbers);
+    Plan.bRemovePunctuation = Config.HasMode(ERENormalizationMode::RemovePunctuation);
+    Plan.bCollapseWhitespace = Config.HasMode(ERENormalizationMode::CollapseWhitespace);
+    Plan.bTrimWhitespace = Config.HasMode(ERENormalizationMode::TrimWhitespace);
+    Plan.bConvertToAscii = Config.bConvertToAscii;
+    Plan.AsciiReplacement = Config.AsciiReplacementChar;
+    Plan.MinLength = Config.MinLength;
+    Plan.MaxLength = Config.MaxLength;
     
-    // 1. Unicode normalization (if needed)
-    if (Config.UnicodeForm != EREUnicodeNormalizationForm::NFC)
+    // Custom removal has always been case-insensitive (FString::Replace default)
+    for (TCHAR Char : Config.CustomRemoveChars)
     {
-        Result = NormalizeUnicode(Result, Config.UnicodeForm);
+        Plan.RemoveCharsLower.AddUnique(FChar::ToLower(Char));
     }
     
-    // 2. Remove custom characters
-    if (!Config.CustomRemoveChars.IsEmpty())
+    // Precompute every stage for the ASCII range, in pipeline order
+    for (uint32 Code = 0; Code < 128; ++Code)
     {
-        for (TCHAR Char : Config.CustomRemoveChars)
+        TCHAR Char = static_cast<TCHAR>(Code);
+        uint16 Action = 0;
+        
+        if (Plan.RemoveCharsLower.Contains(FChar::ToLower(Char)))
+        {
+            Action |= FRENormalizationPlan::Action_Remove;
+        }
+        
+        if (Plan.bLowercase)
+        {
+            Char = FChar::ToLower(Char);
+        }
+        else if (Plan.bUppercase)
+        {
+            Char = FChar::ToUpper(Char);
+        }
+        
+        if ((Plan.bRemoveNumbers && FChar::IsDigit(Char)) ||
+            (Plan.bRemovePunctuation && RETextSimd::IsPunctuation(Char)))
+        {
+            Action |= FRENormalizationPlan::Action_Remove;
+        }
+        
+        if (RETextSimd::IsWhitespace(Char))
         {
-            Result = Result.Replace(&Char, TEXT(""));
+            Action |= FRENormalizationPlan::Action_Whitespace;
         }
+        
+        Plan.AsciiActions[Code] = Action | static_cast<uint16>(Char & 0xFF);
     }
     
-    // 3. Apply case conversion
-    if (Config.HasMode(ERENormalizationMode::Lowercase))
+    return Plan;
+}
+
+FString RENormalizer::NormalizeTextWithPlan(const FString& Text, const FRENormalizationPlan& Plan)
+{
+    if (Text.IsEmpty())
     {
-        Result = ToLowercase(Result);
+        return Text;
     }
-    else if (Config.HasMode(ERENormalizationMode::Uppercase))
+    
+    FString UnicodeNormalized;
+    const FStringView Source = PrepareSource(Text, Plan, UnicodeNormalized);
+    
+    FString Result;
+    auto& Chars = Result.GetCharArray();
+    Chars.SetNumUninitialized(Source.Len() * Plan.GetMaxExpansion() + 1);
+    
+    const int32 Written = NormalizeBuffer(Source, Plan, Chars.GetData());
+    if (Written == 0)
     {
-        Result = ToUppercase(Result);
+        return FString();
     }
     
-    // 4. Remove accents
-    if (Config.HasMode(ERENormalizationMode::RemoveAccents))
+    Chars[Written] = TEXT('\0');
+    Chars.SetNum(Written + 1, EAllowShrinking::Yes);
+    return Result;
+}
+
+// ========== BUFFER AND BATCH NORMALIZATION ==========
+
+int32 RENormalizer::NormalizeInto(FStringView Text, FStringBuilderBase& Out)
+{
+    static const FRENormalizationPlan DefaultPlan = CompilePlan(FRENormalizationConfig());
+    return NormalizeInto(Text, DefaultPlan, Out);
+}
+
+int32 RENormalizer::NormalizeInto(FStringView Text, const FRENormalizationConfig& Config, FStringBuilderBase& Out)
+{
+    return NormalizeInto(Text, CompilePlan(Config), Out);
+}
+
+int32 RENormalizer::NormalizeInto(FStringView Text, const FRENormalizationPlan& Plan, FStringBuilderBase& Out)
+{
+    if (Text.IsEmpty())
     {
-        Result = RemoveAccents(Result);
+        return 0;
     }
     
-    // 5. Remove numbers
-    if (Config.HasMode(ERENormalizationMode::RemoveNumbers))
+    FString UnicodeNormalized;
+    const FStringView Source = PrepareSource(Text, Plan, UnicodeNormalized);
+    
+    // Reserve the worst case in the builder, then give back what was not used
+    const int32 Capacity = Source.Len() * Plan.GetMaxExpansion();
+    TCHAR* Dst = Out.AddUninitialized(Capacity);
+    const int32 Written = NormalizeBuffer(Source, Plan, Dst);
+    Out.RemoveSuffix(Capacity - Written);
+    
+    return Written;
+}
+
+FRENormalizedBatch RENormalizer::NormalizeBatch(TArrayView<const FString> Texts, const FRENormalizationConfig& Config)
+{
+    return NormalizeBatch(Texts, CompilePlan(Config));
+}
+
+FRENormalizedBatch RENormalizer::NormalizeBatch(TArrayView<const FString> Texts, const FRENormalizationPlan& Plan)
+{
+    // Strings per work item, and total input size below which threading costs more than it saves
+    constexpr int32 StringsPerChunk = 256;
+    constexpr int64 MinParallelChars = 16 * 1024;
+    
+    FRENormalizedBatch Batch;
+    const int32 NumTexts = Texts.Num();
+    Batch.Offsets.SetNumUninitialized(NumTexts + 1);
+    Batch.Offsets[0] = 0;
+    
+    if (NumTexts == 0)
     {
-        Result = RemoveNumbers(Result);
+        return Batch;
     }
     
-    // 6. Remove punctuation
-    if (Config.HasMode(ERENormalizationMode::RemovePunctuation))
+    // Normalize [First, Last) into Out, recording each output length at Offsets[I + 1]
+    auto NormalizeRange = [&Texts, &Plan, &Batch](int32 First, int32 Last, TArray<TCHAR>& Out)
     {
-        Result = RemovePunctuation(Result);
+        FString UnicodeNormalized;
+        for (int32 Index = First; Index < Last; ++Index)
+        {
+            const FStringView Source = PrepareSource(Texts[Index], Plan, UnicodeNormalized);
+            const int32 Start = Out.Num();
+            Out.AddUninitialized(Source.Len() * Plan.GetMaxExpansion());
+            const int32 Written = NormalizeBuffer(Source, Plan, Out.GetData() + Start);
+            Out.SetNum(Start + Written, EAllowShrinking::No);
+            Batch.Offsets[Index + 1] = Written;
+        }
+    };
+    
+    int64 TotalChars = 0;
+    for (const FString& Text : Texts)
+    {
+        TotalChars += Text.Len();
     }
     
-    // 7. Collapse whitespace
-    if (Config.HasMode(ERENormalizationMode::CollapseWhitespace))
+    const int32 NumChunks = FMath::DivideAndRoundUp(NumTexts, StringsPerChunk);
+    
+    if (NumChunks == 1 || TotalChars < MinParallelChars)
+    {
+        Batch.Chars.Reserve(static_cast<int32>(TotalChars));
+        NormalizeRange(0, NumTexts, Batch.Chars);
+    }
+    else
     {
-        Result = CollapseWhitespace(Result);
+        // Each chunk normalizes into its own buffer, then buffers are stitched into the arena
+        TArray<TArray<TCHAR>> ChunkChars;
+        ChunkChars.SetNum(NumChunks);
+        
+        ParallelFor(NumChunks, [&](int32 Chunk)
+        {
+            const int32 First = Chunk * StringsPerChunk;
+            const int32 Last = FMath::Min(First + StringsPerChunk, NumTexts);
+            NormalizeRange(First, Last, ChunkChars[Chunk]);
+        });
+        
+        int32 ArenaSize = 0;
+        for (const TArray<TCHAR>& Chars : ChunkChars)
+        {
+            ArenaSize += Chars.Num();
+        }
+        Batch.Chars.SetNumUninitialized(ArenaSize);
+        
+        TArray<int32> ChunkStarts;
+        ChunkStarts.SetNumUninitialized(NumChunks);
+        for (int32 Chunk = 0, Start = 0; Chunk < NumChunks; ++Chunk)
+        {
+            ChunkStarts[Chunk] = Start;
+            Start += ChunkChars[Chunk].Num();
+        }
+        
+        ParallelFor(NumChunks, [&](int32 Chunk)
+        {
+            FMemory::Memcpy(Batch.Chars.GetData() + ChunkStarts[Chunk], ChunkChars[Chunk].GetData(), ChunkChars[Chunk].Num() * sizeof(TCHAR));
+        });
     }
     
-    // 8. Trim whitespace
-    if (Config.HasMode(ERENormalizationMode::TrimWhitespace))
+    // Output lengths -> start offsets
+    for (int32 Index = 0; Index < NumTexts; ++Index)
     {
-        Result = TrimWhitespace(Result);
+        Batch.Offsets[Index + 1] += Batch.Offsets[Index];
     }
     
-    // 9. Convert to ASCII if requested
-    if (Config.bConvertToAscii)
+    return Batch;
+}
+
+FStringView RENormalizer::PrepareSource(FStringView Text, const FRENormalizationPlan& Plan, FString& Storage)
+{
+    // 1. Unicode normalization needs composition context, so it stays a pre-pass
+    // Text already in the target form (all ASCII text included) is used in place
+    if (REUnicode::QuickCheck(Text, Plan.UnicodeForm) == REUnicode::EQuickCheckResult::Yes)
     {
-        Result = ToAscii(Result, Config.AsciiReplacementChar);
+        return Text;
+    }
+    
+    Storage = REUnicode::Normalize(Text, Plan.UnicodeForm);
+    return Storage;
+}
+
+int32 RENormalizer::NormalizeBuffer(FStringView Text, const FRENormalizationPlan& Plan, TCHAR* Dst)
+{
+    // 2-9. Fused per-character stages, then 10. length constraints
+    const int32 Written = ApplyLengthConstraints(ApplyPlan(Text.GetData(), Text.Len(), Plan, Dst), Plan);
+    return FMath::Max(0, Written);
+}
+
+int32 RENormalizer::ApplyPlan(const TCHAR* Src, int32 Len, const FRENormalizationPlan& Plan, TCHAR* Dst)
+{
+    const TCHAR* Replacement = *Plan.AsciiReplacement;
+    const int32 ReplacementLen = Plan.AsciiReplacement.Len();
+    
+    int32 Written = 0;
+    int32 ContentEnd = 0;         // Output length after the last non-whitespace char (trim)
+    bool bSeenContent = false;    // Leading whitespace is dropped until this is set (trim)
+    bool bInWhitespace = false;   // Inside a collapsed whitespace run
+    
+    for (int32 Index = 0; Index < Len; ++Index)
+    {
+        TCHAR Char = Src[Index];
+        bool bWhitespace;
+        
+        if (RETextSimd::IsAsciiChar(Char))
+        {
+            const uint16 Action = Plan.AsciiActions[static_cast<uint32>(Char)];
+            if (Action & FRENormalizationPlan::Action_Remove)
+            {
+                continue;
+            }
+            Char = static_cast<TCHAR>(Action & 0xFF);
+            bWhitespace = (Action & FRENormalizationPlan::Action_Whitespace) != 0;
+        }
+        else
+        {
+            // 2. Custom characters
+            if (Plan.RemoveCharsLower.Num() > 0 && Plan.RemoveCharsLower.Contains(FChar::ToLower(Char)))
+            {
+                continue;
+            }
+            
+            // 3. Case conversion
+            if (Plan.bLowercase)
+            {
+                Char = FChar::ToLower(Char);
+            }
+            else if (Plan.bUppercase)
+            {
+                Char = FChar::ToUpper(Char);
+            }
+            
+            // 4. Accents
+            if (Plan.bRemoveAccents)
+            {
+                Char = REUnicode::StripAccent(Char);
+            }
+            
+            // 5-6. Numbers and punctuation
+            if ((Plan.bRemoveNumbers && FChar::IsDigit(Char)) ||
+                (Plan.bRemovePunctuation && RETextSimd::IsPunctuation(Char)))
+            {
+                continue;
+            }
+            
+            bWhitespace = RETextSimd::IsWhitespace(Char);
+        }
+        
+        // 7-8. Whitespace collapsing and trimming
+        if (bWhitespace)
+        {
+            if (Plan.bTrimWhitespace && !bSeenContent)
+            {
+                continue;
+            }
+            if (Plan.bCollapseWhitespace)
+            {
+                if (bInWhitespace)
+                {
+                    continue;
+                }
+                Char = TEXT(' ');
+                bInWhitespace = true;
+            }
+        }
+        else
+        {
+            bInWhitespace = false;
+            bSeenContent = true;
+        }
+        
+        // 9. ASCII conversion (applied after trimming, as in the staged pipeline)
+        if (Plan.bConvertToAscii && !RETextSimd::IsAsciiChar(Char))
+        {
+            for (int32 R = 0; R < ReplacementLen; ++R)
+            {
+                Dst[Written++] = Replacement[R];
+            }
+        }
+        else
+        {
+            Dst[Written++] = Char;
+        }
+        
+        if (!bWhitespace)
+        {
+            ContentEnd = Written;
+        }
     }
     
+    return Plan.bTrimWhitespace ? ContentEnd : Written;
+}
+
+int32 RENormalizer::ApplyLengthConstraints(int32 Len, const FRENormalizationPlan& Plan)
+{
     // 10. Apply length constraints
-    if (Config.MinLength > 0 && Result.Len() < Config.MinLength)
+    if (Plan.MinLength > 0 && Len < Plan.MinLength)
     {
-        UE_LOG(LogReasoningEngine, Warning, TEXT("Normalized text too short: %d < %d"), Result.Len(), Config.MinLength);
-        return TEXT("");
+        UE_LOG(LogReasoningEngine, Warning, TEXT("Normalized text too short: %d < %d"), Len, Plan.MinLength);
+        return INDEX_NONE;
     }
     
-    if (Config.MaxLength > 0 && Result.Len() > Config.MaxLength)
+    if (Plan.MaxLength > 0 && Len > Plan.MaxLength)
     {
-        Result = Result.Left(Config.MaxLength);
+        return Plan.MaxLength;
     }
     
-    return Result;
+    return Len;
 }
 
 // ========== SPECIFIC NORMALIZATIONS ==========
 
 FString RENormalizer::ToLowercase(const FString& Text)
 {
-    return Text.ToLower();
+    // ASCII blocks are lowercased with SIMD, others via FChar::ToLower
+    return TransformToString(Text, [](const TCHAR* Src, TCHAR* Dst, int32 Len)
+    {
+        RETextSimd::ToLower(Src, Dst, Len);
+        return Len;
+    });
 }
 
 FString RENormalizer::ToUppercase(const FString& Text)
@@ -118,18 +432,7 @@ FString RENormalizer::TrimWhitespace(const FString& Text)
 
 FString RENormalizer::RemovePunctuation(const FString& Text)
 {
-    FString Result;
-    Result.Reserve(Text.Len());
-    
-    for (TCHAR Char : Text)
-    {
-        if (!FChar::IsPunctuation(Char))
-        {
-            Result.AppendChar(Char);
-        }
-    }
-    
-    return Result;
+    return TransformToString(Text, &RETextSimd::RemovePunctuation);
 }
 
 FString RENormalizer::RemoveAccents(const FString& Text)
@@ -137,34 +440,9 @@ FString RENormalizer::RemoveAccents(const FString& Text)
     FString Result;
     Result.Reserve(Text.Len());
     
-    // Common accent replacements
-    static const TMap<TCHAR, TCHAR> AccentMap = {
-        {TEXT('à'), TEXT('a')}, {TEXT('á'), TEXT('a')}, {TEXT('â'), TEXT('a')}, {TEXT('ã'), TEXT('a')}, {TEXT('ä'), TEXT('a')}, {TEXT('å'), TEXT('a')},
-        {TEXT('è'), TEXT('e')}, {TEXT('é'), TEXT('e')}, {TEXT('ê'), TEXT('e')}, {TEXT('ë'), TEXT('e')},
-        {TEXT('ì'), TEXT('i')}, {TEXT('í'), TEXT('i')}, {TEXT('î'), TEXT('i')}, {TEXT('ï'), TEXT('i')},
-        {TEXT('ò'), TEXT('o')}, {TEXT('ó'), TEXT('o')}, {TEXT('ô'), TEXT('o')}, {TEXT('õ'), TEXT('o')}, {TEXT('ö'), TEXT('o')}, {TEXT('ø'), TEXT('o')},
-        {TEXT('ù'), TEXT('u')}, {TEXT('ú'), TEXT('u')}, {TEXT('û'), TEXT('u')}, {TEXT('ü'), TEXT('u')},
-        {TEXT('ý'), TEXT('y')}, {TEXT('ÿ'), TEXT('y')},
-        {TEXT('ñ'), TEXT('n')}, {TEXT('ç'), TEXT('c')},
-        // Uppercase
-        {TEXT('À'), TEXT('A')}, {TEXT('Á'), TEXT('A')}, {TEXT('Â'), TEXT('A')}, {TEXT('Ã'), TEXT('A')}, {TEXT('Ä'), TEXT('A')}, {TEXT('Å'), TEXT('A')},
-        {TEXT('È'), TEXT('E')}, {TEXT('É'), TEXT('E')}, {TEXT('Ê'), TEXT('E')}, {TEXT('Ë'), TEXT('E')},
-        {TEXT('Ì'), TEXT('I')}, {TEXT('Í'), TEXT('I')}, {TEXT('Î'), TEXT('I')}, {TEXT('Ï'), TEXT('I')},
-        {TEXT('Ò'), TEXT('O')}, {TEXT('Ó'), TEXT('O')}, {TEXT('Ô'), TEXT('O')}, {TEXT('Õ'), TEXT('O')}, {TEXT('Ö'), TEXT('O')}, {TEXT('Ø'), TEXT('O')},
-        {TEXT('Ù'), TEXT('U')}, {TEXT('Ú'), TEXT('U')}, {TEXT('Û'), TEXT('U')}, {TEXT('Ü'), TEXT('U')},
-        {TEXT('Ý'), TEXT('Y')}, {TEXT('Ñ'), TEXT('N')}, {TEXT('Ç'), TEXT('C')}
-    };
-    
     for (TCHAR Char : Text)
     {
-        if (const TCHAR* Replacement = AccentMap.Find(Char))
-        {
-            Result.AppendChar(*Replacement);
-        }
-        else
-        {
-            Result.AppendChar(Char);
-        }
+        Result.AppendChar(REUnicode::StripAccent(Char));
     }
     
     return Result;
@@ -172,29 +450,7 @@ FString RENormalizer::RemoveAccents(const FString& Text)
 
 FString RENormalizer::CollapseWhitespace(const FString& Text)
 {
-    FString Result;
-    Result.Reserve(Text.Len());
-    
-    bool bInWhitespace = false;
-    
-    for (TCHAR Char : Text)
-    {
-        if (FChar::IsWhitespace(Char))
-        {
-            if (!bInWhitespace)
-            {
-                Result.AppendChar(TEXT(' '));
-                bInWhitespace = true;
-            }
-        }
-        else
-        {
-            Result.AppendChar(Char);
-            bInWhitespace = false;
-        }
-    }
-    
-    return Result;
+    return TransformToString(Text, &RETextSimd::CollapseWhitespace);
 }
 
 FString RENormalizer::RemoveNumbers(const FString& Text)
@@ -306,12 +562,18 @@ bool RENormalizer::ContainsWhitespace(const FString& Text)
 
 FString RENormalizer::NormalizeUnicode(const FString& Text, EREUnicodeNormalizationForm Form)
 {
-    // Note: Unreal doesn't have built-in Unicode normalization
-    // This would require ICU or similar library for full implementation
-    // For now, return the text unchanged
-    
-    UE_LOG(LogReasoningEngine, Verbose, TEXT("Unicode normalization not fully implemented, returning original text"));
-    return Text;
+    // Generated tables (Tools/GenerateUnicodeTables.py), quick-check skips normalized text
+    return REUnicode::Normalize(Text, Form);
+}
+
+bool RENormalizer::IsUnicodeNormalized(const FString& Text, EREUnicodeNormalizationForm Form)
+{
+    return REUnicode::IsNormalized(Text, Form);
+}
+
+FString RENormalizer::CaseFold(const FString& Text)
+{
+    return REUnicode::CaseFold(Text);
 }
 
 FString RENormalizer::ToAscii(const FString& Text, const FString& ReplacementChar)
@@ -480,10 +742,48 @@ bool RENormalizer::IsConsonant(TCHAR Char)
 
 FString RENormalizer::GetComparisonForm(const FString& Text)
 {
-    // Aggressive normalization for comparison
-    FRENormalizationConfig Config;
-    Config.Modes = static_cast<uint8>(ERENormalizationMode::Full);
-    Config.bConvertToAscii = true;
-    
-    return NormalizeTextWithConfig(Text, Config);
+    // Reuse an interned form when there is one; misses are not interned so
+    // one-off comparisons do not grow the shared table
+    const FRENormalizedFormTable& Table = GetComparisonFormTable();
+    const FRENormalizedHandle Handle = Table.Find(Text);
+    if (Handle.IsValid())
+    {
+        return Table.Resolve(Handle);
+    }
+    return NormalizeTextWithPlan(Text, Table.GetPlan());
+}
+
+// ========== INTERNED FORMS ==========
+
+namespace
+{
+    FRENormalizationConfig MakeComparisonConfig()
+    {
+        FRENormalizationConfig Config;
+        Config.Modes = static_cast<uint8>(ERENormalizationMode::Full);
+        Config.bConvertToAscii = true;
+        return Config;
+    }
+}
+
+FRENormalizedFormTable& RENormalizer::GetComparisonFormTable()
+{
+    static FRENormalizedFormTable Table(CompilePlan(MakeComparisonConfig()));
+    return Table;
+}
+
+FRENormalizedFormTable& RENormalizer::GetNormalizedFormTable()
+{
+    static FRENormalizedFormTable Table(CompilePlan(FRENormalizationConfig()));
+    return Table;
+}
+
+FRENormalizedHandle RENormalizer::InternComparisonForm(const FString& Text)
+{
+    return GetComparisonFormTable().Intern(Text);
+}
+
+FRENormalizedHandle RENormalizer::InternNormalizedForm(const FString& Text)
+{
+    return GetNormalizedFormTable().Intern(Text);
 }
\ No newline at end of file
@@ -0,0 +1,167 @@
+// Source/ReasoningEngine/Private/Infrastructure/REPackedTokenStream.cpp
+#include "Infrastructure/REPackedTokenStream.h"
+#include "Infrastructure/RETokenDictionary.h"
+
+const FString& FREPackedTokenStream::GetNormalizedText(int32 Index) const
+{
+    // Tokens packed after the dictionary filled up have no id
+    static const FString NoText;
+    return Ids[Index] != FRETokenDictionary::InvalidId ? FRETokenDictionary::Get().Resolve(Ids[Index]) : NoText;
+}
+
+int32 FREPackedTokenStream::Add(const FREToken& Token)
+{
+    const int32 Index = Ids.Num();
+    
+    Offsets.Add(Chars.Num());
+    Lengths.Add(Token.Text.Len());
+    Chars.Append(*Token.Text, Token.Text.Len());
+    StartIndices.Add(Token.StartIndex);
+    EndIndices.Add(Token.EndIndex);
+    Types.Add(Token.Type);
+    Weights.Add(Token.Weight);
+    Ids.Add(Token.HasTokenId() ? Token.TokenId : FRETokenDictionary::Get().Intern(Token.NormalizedText));
+    
+    if (Token.LineNumber != 0 || Token.ColumnNumber != 0 || LineNumbers.Num() > 0)
+    {
+        LineNumbers.SetNumZeroed(Index + 1);
+        ColumnNumbers.SetNumZeroed(Index + 1);
+        LineNumbers[Index] = Token.LineNumber;
+        ColumnNumbers[Index] = Token.ColumnNumber;
+    }
+    if (Token.Confidence != 1.0f)
+    {
+        Confidences.Add(Index, Token.Confidence);
+    }
+    if (Token.Variants.Num() > 0)
+    {
+        Variants.Add(Index, Token.Variants);
+    }
+    if (Token.Metadata.Num() > 0)
+    {
+        Metadata.Add(Index, Token.Metadata);
+    }
+    
+    return Index;
+}
+
+FREToken FREPackedTokenStream::GetToken(int32 Index) const
+{
+    FREToken Token;
+    Token.Text = FString(GetText(Index));
+    Token.NormalizedText = GetNormalizedText(Index);
+    Token.Type = Types[Index];
+    Token.StartIndex = StartIndices[Index];
+    Token.EndIndex = EndIndices[Index];
+    Token.Weight = Weights[Index];
+    Token.TokenId = Ids[Index];
+    
+    if (LineNumbers.IsValidIndex(Index))
+    {
+        Token.LineNumber = LineNumbers[Index];
+        Token.ColumnNumber = ColumnNumbers[Index];
+    }
+    if (const float* Confidence = Confidences.Find(Index))
+    {
+        Token.Confidence = *Confidence;
+    }
+    if (const TArray<FString>* TokenVariants = Variants.Find(Index))
+    {
+        Token.Variants = *TokenVariants;
+    }
+    if (const TMap<FString, FString>* TokenMetadata = Metadata.Find(Index))
+    {
+        Token.Metadata = *TokenMetadata;
+    }
+    
+    return Token;
+}
+
+void FREPackedTokenStream::Reserve(int32 NumTokens, int32 NumChars)
+{
+    Offsets.Reserve(NumTokens);
+    Lengths.Reserve(NumTokens);
+    StartIndices.Reserve(NumTokens);
+    EndIndices.Reserve(NumTokens);
+    Types.Reserve(NumTokens);
+    Weights.Reserve(NumTokens);
+    Ids.Reserve(NumTokens);
+    Chars.Reserve(NumChars);
+}
+
+void FREPackedTokenStream::Reset()
+{
+    Offsets.Reset();
+    Lengths.Reset();
+    StartIndices.Reset();
+    EndIndices.Reset();
+    Types.Reset();
+    Weights.Reset();
+    Ids.Reset();
+    Chars.Reset();
+    LineNumbers.Reset();
+    ColumnNumbers.Reset();
+    Confidences.Reset();
+    Variants.Reset();
+    Metadata.Reset();
+    OriginalText.Reset();
+    StreamMetadata.Reset();
+    DetectedConvention = ERENamingConvention::Unknown;
+}
+
+SIZE_T FREPackedTokenStream::GetAllocatedSize() const
+{
+    SIZE_T Size = Offsets.GetAllocatedSize() + Lengths.GetAllocatedSize()
+        + StartIndices.GetAllocatedSize() + EndIndices.GetAllocatedSize()
+        + Types.GetAllocatedSize() + Weights.GetAllocatedSize() + Ids.GetAllocatedSize()
+        + Chars.GetAllocatedSize() + LineNumbers.GetAllocatedSize() + ColumnNumbers.GetAllocatedSize()
+        + Confidences.GetAllocatedSize() + Variants.GetAllocatedSize() + Metadata.GetAllocatedSize()
+        + OriginalText.GetAllocatedSize() + StreamMetadata.GetAllocatedSize();
+    
+    for (const TPair<int32, TArray<FString>>& Entry : Variants)
+    {
+        Size += Entry.Value.GetAllocatedSize();
+    }
+    for (const TPair<int32, TMap<FString, FString>>& Entry : Metadata)
+    {
+        Size += Entry.Value.GetAllocatedSize();
+    }
+    return Size;
+}
+
+FREPackedTokenStream FREPackedTokenStream::FromStream(const FRETokenStream& Stream)
+{
+    FREPackedTokenStream Packed;
+    
+    int32 NumChars = 0;
+    for (const FREToken& Token : Stream.Tokens)
+    {
+        NumChars += Token.Text.Len();
+    }
+    Packed.Reserve(Stream.Tokens.Num(), NumChars);
+    
+    for (const FREToken& Token : Stream.Tokens)
+    {
+        Packed.Add(Token);
+    }
+    
+    Packed.OriginalText = Stream.OriginalText;
+    Packed.DetectedConvention = Stream.DetectedConvention;
+    Packed.StreamMetadata = Stream.Metadata;
+    return Packed;
+}
+
+FRETokenStream FREPackedTokenStream::ToStream() const
+{
+    FRETokenStream Stream;
+    Stream.Tokens.Reserve(Num());
+    for (int32 Index = 0; Index < Num(); Index++)
+    {
+        Stream.Tokens.Add(GetToken(Index));
+    }
+    
+    Stream.OriginalText = OriginalText;
+    Stream.DetectedConvention = DetectedConvention;
+    Stream.Metadata = StreamMetadata;
+    return Stream;
+}
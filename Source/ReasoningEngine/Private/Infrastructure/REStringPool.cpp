@@ -0,0 +1,158 @@
+// Source/ReasoningEngine/Private/Infrastructure/REStringPool.cpp
+#include "Infrastructure/REStringPool.h"
+#include "ReasoningEngine.h"
+
+FREStringPool::FREStringPool()
+    : NextId(0)
+    , PublishedId(0)
+{
+    for (std::atomic<FString*>& Chunk : Chunks)
+    {
+        Chunk.store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+FREStringPool::~FREStringPool()
+{
+    Reset();
+}
+
+uint32 FREStringPool::Intern(FStringView Text)
+{
+    return InternByHash(HashString(Text), Text);
+}
+
+uint32 FREStringPool::InternByHash(uint32 Hash, FStringView Text)
+{
+    FShard& Shard = Shards[Hash % NumShards];
+    
+    // Fast path - already interned
+    {
+        FReadScopeLock ReadLock(Shard.Lock);
+        if (const uint32* Found = Shard.Map.FindByHash(Hash, Text))
+        {
+            return *Found;
+        }
+    }
+    
+    uint32 Id;
+    {
+        FWriteScopeLock WriteLock(Shard.Lock);
+        
+        // Another thread may have added it between the locks
+        if (const uint32* Found = Shard.Map.FindByHash(Hash, Text))
+        {
+            return *Found;
+        }
+        
+        // Never hand out an id past the chunk table, so every id gets a slot
+        Id = NextId.load(std::memory_order_relaxed);
+        do
+        {
+            if (Id >= MaxChunks * ChunkSize)
+            {
+                // Report once rather than for every string that no longer fits
+                static std::atomic<bool> bReported(false);
+                if (!bReported.exchange(true, std::memory_order_relaxed))
+                {
+                    UE_LOG(LogReasoningEngine, Warning, TEXT("FREStringPool: all %u ids are in use; further strings are not interned"),
+                           MaxChunks * ChunkSize);
+                }
+                return InvalidId;
+            }
+        }
+        while (!NextId.compare_exchange_weak(Id, Id + 1, std::memory_order_acq_rel, std::memory_order_relaxed));
+        
+        FString& Slot = AllocateSlot(Id);
+        Slot = FString(Text);
+        
+        Shard.Map.AddByHash(Hash, FStringView(Slot), Id);
+    }
+    
+    // Publish in id order, outside the shard lock, so a writer waiting on
+    // an earlier id never blocks lookups
+    while (PublishedId.load(std::memory_order_acquire) != Id)
+    {
+        FPlatformProcess::Yield();
+    }
+    PublishedId.store(Id + 1, std::memory_order_release);
+    return Id;
+}
+
+uint32 FREStringPool::Find(FStringView Text) const
+{
+    const uint32 Hash = HashString(Text);
+    const FShard& Shard = Shards[Hash % NumShards];
+    
+    FReadScopeLock ReadLock(Shard.Lock);
+    const uint32* Found = Shard.Map.FindByHash(Hash, Text);
+    return Found ? *Found : InvalidId;
+}
+
+void FREStringPool::Reset()
+{
+    for (FShard& Shard : Shards)
+    {
+        FWriteScopeLock WriteLock(Shard.Lock);
+        Shard.Map.Empty();
+    }
+    
+    FScopeLock Lock(&ChunkMutex);
+    for (std::atomic<FString*>& Chunk : Chunks)
+    {
+        delete[] Chunk.exchange(nullptr, std::memory_order_acq_rel);
+    }
+    NextId.store(0, std::memory_order_release);
+    PublishedId.store(0, std::memory_order_release);
+}
+
+SIZE_T FREStringPool::GetAllocatedSize() const
+{
+    SIZE_T Size = 0;
+    
+    for (const FShard& Shard : Shards)
+    {
+        FReadScopeLock ReadLock(Shard.Lock);
+        Size += Shard.Map.GetAllocatedSize();
+    }
+    
+    const uint32 Count = PublishedId.load(std::memory_order_acquire);
+    for (uint32 ChunkIndex = 0; ChunkIndex < MaxChunks; ++ChunkIndex)
+    {
+        const FString* Chunk = Chunks[ChunkIndex].load(std::memory_order_acquire);
+        if (!Chunk)
+        {
+            break;
+        }
+        
+        Size += ChunkSize * sizeof(FString);
+        const uint32 First = ChunkIndex << ChunkBits;
+        const uint32 Last = FMath::Min(First + ChunkSize, Count);
+        for (uint32 Id = First; Id < Last; ++Id)
+        {
+            Size += Chunk[Id - First].GetAllocatedSize();
+        }
+    }
+    
+    return Size;
+}
+
+FString& FREStringPool::AllocateSlot(uint32 Id)
+{
+    const uint32 ChunkIndex = Id >> ChunkBits;
+    checkSlow(ChunkIndex < MaxChunks);
+    
+    FString* Chunk = Chunks[ChunkIndex].load(std::memory_order_acquire);
+    if (!Chunk)
+    {
+        FScopeLock Lock(&ChunkMutex);
+        Chunk = Chunks[ChunkIndex].load(std::memory_order_relaxed);
+        if (!Chunk)
+        {
+            Chunk = new FString[ChunkSize];
+            Chunks[ChunkIndex].store(Chunk, std::memory_order_release);
+        }
+    }
+    
+    return Chunk[Id & ChunkMask];
+}
@@ -0,0 +1,520 @@
+// Source/ReasoningEngine/Private/Infrastructure/RETextSimd.h
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Vectorized ASCII kernels shared by RENormalizer and RETokenizer
+ * Internal to the module - not part of the public API
+ *
+ * Design Philosophy:
+ * - Blocks that are entirely ASCII are handled with SIMD compares
+ * - Any block containing a non-ASCII code unit falls back to the
+ *   scalar FChar path, so results are identical to the scalar code
+ * - Only enabled for 16-bit TCHAR; other encodings use the scalar path
+ *
+ * Lane widths (UTF-16 code units per instruction):
+ * - AVX2: 16, SSE2/SSSE3: 8, NEON: 8
+ */
+
+#if PLATFORM_ENABLE_VECTORINTRINSICS_NEON
+    #include <arm_neon.h>
+    #define RE_TEXT_SIMD_NEON 1
+#elif PLATFORM_ENABLE_VECTORINTRINSICS
+    #include <emmintrin.h>
+    #if defined(PLATFORM_ALWAYS_HAS_AVX_2) && PLATFORM_ALWAYS_HAS_AVX_2
+        #include <immintrin.h>
+        #define RE_TEXT_SIMD_AVX2 1
+    #else
+        #define RE_TEXT_SIMD_SSE2 1
+        #if defined(PLATFORM_ALWAYS_HAS_SSE4_1) && PLATFORM_ALWAYS_HAS_SSE4_1
+            #include <tmmintrin.h>
+            #define RE_TEXT_SIMD_SSSE3 1
+        #endif
+    #endif
+#endif
+
+#ifndef RE_TEXT_SIMD_NEON
+    #define RE_TEXT_SIMD_NEON 0
+#endif
+#ifndef RE_TEXT_SIMD_AVX2
+    #define RE_TEXT_SIMD_AVX2 0
+#endif
+#ifndef RE_TEXT_SIMD_SSE2
+    #define RE_TEXT_SIMD_SSE2 0
+#endif
+#ifndef RE_TEXT_SIMD_SSSE3
+    #define RE_TEXT_SIMD_SSSE3 0
+#endif
+
+#define RE_TEXT_SIMD (RE_TEXT_SIMD_NEON || RE_TEXT_SIMD_AVX2 || RE_TEXT_SIMD_SSE2)
+
+namespace RETextSimd
+{
+    // ========== ASCII CLASSIFICATION ==========
+
+    /** Per-character class bits for code units below 128 */
+    enum EAsciiClass : uint8
+    {
+        Ascii_Whitespace  = 0x01,
+        Ascii_Punctuation = 0x02,
+        Ascii_Digit       = 0x04,
+        Ascii_Upper       = 0x08,
+        Ascii_Lower       = 0x10
+    };
+
+    /** Matches FChar::IsWhitespace / IsPunctuation / IsDigit / IsUpper / IsLower for ASCII */
+    constexpr uint8 ClassifyAscii(uint32 C)
+    {
+        return static_cast<uint8>(((C == ' ' || (C >= 0x09 && C <= 0x0D)) ? Ascii_Whitespace : 0)
+             | (((C >= 0x21 && C <= 0x2F) || (C >= 0x3A && C <= 0x40) || (C >= 0x5B && C <= 0x60) || (C >= 0x7B && C <= 0x7E)) ? Ascii_Punctuation : 0)
+             | ((C >= '0' && C <= '9') ? Ascii_Digit : 0)
+             | ((C >= 'A' && C <= 'Z') ? Ascii_Upper : 0)
+             | ((C >= 'a' && C <= 'z') ? Ascii_Lower : 0));
+    }
+
+    struct FAsciiClassTable
+    {
+        uint8 Flags[128];
+
+        constexpr FAsciiClassTable() : Flags{}
+        {
+            for (uint32 C = 0; C < 128; ++C)
+            {
+                Flags[C] = ClassifyAscii(C);
+            }
+        }
+    };
+
+    inline constexpr FAsciiClassTable AsciiClassTable;
+
+    FORCEINLINE bool IsAsciiChar(TCHAR Char)
+    {
+        return static_cast<uint32>(Char) < 128u;
+    }
+
+    FORCEINLINE bool HasAsciiClass(TCHAR Char, uint8 ClassMask)
+    {
+        return (AsciiClassTable.Flags[static_cast<uint32>(Char)] & ClassMask) != 0;
+    }
+
+    /** Scalar classification - ASCII via table, everything else via FChar */
+    FORCEINLINE bool IsWhitespace(TCHAR Char)
+    {
+        return IsAsciiChar(Char) ? HasAsciiClass(Char, Ascii_Whitespace) : FChar::IsWhitespace(Char);
+    }
+
+    FORCEINLINE bool IsPunctuation(TCHAR Char)
+    {
+        return IsAsciiChar(Char) ? HasAsciiClass(Char, Ascii_Punctuation) : FChar::IsPunctuation(Char);
+    }
+
+    FORCEINLINE TCHAR ToLower(TCHAR Char)
+    {
+        return IsAsciiChar(Char) ? (HasAsciiClass(Char, Ascii_Upper) ? static_cast<TCHAR>(Char + 32) : Char) : FChar::ToLower(Char);
+    }
+
+    // ========== VECTOR BACKEND ==========
+
+#if RE_TEXT_SIMD
+
+    /**
+     * Thin wrapper over the platform vector type
+     * Compare results are lane masks (all ones / all zeros per 16-bit lane)
+     * Masks returned to callers carry MaskBitsPerLane bits per lane
+     */
+    struct FVec
+    {
+#if RE_TEXT_SIMD_AVX2
+        using FReg = __m256i;
+        static constexpr int32 Lanes = 16;
+        static constexpr int32 MaskBitsPerLane = 2;
+
+        static FORCEINLINE FReg Load(const TCHAR* Src) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Src)); }
+        static FORCEINLINE void Store(TCHAR* Dst, FReg V) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(Dst), V); }
+        static FORCEINLINE FReg Splat(uint16 C) { return _mm256_set1_epi16(static_cast<int16>(C)); }
+        static FORCEINLINE FReg And(FReg A, FReg B) { return _mm256_and_si256(A, B); }
+        static FORCEINLINE FReg Or(FReg A, FReg B) { return _mm256_or_si256(A, B); }
+        static FORCEINLINE FReg Equal(FReg A, FReg B) { return _mm256_cmpeq_epi16(A, B); }
+        static FORCEINLINE FReg Greater(FReg A, FReg B) { return _mm256_cmpgt_epi16(A, B); }
+        static FORCEINLINE uint64 ToMask(FReg Cmp) { return static_cast<uint32>(_mm256_movemask_epi8(Cmp)); }
+        static FORCEINLINE bool IsAscii(FReg V) { return _mm256_testz_si256(V, Splat(0xFF80)) != 0; }
+        static FORCEINLINE FReg AsciiLanes(FReg V) { return Equal(And(V, Splat(0xFF80)), Splat(0)); }
+
+        /** Set membership via nibble lookup - see FDelimiterSet */
+        static FORCEINLINE FReg Lookup(FReg V, const uint8* LowNibbleTable, const uint8* HighNibbleBits)
+        {
+            const __m128i LowTable = _mm_loadu_si128(reinterpret_cast<const __m128i*>(LowNibbleTable));
+            const __m128i HighTable = _mm_loadu_si128(reinterpret_cast<const __m128i*>(HighNibbleBits));
+            const FReg NibbleMask = _mm256_set1_epi8(0x0F);
+            const FReg Low = _mm256_and_si256(V, NibbleMask);
+            const FReg High = _mm256_and_si256(_mm256_srli_epi16(V, 4), NibbleMask);
+            const FReg Hit = _mm256_and_si256(
+                _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(LowTable), Low),
+                _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(HighTable), High));
+            // Only the low byte of each lane carries the character
+            return _mm256_andnot_si256(Equal(And(Hit, Splat(0x00FF)), Splat(0)), AsciiLanes(V));
+        }
+        static constexpr bool bHasLookup = true;
+#elif RE_TEXT_SIMD_SSE2
+        using FReg = __m128i;
+        static constexpr int32 Lanes = 8;
+        static constexpr int32 MaskBitsPerLane = 2;
+
+        static FORCEINLINE FReg Load(const TCHAR* Src) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(Src)); }
+        static FORCEINLINE void Store(TCHAR* Dst, FReg V) { _mm_storeu_si128(reinterpret_cast<__m128i*>(Dst), V); }
+        static FORCEINLINE FReg Splat(uint16 C) { return _mm_set1_epi16(static_cast<int16>(C)); }
+        static FORCEINLINE FReg And(FReg A, FReg B) { return _mm_and_si128(A, B); }
+        static FORCEINLINE FReg Or(FReg A, FReg B) { return _mm_or_si128(A, B); }
+        static FORCEINLINE FReg Equal(FReg A, FReg B) { return _mm_cmpeq_epi16(A, B); }
+        static FORCEINLINE FReg Greater(FReg A, FReg B) { return _mm_cmpgt_epi16(A, B); }
+        static FORCEINLINE uint64 ToMask(FReg Cmp) { return static_cast<uint32>(_mm_movemask_epi8(Cmp)); }
+        static FORCEINLINE FReg AsciiLanes(FReg V) { return Equal(And(V, Splat(0xFF80)), _mm_setzero_si128()); }
+        static FORCEINLINE bool IsAscii(FReg V) { return _mm_movemask_epi8(AsciiLanes(V)) == 0xFFFF; }
+
+#if RE_TEXT_SIMD_SSSE3
+        static FORCEINLINE FReg Lookup(FReg V, const uint8* LowNibbleTable, const uint8* HighNibbleBits)
+        {
+            const FReg NibbleMask = _mm_set1_epi8(0x0F);
+            const FReg Low = _mm_and_si128(V, NibbleMask);
+            const FReg High = _mm_and_si128(_mm_srli_epi16(V, 4), NibbleMask);
+            const FReg Hit = _mm_and_si128(
+                _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(LowNibbleTable)), Low),
+                _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(HighNibbleBits)), High));
+            return _mm_andnot_si128(Equal(And(Hit, Splat(0x00FF)), Splat(0)), AsciiLanes(V));
+        }
+        static constexpr bool bHasLookup = true;
+#else
+        static FORCEINLINE FReg Lookup(FReg V, const uint8*, const uint8*) { return _mm_setzero_si128(); }
+        static constexpr bool bHasLookup = false;
+#endif
+#elif RE_TEXT_SIMD_NEON
+        using FReg = uint16x8_t;
+        static constexpr int32 Lanes = 8;
+        static constexpr int32 MaskBitsPerLane = 8;
+
+        static FORCEINLINE FReg Load(const TCHAR* Src) { return vld1q_u16(reinterpret_cast<const uint16_t*>(Src)); }
+        static FORCEINLINE void Store(TCHAR* Dst, FReg V) { vst1q_u16(reinterpret_cast<uint16_t*>(Dst), V); }
+        static FORCEINLINE FReg Splat(uint16 C) { return vdupq_n_u16(C); }
+        static FORCEINLINE FReg And(FReg A, FReg B) { return vandq_u16(A, B); }
+        static FORCEINLINE FReg Or(FReg A, FReg B) { return vorrq_u16(A, B); }
+        static FORCEINLINE FReg Equal(FReg A, FReg B) { return vceqq_u16(A, B); }
+        static FORCEINLINE FReg Greater(FReg A, FReg B) { return vcgtq_u16(A, B); }
+        static FORCEINLINE uint64 ToMask(FReg Cmp) { return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(Cmp, 4)), 0); }
+        static FORCEINLINE bool IsAscii(FReg V) { return vmaxvq_u16(V) < 0x80; }
+        static FORCEINLINE FReg AsciiLanes(FReg V) { return vcltq_u16(V, Splat(0x80)); }
+
+        static FORCEINLINE FReg Lookup(FReg V, const uint8* LowNibbleTable, const uint8* HighNibbleBits)
+        {
+            const uint8x16_t Bytes = vreinterpretq_u8_u16(V);
+            const uint8x16_t Low = vandq_u8(Bytes, vdupq_n_u8(0x0F));
+            const uint8x16_t High = vshrq_n_u8(Bytes, 4);
+            const uint8x16_t Hit = vandq_u8(vqtbl1q_u8(vld1q_u8(LowNibbleTable), Low), vqtbl1q_u8(vld1q_u8(HighNibbleBits), High));
+            return vandq_u16(vtstq_u16(vreinterpretq_u16_u8(Hit), vdupq_n_u16(0x00FF)), AsciiLanes(V));
+        }
+        static constexpr bool bHasLookup = true;
+#endif
+
+        /** Lanes with Lo <= V <= Hi (signed compare is safe: callers only pass ASCII blocks) */
+        static FORCEINLINE FReg InRange(FReg V, uint16 Lo, uint16 Hi)
+        {
+            return And(Greater(V, Splat(Lo - 1)), Greater(Splat(Hi + 1), V));
+        }
+
+        static FORCEINLINE FReg ToLowerAscii(FReg V)
+        {
+            return Or(V, And(InRange(V, 'A', 'Z'), Splat(0x20)));
+        }
+
+        static FORCEINLINE uint64 WhitespaceMask(FReg V)
+        {
+            return ToMask(Or(Equal(V, Splat(' ')), InRange(V, 0x09, 0x0D)));
+        }
+
+        static FORCEINLINE uint64 PunctuationMask(FReg V)
+        {
+            return ToMask(Or(Or(InRange(V, 0x21, 0x2F), InRange(V, 0x3A, 0x40)),
+                             Or(InRange(V, 0x5B, 0x60), InRange(V, 0x7B, 0x7E))));
+        }
+
+        static FORCEINLINE int32 FirstLane(uint64 Mask)
+        {
+            return static_cast<int32>(FPlatformMath::CountTrailingZeros64(Mask)) / MaskBitsPerLane;
+        }
+    };
+
+    /** SIMD kernels are only valid when TCHAR is a UTF-16 code unit */
+    inline constexpr bool bVectorTChar = sizeof(TCHAR) == sizeof(uint16);
+
+#endif // RE_TEXT_SIMD
+
+    // ========== KERNELS ==========
+
+    /**
+     * Check whether every code unit is below 128
+     * @return true if Src[0..Len) is pure ASCII
+     */
+    inline bool IsAscii(const TCHAR* Src, int32 Len)
+    {
+        int32 Index = 0;
+#if RE_TEXT_SIMD
+        if constexpr (bVectorTChar)
+        {
+            for (; Index + FVec::Lanes <= Len; Index += FVec::Lanes)
+            {
+                if (!FVec::IsAscii(FVec::Load(Src + Index)))
+                {
+                    return false;
+                }
+            }
+        }
+#endif
+        for (; Index < Len; ++Index)
+        {
+            if (!IsAsciiChar(Src[Index]))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Lowercase Len code units from Src into Dst (may alias)
+     * Equivalent to FChar::ToLower per character
+     */
+    inline void ToLower(const TCHAR* Src, TCHAR* Dst, int32 Len)
+    {
+        int32 Index = 0;
+#if RE_TEXT_SIMD
+        if constexpr (bVectorTChar)
+        {
+            for (; Index + FVec::Lanes <= Len; Index += FVec::Lanes)
+            {
+                const FVec::FReg Block = FVec::Load(Src + Index);
+                if (FVec::IsAscii(Block))
+                {
+                    FVec::Store(Dst + Index, FVec::ToLowerAscii(Block));
+                }
+                else
+                {
+                    for (int32 Lane = 0; Lane < FVec::Lanes; ++Lane)
+                    {
+                        Dst[Index + Lane] = ToLower(Src[Index + Lane]);
+                    }
+                }
+            }
+        }
+#endif
+        for (; Index < Len; ++Index)
+        {
+            Dst[Index] = ToLower(Src[Index]);
+        }
+    }
+
+    /**
+     * Copy Src to Dst dropping punctuation
+     * Dst must hold at least Len code units and must not overlap Src ahead of the read position
+     * @return Number of code units written
+     */
+    inline int32 RemovePunctuation(const TCHAR* Src, TCHAR* Dst, int32 Len)
+    {
+        int32 Index = 0;
+        int32 Written = 0;
+#if RE_TEXT_SIMD
+        if constexpr (bVectorTChar)
+        {
+            for (; Index + FVec::Lanes <= Len; Index += FVec::Lanes)
+            {
+                const FVec::FReg Block = FVec::Load(Src + Index);
+                if (FVec::IsAscii(Block) && FVec::PunctuationMask(Block) == 0)
+                {
+                    FVec::Store(Dst + Written, Block);
+                    Written += FVec::Lanes;
+                    continue;
+                }
+
+                for (int32 Lane = 0; Lane < FVec::Lanes; ++Lane)
+                {
+                    const TCHAR Char = Src[Index + Lane];
+                    if (!IsPunctuation(Char))
+                    {
+                        Dst[Written++] = Char;
+                    }
+                }
+            }
+        }
+#endif
+        for (; Index < Len; ++Index)
+        {
+            const TCHAR Char = Src[Index];
+            if (!IsPunctuation(Char))
+            {
+                Dst[Written++] = Char;
+            }
+        }
+        return Written;
+    }
+
+    /**
+     * Copy Src to Dst replacing each whitespace run with a single space
+     * @return Number of code units written
+     */
+    inline int32 CollapseWhitespace(const TCHAR* Src, TCHAR* Dst, int32 Len)
+    {
+        int32 Index = 0;
+        int32 Written = 0;
+        bool bInWhitespace = false;
+#if RE_TEXT_SIMD
+        if constexpr (bVectorTChar)
+        {
+            for (; Index + FVec::Lanes <= Len; Index += FVec::Lanes)
+            {
+                const FVec::FReg Block = FVec::Load(Src + Index);
+                if (FVec::IsAscii(Block) && FVec::WhitespaceMask(Block) == 0)
+                {
+                    FVec::Store(Dst + Written, Block);
+                    Written += FVec::Lanes;
+                    bInWhitespace = false;
+                    continue;
+                }
+
+                for (int32 Lane = 0; Lane < FVec::Lanes; ++Lane)
+                {
+                    const TCHAR Char = Src[Index + Lane];
+                    if (IsWhitespace(Char))
+                    {
+                        if (!bInWhitespace)
+                        {
+                            Dst[Written++] = TEXT(' ');
+                            bInWhitespace = true;
+                        }
+                    }
+                    else
+                    {
+                        Dst[Written++] = Char;
+                        bInWhitespace = false;
+                    }
+                }
+            }
+        }
+#endif
+        for (; Index < Len; ++Index)
+        {
+            const TCHAR Char = Src[Index];
+            if (IsWhitespace(Char))
+            {
+                if (!bInWhitespace)
+                {
+                    Dst[Written++] = TEXT(' ');
+                    bInWhitespace = true;
+                }
+            }
+            else
+            {
+                Dst[Written++] = Char;
+                bInWhitespace = false;
+            }
+        }
+        return Written;
+    }
+
+    // ========== DELIMITER SCANNING ==========
+
+    /**
+     * Precompiled delimiter set for boundary detection
+     * ASCII members are encoded as a nibble lookup (low nibble -> bitmask of
+     * high nibbles) so a block can be classified with two table shuffles.
+     * Non-ASCII members are checked with a linear scan (rare in practice).
+     */
+    struct FDelimiterSet
+    {
+        /** For low nibble L, bit H is set if (H << 4 | L) is a delimiter */
+        alignas(16) uint8 LowNibbleTable[16] = {};
+
+        /** Bit H for high nibbles 0-7, zero for 8-15 so non-ASCII never matches */
+        alignas(16) uint8 HighNibbleBits[16] = { 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80 };
+
+        /** Scalar ASCII membership */
+        uint64 AsciiBits[2] = { 0, 0 };
+
+        /** Delimiters outside the ASCII range */
+        TArray<TCHAR, TInlineAllocator<4>> WideDelimiters;
+
+        explicit FDelimiterSet(const FString& Delimiters)
+        {
+            for (TCHAR Char : Delimiters)
+            {
+                const uint32 Code = static_cast<uint32>(Char);
+                if (Code == 0)
+                {
+                    continue;
+                }
+                if (Code < 128u)
+                {
+                    AsciiBits[Code >> 6] |= 1ull << (Code & 63);
+                    LowNibbleTable[Code & 0x0F] |= static_cast<uint8>(1u << (Code >> 4));
+                }
+                else
+                {
+                    WideDelimiters.AddUnique(Char);
+                }
+            }
+        }
+
+        FORCEINLINE bool Contains(TCHAR Char) const
+        {
+            const uint32 Code = static_cast<uint32>(Char);
+            if (Code < 128u)
+            {
+                return (AsciiBits[Code >> 6] & (1ull << (Code & 63))) != 0;
+            }
+            return WideDelimiters.Contains(Char);
+        }
+    };
+
+    /**
+     * Find the next delimiter at or after Start
+     * @return Index of the delimiter, or Len if none
+     */
+    inline int32 FindDelimiter(const TCHAR* Src, int32 Start, int32 Len, const FDelimiterSet& Set)
+    {
+        int32 Index = Start;
+#if RE_TEXT_SIMD
+        if constexpr (bVectorTChar && FVec::bHasLookup)
+        {
+            for (; Index + FVec::Lanes <= Len; Index += FVec::Lanes)
+            {
+                const FVec::FReg Block = FVec::Load(Src + Index);
+                if (FVec::IsAscii(Block) || Set.WideDelimiters.Num() == 0)
+                {
+                    // Non-ASCII lanes are masked out of the lookup, so this is
+                    // exact whenever the set has no wide members
+                    const uint64 Mask = FVec::ToMask(FVec::Lookup(Block, Set.LowNibbleTable, Set.HighNibbleBits));
+                    if (Mask != 0)
+                    {
+                        return Index + FVec::FirstLane(Mask);
+                    }
+                    continue;
+                }
+
+                for (int32 Lane = 0; Lane < FVec::Lanes; ++Lane)
+                {
+                    if (Set.Contains(Src[Index + Lane]))
+                    {
+                        return Index + Lane;
+                    }
+                }
+            }
+        }
+#endif
+        for (; Index < Len; ++Index)
+        {
+            if (Set.Contains(Src[Index]))
+            {
+                return Index;
+            }
+        }
+        return Len;
+    }
+}
@@ -0,0 +1,41 @@
+// Source/ReasoningEngine/Private/Infrastructure/RETokenDictionary.cpp
+#include "Infrastructure/RETokenDictionary.h"
+#include "Infrastructure/RENormalizer.h"
+
+FRETokenDictionary& FRETokenDictionary::Get()
+{
+    // Never reset - ids stored in tokens and side tables must stay valid
+    static FRETokenDictionary Dictionary;
+    return Dictionary;
+}
+
+void FRETokenDictionary::InternWords(const TArray<FString>& Words, TArray<uint32>& OutIds)
+{
+    OutIds.Reset(Words.Num());
+    for (const FString& Word : Words)
+    {
+        OutIds.Add(Intern(RENormalizer::ToLowercase(Word)));
+    }
+}
+
+TBitArray<> FRETokenDictionary::MakeMask(const TSet<FString>& Words)
+{
+    TArray<uint32> Ids;
+    InternWords(Words.Array(), Ids);
+    
+    // Words the full dictionary could not take stay out of the mask
+    Ids.Remove(InvalidId);
+    
+    uint32 MaxId = 0;
+    for (uint32 Id : Ids)
+    {
+        MaxId = FMath::Max(MaxId, Id);
+    }
+    
+    TBitArray<> Mask(false, Ids.Num() > 0 ? static_cast<int32>(MaxId) + 1 : 0);
+    for (uint32 Id : Ids)
+    {
+        Mask[Id] = true;
+    }
+    return Mask;
+}
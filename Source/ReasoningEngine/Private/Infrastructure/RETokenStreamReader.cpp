@@ -0,0 +1,304 @@
+// Source/ReasoningEngine/Private/Infrastructure/RETokenStreamReader.cpp
+#include "Infrastructure/RETokenStreamReader.h"
+#include "Infrastructure/RETokenizer.h"
+#include "Serialization/Archive.h"
+#include "RETextSimd.h"
+
+namespace
+{
+    constexpr TCHAR ReplacementChar = 0xFFFD;
+    
+    /** Length of a UTF-8 sequence from its lead byte (0 = invalid lead) */
+    FORCEINLINE int32 Utf8SequenceLength(uint8 Lead)
+    {
+        if (Lead < 0x80) return 1;
+        if (Lead < 0xC2) return 0;
+        if (Lead < 0xE0) return 2;
+        if (Lead < 0xF0) return 3;
+        if (Lead < 0xF5) return 4;
+        return 0;
+    }
+    
+    /**
+     * Decode UTF-8 into UTF-16, stopping before an incomplete trailing sequence
+     * Invalid bytes become U+FFFD
+     * @return Number of bytes consumed
+     */
+    int32 DecodeUtf8(const uint8* Src, int32 Num, bool bFinal, TArray<TCHAR>& Out)
+    {
+        int32 Index = 0;
+        while (Index < Num)
+        {
+            // ASCII run
+            const uint8 Lead = Src[Index];
+            if (Lead < 0x80)
+            {
+                Out.Add(static_cast<TCHAR>(Lead));
+                ++Index;
+                continue;
+            }
+            
+            const int32 SeqLen = Utf8SequenceLength(Lead);
+            if (SeqLen == 0)
+            {
+                Out.Add(ReplacementChar);
+                ++Index;
+                continue;
+            }
+            
+            if (Index + SeqLen > Num && !bFinal)
+            {
+                // Validate what we have; if still plausible, wait for more bytes
+                bool bPlausible = true;
+                for (int32 Cont = Index + 1; Cont < Num; ++Cont)
+                {
+                    bPlausible &= (Src[Cont] & 0xC0) == 0x80;
+                }
+                if (bPlausible)
+                {
+                    break;
+                }
+            }
+            
+            uint32 Code = Lead & (0xFF >> (SeqLen + 1));
+            int32 Consumed = 1;
+            for (; Consumed < SeqLen && Index + Consumed < Num; ++Consumed)
+            {
+                const uint8 Cont = Src[Index + Consumed];
+                if ((Cont & 0xC0) != 0x80)
+                {
+                    break;
+                }
+                Code = (Code << 6) | (Cont & 0x3F);
+            }
+            
+            const bool bOverlong = (SeqLen == 3 && Code < 0x800) || (SeqLen == 4 && Code < 0x10000);
+            if (Consumed < SeqLen || bOverlong || Code > 0x10FFFF || (Code >= 0xD800 && Code < 0xE000))
+            {
+                Out.Add(ReplacementChar);
+                Index += FMath::Max(1, Consumed);
+                continue;
+            }
+            
+            if (Code >= 0x10000)
+            {
+                Code -= 0x10000;
+                Out.Add(static_cast<TCHAR>(0xD800 + (Code >> 10)));
+                Out.Add(static_cast<TCHAR>(0xDC00 + (Code & 0x3FF)));
+            }
+            else
+            {
+                Out.Add(static_cast<TCHAR>(Code));
+            }
+            Index += SeqLen;
+        }
+        
+        return Index;
+    }
+}
+
+FRETokenStreamReader::FRETokenStreamReader(FArchive& InArchive, const FRETokenizerConfig& InConfig, int32 InChunkBytes)
+    : Archive(InArchive)
+    , Config(InConfig)
+    , Delimiters(MakeUnique<RETextSimd::FDelimiterSet>(InConfig.Delimiters + TEXT("\r\n\t")))
+    , ChunkBytes(FMath::Max(InChunkBytes, 16))
+    , MaxPendingChars(FMath::Max(InChunkBytes, 16))
+{
+    check(Archive.IsLoading());
+}
+
+FRETokenStreamReader::~FRETokenStreamReader() = default;
+
+bool FRETokenStreamReader::Next(FREToken& OutToken)
+{
+    while (true)
+    {
+        if (ReadyIndex < Ready.Num())
+        {
+            OutToken = MoveTemp(Ready[ReadyIndex++]);
+            return true;
+        }
+        Ready.Reset();
+        ReadyIndex = 0;
+        
+        // Complete words are those followed by a delimiter
+        const int32 Boundary = RETextSimd::FindDelimiter(Buffer.GetData(), ScanPos, Buffer.Num(), *Delimiters);
+        if (Boundary < Buffer.Num())
+        {
+            EmitRawToken(ScanPos, Boundary);
+            if (Config.bPreserveDelimiters)
+            {
+                EmitRawToken(Boundary, Boundary + 1);
+            }
+            ScanPos = Boundary + 1;
+            continue;
+        }
+        
+        // Bound memory: a word that outgrows the window is split here
+        if (Buffer.Num() - ScanPos >= MaxPendingChars)
+        {
+            EmitRawToken(ScanPos, Buffer.Num());
+            ScanPos = Buffer.Num();
+            continue;
+        }
+        
+        if (bEndOfInput)
+        {
+            if (ScanPos < Buffer.Num())
+            {
+                EmitRawToken(ScanPos, Buffer.Num());
+                ScanPos = Buffer.Num();
+                continue;
+            }
+            return false;
+        }
+        
+        // Drop consumed characters, keep the partial word, read more
+        AdvanceLineTracking(BufferBase + ScanPos);
+        Buffer.RemoveAt(0, ScanPos, EAllowShrinking::No);
+        BufferBase += ScanPos;
+        ScanPos = 0;
+        
+        if (!Refill())
+        {
+            bEndOfInput = true;
+        }
+    }
+}
+
+int64 FRETokenStreamReader::ForEach(TFunctionRef<bool(const FREToken&)> OnToken)
+{
+    int64 Count = 0;
+    FREToken Token;
+    while (Next(Token))
+    {
+        ++Count;
+        if (!OnToken(Token))
+        {
+            break;
+        }
+    }
+    return Count;
+}
+
+bool FRETokenStreamReader::Refill()
+{
+    const int64 Remaining = Archive.TotalSize() - Archive.Tell();
+    if (Remaining <= 0 || Archive.IsError())
+    {
+        DecodePending(true);
+        return false;
+    }
+    
+    const int32 ToRead = static_cast<int32>(FMath::Min<int64>(Remaining, ChunkBytes));
+    const int32 Carried = Bytes.Num();
+    Bytes.SetNumUninitialized(Carried + ToRead, EAllowShrinking::No);
+    Archive.Serialize(Bytes.GetData() + Carried, ToRead);
+    
+    // Encoding is decided by the first bytes of the stream
+    if (Encoding == EEncoding::Unknown && Bytes.Num() >= 2)
+    {
+        if (Bytes.Num() >= 3 && Bytes[0] == 0xEF && Bytes[1] == 0xBB && Bytes[2] == 0xBF)
+        {
+            Encoding = EEncoding::Utf8;
+            Bytes.RemoveAt(0, 3, EAllowShrinking::No);
+        }
+        else if (Bytes[0] == 0xFF && Bytes[1] == 0xFE)
+        {
+            Encoding = EEncoding::Utf16LE;
+            Bytes.RemoveAt(0, 2, EAllowShrinking::No);
+        }
+        else
+        {
+            Encoding = EEncoding::Utf8;
+        }
+    }
+    
+    DecodePending(Remaining <= ToRead);
+    return true;
+}
+
+void FRETokenStreamReader::DecodePending(bool bFinal)
+{
+    int32 Consumed = 0;
+    
+    if (Encoding == EEncoding::Utf16LE)
+    {
+        const int32 NumUnits = Bytes.Num() / 2;
+        Buffer.Reserve(Buffer.Num() + NumUnits);
+        for (int32 Unit = 0; Unit < NumUnits; ++Unit)
+        {
+            Buffer.Add(static_cast<TCHAR>(Bytes[Unit * 2] | (Bytes[Unit * 2 + 1] << 8)));
+        }
+        Consumed = NumUnits * 2;
+        if (bFinal && Consumed < Bytes.Num())
+        {
+            Buffer.Add(ReplacementChar);
+            Consumed = Bytes.Num();
+        }
+    }
+    else
+    {
+        Buffer.Reserve(Buffer.Num() + Bytes.Num());
+        Consumed = DecodeUtf8(Bytes.GetData(), Bytes.Num(), bFinal, Buffer);
+    }
+    
+    Bytes.RemoveAt(0, Consumed, EAllowShrinking::No);
+}
+
+void FRETokenStreamReader::EmitRawToken(int32 Start, int32 End)
+{
+    if (End <= Start)
+    {
+        return;
+    }
+    
+    const FString RawToken(End - Start, Buffer.GetData() + Start);
+    const ERENamingConvention Convention = Config.bDetectNamingConvention
+        ? RETokenizer::DetectNamingConvention(RawToken)
+        : ERENamingConvention::Unknown;
+    
+    int32 Position = 0;
+    const int32 FirstNew = Ready.Num();
+    RawOffsets.Reset();
+    RETokenizer::ProcessRawToken(RawToken, Config, Convention, Position, Ready, &RawOffsets);
+    
+    // Replace synthetic positions with the absolute offset of each sub-token
+    const int64 RawStart = BufferBase + Start;
+    for (int32 Index = FirstNew; Index < Ready.Num(); ++Index)
+    {
+        FREToken& Token = Ready[Index];
+        const int64 Offset = RawStart + RawOffsets[Index - FirstNew];
+        const int64 End = Offset + Token.Text.Len();
+        
+        AdvanceLineTracking(Offset);
+        const int64 Column = Offset - LineStart + 1;
+        if (End > MAX_int32 || Column > MAX_int32)
+        {
+            // Token positions are 32-bit; keep the exact offset alongside the clamped ones
+            Token.Metadata.Add(TEXT("StreamOffset"), LexToString(Offset));
+        }
+        Token.StartIndex = static_cast<int32>(FMath::Min<int64>(Offset, MAX_int32));
+        Token.EndIndex = static_cast<int32>(FMath::Min<int64>(End, MAX_int32));
+        Token.LineNumber = Line;
+        Token.ColumnNumber = static_cast<int32>(FMath::Min<int64>(Column, MAX_int32));
+    }
+}
+
+void FRETokenStreamReader::AdvanceLineTracking(int64 AbsoluteOffset)
+{
+    // Offsets only move forward, and everything past the cursor is still buffered
+    const int32 From = static_cast<int32>(FMath::Max<int64>(LineCursor - BufferBase, 0));
+    const int32 To = static_cast<int32>(FMath::Min<int64>(AbsoluteOffset - BufferBase, Buffer.Num()));
+    
+    for (int32 Index = From; Index < To; ++Index)
+    {
+        if (Buffer[Index] == TEXT('\n'))
+        {
+            ++Line;
+            LineStart = BufferBase + Index + 1;
+        }
+    }
+    
+    LineCursor = FMath::Max(LineCursor, AbsoluteOffset);
+}
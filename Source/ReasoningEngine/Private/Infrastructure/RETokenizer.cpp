@@ -1,8 +1,215 @@
 // Source/ReasoningEngine/Private/Infrastructure/RETokenizer.cpp
 #include "Infrastructure/RETokenizer.h"
 #include "Infrastructure/RENormalizer.h"
+#include "Infrastructure/RECorpusStatistics.h"
+#include "Infrastructure/REPackedTokenStream.h"
+#include "Infrastructure/RETokenDictionary.h"
+#include "Infrastructure/RETokenStreamReader.h"
+#include "Infrastructure/REVocabularyMatcher.h"
+#include "Infrastructure/REWordSegmenter.h"
 #include "Semantic/REFuzzy.h"  // For typo generation
 #include "ReasoningEngine.h"
+#include "RETextSimd.h"
+#include "Algo/AllOf.h"
+#include "Async/ParallelFor.h"
+#include "Hash/CityHash.h"
+#include "HAL/FileManager.h"
+#include "Infrastructure/RECache.h"
+
+namespace
+{
+    /** Vowel swaps used for typo generation */
+    const TMap<TCHAR, TArray<TCHAR>>& GetTypoSubstitutions()
+    {
+        // This would ideally use REFuzzy::CalculateKeyboardDistance
+        // For now, just do simple vowel substitutions
+        static const TMap<TCHAR, TArray<TCHAR>> Substitutions = {
+            {TEXT('a'), {TEXT('e'), TEXT('o')}},
+            {TEXT('e'), {TEXT('a'), TEXT('i')}},
+            {TEXT('i'), {TEXT('e'), TEXT('y')}},
+            {TEXT('o'), {TEXT('a'), TEXT('u')}},
+            {TEXT('u'), {TEXT('o'), TEXT('i')}}
+        };
+        return Substitutions;
+    }
+    
+    /** Variant cache key - case-sensitive, since typos preserve case */
+    struct FVariantCacheKey
+    {
+        FString Token;
+        uint8 Flags = 0;
+        
+        bool operator==(const FVariantCacheKey& Other) const
+        {
+            return Flags == Other.Flags && Token.Equals(Other.Token, ESearchCase::CaseSensitive);
+        }
+        
+        friend uint32 GetTypeHash(const FVariantCacheKey& Key)
+        {
+            return HashCombine(FCrc::StrCrc32(*Key.Token), Key.Flags);
+        }
+    };
+    
+    using FVariantList = TSharedPtr<const TArray<FString>, ESPMode::ThreadSafe>;
+    using FVariantCache = TThreadSafeCache<FVariantCacheKey, FVariantList>;
+    
+    /** Bounded variant cache, sharded to keep lock hold and LRU scans short */
+    constexpr int32 NumVariantCacheShards = 16;
+    constexpr int32 VariantCacheEntriesPerShard = 256;
+    
+    FVariantCache* GetVariantCacheShards()
+    {
+        static FVariantCache Shards[NumVariantCacheShards] = {
+            FVariantCache(VariantCacheEntriesPerShard), FVariantCache(VariantCacheEntriesPerShard),
+            FVariantCache(VariantCacheEntriesPerShard), FVariantCache(VariantCacheEntriesPerShard),
+            FVariantCache(VariantCacheEntriesPerShard), FVariantCache(VariantCacheEntriesPerShard),
+            FVariantCache(VariantCacheEntriesPerShard), FVariantCache(VariantCacheEntriesPerShard),
+            FVariantCache(VariantCacheEntriesPerShard), FVariantCache(VariantCacheEntriesPerShard),
+            FVariantCache(VariantCacheEntriesPerShard), FVariantCache(VariantCacheEntriesPerShard),
+            FVariantCache(VariantCacheEntriesPerShard), FVariantCache(VariantCacheEntriesPerShard),
+            FVariantCache(VariantCacheEntriesPerShard), FVariantCache(VariantCacheEntriesPerShard)
+        };
+        return Shards;
+    }
+    
+    FVariantCache& GetVariantCacheShard(const FVariantCacheKey& Key)
+    {
+        return GetVariantCacheShards()[GetTypeHash(Key) % NumVariantCacheShards];
+    }
+    
+    FVariantCacheKey MakeVariantKey(const FString& Token, bool bTypos, bool bAbbreviations, bool bExpansions)
+    {
+        return FVariantCacheKey{ Token, static_cast<uint8>((bTypos ? 1 : 0) | (bAbbreviations ? 2 : 0) | (bExpansions ? 4 : 0)) };
+    }
+    
+    // ========== SIMILARITY BLOCKING ==========
+    
+    /** Below this many distinct terms every pair is scored */
+    constexpr int32 AllPairsTermLimit = 64;
+    
+    /** MinHash signature: NumBands bands of NumBandRows rows */
+    constexpr int32 NumBands = 8;
+    constexpr int32 NumBandRows = 2;
+    constexpr int32 NumMinHashes = NumBands * NumBandRows;
+    
+    /** Each bucket member is compared with at most this many later members */
+    constexpr int32 MaxBucketNeighbors = 16;
+    
+    /** Candidate pairs needed before scoring goes parallel */
+    constexpr int32 ParallelPairThreshold = 512;
+    
+    FORCEINLINE uint64 MixHash64(uint64 Value)
+    {
+        // SplitMix64 finalizer
+        Value ^= Value >> 30;
+        Value *= 0xBF58476D1CE4E5B9ull;
+        Value ^= Value >> 27;
+        Value *= 0x94D049BB133111EBull;
+        Value ^= Value >> 31;
+        return Value;
+    }
+    
+    /** MinHash over boundary-padded character bigrams ("^w", "wa", ..., "k$") */
+    void ComputeMinHash(const FString& Text, uint32* OutSignature)
+    {
+        for (int32 Hash = 0; Hash < NumMinHashes; Hash++)
+        {
+            OutSignature[Hash] = MAX_uint32;
+        }
+        
+        for (int32 Index = -1; Index < Text.Len(); Index++)
+        {
+            const uint32 First = Index >= 0 ? Text[Index] : TEXT('^');
+            const uint32 Second = Index + 1 < Text.Len() ? Text[Index + 1] : TEXT('$');
+            const uint64 Shingle = MixHash64((static_cast<uint64>(First) << 32) | Second);
+            
+            for (int32 Hash = 0; Hash < NumMinHashes; Hash++)
+            {
+                const uint32 Value = static_cast<uint32>(MixHash64(Shingle + (Hash + 1) * 0x9E3779B97F4A7C15ull));
+                OutSignature[Hash] = FMath::Min(OutSignature[Hash], Value);
+            }
+        }
+    }
+    
+    /**
+     * Pairs of terms worth scoring, packed as (Low << 32) | High
+     * Terms sharing a MinHash band (similar bigram sets) or a two-character
+     * prefix (what Jaro-Winkler rewards) become candidates
+     */
+    TArray<uint64> FindSimilarityCandidates(TArrayView<const FString* const> Terms)
+    {
+        const int32 NumTerms = Terms.Num();
+        TArray<uint64> Pairs;
+        
+        if (NumTerms <= AllPairsTermLimit)
+        {
+            for (int32 A = 0; A < NumTerms; A++)
+            {
+                for (int32 B = A + 1; B < NumTerms; B++)
+                {
+                    Pairs.Add((static_cast<uint64>(A) << 32) | static_cast<uint32>(B));
+                }
+            }
+            return Pairs;
+        }
+        
+        TArray<uint32> Signatures;
+        Signatures.SetNumUninitialized(NumTerms * NumMinHashes);
+        ParallelFor(NumTerms, [&](int32 Term)
+        {
+            ComputeMinHash(*Terms[Term], &Signatures[Term * NumMinHashes]);
+        });
+        
+        // Bucket members are added in term order
+        TMap<uint64, TArray<int32>> Buckets;
+        for (int32 Term = 0; Term < NumTerms; Term++)
+        {
+            const uint32* Signature = &Signatures[Term * NumMinHashes];
+            for (int32 Band = 0; Band < NumBands; Band++)
+            {
+                const uint64 Rows = (static_cast<uint64>(Signature[Band * NumBandRows]) << 32) | Signature[Band * NumBandRows + 1];
+                Buckets.FindOrAdd(MixHash64(Rows ^ (Band + 1))).Add(Term);
+            }
+            
+            const FString& Text = *Terms[Term];
+            const uint64 Prefix = (static_cast<uint64>(Text.Len() > 0 ? Text[0] : 0) << 16) | (Text.Len() > 1 ? Text[1] : 0);
+            Buckets.FindOrAdd(MixHash64(Prefix | (1ull << 63))).Add(Term);
+        }
+        
+        TSet<uint64> Seen;
+        for (const TPair<uint64, TArray<int32>>& Bucket : Buckets)
+        {
+            const TArray<int32>& Members = Bucket.Value;
+            for (int32 A = 0; A < Members.Num(); A++)
+            {
+                const int32 Last = FMath::Min(Members.Num(), A + 1 + MaxBucketNeighbors);
+                for (int32 B = A + 1; B < Last; B++)
+                {
+                    const uint64 Pair = (static_cast<uint64>(Members[A]) << 32) | static_cast<uint32>(Members[B]);
+                    bool bAlreadySeen = false;
+                    Seen.Add(Pair, &bAlreadySeen);
+                    if (!bAlreadySeen)
+                    {
+                        Pairs.Add(Pair);
+                    }
+                }
+            }
+        }
+        
+        return Pairs;
+    }
+    
+    /** Union-find root with path halving */
+    int32 FindRoot(TArray<int32>& Parents, int32 Node)
+    {
+        while (Parents[Node] != Node)
+        {
+            Parents[Node] = Parents[Parents[Node]];
+            Node = Parents[Node];
+        }
+        return Node;
+    }
+}
 
 // ========== PRIMARY TOKENIZATION ==========
 
@@ -17,15 +224,26 @@ FRETokenStream RETokenizer::TokenizeWithConfig(const FString& Text, const FRETok
     FRETokenStream Result;
     Result.OriginalText = Text;
     
+    TokenizeInto(Text, Config, Result.Tokens, Result.DetectedConvention);
+    
+    return Result;
+}
+
+void RETokenizer::TokenizeInto(
+    const FString& Text,
+    const FRETokenizerConfig& Config,
+    TArray<FREToken>& OutTokens,
+    ERENamingConvention& OutConvention)
+{
     if (Text.IsEmpty())
     {
-        return Result;
+        return;
     }
     
     // Detect naming convention if requested
     if (Config.bDetectNamingConvention)
     {
-        Result.DetectedConvention = DetectNamingConvention(Text);
+        OutConvention = DetectNamingConvention(Text);
     }
     
     // Primary tokenization based on delimiters
@@ -35,75 +253,190 @@ FRETokenStream RETokenizer::TokenizeWithConfig(const FString& Text, const FRETok
     int32 CurrentPosition = 0;
     for (const FString& RawToken : RawTokens)
     {
-        if (RawToken.IsEmpty())
+        ProcessRawToken(RawToken, Config, OutConvention, CurrentPosition, OutTokens);
+    }
+}
+
+void RETokenizer::ProcessRawToken(
+    const FString& RawToken,
+    const FRETokenizerConfig& Config,
+    ERENamingConvention Convention,
+    int32& InOutPosition,
+    TArray<FREToken>& OutTokens,
+    TArray<int32>* OutRawOffsets)
+{
+    if (RawToken.IsEmpty())
+    {
+        return;
+    }
+    
+    TArray<FString> SubTokens;
+    
+    // Further split based on naming convention
+    if (Config.bSplitCamelCase && 
+        (Convention == ERENamingConvention::CamelCase || 
+         Convention == ERENamingConvention::PascalCase))
+    {
+        SubTokens = SplitCamelCase(RawToken);
+    }
+    else if (Config.bSplitNumbers)
+    {
+        SubTokens = SplitAlphanumeric(RawToken);
+    }
+    else
+    {
+        SubTokens.Add(RawToken);
+    }
+    
+    // Segment names that had no case or delimiter boundaries
+    if (Config.bSegmentWords)
+    {
+        const FREWordSegmenter& Segmenter = FREWordSegmenter::GetDefault();
+        TArray<FString> Segmented;
+        for (FString& SubToken : SubTokens)
+        {
+            const bool bAllLetters = Algo::AllOf(SubToken, [](TCHAR Char) { return FChar::IsAlpha(Char); });
+            if (SubToken.Len() >= Config.MinSegmentLength && bAllLetters)
+            {
+                Segmented.Append(Segmenter.SegmentToStrings(SubToken));
+            }
+            else
+            {
+                Segmented.Add(MoveTemp(SubToken));
+            }
+        }
+        SubTokens = MoveTemp(Segmented);
+    }
+    
+    // Create tokens from subtokens; they cover RawToken in order, so each
+    // starts where the previous one ended
+    int32 RawOffset = 0;
+    for (const FString& SubToken : SubTokens)
+    {
+        const int32 SubTokenOffset = RawOffset;
+        RawOffset += SubToken.Len();
+        
+        // Apply length filters
+        if (SubToken.Len() < Config.MinTokenLength)
         {
             continue;
         }
         
-        TArray<FString> SubTokens;
+        FString FinalToken = SubToken;
+        if (SubToken.Len() > Config.MaxTokenLength)
+        {
+            FinalToken = SubToken.Left(Config.MaxTokenLength);
+        }
         
-        // Further split based on naming convention
-        if (Config.bSplitCamelCase && 
-            (Result.DetectedConvention == ERENamingConvention::CamelCase || 
-             Result.DetectedConvention == ERENamingConvention::PascalCase))
+        // Normalize case if requested
+        if (Config.bNormalizeCase)
         {
-            SubTokens = SplitCamelCase(RawToken);
+            FinalToken = RENormalizer::ToLowercase(FinalToken);
         }
-        else if (Config.bSplitNumbers)
+        
+        // Create token
+        FREToken Token = CreateToken(
+            FinalToken,
+            InOutPosition,
+            InOutPosition + FinalToken.Len(),
+            ClassifyTokenType(FinalToken)
+        );
+        
+        if (Config.bEmitTokenIds)
         {
-            SubTokens = SplitAlphanumeric(RawToken);
+            Token.TokenId = FRETokenDictionary::Get().Intern(Token.NormalizedText);
         }
-        else
+        
+        // Generate variants if requested (deferred variants come from GetVariants)
+        if (Config.bGenerateVariants && !Config.bDeferVariants)
         {
-            SubTokens.Add(RawToken);
+            Token.Variants = GetVariants(Token, Config).ToArray();
         }
         
-        // Create tokens from subtokens
-        for (const FString& SubToken : SubTokens)
+        if (OutRawOffsets)
         {
-            // Apply length filters
-            if (SubToken.Len() < Config.MinTokenLength)
-            {
-                continue;
-            }
-            
-            FString FinalToken = SubToken;
-            if (SubToken.Len() > Config.MaxTokenLength)
-            {
-                FinalToken = SubToken.Left(Config.MaxTokenLength);
-            }
-            
-            // Normalize case if requested
-            if (Config.bNormalizeCase)
-            {
-                FinalToken = RENormalizer::ToLowercase(FinalToken);
-            }
-            
-            // Create token
-            FREToken Token = CreateToken(
-                FinalToken,
-                CurrentPosition,
-                CurrentPosition + FinalToken.Len(),
-                ClassifyTokenType(FinalToken)
-            );
-            
-            // Generate variants if requested
-            if (Config.bGenerateVariants)
+            OutRawOffsets->Add(SubTokenOffset);
+        }
+        
+        OutTokens.Add(MoveTemp(Token));
+        InOutPosition += FinalToken.Len() + 1;  // +1 for assumed space
+    }
+}
+
+FRETokenBatch RETokenizer::TokenizeBatch(TArrayView<const FString> Texts, const FRETokenizerConfig& Config)
+{
+    // Inputs per work item, and batch size below which threading costs more than it saves
+    constexpr int32 TextsPerChunk = 128;
+    constexpr int32 MinParallelTexts = 256;
+    
+    FRETokenBatch Batch;
+    const int32 NumTexts = Texts.Num();
+    Batch.Offsets.SetNumZeroed(NumTexts + 1);
+    Batch.Conventions.Init(ERENamingConvention::Unknown, NumTexts);
+    
+    if (NumTexts == 0)
+    {
+        return Batch;
+    }
+    
+    // Tokenize [First, Last) into Out, recording each input's token count at Offsets[I + 1]
+    auto TokenizeRange = [&Texts, &Config, &Batch](int32 First, int32 Last, TArray<FREToken>& Out)
+    {
+        for (int32 Index = First; Index < Last; ++Index)
+        {
+            const int32 Before = Out.Num();
+            TokenizeInto(Texts[Index], Config, Out, Batch.Conventions[Index]);
+            Batch.Offsets[Index + 1] = Out.Num() - Before;
+        }
+    };
+    
+    const int32 NumChunks = FMath::DivideAndRoundUp(NumTexts, TextsPerChunk);
+    
+    if (NumTexts < MinParallelTexts)
+    {
+        TokenizeRange(0, NumTexts, Batch.Tokens);
+    }
+    else
+    {
+        // Each chunk fills its own array, then chunks are moved into the arena in input order
+        TArray<TArray<FREToken>> ChunkTokens;
+        ChunkTokens.SetNum(NumChunks);
+        
+        ParallelFor(NumChunks, [&](int32 Chunk)
+        {
+            const int32 First = Chunk * TextsPerChunk;
+            const int32 Last = FMath::Min(First + TextsPerChunk, NumTexts);
+            TokenizeRange(First, Last, ChunkTokens[Chunk]);
+        });
+        
+        TArray<int32> ChunkStarts;
+        ChunkStarts.SetNumUninitialized(NumChunks);
+        int32 TotalTokens = 0;
+        for (int32 Chunk = 0; Chunk < NumChunks; ++Chunk)
+        {
+            ChunkStarts[Chunk] = TotalTokens;
+            TotalTokens += ChunkTokens[Chunk].Num();
+        }
+        Batch.Tokens.SetNum(TotalTokens);
+        
+        ParallelFor(NumChunks, [&](int32 Chunk)
+        {
+            TArray<FREToken>& Source = ChunkTokens[Chunk];
+            for (int32 Index = 0; Index < Source.Num(); ++Index)
             {
-                Token.Variants = GenerateVariants(
-                    FinalToken,
-                    true,  // Include typos
-                    Config.bExpandAbbreviations,
-                    Config.bExpandAbbreviations
-                );
+                Batch.Tokens[ChunkStarts[Chunk] + Index] = MoveTemp(Source[Index]);
             }
-            
-            Result.Tokens.Add(Token);
-            CurrentPosition += FinalToken.Len() + 1;  // +1 for assumed space
-        }
+            Source.Empty();
+        });
     }
     
-    return Result;
+    // Token counts -> start offsets
+    for (int32 Index = 0; Index < NumTexts; ++Index)
+    {
+        Batch.Offsets[Index + 1] += Batch.Offsets[Index];
+    }
+    
+    return Batch;
 }
 
 FRETokenStream RETokenizer::TokenizeWithKnowledge(
@@ -121,6 +454,41 @@ FRETokenStream RETokenizer::TokenizeWithKnowledge(
     return Result;
 }
 
+// ========== STREAMING TOKENIZATION ==========
+
+int64 RETokenizer::TokenizeArchive(
+    FArchive& Archive,
+    const FRETokenizerConfig& Config,
+    TFunctionRef<bool(const FREToken&)> OnToken,
+    int32 ChunkBytes)
+{
+    FRETokenStreamReader Reader(Archive, Config, ChunkBytes);
+    const int64 Count = Reader.ForEach(OnToken);
+    
+    if (Reader.IsError())
+    {
+        UE_LOG(LogReasoningEngine, Warning, TEXT("TokenizeArchive: read error after %lld characters"), Reader.GetCharsRead());
+    }
+    
+    return Count;
+}
+
+int64 RETokenizer::TokenizeFile(
+    const FString& FilePath,
+    const FRETokenizerConfig& Config,
+    TFunctionRef<bool(const FREToken&)> OnToken,
+    int32 ChunkBytes)
+{
+    TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*FilePath));
+    if (!Reader)
+    {
+        UE_LOG(LogReasoningEngine, Warning, TEXT("TokenizeFile: could not open %s"), *FilePath);
+        return INDEX_NONE;
+    }
+    
+    return TokenizeArchive(*Reader, Config, OnToken, ChunkBytes);
+}
+
 // ========== TEXT SPLITTING ==========
 
 TArray<FString> RETokenizer::SplitByDelimiters(
@@ -135,35 +503,34 @@ TArray<FString> RETokenizer::SplitByDelimiters(
         return Result;
     }
     
-    FString CurrentToken;
+    // Boundary detection scans whole ASCII blocks at a time
+    const RETextSimd::FDelimiterSet DelimiterSet(Delimiters);
+    const TCHAR* Data = *Text;
+    const int32 Len = Text.Len();
     
-    for (TCHAR Char : Text)
+    int32 Index = 0;
+    while (Index < Len)
     {
-        if (IsDelimiter(Char, Delimiters))
+        const int32 Boundary = RETextSimd::FindDelimiter(Data, Index, Len, DelimiterSet);
+        
+        // Add current token if not empty
+        if (Boundary > Index)
         {
-            // Add current token if not empty
-            if (!CurrentToken.IsEmpty())
-            {
-                Result.Add(CurrentToken);
-                CurrentToken.Empty();
-            }
-            
-            // Add delimiter as token if requested
-            if (bKeepDelimiters)
-            {
-                Result.Add(FString::Chr(Char));
-            }
+            Result.Emplace(Boundary - Index, Data + Index);
         }
-        else
+        
+        if (Boundary >= Len)
         {
-            CurrentToken.AppendChar(Char);
+            break;
         }
-    }
-    
-    // Add final token
-    if (!CurrentToken.IsEmpty())
-    {
-        Result.Add(CurrentToken);
+        
+        // Add delimiter as token if requested
+        if (bKeepDelimiters)
+        {
+            Result.Add(FString::Chr(Data[Boundary]));
+        }
+        
+        Index = Boundary + 1;
     }
     
     return Result;
@@ -399,15 +766,20 @@ FString RETokenizer::ConvertNamingConvention(
     return Result;
 }
 
-FRETokenStream RETokenizer::TokenizeAnimationName(const FString& AnimationName)
+FRETokenizerConfig RETokenizer::GetAnimationNameConfig()
 {
     FRETokenizerConfig Config;
     Config.Delimiters = TEXT("_-");
     Config.bSplitNumbers = true;
     Config.bDetectNamingConvention = true;
     Config.bNormalizeCase = false;  // Preserve case for animation names
-    
-    FRETokenStream Result = TokenizeWithConfig(AnimationName, Config);
+    Config.bSegmentWords = true;    // "walkforwardloop" -> walk, forward, loop
+    return Config;
+}
+
+FRETokenStream RETokenizer::TokenizeAnimationName(const FString& AnimationName)
+{
+    FRETokenStream Result = TokenizeWithConfig(AnimationName, GetAnimationNameConfig());
     
     // Mark common animation prefixes
     if (Result.Tokens.Num() > 0)
@@ -521,28 +893,18 @@ TArray<FString> RETokenizer::GenerateVariants(
     bool bIncludeAbbreviations,
     bool bIncludeExpansions)
 {
-    TArray<FString> Variants;
-    
-    if (bIncludeTypos)
-    {
-        Variants.Append(GenerateTypos(Token, 1));
-    }
-    
-    if (bIncludeAbbreviations)
-    {
-        Variants.Append(GenerateAbbreviations(Token));
-    }
-    
-    if (bIncludeExpansions)
-    {
-        Variants.Append(GenerateExpansions(Token));
-    }
-    
-    // Remove duplicates
-    TSet<FString> UniqueVariants(Variants);
-    Variants = UniqueVariants.Array();
-    
-    return Variants;
+    // Deduplicated in generation order, shared with the lazy view and its cache
+    return FRETokenVariants(Token, bIncludeTypos, bIncludeAbbreviations, bIncludeExpansions).ToArray();
+}
+
+FRETokenVariants RETokenizer::GetVariants(const FREToken& Token, const FRETokenizerConfig& Config)
+{
+    return FRETokenVariants(
+        Token.Text,
+        true,  // Include typos
+        Config.bExpandAbbreviations,
+        Config.bExpandAbbreviations
+    );
 }
 
 TArray<FString> RETokenizer::GenerateTypos(const FString& Word, int32 MaxDistance)
@@ -572,15 +934,7 @@ TArray<FString> RETokenizer::GenerateTypos(const FString& Word, int32 MaxDistanc
     }
     
     // 3. Character substitution (keyboard neighbors)
-    // This would ideally use REFuzzy::CalculateKeyboardDistance
-    // For now, just do simple vowel substitutions
-    static const TMap<TCHAR, TArray<TCHAR>> Substitutions = {
-        {TEXT('a'), {TEXT('e'), TEXT('o')}},
-        {TEXT('e'), {TEXT('a'), TEXT('i')}},
-        {TEXT('i'), {TEXT('e'), TEXT('y')}},
-        {TEXT('o'), {TEXT('a'), TEXT('u')}},
-        {TEXT('u'), {TEXT('o'), TEXT('i')}}
-    };
+    const TMap<TCHAR, TArray<TCHAR>>& Substitutions = GetTypoSubstitutions();
     
     for (int32 i = 0; i < Word.Len(); i++)
     {
@@ -667,6 +1021,210 @@ TArray<FString> RETokenizer::GenerateExpansions(const FString& Abbreviation)
     return Expansions;
 }
 
+// ========== LAZY VARIANTS ==========
+
+FRETokenVariants::FRETokenVariants(const FString& InToken, bool bInTypos, bool bInAbbreviations, bool bInExpansions)
+    : Token(InToken)
+    , bTypos(bInTypos)
+    , bAbbreviations(bInAbbreviations)
+    , bExpansions(bInExpansions)
+{
+}
+
+int32 FRETokenVariants::ForEach(TFunctionRef<bool(const FString&)> Visitor) const
+{
+    int32 Count = 0;
+    for (FIterator It = begin(); It; ++It)
+    {
+        ++Count;
+        if (!Visitor(*It))
+        {
+            break;
+        }
+    }
+    return Count;
+}
+
+TArray<FString> FRETokenVariants::ToArray() const
+{
+    FIterator It = begin();
+    if (It.Cached.IsValid())
+    {
+        return *It.Cached;
+    }
+    
+    while (It)
+    {
+        ++It;
+    }
+    return MoveTemp(It.Emitted);
+}
+
+TArray<FString> FRETokenVariants::Take(int32 Count) const
+{
+    TArray<FString> Result;
+    for (FIterator It = begin(); It && Result.Num() < Count; ++It)
+    {
+        Result.Add(*It);
+    }
+    return Result;
+}
+
+void FRETokenVariants::ClearCache()
+{
+    FVariantCache* Shards = GetVariantCacheShards();
+    for (int32 Shard = 0; Shard < NumVariantCacheShards; ++Shard)
+    {
+        Shards[Shard].Clear();
+    }
+}
+
+FRETokenVariants::FIterator::FIterator(const FRETokenVariants& InOwner)
+    : Owner(&InOwner)
+{
+    const FVariantCacheKey Key = MakeVariantKey(Owner->Token, Owner->bTypos, Owner->bAbbreviations, Owner->bExpansions);
+    FVariantList CachedList;
+    if (GetVariantCacheShard(Key).Get(Key, CachedList) && CachedList.IsValid())
+    {
+        Cached = MoveTemp(CachedList);
+    }
+    
+    // Typos are skipped entirely when disabled or the word is empty (as GenerateTypos)
+    if (!Owner->bTypos || Owner->Token.IsEmpty())
+    {
+        Stage = EStage::Abbreviation;
+        Position = -1;
+    }
+    
+    Advance();
+}
+
+bool FRETokenVariants::FIterator::NextCandidate(FString& OutCandidate)
+{
+    const FString& Word = Owner->Token;
+    const int32 Len = Word.Len();
+    
+    while (true)
+    {
+        switch (Stage)
+        {
+        case EStage::Deletion:
+            // 1. Character deletion
+            if (Position < Len)
+            {
+                OutCandidate = Word.Left(Position) + Word.Mid(Position + 1);
+                ++Position;
+                return true;
+            }
+            Stage = EStage::Transposition;
+            Position = 0;
+            break;
+            
+        case EStage::Transposition:
+            // 2. Character transposition
+            if (Position < Len - 1)
+            {
+                OutCandidate = Word;
+                Swap(OutCandidate[Position], OutCandidate[Position + 1]);
+                ++Position;
+                return true;
+            }
+            Stage = EStage::Substitution;
+            Position = 0;
+            SubIndex = 0;
+            break;
+            
+        case EStage::Substitution:
+            // 3. Vowel substitution
+            while (Position < Len)
+            {
+                const TCHAR Char = FChar::ToLower(Word[Position]);
+                const TArray<TCHAR>* Subs = GetTypoSubstitutions().Find(Char);
+                if (Subs && SubIndex < Subs->Num())
+                {
+                    const TCHAR Sub = (*Subs)[SubIndex++];
+                    OutCandidate = Word;
+                    OutCandidate[Position] = Word[Position] == Char ? Sub : FChar::ToUpper(Sub);
+                    return true;
+                }
+                ++Position;
+                SubIndex = 0;
+            }
+            Stage = EStage::Abbreviation;
+            Position = -1;
+            break;
+            
+        case EStage::Abbreviation:
+        case EStage::Expansion:
+        {
+            const bool bEnabled = Stage == EStage::Abbreviation ? Owner->bAbbreviations : Owner->bExpansions;
+            if (Position < 0)
+            {
+                // Small fixed-size stages are produced in one step
+                StageItems.Reset();
+                if (bEnabled)
+                {
+                    StageItems = Stage == EStage::Abbreviation
+                        ? RETokenizer::GenerateAbbreviations(Word)
+                        : RETokenizer::GenerateExpansions(Word);
+                }
+                Position = 0;
+            }
+            if (Position < StageItems.Num())
+            {
+                OutCandidate = MoveTemp(StageItems[Position++]);
+                return true;
+            }
+            Stage = Stage == EStage::Abbreviation ? EStage::Expansion : EStage::Done;
+            Position = -1;
+            break;
+        }
+            
+        case EStage::Done:
+        default:
+            return false;
+        }
+    }
+}
+
+void FRETokenVariants::FIterator::Advance()
+{
+    if (bDone)
+    {
+        return;
+    }
+    
+    if (Cached.IsValid())
+    {
+        if (CachedIndex < Cached->Num())
+        {
+            Current = (*Cached)[CachedIndex++];
+            return;
+        }
+        bDone = true;
+        return;
+    }
+    
+    FString Candidate;
+    while (NextCandidate(Candidate))
+    {
+        // Case-insensitive, first occurrence wins (as the TSet dedup it replaces)
+        bool bAlreadySeen = false;
+        Seen.Add(Candidate, &bAlreadySeen);
+        if (!bAlreadySeen)
+        {
+            Current = Candidate;
+            Emitted.Add(MoveTemp(Candidate));
+            return;
+        }
+    }
+    
+    // Enumerated to the end - publish the full list for later lookups
+    bDone = true;
+    const FVariantCacheKey Key = MakeVariantKey(Owner->Token, Owner->bTypos, Owner->bAbbreviations, Owner->bExpansions);
+    GetVariantCacheShard(Key).Put(Key, MakeShared<const TArray<FString>, ESPMode::ThreadSafe>(Emitted));
+}
+
 // ========== TOKEN ANALYSIS ==========
 
 TArray<FRETokenGroup> RETokenizer::GroupTokensBySimilarity(
@@ -675,62 +1233,144 @@ TArray<FRETokenGroup> RETokenizer::GroupTokensBySimilarity(
 {
     TArray<FRETokenGroup> Groups;
     
-    // Simple clustering by similarity
-    // This would ideally use REFuzzy for similarity calculation
+    if (Tokens.Num() == 0)
+    {
+        return Groups;
+    }
     
-    for (const FREToken& Token : Tokens)
+    // 1. Exact duplicates - one term per distinct NormalizedText, in first-seen order
+    TArray<int32> TermFirstToken;
+    const TArray<uint32> TermOfToken = GetLocalTermIds(Tokens, TermFirstToken);
+    
+    const int32 NumTerms = TermFirstToken.Num();
+    TArray<int32> TermCounts;
+    TermCounts.Init(0, NumTerms);
+    for (uint32 Term : TermOfToken)
     {
-        bool bAddedToGroup = false;
+        TermCounts[Term]++;
+    }
+    TArray<const FString*> TermTexts;
+    TermTexts.Reserve(NumTerms);
+    for (int32 Term = 0; Term < NumTerms; Term++)
+    {
+        TermTexts.Add(&Tokens[TermFirstToken[Term]].NormalizedText);
+    }
+    
+    // 2. Score only blocked candidate pairs and merge the similar ones
+    TArray<int32> Parents;
+    Parents.SetNumUninitialized(NumTerms);
+    for (int32 Term = 0; Term < NumTerms; Term++)
+    {
+        Parents[Term] = Term;
+    }
+    
+    if (SimilarityThreshold < 1.0f && NumTerms > 1)
+    {
+        const TArray<uint64> Pairs = FindSimilarityCandidates(TermTexts);
         
-        for (FRETokenGroup& Group : Groups)
+        TArray<float> Scores;
+        Scores.SetNumUninitialized(Pairs.Num());
+        ParallelFor(Pairs.Num(), [&](int32 Pair)
         {
-            // Check similarity with group canonical form
-            // For now, just check exact match
-            if (Group.CanonicalForm == Token.NormalizedText)
+            const int32 A = static_cast<int32>(Pairs[Pair] >> 32);
+            const int32 B = static_cast<int32>(Pairs[Pair] & MAX_uint32);
+            Scores[Pair] = REFuzzy::GetSimilarity(*TermTexts[A], *TermTexts[B], EREFuzzyAlgorithm::Auto, false);
+        }, Pairs.Num() < ParallelPairThreshold);
+        
+        for (int32 Pair = 0; Pair < Pairs.Num(); Pair++)
+        {
+            if (Scores[Pair] >= SimilarityThreshold)
             {
-                Group.Tokens.Add(Token);
-                Group.Frequency++;
-                bAddedToGroup = true;
-                break;
+                const int32 RootA = FindRoot(Parents, static_cast<int32>(Pairs[Pair] >> 32));
+                const int32 RootB = FindRoot(Parents, static_cast<int32>(Pairs[Pair] & MAX_uint32));
+                if (RootA != RootB)
+                {
+                    // Earlier term stays the root so group order follows first appearance
+                    Parents[FMath::Max(RootA, RootB)] = FMath::Min(RootA, RootB);
+                }
             }
         }
-        
-        if (!bAddedToGroup)
+    }
+    
+    // 3. One group per cluster, canonical form is its most frequent term
+    TArray<int32> GroupOfTerm;
+    TArray<int32> CanonicalTerms;
+    GroupOfTerm.SetNumUninitialized(NumTerms);
+    
+    for (int32 Term = 0; Term < NumTerms; Term++)
+    {
+        const int32 Root = FindRoot(Parents, Term);
+        if (Root == Term)
+        {
+            GroupOfTerm[Term] = CanonicalTerms.Add(Term);
+        }
+        else
         {
-            FRETokenGroup NewGroup;
-            NewGroup.GroupName = Token.Text;
-            NewGroup.CanonicalForm = Token.NormalizedText;
-            NewGroup.Tokens.Add(Token);
-            NewGroup.Frequency = 1;
-            NewGroup.AverageSimilarity = 1.0f;
-            Groups.Add(NewGroup);
+            const int32 Group = GroupOfTerm[Root];
+            GroupOfTerm[Term] = Group;
+            if (TermCounts[Term] > TermCounts[CanonicalTerms[Group]])
+            {
+                CanonicalTerms[Group] = Term;
+            }
         }
     }
     
+    Groups.SetNum(CanonicalTerms.Num());
+    for (int32 i = 0; i < Tokens.Num(); i++)
+    {
+        FRETokenGroup& Group = Groups[GroupOfTerm[TermOfToken[i]]];
+        Group.Tokens.Add(Tokens[i]);
+        Group.Frequency++;
+    }
+    
+    for (int32 Group = 0; Group < Groups.Num(); Group++)
+    {
+        const int32 Canonical = CanonicalTerms[Group];
+        Groups[Group].GroupName = Tokens[TermFirstToken[Canonical]].Text;
+        Groups[Group].CanonicalForm = *TermTexts[Canonical];
+        Groups[Group].AverageSimilarity = 0.0f;
+    }
+    
+    // Token-weighted similarity of members to the canonical form
+    for (int32 Term = 0; Term < NumTerms; Term++)
+    {
+        FRETokenGroup& Group = Groups[GroupOfTerm[Term]];
+        const int32 Canonical = CanonicalTerms[GroupOfTerm[Term]];
+        const float Similarity = Term == Canonical
+            ? 1.0f
+            : REFuzzy::GetSimilarity(*TermTexts[Term], *TermTexts[Canonical], EREFuzzyAlgorithm::Auto, false);
+        Group.AverageSimilarity += Similarity * TermCounts[Term] / static_cast<float>(Group.Frequency);
+    }
+    
     return Groups;
 }
 
 TArray<FString> RETokenizer::FindCompoundWords(
     const FRETokenStream& Stream,
     const TArray<FREVocabularyEntry>& Vocabularies)
+{
+    if (Stream.Tokens.Num() < 2 || Vocabularies.Num() == 0)
+    {
+        return TArray<FString>();
+    }
+    
+    return FindCompoundWords(Stream, FREVocabularyMatcher(Vocabularies));
+}
+
+TArray<FString> RETokenizer::FindCompoundWords(
+    const FRETokenStream& Stream,
+    const FREVocabularyMatcher& Matcher)
 {
     TArray<FString> Compounds;
     
-    // Look for adjacent tokens that form known compounds
-    for (int32 i = 0; i < Stream.Tokens.Num() - 1; i++)
+    // Compounds span at least two tokens
+    TArray<FREVocabularyMatcher::FMatch> Matches;
+    Matcher.FindMatches(Stream.Tokens, 2, Matches);
+    
+    Compounds.Reserve(Matches.Num());
+    for (const FREVocabularyMatcher::FMatch& Match : Matches)
     {
-        FString Compound = Stream.Tokens[i].Text + Stream.Tokens[i + 1].Text;
-        FString CompoundWithSpace = Stream.Tokens[i].Text + TEXT(" ") + Stream.Tokens[i + 1].Text;
-        
-        // Check if compound exists in vocabulary
-        for (const FREVocabularyEntry& Entry : Vocabularies)
-        {
-            if (Entry.Term == Compound || Entry.Term == CompoundWithSpace)
-            {
-                Compounds.Add(Entry.Term);
-                break;
-            }
-        }
+        Compounds.Add(Matcher.GetTerm(Match.EntryIndex));
     }
     
     return Compounds;
@@ -742,41 +1382,81 @@ FRETokenStream RETokenizer::CalculateTokenWeights(
 {
     FRETokenStream Result = Stream;
     
-    // Calculate term frequency for this stream
-    TMap<FString, int32> TermFrequency;
-    for (const FREToken& Token : Result.Tokens)
+    if (!DocumentFrequencies)
     {
-        TermFrequency.FindOrAdd(Token.NormalizedText)++;
+        // Just use term frequency
+        ApplyTermWeights(Result, [](const FREToken&) { return 1.0f; });
+        return Result;
     }
     
-    // Calculate weights
-    int32 TotalTokens = Result.Tokens.Num();
+    ApplyTermWeights(Result, [DocumentFrequencies](const FREToken& Token)
+    {
+        // TF-IDF calculation; unknown term, give it high IDF
+        const float* IDF = DocumentFrequencies->Find(Token.NormalizedText);
+        return IDF ? *IDF : 10.0f;
+    });
     
-    for (FREToken& Token : Result.Tokens)
+    return Result;
+}
+
+FRETokenStream RETokenizer::CalculateTokenWeights(
+    const FRETokenStream& Stream,
+    const FRECorpusStatistics& Corpus)
+{
+    FRETokenStream Result = Stream;
+    const FRETokenDictionary& Dictionary = FRETokenDictionary::Get();
+    ApplyTermWeights(Result, [&Corpus, &Dictionary](const FREToken& Token)
     {
-        float TF = static_cast<float>(TermFrequency[Token.NormalizedText]) / static_cast<float>(TotalTokens);
-        
-        if (DocumentFrequencies)
-        {
-            // TF-IDF calculation
-            if (const float* IDF = DocumentFrequencies->Find(Token.NormalizedText))
-            {
-                Token.Weight = TF * (*IDF);
-            }
-            else
-            {
-                // Unknown term, give it high IDF
-                Token.Weight = TF * 10.0f;
-            }
-        }
-        else
-        {
-            // Just use term frequency
-            Token.Weight = TF;
-        }
+        // Terms the dictionary never saw are unseen by the corpus too (highest IDF)
+        return Corpus.GetIdf(Token.HasTokenId() ? Token.TokenId : Dictionary.Find(Token.NormalizedText));
+    });
+    return Result;
+}
+
+void RETokenizer::ApplyTermWeights(FRETokenStream& Stream, TFunctionRef<float(const FREToken& Token)> GetIdf)
+{
+    TArray<int32> FirstTokens;
+    const TArray<uint32> Terms = GetLocalTermIds(Stream.Tokens, FirstTokens);
+    TArray<float> Weights;
+    Weights.SetNumUninitialized(Terms.Num());
+    ComputeTermWeights(Terms, [&Stream, &FirstTokens, GetIdf](uint32 Term)
+    {
+        return GetIdf(Stream.Tokens[FirstTokens[Term]]);
+    }, Weights);
+    
+    for (int32 i = 0; i < Stream.Tokens.Num(); i++)
+    {
+        Stream.Tokens[i].Weight = Weights[i];
+    }
+}
+
+void RETokenizer::ComputeTermWeights(
+    TArrayView<const uint32> Ids,
+    TFunctionRef<float(uint32 Id)> GetIdf,
+    TArrayView<float> OutWeights)
+{
+    // Calculate term frequency for this stream
+    TMap<uint32, int32> TermFrequency;
+    TermFrequency.Reserve(Ids.Num());
+    for (uint32 Id : Ids)
+    {
+        TermFrequency.FindOrAdd(Id)++;
     }
     
-    return Result;
+    // Weigh each distinct term once
+    const float TotalTokens = static_cast<float>(Ids.Num());
+    TMap<uint32, float> TermWeights;
+    TermWeights.Reserve(TermFrequency.Num());
+    for (const TPair<uint32, int32>& Term : TermFrequency)
+    {
+        const float TF = static_cast<float>(Term.Value) / TotalTokens;
+        TermWeights.Add(Term.Key, TF * GetIdf(Term.Key));
+    }
+    
+    for (int32 i = 0; i < Ids.Num(); i++)
+    {
+        OutWeights[i] = TermWeights[Ids[i]];
+    }
 }
 
 // ========== STOP WORDS ==========
@@ -859,6 +1539,200 @@ TArray<FString> RETokenizer::GenerateWordNGrams(const TArray<FREToken>& Tokens,
     return NGrams;
 }
 
+// ========== TOKEN IDS ==========
+
+TArray<uint32> RETokenizer::TokenizeToIds(const FString& Text, const FRETokenizerConfig& Config)
+{
+    FRETokenizerConfig IdConfig = Config;
+    IdConfig.bEmitTokenIds = true;
+    IdConfig.bDeferVariants = true;
+    
+    TArray<FREToken> Tokens;
+    ERENamingConvention Convention = ERENamingConvention::Unknown;
+    TokenizeInto(Text, IdConfig, Tokens, Convention);
+    
+    TArray<uint32> Ids;
+    Ids.Reserve(Tokens.Num());
+    for (const FREToken& Token : Tokens)
+    {
+        Ids.Add(Token.TokenId);
+    }
+    return Ids;
+}
+
+TArray<uint32> RETokenizer::GetTokenIds(const TArray<FREToken>& Tokens)
+{
+    FRETokenDictionary& Dictionary = FRETokenDictionary::Get();
+    
+    TArray<uint32> Ids;
+    Ids.Reserve(Tokens.Num());
+    for (const FREToken& Token : Tokens)
+    {
+        Ids.Add(Token.HasTokenId() ? Token.TokenId : Dictionary.Intern(Token.NormalizedText));
+    }
+    return Ids;
+}
+
+TArray<uint32> RETokenizer::GetLocalTermIds(const TArray<FREToken>& Tokens, TArray<int32>& OutFirstTokens)
+{
+    // Keys view the tokens' own strings, so nothing is copied
+    TMap<FStringView, uint32, FDefaultSetAllocator, TRECaseSensitiveKeyFuncs<FStringView, uint32>> TermOfText;
+    TermOfText.Reserve(Tokens.Num());
+    OutFirstTokens.Reset();
+    
+    TArray<uint32> Terms;
+    Terms.Reserve(Tokens.Num());
+    for (int32 i = 0; i < Tokens.Num(); i++)
+    {
+        const FStringView Text = Tokens[i].NormalizedText;
+        if (const uint32* Found = TermOfText.Find(Text))
+        {
+            Terms.Add(*Found);
+        }
+        else
+        {
+            const uint32 Term = static_cast<uint32>(OutFirstTokens.Add(i));
+            TermOfText.Add(Text, Term);
+            Terms.Add(Term);
+        }
+    }
+    return Terms;
+}
+
+const TBitArray<>& RETokenizer::GetDefaultStopWordMask()
+{
+    static const TBitArray<> Mask = FRETokenDictionary::Get().MakeMask(GetDefaultStopWords());
+    return Mask;
+}
+
+TArray<uint32> RETokenizer::FilterStopWordIds(TArrayView<const uint32> Ids, const TBitArray<>& StopWordMask)
+{
+    TArray<uint32> Result;
+    Result.Reserve(Ids.Num());
+    for (uint32 Id : Ids)
+    {
+        // Ids beyond the mask were interned later and cannot be stop words
+        if (static_cast<int32>(Id) >= StopWordMask.Num() || !StopWordMask[Id])
+        {
+            Result.Add(Id);
+        }
+    }
+    return Result;
+}
+
+TArray<float> RETokenizer::CalculateTermWeights(
+    TArrayView<const uint32> Ids,
+    const TArray<float>* InverseDocumentFrequencies)
+{
+    TArray<float> Weights;
+    if (Ids.Num() == 0)
+    {
+        return Weights;
+    }
+    
+    Weights.SetNumUninitialized(Ids.Num());
+    if (InverseDocumentFrequencies)
+    {
+        // Ids outside the table are unknown terms - same high IDF as CalculateTokenWeights
+        ComputeTermWeights(Ids, [InverseDocumentFrequencies](uint32 Id)
+        {
+            return InverseDocumentFrequencies->IsValidIndex(static_cast<int32>(Id)) ? (*InverseDocumentFrequencies)[Id] : 10.0f;
+        }, Weights);
+    }
+    else
+    {
+        ComputeTermWeights(Ids, [](uint32) { return 1.0f; }, Weights);
+    }
+    
+    return Weights;
+}
+
+TArray<uint64> RETokenizer::GenerateWordNGramIds(TArrayView<const uint32> Ids, int32 N)
+{
+    TArray<uint64> NGrams;
+    
+    if (Ids.Num() < N || N <= 0)
+    {
+        return NGrams;
+    }
+    
+    NGrams.Reserve(Ids.Num() - N + 1);
+    for (int32 i = 0; i <= Ids.Num() - N; i++)
+    {
+        if (N == 1)
+        {
+            NGrams.Add(Ids[i]);
+        }
+        else if (N == 2)
+        {
+            NGrams.Add((static_cast<uint64>(Ids[i]) << 32) | Ids[i + 1]);
+        }
+        else
+        {
+            NGrams.Add(CityHash64(reinterpret_cast<const char*>(&Ids[i]), N * sizeof(uint32)));
+        }
+    }
+    
+    return NGrams;
+}
+
+// ========== PACKED STREAMS ==========
+
+FREPackedTokenStream RETokenizer::TokenizePacked(const FString& Text, const FRETokenizerConfig& Config)
+{
+    FRETokenizerConfig IdConfig = Config;
+    IdConfig.bEmitTokenIds = true;
+    
+    TArray<FREToken> Tokens;
+    FREPackedTokenStream Packed;
+    TokenizeInto(Text, IdConfig, Tokens, Packed.DetectedConvention);
+    
+    Packed.Reserve(Tokens.Num(), Text.Len());
+    for (const FREToken& Token : Tokens)
+    {
+        Packed.Add(Token);
+    }
+    Packed.OriginalText = Text;
+    
+    return Packed;
+}
+
+void RETokenizer::CalculateTokenWeights(FREPackedTokenStream& Stream, const FRECorpusStatistics* Corpus)
+{
+    if (Corpus)
+    {
+        ComputeTermWeights(Stream.Ids, [Corpus](uint32 Id) { return Corpus->GetIdf(Id); }, Stream.Weights);
+    }
+    else
+    {
+        ComputeTermWeights(Stream.Ids, [](uint32) { return 1.0f; }, Stream.Weights);
+    }
+}
+
+TArray<int32> RETokenizer::FindTokenSequence(const FREPackedTokenStream& Stream, TArrayView<const uint32> Sequence)
+{
+    TArray<int32> Starts;
+    
+    const int32 SequenceLength = Sequence.Num();
+    if (SequenceLength == 0 || SequenceLength > Stream.Num())
+    {
+        return Starts;
+    }
+    
+    const uint32* Ids = Stream.Ids.GetData();
+    const uint32 First = Sequence[0];
+    for (int32 Start = 0; Start <= Stream.Num() - SequenceLength; Start++)
+    {
+        if (Ids[Start] == First
+            && FMemory::Memcmp(Ids + Start, Sequence.GetData(), SequenceLength * sizeof(uint32)) == 0)
+        {
+            Starts.Add(Start);
+        }
+    }
+    
+    return Starts;
+}
+
 // ========== UTILITY FUNCTIONS ==========
 
 FRETokenStream RETokenizer::MergeAdjacentTokens(const FRETokenStream& Stream)
@@ -895,6 +1769,15 @@ FRETokenStream RETokenizer::MergeAdjacentTokens(const FRETokenStream& Stream)
     // Add final token
     MergedTokens.Add(CurrentMerged);
     
+    // Only id streams (bEmitTokenIds) carry ids; merged text needs its own
+    for (FREToken& Token : MergedTokens)
+    {
+        if (Token.HasTokenId())
+        {
+            Token.TokenId = FRETokenDictionary::Get().Intern(Token.NormalizedText);
+        }
+    }
+    
     Result.Tokens = MergedTokens;
     return Result;
 }
@@ -915,6 +1798,11 @@ FRETokenStream RETokenizer::SplitLongTokens(const FRETokenStream& Stream, int32
                 FREToken Chunk = Token;
                 Chunk.Text = Token.Text.Mid(i * MaxLength, MaxLength);
                 Chunk.NormalizedText = RENormalizer::ToLowercase(Chunk.Text);
+                // Only id streams (bEmitTokenIds) carry ids
+                if (Chunk.HasTokenId())
+                {
+                    Chunk.TokenId = FRETokenDictionary::Get().Intern(Chunk.NormalizedText);
+                }
                 Chunk.StartIndex = Token.StartIndex + (i * MaxLength);
                 Chunk.EndIndex = FMath::Min(Chunk.StartIndex + MaxLength, Token.EndIndex);
                 SplitTokens.Add(Chunk);
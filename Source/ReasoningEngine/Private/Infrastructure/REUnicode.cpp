@@ -0,0 +1,348 @@
+// Source/ReasoningEngine/Private/Infrastructure/REUnicode.cpp
+#include "REUnicode.h"
+#include "RETextSimd.h"
+#include "Algo/BinarySearch.h"
+#include "REUnicodeTables.inl"
+
+namespace
+{
+    // ========== HANGUL (algorithmic) ==========
+    
+    constexpr uint32 HangulSBase = 0xAC00;
+    constexpr uint32 HangulLBase = 0x1100;
+    constexpr uint32 HangulVBase = 0x1161;
+    constexpr uint32 HangulTBase = 0x11A7;
+    constexpr uint32 HangulLCount = 19;
+    constexpr uint32 HangulVCount = 21;
+    constexpr uint32 HangulTCount = 28;
+    constexpr uint32 HangulNCount = HangulVCount * HangulTCount;
+    constexpr uint32 HangulSCount = HangulLCount * HangulNCount;
+    
+    FORCEINLINE uint32 CodeOf(TCHAR Char)
+    {
+        return static_cast<uint32>(Char) & 0xFFFF;
+    }
+    
+    FORCEINLINE bool IsHangulSyllable(uint32 Code)
+    {
+        return Code - HangulSBase < HangulSCount;
+    }
+    
+    /** Vowel and trailing jamo may merge into a preceding syllable */
+    FORCEINLINE bool IsHangulComposingJamo(uint32 Code)
+    {
+        return Code - HangulVBase < HangulVCount || Code - (HangulTBase + 1) < HangulTCount - 1;
+    }
+    
+    FORCEINLINE bool IsComposedForm(EREUnicodeNormalizationForm Form)
+    {
+        return Form == EREUnicodeNormalizationForm::NFC || Form == EREUnicodeNormalizationForm::NFKC;
+    }
+    
+    FORCEINLINE bool IsCompatibilityForm(EREUnicodeNormalizationForm Form)
+    {
+        return Form == EREUnicodeNormalizationForm::NFKC || Form == EREUnicodeNormalizationForm::NFKD;
+    }
+    
+    using FCodeBuffer = TArray<TCHAR, TInlineAllocator<256>>;
+    
+    // ========== DECOMPOSITION ==========
+    
+    void Decompose(FStringView Text, bool bCompatibility, FCodeBuffer& Out)
+    {
+        Out.Reserve(Text.Len() + Text.Len() / 2);
+        
+        for (TCHAR Char : Text)
+        {
+            const uint32 Code = CodeOf(Char);
+            
+            if (Code < 0x80)
+            {
+                Out.Add(Char);
+                continue;
+            }
+            
+            if (IsHangulSyllable(Code))
+            {
+                const uint32 SIndex = Code - HangulSBase;
+                Out.Add(static_cast<TCHAR>(HangulLBase + SIndex / HangulNCount));
+                Out.Add(static_cast<TCHAR>(HangulVBase + (SIndex % HangulNCount) / HangulTCount));
+                if (SIndex % HangulTCount != 0)
+                {
+                    Out.Add(static_cast<TCHAR>(HangulTBase + SIndex % HangulTCount));
+                }
+                continue;
+            }
+            
+            const REUnicode::FCharRecord& Record = REUnicode::GetRecord(Char);
+            const uint16 Offset = bCompatibility ? Record.CompatOffset : Record.CanonicalOffset;
+            const uint8 Len = bCompatibility ? Record.CompatLen : Record.CanonicalLen;
+            
+            if (Len == 0)
+            {
+                Out.Add(Char);
+                continue;
+            }
+            
+            for (int32 Index = 0; Index < Len; ++Index)
+            {
+                Out.Add(static_cast<TCHAR>(REUnicodeTables::DecompositionPool[Offset + Index]));
+            }
+        }
+    }
+    
+    /** Stable sort each run of non-starters by combining class */
+    void CanonicalOrder(FCodeBuffer& Buffer)
+    {
+        const int32 Num = Buffer.Num();
+        for (int32 Index = 1; Index < Num; ++Index)
+        {
+            const TCHAR Char = Buffer[Index];
+            const uint8 Class = REUnicode::GetRecord(Char).CombiningClass;
+            if (Class == 0)
+            {
+                continue;
+            }
+            
+            int32 Insert = Index;
+            while (Insert > 0)
+            {
+                const uint8 PrevClass = REUnicode::GetRecord(Buffer[Insert - 1]).CombiningClass;
+                if (PrevClass <= Class)
+                {
+                    break;
+                }
+                Buffer[Insert] = Buffer[Insert - 1];
+                --Insert;
+            }
+            Buffer[Insert] = Char;
+        }
+    }
+    
+    // ========== COMPOSITION ==========
+    
+    /** @return Primary composite of a pair, or 0 if none */
+    uint32 ComposePair(uint32 First, uint32 Second)
+    {
+        // Hangul LV and LVT
+        if (First - HangulLBase < HangulLCount && Second - HangulVBase < HangulVCount)
+        {
+            return HangulSBase + ((First - HangulLBase) * HangulVCount + (Second - HangulVBase)) * HangulTCount;
+        }
+        if (IsHangulSyllable(First) && (First - HangulSBase) % HangulTCount == 0 && Second - (HangulTBase + 1) < HangulTCount - 1)
+        {
+            return First + (Second - HangulTBase);
+        }
+        
+        const uint32 Key = (First << 16) | Second;
+        const int32 Index = Algo::LowerBound(TArrayView<const uint32>(REUnicodeTables::CompositionKeys), Key);
+        if (Index < REUnicodeTables::NumCompositions && REUnicodeTables::CompositionKeys[Index] == Key)
+        {
+            return REUnicodeTables::CompositionValues[Index];
+        }
+        return 0;
+    }
+    
+    /** Canonical composition in place (UAX #15) */
+    void Compose(FCodeBuffer& Buffer)
+    {
+        const int32 Num = Buffer.Num();
+        if (Num < 2)
+        {
+            return;
+        }
+        
+        int32 StarterPos = 0;
+        uint32 Starter = CodeOf(Buffer[0]);
+        int32 LastClass = REUnicode::GetRecord(Buffer[0]).CombiningClass;
+        if (LastClass != 0)
+        {
+            // Leading non-starters block every composition until the first starter
+            LastClass = 256;
+        }
+        
+        int32 Write = 1;
+        for (int32 Read = 1; Read < Num; ++Read)
+        {
+            const TCHAR Char = Buffer[Read];
+            const int32 Class = REUnicode::GetRecord(Char).CombiningClass;
+            const uint32 Composite = ComposePair(Starter, CodeOf(Char));
+            
+            if (Composite != 0 && (LastClass < Class || LastClass == 0))
+            {
+                Buffer[StarterPos] = static_cast<TCHAR>(Composite);
+                Starter = Composite;
+                continue;
+            }
+            
+            if (Class == 0)
+            {
+                StarterPos = Write;
+                Starter = CodeOf(Char);
+            }
+            LastClass = Class;
+            Buffer[Write++] = Char;
+        }
+        
+        Buffer.SetNum(Write, EAllowShrinking::No);
+    }
+}
+
+// ========== LOOKUP ==========
+
+const REUnicode::FCharRecord& REUnicode::GetRecord(TCHAR Char)
+{
+    const uint32 Code = CodeOf(Char);
+    const uint32 Block = REUnicodeTables::Stage1[Code >> REUnicodeTables::BlockBits];
+    return REUnicodeTables::Records[REUnicodeTables::Stage2[(Block << REUnicodeTables::BlockBits) | (Code & 0xFF)]];
+}
+
+// ========== NORMALIZATION ==========
+
+REUnicode::EQuickCheckResult REUnicode::QuickCheck(FStringView Text, EREUnicodeNormalizationForm Form)
+{
+    // ASCII is invariant under every normalization form
+    if (RETextSimd::IsAscii(Text.GetData(), Text.Len()))
+    {
+        return EQuickCheckResult::Yes;
+    }
+    
+    uint8 NoMask = QC_NFC_No;
+    uint8 MaybeMask = QC_NFC_Maybe;
+    switch (Form)
+    {
+    case EREUnicodeNormalizationForm::NFD:  NoMask = QC_NFD_No;  MaybeMask = 0; break;
+    case EREUnicodeNormalizationForm::NFKC: NoMask = QC_NFKC_No; MaybeMask = QC_NFKC_Maybe; break;
+    case EREUnicodeNormalizationForm::NFKD: NoMask = QC_NFKD_No; MaybeMask = 0; break;
+    default: break;
+    }
+    
+    const bool bComposed = IsComposedForm(Form);
+    EQuickCheckResult Result = EQuickCheckResult::Yes;
+    uint8 LastClass = 0;
+    
+    for (TCHAR Char : Text)
+    {
+        const uint32 Code = CodeOf(Char);
+        if (Code < 0x80)
+        {
+            LastClass = 0;
+            continue;
+        }
+        
+        if (IsHangulSyllable(Code))
+        {
+            if (!bComposed)
+            {
+                return EQuickCheckResult::No;
+            }
+            LastClass = 0;
+            continue;
+        }
+        
+        if (bComposed && IsHangulComposingJamo(Code))
+        {
+            Result = EQuickCheckResult::Maybe;
+        }
+        
+        const FCharRecord& Record = GetRecord(Char);
+        if (Record.CombiningClass != 0 && LastClass > Record.CombiningClass)
+        {
+            return EQuickCheckResult::No;
+        }
+        if (Record.QuickCheck & NoMask)
+        {
+            return EQuickCheckResult::No;
+        }
+        if (Record.QuickCheck & MaybeMask)
+        {
+            Result = EQuickCheckResult::Maybe;
+        }
+        LastClass = Record.CombiningClass;
+    }
+    
+    return Result;
+}
+
+bool REUnicode::IsNormalized(FStringView Text, EREUnicodeNormalizationForm Form)
+{
+    switch (QuickCheck(Text, Form))
+    {
+    case EQuickCheckResult::Yes:
+        return true;
+    case EQuickCheckResult::No:
+        return false;
+    default:
+        return Normalize(Text, Form).Equals(Text, ESearchCase::CaseSensitive);
+    }
+}
+
+FString REUnicode::Normalize(FStringView Text, EREUnicodeNormalizationForm Form)
+{
+    if (QuickCheck(Text, Form) == EQuickCheckResult::Yes)
+    {
+        return FString(Text);
+    }
+    
+    FCodeBuffer Buffer;
+    Decompose(Text, IsCompatibilityForm(Form), Buffer);
+    CanonicalOrder(Buffer);
+    
+    if (IsComposedForm(Form))
+    {
+        Compose(Buffer);
+    }
+    
+    return FString(Buffer.Num(), Buffer.GetData());
+}
+
+// ========== CASE FOLDING AND ACCENTS ==========
+
+FString REUnicode::CaseFold(FStringView Text)
+{
+    FString Result;
+    const int32 Len = Text.Len();
+    if (Len == 0)
+    {
+        return Result;
+    }
+    
+    if (RETextSimd::IsAscii(Text.GetData(), Len))
+    {
+        // Simple and full folding agree on ASCII
+        auto& Chars = Result.GetCharArray();
+        Chars.SetNumUninitialized(Len + 1);
+        RETextSimd::ToLower(Text.GetData(), Chars.GetData(), Len);
+        Chars[Len] = TEXT('\0');
+        return Result;
+    }
+    
+    Result.Reserve(Len + Len / 8);
+    for (TCHAR Char : Text)
+    {
+        const FCharRecord& Record = GetRecord(Char);
+        if (Record.FoldLen == 0)
+        {
+            Result.AppendChar(Char);
+            continue;
+        }
+        
+        for (int32 Index = 0; Index < Record.FoldLen; ++Index)
+        {
+            Result.AppendChar(static_cast<TCHAR>(REUnicodeTables::FoldPool[Record.FoldOffset + Index]));
+        }
+    }
+    
+    return Result;
+}
+
+TCHAR REUnicode::StripAccent(TCHAR Char)
+{
+    if (CodeOf(Char) < 0x80)
+    {
+        return Char;
+    }
+    
+    const uint16 Base = GetRecord(Char).AccentBase;
+    return Base != 0 ? static_cast<TCHAR>(Base) : Char;
+}
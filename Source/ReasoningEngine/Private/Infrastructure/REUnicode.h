@@ -0,0 +1,101 @@
+// Source/ReasoningEngine/Private/Infrastructure/REUnicode.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Infrastructure/Data/REInfrastructureTypes.h"
+
+/**
+ * Table-driven Unicode normalization, case folding and accent stripping
+ * Internal to the module - RENormalizer exposes the public entry points
+ *
+ * Design Philosophy:
+ * - Data is generated at build time by Tools/GenerateUnicodeTables.py
+ *   into REUnicodeTables.inl as constexpr two-stage lookup tables
+ * - One lookup per code unit yields every property (decomposition,
+ *   combining class, case fold, accent base, quick-check flags)
+ * - Quick-check lets already-normalized text through without copying
+ *
+ * Coverage:
+ * - Basic Multilingual Plane; surrogate pairs pass through unchanged
+ * - Hangul syllables are decomposed and composed algorithmically
+ */
+namespace REUnicode
+{
+    /** Per-character properties stored in the generated tables */
+    struct FCharRecord
+    {
+        uint16 CanonicalOffset;     // Full canonical decomposition in DecompositionPool
+        uint16 CompatOffset;        // Full compatibility decomposition in DecompositionPool
+        uint8 CanonicalLen;         // 0 = no canonical decomposition
+        uint8 CompatLen;            // 0 = no compatibility decomposition
+        uint16 FoldOffset;          // Full case folding in FoldPool
+        uint8 FoldLen;              // 0 = folds to itself
+        uint8 CombiningClass;       // Canonical combining class (0 = starter)
+        uint8 QuickCheck;           // EQuickCheckBits
+        uint16 AccentBase;          // Base letter with diacritics removed (0 = none)
+    };
+    
+    /** Per-character quick-check flags */
+    enum EQuickCheckBits : uint8
+    {
+        QC_NFD_No     = 0x01,
+        QC_NFKD_No    = 0x02,
+        QC_NFC_No     = 0x04,
+        QC_NFC_Maybe  = 0x08,
+        QC_NFKC_No    = 0x10,
+        QC_NFKC_Maybe = 0x20
+    };
+    
+    /** Result of a normalization quick-check */
+    enum class EQuickCheckResult : uint8
+    {
+        Yes,    // Text is already in the requested form
+        No,     // Text is definitely not in the requested form
+        Maybe   // Composition context decides - run the full algorithm
+    };
+    
+    /**
+     * Look up the properties of a UTF-16 code unit
+     * @param Char - Code unit
+     * @return Property record (all-zero for unassigned code units)
+     */
+    const FCharRecord& GetRecord(TCHAR Char);
+    
+    /**
+     * Check whether text is already in a normalization form without allocating
+     * @param Text - Text to check
+     * @param Form - Normalization form
+     * @return Yes/No, or Maybe when composition context must be examined
+     */
+    EQuickCheckResult QuickCheck(FStringView Text, EREUnicodeNormalizationForm Form);
+    
+    /**
+     * Check whether text is in a normalization form (resolves Maybe)
+     * @param Text - Text to check
+     * @param Form - Normalization form
+     * @return true if normalizing would not change the text
+     */
+    bool IsNormalized(FStringView Text, EREUnicodeNormalizationForm Form);
+    
+    /**
+     * Convert text to a normalization form
+     * @param Text - Text to normalize
+     * @param Form - NFC, NFD, NFKC or NFKD
+     * @return Normalized text
+     */
+    FString Normalize(FStringView Text, EREUnicodeNormalizationForm Form);
+    
+    /**
+     * Apply full Unicode case folding (e.g. "Straße" -> "strasse")
+     * @param Text - Text to fold
+     * @return Case-folded text
+     */
+    FString CaseFold(FStringView Text);
+    
+    /**
+     * Map a character to its base letter with diacritics removed
+     * @param Char - Character
+     * @return Base letter, or Char if it has no accent
+     */
+    TCHAR StripAccent(TCHAR Char);
+}
@@ -0,0 +1,5473 @@
+// Source/ReasoningEngine/Private/Infrastructure/REUnicodeTables.inl
+// GENERATED by Tools/GenerateUnicodeTables.py from Unicode 14.0.0 - do not edit
+#pragma once
+
+namespace REUnicodeTables
+{
+    inline constexpr int32 BlockBits = 8;
+    inline constexpr int32 NumBlocks = 55;
+    inline constexpr int32 NumRecords = 3915;
+    inline constexpr int32 NumCompositions = 928;
+
+    /** High byte of a code unit -> block in Stage2 */
+    inline constexpr uint8 Stage1[256] = {
+          0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+         16,  17,  17,  18,  17,  17,  17,  19,  20,  21,  22,  23,  24,  25,  26,  27,
+         28,  29,  30,  31,  32,  17,  17,  17,  17,  17,  33,  17,  34,  35,  36,  37,
+         38,  39,  40,  41,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+         17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+         17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+         17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+         17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+         17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+         17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+         17,  17,  17,  17,  17,  17,  42,  43,  44,  45,  46,  47,  17,  17,  17,  17,
+         17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+         17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+         17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+         17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+         17,  17,  17,  17,  17,  17,  17,  17,  17,  48,  49,  50,  51,  52,  53,  54,
+    };
+
+    /** Block * 256 + low byte -> index into Records */
+    inline constexpr uint16 Stage2[14080] = {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+        16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        27, 0, 0, 0, 0, 0, 0, 0, 28, 0, 29, 0, 0, 0, 0, 30,
+        0, 0, 31, 32, 33, 34, 0, 0, 35, 36, 37, 0, 38, 39, 40, 0,
+        41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56,
+        57, 58, 59, 60, 61, 62, 63, 0, 64, 65, 66, 67, 68, 69, 70, 71,
+        72, 73, 74, 75, 76, 77, 0, 78, 79, 80, 81, 82, 83, 84, 85, 86,
+        0, 87, 88, 89, 90, 91, 92, 0, 93, 94, 95, 96, 97, 98, 0, 99,
+        100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115,
+        116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131,
+        132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147,
+        148, 0, 149, 150, 151, 152, 153, 154, 0, 155, 156, 157, 158, 159, 160, 161,
+        162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 0, 173, 174, 175, 176,
+        177, 178, 179, 0, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+        192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+        208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223,
+        224, 225, 226, 0, 227, 0, 228, 229, 0, 230, 231, 232, 0, 0, 233, 234,
+        235, 236, 0, 237, 238, 0, 239, 240, 241, 0, 0, 0, 242, 243, 0, 244,
+        245, 246, 247, 0, 248, 0, 249, 250, 0, 251, 0, 0, 252, 0, 253, 254,
+        255, 256, 257, 258, 0, 259, 0, 260, 261, 0, 0, 0, 262, 0, 0, 0,
+        0, 0, 0, 0, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274,
+        275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 0, 288, 289,
+        290, 291, 292, 293, 294, 0, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304,
+        305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320,
+        321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336,
+        337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 0, 350, 351,
+        352, 0, 353, 0, 354, 0, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364,
+        365, 366, 367, 368, 0, 0, 0, 0, 0, 0, 369, 370, 0, 371, 372, 0,
+        0, 373, 0, 374, 375, 376, 377, 0, 378, 0, 379, 0, 380, 0, 381, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 382, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        383, 384, 385, 386, 387, 388, 389, 390, 391, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 392, 393, 394, 395, 396, 397, 0, 0,
+        398, 399, 400, 401, 402, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        403, 403, 403, 403, 403, 404, 403, 403, 403, 403, 403, 403, 403, 404, 404, 403,
+        404, 403, 404, 403, 403, 405, 406, 406, 406, 406, 405, 407, 406, 406, 406, 406,
+        406, 408, 408, 409, 409, 409, 409, 410, 410, 406, 406, 406, 406, 409, 409, 406,
+        409, 409, 406, 406, 411, 411, 411, 411, 412, 406, 406, 406, 406, 404, 404, 404,
+        413, 414, 403, 415, 416, 417, 404, 406, 406, 406, 404, 404, 404, 406, 406, 0,
+        404, 404, 404, 406, 406, 406, 406, 404, 405, 406, 406, 404, 418, 419, 419, 418,
+        419, 419, 418, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404,
+        420, 0, 421, 0, 422, 0, 423, 0, 0, 0, 424, 0, 0, 0, 425, 426,
+        0, 0, 0, 0, 33, 427, 428, 429, 430, 431, 432, 0, 433, 0, 434, 435,
+        436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449, 450, 451,
+        452, 453, 0, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465, 466,
+        467, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 454, 0, 0, 0, 0, 0, 0, 0, 468, 469, 470, 471, 472, 473,
+        474, 475, 476, 477, 478, 479, 480, 0, 481, 0, 482, 0, 483, 0, 484, 0,
+        485, 0, 486, 0, 487, 0, 488, 0, 489, 0, 490, 0, 491, 0, 492, 0,
+        493, 494, 495, 0, 496, 497, 0, 498, 0, 499, 500, 0, 0, 501, 502, 503,
+        504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515, 516, 517, 518, 519,
+        520, 521, 522, 523, 524, 525, 526, 527, 528, 529, 530, 531, 532, 533, 534, 535,
+        536, 537, 538, 539, 540, 541, 542, 543, 544, 545, 546, 547, 548, 549, 550, 551,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 552, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        553, 554, 0, 555, 0, 0, 0, 556, 0, 0, 0, 0, 557, 558, 559, 0,
+        560, 0, 561, 0, 562, 0, 563, 0, 564, 0, 565, 0, 566, 0, 567, 0,
+        568, 0, 569, 0, 570, 0, 571, 572, 573, 0, 574, 0, 575, 0, 576, 0,
+        577, 0, 0, 404, 404, 404, 404, 404, 0, 0, 578, 0, 579, 0, 580, 0,
+        581, 0, 582, 0, 583, 0, 584, 0, 585, 0, 586, 0, 587, 0, 588, 0,
+        589, 0, 590, 0, 591, 0, 592, 0, 593, 0, 594, 0, 595, 0, 596, 0,
+        597, 0, 598, 0, 599, 0, 600, 0, 601, 0, 602, 0, 603, 0, 604, 0,
+        605, 606, 607, 608, 0, 609, 0, 610, 0, 611, 0, 612, 0, 613, 0, 0,
+        614, 615, 616, 617, 618, 0, 619, 620, 621, 0, 622, 623, 624, 625, 626, 627,
+        628, 0, 629, 630, 631, 632, 633, 634, 635, 0, 636, 637, 638, 639, 640, 641,
+        642, 643, 644, 645, 646, 647, 648, 0, 649, 650, 651, 0, 652, 0, 653, 0,
+        654, 0, 655, 0, 656, 0, 657, 0, 658, 0, 659, 0, 660, 0, 661, 0,
+        662, 0, 663, 0, 664, 0, 665, 0, 666, 0, 667, 0, 668, 0, 669, 0,
+        670, 0, 671, 0, 672, 0, 673, 0, 674, 0, 675, 0, 676, 0, 677, 0,
+        0, 678, 679, 680, 681, 682, 683, 684, 685, 686, 687, 688, 689, 690, 691, 692,
+        693, 694, 695, 696, 697, 698, 699, 700, 701, 702, 703, 704, 705, 706, 707, 708,
+        709, 710, 711, 712, 713, 714, 715, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 716, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 406, 404, 404, 404, 404, 406, 404, 404, 404, 717, 406, 404, 404, 404, 404,
+        404, 404, 406, 406, 406, 406, 406, 406, 404, 404, 406, 404, 404, 717, 718, 404,
+        719, 720, 721, 722, 723, 724, 725, 726, 727, 728, 728, 729, 730, 731, 0, 732,
+        0, 733, 734, 0, 404, 406, 0, 727, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        404, 404, 404, 404, 404, 404, 404, 404, 735, 736, 737, 0, 0, 0, 0, 0,
+        0, 0, 738, 739, 740, 741, 742, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 743, 744, 745, 735, 736,
+        737, 746, 747, 403, 403, 409, 406, 404, 404, 404, 404, 404, 406, 404, 404, 406,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        748, 0, 0, 0, 0, 749, 750, 751, 752, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        753, 0, 754, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 755, 0, 0, 404, 404, 404, 404, 404, 404, 404, 0, 0, 404,
+        404, 404, 404, 406, 404, 0, 0, 404, 404, 0, 406, 404, 404, 406, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 756, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        404, 406, 404, 404, 406, 404, 404, 406, 406, 406, 404, 406, 406, 404, 406, 404,
+        404, 404, 406, 404, 406, 404, 406, 404, 406, 404, 404, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 404, 404, 404, 404, 404,
+        404, 404, 406, 404, 0, 0, 0, 0, 0, 0, 0, 0, 0, 406, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 404, 404, 404, 404, 0, 404, 404, 404, 404, 404,
+        404, 404, 404, 404, 0, 404, 404, 404, 0, 404, 404, 404, 404, 404, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 406, 406, 406, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 404, 406, 406, 406, 404, 404, 404, 404,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 404, 404, 404, 404, 404, 406,
+        406, 406, 406, 406, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404,
+        404, 404, 0, 406, 404, 404, 406, 404, 404, 406, 404, 404, 404, 406, 406, 406,
+        743, 744, 745, 404, 404, 404, 406, 404, 404, 406, 406, 404, 404, 404, 404, 404,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 757, 0, 0, 0, 0, 0, 0,
+        0, 758, 0, 0, 759, 0, 0, 0, 0, 0, 0, 0, 760, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 761, 0, 0,
+        0, 404, 406, 404, 404, 0, 0, 0, 762, 763, 764, 765, 766, 767, 768, 769,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 770, 0, 771, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 772, 773, 761, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 771, 0, 0, 0, 0, 774, 775, 0, 776,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 404, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 777, 0, 0, 778, 0, 0, 0, 0, 0, 770, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 761, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 779, 780, 781, 0, 0, 782, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 770, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 761, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 770, 0, 771, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 783, 0, 0, 784, 785, 761, 0, 0,
+        0, 0, 0, 0, 0, 0, 771, 771, 0, 0, 0, 0, 786, 787, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 788, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 771, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 789, 790, 791, 761, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 771, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 770, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 792, 0, 0, 0, 0, 761, 0, 0,
+        0, 0, 0, 0, 0, 793, 794, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 770, 0, 0, 0,
+        795, 0, 771, 0, 0, 0, 0, 796, 797, 0, 798, 799, 0, 761, 0, 0,
+        0, 0, 0, 0, 0, 771, 771, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 761, 761, 0, 771, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 800, 801, 802, 761, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 771, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 803, 0, 0, 0, 0, 771,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 804, 0, 805, 806, 807, 771,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 808, 0, 0, 0, 0, 809, 809, 761, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 810, 810, 810, 810, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 811, 0, 0, 0, 0, 812, 812, 761, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 813, 813, 813, 813, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 814, 815, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 816, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 406, 406, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 406, 0, 406, 0, 817, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 818, 0, 0, 0, 0, 0, 0, 0, 0, 0, 819, 0, 0,
+        0, 0, 820, 0, 0, 0, 0, 821, 0, 0, 0, 0, 822, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 823, 0, 0, 0, 0, 0, 0,
+        0, 824, 825, 826, 827, 828, 829, 830, 831, 832, 825, 825, 825, 825, 0, 0,
+        825, 833, 404, 404, 761, 0, 404, 404, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 834, 0, 0, 0, 0, 0, 0, 0, 0, 0, 835, 0, 0,
+        0, 0, 836, 0, 0, 0, 0, 837, 0, 0, 0, 0, 838, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 839, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 406, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 840, 0, 0, 0, 0, 0, 0, 0, 771, 0,
+        0, 0, 0, 0, 0, 0, 0, 770, 0, 761, 761, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 406, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        841, 842, 843, 844, 845, 846, 847, 848, 849, 850, 851, 852, 853, 854, 855, 856,
+        857, 858, 859, 860, 861, 862, 863, 864, 865, 866, 867, 868, 869, 870, 871, 872,
+        873, 874, 875, 876, 877, 878, 0, 879, 0, 0, 0, 0, 0, 880, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 881, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 404, 404, 404,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 882, 883, 884, 885, 886, 887, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 761, 761, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 761, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 761, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 404, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 718, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 717, 404, 406, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 404, 406, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        761, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 404, 404, 404, 404, 404, 404, 404, 404, 0, 0, 406,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        404, 404, 404, 404, 404, 406, 406, 406, 406, 406, 406, 404, 404, 406, 0, 406,
+        406, 404, 404, 406, 406, 404, 404, 404, 404, 404, 406, 404, 404, 404, 404, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 888, 0, 889, 0, 890, 0, 891, 0, 892, 0,
+        0, 0, 893, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 770, 771, 0, 0, 0, 0, 0, 894, 0, 895, 0, 0,
+        896, 897, 0, 898, 761, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 404, 406, 404, 404, 404,
+        404, 404, 404, 404, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 761, 761, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 770, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 761, 761, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 770, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        522, 524, 534, 537, 538, 538, 546, 561, 899, 0, 0, 0, 0, 0, 0, 0,
+        900, 901, 902, 903, 904, 905, 906, 907, 908, 909, 910, 911, 912, 913, 914, 915,
+        916, 917, 918, 919, 920, 921, 922, 923, 924, 925, 926, 927, 928, 929, 930, 931,
+        932, 933, 934, 935, 936, 937, 938, 939, 940, 941, 942, 0, 0, 943, 944, 945,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        404, 404, 404, 0, 411, 406, 406, 406, 406, 406, 404, 404, 406, 406, 406, 406,
+        404, 0, 411, 411, 411, 411, 411, 411, 411, 0, 0, 0, 0, 406, 0, 0,
+        0, 0, 0, 0, 404, 0, 0, 0, 404, 404, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 946, 947, 948, 0,
+        949, 950, 951, 952, 953, 954, 955, 956, 957, 958, 959, 0, 960, 961, 962, 963,
+        964, 965, 966, 29, 967, 968, 969, 970, 971, 972, 973, 974, 975, 976, 0, 977,
+        978, 979, 37, 980, 981, 982, 983, 984, 985, 986, 987, 988, 989, 990, 991, 992,
+        993, 994, 995, 386, 985, 988, 990, 991, 996, 993, 994, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 997, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 998, 999, 1000, 1001, 975,
+        1002, 1003, 1004, 1005, 1006, 1007, 1008, 1009, 1010, 1011, 1012, 1013, 1014, 1015, 1016, 1017,
+        1018, 1019, 1020, 1021, 1022, 1023, 1024, 1025, 1026, 1027, 1028, 1029, 1030, 1031, 1032, 1033,
+        404, 404, 406, 404, 404, 404, 404, 404, 404, 404, 406, 404, 404, 419, 1034, 406,
+        408, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404,
+        404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404,
+        404, 404, 404, 404, 404, 404, 405, 718, 718, 406, 1035, 404, 418, 406, 404, 406,
+        1036, 1037, 1038, 1039, 1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047, 1048, 1049, 1050, 1051,
+        1052, 1053, 1054, 1055, 1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064, 1065, 1066, 1067,
+        1068, 1069, 1070, 1071, 1072, 1073, 1074, 1075, 1076, 1077, 1078, 1079, 1080, 1081, 1082, 1083,
+        1084, 1085, 1086, 1087, 1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096, 1097, 1098, 1099,
+        1100, 1101, 1102, 1103, 1104, 1105, 1106, 1107, 1108, 1109, 1110, 1111, 1112, 1113, 1114, 1115,
+        1116, 1117, 1118, 1119, 1120, 1121, 1122, 1123, 1124, 1125, 1126, 1127, 1128, 1129, 1130, 1131,
+        1132, 1133, 1134, 1135, 1136, 1137, 1138, 1139, 1140, 1141, 1142, 1143, 1144, 1145, 1146, 1147,
+        1148, 1149, 1150, 1151, 1152, 1153, 1154, 1155, 1156, 1157, 1158, 1159, 1160, 1161, 1162, 1163,
+        1164, 1165, 1166, 1167, 1168, 1169, 1170, 1171, 1172, 1173, 1174, 1175, 1176, 1177, 1178, 1179,
+        1180, 1181, 1182, 1183, 1184, 1185, 1186, 1187, 1188, 1189, 1190, 1191, 0, 0, 71, 0,
+        1192, 1193, 1194, 1195, 1196, 1197, 1198, 1199, 1200, 1201, 1202, 1203, 1204, 1205, 1206, 1207,
+        1208, 1209, 1210, 1211, 1212, 1213, 1214, 1215, 1216, 1217, 1218, 1219, 1220, 1221, 1222, 1223,
+        1224, 1225, 1226, 1227, 1228, 1229, 1230, 1231, 1232, 1233, 1234, 1235, 1236, 1237, 1238, 1239,
+        1240, 1241, 1242, 1243, 1244, 1245, 1246, 1247, 1248, 1249, 1250, 1251, 1252, 1253, 1254, 1255,
+        1256, 1257, 1258, 1259, 1260, 1261, 1262, 1263, 1264, 1265, 1266, 1267, 1268, 1269, 1270, 1271,
+        1272, 1273, 1274, 1275, 1276, 1277, 1278, 1279, 1280, 1281, 1282, 0, 1283, 0, 1284, 0,
+        1285, 1286, 1287, 1288, 1289, 1290, 1291, 1292, 1293, 1294, 1295, 1296, 1297, 1298, 1299, 1300,
+        1301, 1302, 1303, 1304, 1305, 1306, 0, 0, 1307, 1308, 1309, 1310, 1311, 1312, 0, 0,
+        1313, 1314, 1315, 1316, 1317, 1318, 1319, 1320, 1321, 1322, 1323, 1324, 1325, 1326, 1327, 1328,
+        1329, 1330, 1331, 1332, 1333, 1334, 1335, 1336, 1337, 1338, 1339, 1340, 1341, 1342, 1343, 1344,
+        1345, 1346, 1347, 1348, 1349, 1350, 0, 0, 1351, 1352, 1353, 1354, 1355, 1356, 0, 0,
+        1357, 1358, 1359, 1360, 1361, 1362, 1363, 1364, 0, 1365, 0, 1366, 0, 1367, 0, 1368,
+        1369, 1370, 1371, 1372, 1373, 1374, 1375, 1376, 1377, 1378, 1379, 1380, 1381, 1382, 1383, 1384,
+        1385, 1386, 1387, 1388, 1389, 1390, 1391, 1392, 1393, 1394, 1395, 1396, 1397, 1398, 0, 0,
+        1399, 1400, 1401, 1402, 1403, 1404, 1405, 1406, 1407, 1408, 1409, 1410, 1411, 1412, 1413, 1414,
+        1415, 1416, 1417, 1418, 1419, 1420, 1421, 1422, 1423, 1424, 1425, 1426, 1427, 1428, 1429, 1430,
+        1431, 1432, 1433, 1434, 1435, 1436, 1437, 1438, 1439, 1440, 1441, 1442, 1443, 1444, 1445, 1446,
+        1447, 1448, 1449, 1450, 1451, 0, 1452, 1453, 1454, 1455, 1456, 1457, 1458, 1459, 1460, 1459,
+        1461, 1462, 1463, 1464, 1465, 0, 1466, 1467, 1468, 1469, 1470, 1471, 1472, 1473, 1474, 1475,
+        1476, 1477, 1478, 1479, 0, 0, 1480, 1481, 1482, 1483, 1484, 1485, 0, 1486, 1487, 1488,
+        1489, 1490, 1491, 1492, 1493, 1494, 1495, 1496, 1497, 1498, 1499, 1500, 1501, 1502, 1503, 1504,
+        0, 0, 1505, 1506, 1507, 0, 1508, 1509, 1510, 1511, 1512, 1513, 1514, 1515, 1516, 0,
+        1517, 1518, 27, 27, 27, 27, 27, 27, 27, 27, 27, 0, 0, 0, 0, 0,
+        0, 1519, 0, 0, 0, 0, 0, 1520, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 1521, 1522, 1523, 0, 0, 0, 0, 0, 0, 0, 0, 27,
+        0, 0, 0, 1524, 1525, 0, 1526, 1527, 0, 0, 0, 0, 1528, 0, 1529, 0,
+        0, 0, 0, 0, 0, 0, 0, 1530, 1531, 1532, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 1533, 0, 0, 0, 0, 0, 0, 0, 27,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1534, 995, 0, 0, 1535, 1536, 1537, 1538, 1539, 1540, 1541, 1542, 1543, 1544, 1545, 1546,
+        1534, 36, 31, 32, 1535, 1536, 1537, 1538, 1539, 1540, 1541, 1542, 1543, 1544, 1545, 0,
+        29, 972, 37, 401, 973, 383, 977, 399, 978, 1546, 983, 400, 984, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 1547, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        404, 404, 411, 411, 404, 404, 404, 404, 411, 411, 411, 404, 404, 0, 0, 0,
+        0, 404, 0, 0, 0, 411, 411, 404, 406, 404, 411, 411, 406, 406, 406, 406,
+        404, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1548, 1549, 1550, 1551, 0, 1552, 1553, 1554, 0, 1555, 976, 953, 953, 953, 383, 1556,
+        954, 954, 957, 399, 0, 959, 1557, 0, 0, 962, 1558, 963, 963, 963, 0, 0,
+        1559, 1560, 1561, 0, 1562, 0, 1563, 0, 1562, 0, 1564, 1565, 948, 1550, 0, 972,
+        950, 1566, 1567, 958, 37, 1568, 1569, 1570, 1571, 995, 0, 1572, 1573, 991, 1574, 1575,
+        1576, 0, 0, 0, 0, 949, 971, 972, 995, 385, 0, 0, 0, 0, 0, 0,
+        1577, 1578, 1579, 1580, 1581, 1582, 1583, 1584, 1585, 1586, 1587, 1588, 1589, 1590, 1591, 1592,
+        1593, 1594, 1595, 1596, 1597, 1598, 1599, 1600, 1601, 1602, 1603, 1604, 1605, 1606, 1607, 1608,
+        995, 1609, 1610, 1611, 988, 1612, 1613, 1614, 1615, 401, 1616, 1617, 399, 999, 971, 978,
+        0, 0, 0, 1618, 0, 0, 0, 0, 0, 1619, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1620, 1621, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1622, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1623, 1624, 1625,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 1626, 0, 0, 0, 0, 1627, 0, 0, 1628, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 1629, 0, 1630, 0, 0, 0, 0, 0, 1631, 1632, 0, 1633,
+        1634, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 1635, 0, 0, 1636, 0, 0, 1637, 0, 1638, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1639, 0, 1640, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1641, 1642, 1643,
+        1644, 1645, 0, 0, 1646, 1647, 0, 0, 1648, 1649, 0, 0, 0, 0, 0, 0,
+        1650, 1651, 0, 0, 1652, 1653, 0, 0, 1654, 1655, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1656, 1657, 1658, 1659,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1660, 1661, 1662, 1663, 0, 0, 0, 0, 0, 0, 1664, 1665, 1666, 1667, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 1668, 1669, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        36, 31, 32, 1535, 1536, 1537, 1538, 1539, 1540, 1670, 1671, 1672, 1673, 1674, 1675, 1676,
+        1677, 1678, 1679, 1680, 1681, 1682, 1683, 1684, 1685, 1686, 1687, 1688, 1689, 1690, 1691, 1692,
+        1693, 1694, 1695, 1696, 1697, 1698, 1699, 1700, 1701, 1702, 1703, 1704, 1705, 1706, 1707, 1708,
+        1709, 1710, 1711, 1712, 1713, 1714, 1715, 1716, 1717, 1718, 1719, 1720, 1721, 1722, 1723, 1724,
+        1725, 1726, 1727, 1728, 1729, 1730, 1731, 1732, 1733, 1734, 1735, 1736, 1737, 1738, 1739, 1740,
+        1741, 1742, 1743, 1744, 1745, 1746, 1747, 1748, 1749, 1750, 1751, 1752, 1753, 1754, 1755, 1756,
+        1757, 1758, 1759, 1760, 1761, 1762, 1763, 1764, 1765, 1766, 1767, 1768, 1769, 1770, 1771, 1772,
+        29, 970, 999, 971, 972, 1002, 976, 383, 995, 385, 977, 399, 978, 1546, 37, 983,
+        1773, 386, 400, 984, 985, 988, 390, 401, 391, 1029, 1534, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1774, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 1775, 1776, 1777, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1778, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1779, 1780, 1781, 1782, 1783, 1784, 1785, 1786, 1787, 1788, 1789, 1790, 1791, 1792, 1793, 1794,
+        1795, 1796, 1797, 1798, 1799, 1800, 1801, 1802, 1803, 1804, 1805, 1806, 1807, 1808, 1809, 1810,
+        1811, 1812, 1813, 1814, 1815, 1816, 1817, 1818, 1819, 1820, 1821, 1822, 1823, 1824, 1825, 1826,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1827, 0, 1828, 1829, 1830, 0, 0, 1831, 0, 1832, 0, 1833, 0, 1834, 1835, 1836,
+        1837, 0, 1838, 0, 0, 1839, 0, 0, 0, 0, 0, 0, 385, 1840, 1841, 1842,
+        1843, 0, 1844, 0, 1845, 0, 1846, 0, 1847, 0, 1848, 0, 1849, 0, 1850, 0,
+        1851, 0, 1852, 0, 1853, 0, 1854, 0, 1855, 0, 1856, 0, 1857, 0, 1858, 0,
+        1859, 0, 1860, 0, 1861, 0, 1862, 0, 1863, 0, 1864, 0, 1865, 0, 1866, 0,
+        1867, 0, 1868, 0, 1869, 0, 1870, 0, 1871, 0, 1872, 0, 1873, 0, 1874, 0,
+        1875, 0, 1876, 0, 1877, 0, 1878, 0, 1879, 0, 1880, 0, 1881, 0, 1882, 0,
+        1883, 0, 1884, 0, 1885, 0, 1886, 0, 1887, 0, 1888, 0, 1889, 0, 1890, 0,
+        1891, 0, 1892, 0, 0, 0, 0, 0, 0, 0, 0, 1893, 0, 1894, 0, 404,
+        404, 404, 1895, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1896,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 761,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404,
+        404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1897,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 1898, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1899, 1900, 1901, 1902, 1903, 1904, 1905, 1906, 1907, 1908, 1909, 1910, 1911, 1912, 1913, 1914,
+        1915, 1916, 1917, 1918, 1919, 1920, 1921, 1922, 1923, 1924, 1925, 1926, 1927, 1928, 1929, 1930,
+        1931, 1932, 1933, 1934, 1935, 1936, 1937, 1938, 1939, 1940, 1941, 1942, 1943, 1944, 1945, 1946,
+        1947, 1948, 1949, 1950, 1951, 1952, 1953, 1954, 1955, 1956, 1957, 1958, 1959, 1960, 1961, 1962,
+        1963, 1964, 1965, 1966, 1967, 1968, 1969, 1970, 1971, 1972, 1973, 1974, 1975, 1976, 1977, 1978,
+        1979, 1980, 1981, 1982, 1983, 1984, 1985, 1986, 1987, 1988, 1989, 1990, 1991, 1992, 1993, 1994,
+        1995, 1996, 1997, 1998, 1999, 2000, 2001, 2002, 2003, 2004, 2005, 2006, 2007, 2008, 2009, 2010,
+        2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024, 2025, 2026,
+        2027, 2028, 2029, 2030, 2031, 2032, 2033, 2034, 2035, 2036, 2037, 2038, 2039, 2040, 2041, 2042,
+        2043, 2044, 2045, 2046, 2047, 2048, 2049, 2050, 2051, 2052, 2053, 2054, 2055, 2056, 2057, 2058,
+        2059, 2060, 2061, 2062, 2063, 2064, 2065, 2066, 2067, 2068, 2069, 2070, 2071, 2072, 2073, 2074,
+        2075, 2076, 2077, 2078, 2079, 2080, 2081, 2082, 2083, 2084, 2085, 2086, 2087, 2088, 2089, 2090,
+        2091, 2092, 2093, 2094, 2095, 2096, 2097, 2098, 2099, 2100, 2101, 2102, 2103, 2104, 2105, 2106,
+        2107, 2108, 2109, 2110, 2111, 2112, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        27, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1035, 718, 405, 717, 2113, 2113,
+        0, 0, 0, 0, 0, 0, 2114, 0, 1922, 2115, 2116, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2117, 0, 2118, 0,
+        2119, 0, 2120, 0, 2121, 0, 2122, 0, 2123, 0, 2124, 0, 2125, 0, 2126, 0,
+        2127, 0, 2128, 0, 0, 2129, 0, 2130, 0, 2131, 0, 0, 0, 0, 0, 0,
+        2132, 2133, 0, 2134, 2135, 0, 2136, 2137, 0, 2138, 2139, 0, 2140, 2141, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 2142, 0, 0, 0, 0, 2143, 2143, 2144, 2145, 0, 2146, 2147,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2148, 0, 2149, 0,
+        2150, 0, 2151, 0, 2152, 0, 2153, 0, 2154, 0, 2155, 0, 2156, 0, 2157, 0,
+        2158, 0, 2159, 0, 0, 2160, 0, 2161, 0, 2162, 0, 0, 0, 0, 0, 0,
+        2163, 2164, 0, 2165, 2166, 0, 2167, 2168, 0, 2169, 2170, 0, 2171, 2172, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 2173, 0, 0, 2174, 2175, 2176, 2177, 0, 0, 0, 2178, 2179,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 2180, 2181, 2182, 2183, 2184, 2185, 2186, 2187, 2188, 2189, 2190, 2191, 2192, 2193, 2194,
+        2195, 2196, 2197, 2198, 2199, 2200, 2201, 2202, 2203, 2204, 2205, 2206, 2207, 2208, 2209, 2210,
+        2211, 2212, 2213, 2214, 2215, 2216, 2217, 2218, 2219, 2220, 2221, 2222, 2223, 2224, 2225, 2226,
+        2227, 2228, 2229, 2230, 2231, 2232, 2233, 2234, 2235, 2236, 2237, 2238, 2239, 2240, 2241, 2242,
+        2243, 2244, 2245, 2246, 2247, 2248, 2249, 2250, 2251, 2252, 2253, 2254, 2255, 2256, 2257, 2258,
+        2259, 2260, 2261, 2262, 2263, 2264, 2265, 2266, 2267, 2268, 2269, 2270, 2271, 2272, 2273, 0,
+        0, 0, 1899, 1905, 2274, 2275, 2276, 2277, 2278, 2279, 1903, 2280, 2281, 2282, 2283, 1907,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        2284, 2285, 2286, 2287, 2288, 2289, 2290, 2291, 2292, 2293, 2294, 2295, 2296, 2297, 2298, 2299,
+        2300, 2301, 2302, 2303, 2304, 2305, 2306, 2307, 2308, 2309, 2310, 2311, 2312, 2313, 2314, 0,
+        2315, 2316, 2317, 2318, 2319, 2320, 2321, 2322, 2323, 2324, 2325, 2326, 2327, 2328, 2329, 2330,
+        2331, 2332, 2333, 2334, 2335, 2336, 2337, 2338, 2339, 2340, 2341, 2342, 2343, 2344, 2345, 2346,
+        2347, 2348, 2349, 2350, 2351, 2352, 1965, 2353, 0, 0, 0, 0, 0, 0, 0, 0,
+        2354, 2355, 2356, 2357, 2358, 2359, 2360, 2361, 2362, 2363, 2364, 2365, 2366, 2367, 2368, 2369,
+        2180, 2183, 2186, 2188, 2196, 2197, 2200, 2202, 2203, 2205, 2206, 2207, 2208, 2209, 2370, 2371,
+        2372, 2373, 2374, 2375, 2376, 2377, 2378, 2379, 2380, 2381, 2382, 2383, 2384, 2385, 2386, 0,
+        1899, 1905, 2274, 2275, 2387, 2388, 2389, 1910, 2390, 1922, 1972, 1984, 1983, 1973, 2065, 1930,
+        1970, 2391, 2392, 2393, 2394, 2395, 2396, 2397, 2398, 2399, 2400, 1936, 2401, 2402, 2403, 2404,
+        2405, 2406, 2407, 2408, 2276, 2277, 2278, 2409, 2410, 2411, 2412, 2413, 2414, 2415, 2416, 2417,
+        2418, 2419, 2420, 2421, 2422, 2423, 2424, 2425, 2426, 2427, 2428, 2429, 2430, 2431, 2432, 2433,
+        2434, 2435, 2436, 2437, 2438, 2439, 2440, 2441, 2442, 2443, 2444, 2445, 2446, 2447, 2448, 2449,
+        2450, 2451, 2452, 2453, 2454, 2455, 2456, 2457, 2458, 2459, 2460, 2461, 2462, 2463, 2464, 2465,
+        2466, 2467, 2468, 2469, 2470, 2471, 2472, 2473, 2474, 2475, 2476, 2477, 2478, 2479, 2480, 2481,
+        2482, 2483, 2484, 2485, 2486, 2487, 2488, 2489, 2490, 2491, 2492, 2493, 2494, 2495, 2496, 2497,
+        2498, 2499, 2500, 2501, 2502, 2503, 2504, 2505, 2506, 2507, 2508, 2509, 2510, 2511, 2512, 2513,
+        2514, 2515, 2516, 2517, 2518, 2519, 2520, 2521, 2522, 2523, 2524, 2525, 2526, 2527, 2528, 2529,
+        2530, 2531, 2532, 2533, 2534, 2535, 2536, 2537, 2538, 2539, 2540, 2541, 2542, 2543, 2544, 2545,
+        2546, 2547, 2548, 2549, 2550, 2551, 2552, 2553, 2554, 2555, 2556, 2557, 2558, 2559, 2560, 2561,
+        2562, 2563, 2564, 2565, 2566, 2567, 2568, 2569, 2570, 2571, 2572, 2573, 2574, 2575, 2576, 2577,
+        2578, 2579, 2580, 2581, 2582, 2583, 2584, 2585, 2586, 2587, 2588, 2589, 2590, 2591, 2592, 2593,
+        2594, 2595, 2596, 2597, 2598, 2599, 2600, 2601, 2602, 2603, 2604, 2605, 2606, 2607, 2608, 2609,
+        2610, 2611, 2612, 2613, 2614, 2615, 2616, 2617, 2618, 2619, 2620, 2621, 2622, 2623, 2624, 2625,
+        2626, 2627, 2628, 2629, 2630, 2631, 2632, 2633, 2634, 2635, 2636, 2637, 2638, 2639, 2640, 2641,
+        2642, 2643, 2644, 2645, 2646, 2647, 2648, 2649, 2650, 2651, 2652, 2653, 2654, 2655, 2656, 2657,
+        2658, 2659, 2660, 2661, 2662, 2663, 2664, 2665, 2666, 2667, 2668, 2669, 2670, 2671, 2672, 2673,
+        2674, 2675, 2676, 2677, 2678, 2679, 2680, 2681, 2682, 2683, 2684, 2685, 2686, 2687, 2688, 2689,
+        2690, 2691, 2692, 2693, 2694, 2695, 2696, 2697, 2698, 2699, 2700, 2701, 2702, 2703, 2704, 2705,
+        2706, 2707, 2708, 2709, 2710, 2711, 2712, 2713, 2714, 2715, 2716, 2717, 2718, 2719, 2720, 2721,
+        2722, 2723, 2724, 2725, 2726, 2727, 2728, 2729, 2730, 2731, 2732, 2733, 2734, 2735, 2736, 2737,
+        2738, 2739, 2740, 2741, 2742, 2743, 2744, 2745, 2746, 2747, 2748, 2749, 2750, 2751, 2752, 2753,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        2754, 0, 2755, 0, 2756, 0, 2757, 0, 2758, 0, 899, 0, 2759, 0, 2760, 0,
+        2761, 0, 2762, 0, 2763, 0, 2764, 0, 2765, 0, 2766, 0, 2767, 0, 2768, 0,
+        2769, 0, 2770, 0, 2771, 0, 2772, 0, 2773, 0, 2774, 0, 2775, 0, 0, 404,
+        0, 0, 0, 0, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 0, 0,
+        2776, 0, 2777, 0, 2778, 0, 2779, 0, 2780, 0, 2781, 0, 2782, 0, 2783, 0,
+        2784, 0, 2785, 0, 2786, 0, 2787, 0, 2788, 0, 2789, 0, 2790, 2791, 404, 404,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        404, 404, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 2792, 0, 2793, 0, 2794, 0, 2795, 0, 2796, 0, 2797, 0, 2798, 0,
+        0, 0, 2799, 0, 2800, 0, 2801, 0, 2802, 0, 2803, 0, 2804, 0, 2805, 0,
+        2806, 0, 2807, 0, 2808, 0, 2809, 0, 2810, 0, 2811, 0, 2812, 0, 2813, 0,
+        2814, 0, 2815, 0, 2816, 0, 2817, 0, 2818, 0, 2819, 0, 2820, 0, 2821, 0,
+        2822, 0, 2823, 0, 2824, 0, 2825, 0, 2826, 0, 2827, 0, 2828, 0, 2829, 0,
+        2830, 0, 0, 0, 0, 0, 0, 0, 0, 2831, 0, 2832, 0, 2833, 2834, 0,
+        2835, 0, 2836, 0, 2837, 0, 2838, 0, 0, 0, 0, 2839, 0, 2840, 0, 0,
+        2841, 0, 2842, 0, 0, 0, 2843, 0, 2844, 0, 2845, 0, 2846, 0, 2847, 0,
+        2848, 0, 2849, 0, 2850, 0, 2851, 0, 2852, 0, 2853, 2854, 2855, 2856, 2857, 0,
+        2858, 2859, 2860, 2861, 2862, 0, 2863, 0, 2864, 0, 2865, 0, 2866, 0, 2867, 0,
+        2868, 0, 2869, 0, 2870, 2871, 2872, 2873, 0, 2874, 0, 0, 0, 0, 0, 0,
+        2875, 0, 0, 0, 0, 0, 2876, 0, 2877, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1550, 1566, 1558, 2878, 0, 0, 2879, 2880, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 761, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 761, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 761, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404,
+        404, 404, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 406, 406, 406, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 761, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 770, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        761, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        404, 0, 404, 404, 406, 0, 0, 404, 404, 0, 0, 0, 0, 0, 404, 404,
+        0, 404, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 761, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2881, 2882, 2883, 2884,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 2885, 0, 0, 0, 0, 0, 0,
+        2886, 2887, 2888, 2889, 2890, 2891, 2892, 2893, 2894, 2895, 2896, 2897, 2898, 2899, 2900, 2901,
+        2902, 2903, 2904, 2905, 2906, 2907, 2908, 2909, 2910, 2911, 2912, 2913, 2914, 2915, 2916, 2917,
+        2918, 2919, 2920, 2921, 2922, 2923, 2924, 2925, 2926, 2927, 2928, 2929, 2930, 2931, 2932, 2933,
+        2934, 2935, 2936, 2937, 2938, 2939, 2940, 2941, 2942, 2943, 2944, 2945, 2946, 2947, 2948, 2949,
+        2950, 2951, 2952, 2953, 2954, 2955, 2956, 2957, 2958, 2959, 2960, 2961, 2962, 2963, 2964, 2965,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 761, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        2966, 2967, 2968, 2969, 2970, 2971, 2972, 2973, 2973, 2974, 2975, 2976, 2977, 2978, 2979, 2980,
+        2981, 2982, 2983, 2984, 2985, 2986, 2987, 2988, 2989, 2990, 2991, 2992, 2993, 2994, 2995, 2996,
+        2997, 2998, 2999, 3000, 3001, 3002, 3003, 3004, 3005, 3006, 3007, 3008, 3009, 3010, 3011, 3012,
+        3013, 3014, 3015, 3016, 3017, 3018, 3019, 3020, 3021, 3022, 3023, 3024, 3025, 3026, 3027, 3028,
+        3029, 3030, 3031, 3032, 3033, 3034, 3035, 3036, 3037, 3038, 3039, 3040, 3041, 3042, 3043, 3044,
+        3045, 3046, 3047, 3048, 3049, 3050, 3051, 3052, 3053, 3054, 3055, 3056, 2985, 3057, 3058, 3059,
+        3060, 3061, 3062, 3063, 3064, 3065, 3066, 3067, 3068, 3069, 3070, 3071, 3072, 3073, 3074, 3075,
+        3076, 3077, 3078, 3079, 3080, 3081, 3082, 3083, 3084, 3085, 3086, 3087, 3088, 3089, 3090, 3091,
+        3092, 3093, 3094, 3095, 3096, 3097, 3098, 3099, 3100, 3101, 3102, 3103, 3104, 3105, 3106, 3107,
+        3108, 3109, 3110, 3111, 3112, 3113, 3114, 3115, 3116, 3117, 3118, 3119, 3120, 3121, 3122, 3123,
+        3124, 3075, 3125, 3126, 3127, 3128, 3129, 3130, 3131, 3132, 3059, 3133, 3134, 3135, 3136, 3137,
+        3138, 3139, 3140, 3141, 3142, 3143, 3144, 3145, 3146, 3147, 3148, 3149, 3150, 3151, 3152, 2985,
+        3153, 3154, 3155, 3156, 3157, 3158, 3159, 3160, 3161, 3162, 3163, 3164, 3165, 3166, 3167, 3168,
+        3169, 3170, 3171, 3172, 3173, 3174, 3175, 3176, 3177, 3178, 3179, 3061, 3180, 3181, 3182, 3183,
+        3184, 3185, 3186, 3187, 3188, 3189, 3190, 3191, 3192, 3193, 3194, 3195, 3196, 3197, 3198, 3199,
+        3200, 3201, 3202, 3203, 3204, 3205, 3206, 3207, 3208, 3209, 3210, 3211, 3212, 3213, 3214, 3215,
+        3216, 3217, 3218, 3219, 3220, 3221, 3222, 3223, 3224, 3225, 3226, 3227, 3228, 3229, 0, 0,
+        3230, 0, 3231, 0, 0, 3232, 3233, 3234, 3235, 3236, 3237, 3238, 3239, 3240, 3241, 0,
+        3242, 0, 3243, 0, 0, 3244, 3245, 0, 0, 0, 3246, 3247, 3248, 3249, 3250, 3251,
+        3252, 3253, 3254, 3255, 3256, 3257, 3258, 3259, 3260, 3261, 3262, 3263, 3264, 3265, 3266, 3267,
+        3268, 3269, 3270, 3271, 3272, 3273, 3274, 3275, 3276, 3277, 3278, 3279, 3280, 3281, 3282, 3283,
+        3284, 3285, 3286, 3287, 3288, 3289, 3290, 3114, 3291, 3292, 3293, 3294, 3295, 3296, 3296, 3297,
+        3298, 3299, 3300, 3301, 3302, 3303, 3304, 3244, 3305, 3306, 3307, 3308, 3309, 3310, 0, 0,
+        3311, 3312, 3313, 3314, 3315, 3316, 3317, 3318, 3258, 3319, 3320, 3321, 3230, 3322, 3323, 3324,
+        3325, 3326, 3327, 3328, 3329, 3330, 3331, 3332, 3333, 3267, 3334, 3268, 3335, 3336, 3337, 3338,
+        3339, 3231, 3006, 3340, 3341, 3342, 3076, 3163, 3343, 3344, 3275, 3345, 3276, 3346, 3347, 3348,
+        3233, 3349, 3350, 3351, 3352, 3353, 3234, 3354, 3355, 3356, 3357, 3358, 3359, 3290, 3360, 3361,
+        3114, 3362, 3294, 3363, 3364, 3365, 3366, 3367, 3299, 3368, 3243, 3369, 3300, 3057, 3370, 3301,
+        3371, 3303, 3372, 3373, 3374, 3375, 3376, 3305, 3239, 3377, 3306, 3378, 3307, 3379, 2973, 3380,
+        3381, 3382, 3383, 3384, 3385, 3386, 3387, 3388, 3389, 3390, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        3391, 3392, 3393, 3394, 3395, 3396, 3396, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 3397, 3398, 3399, 3400, 3401, 0, 0, 0, 0, 0, 3402, 3403, 3404,
+        3405, 1568, 1571, 3406, 3407, 3408, 3409, 3410, 3411, 1541, 3412, 3413, 3414, 3415, 3416, 3417,
+        3418, 3419, 3420, 3421, 3422, 3423, 3424, 0, 3425, 3426, 3427, 3428, 3429, 0, 3430, 0,
+        3431, 3432, 0, 3433, 3434, 0, 3435, 3436, 3437, 3438, 3439, 3440, 3441, 3442, 3443, 3444,
+        3445, 3445, 3446, 3446, 3446, 3446, 3447, 3447, 3447, 3447, 3448, 3448, 3448, 3448, 3449, 3449,
+        3449, 3449, 3450, 3450, 3450, 3450, 3451, 3451, 3451, 3451, 3452, 3452, 3452, 3452, 3453, 3453,
+        3453, 3453, 3454, 3454, 3454, 3454, 3455, 3455, 3455, 3455, 3456, 3456, 3456, 3456, 3457, 3457,
+        3457, 3457, 3458, 3458, 3459, 3459, 3460, 3460, 3461, 3461, 3462, 3462, 3463, 3463, 3464, 3464,
+        3464, 3464, 3465, 3465, 3465, 3465, 3466, 3466, 3466, 3466, 3467, 3467, 3467, 3467, 3468, 3468,
+        3469, 3469, 3469, 3469, 3470, 3470, 3471, 3471, 3471, 3471, 3472, 3472, 3472, 3472, 3473, 3473,
+        3474, 3474, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 3475, 3475, 3475, 3475, 3476, 3476, 3477, 3477, 3478, 3478, 751, 3479, 3479,
+        3480, 3480, 3481, 3481, 3482, 3482, 3482, 3482, 3483, 3483, 3484, 3484, 3485, 3485, 3486, 3486,
+        3487, 3487, 3488, 3488, 3489, 3489, 3490, 3490, 3490, 3491, 3491, 3491, 3492, 3492, 3492, 3492,
+        3493, 3494, 3495, 3491, 3496, 3497, 3498, 3499, 3500, 3501, 3502, 3503, 3504, 3505, 3506, 3507,
+        3508, 3509, 3510, 3511, 3512, 3513, 3514, 3515, 3516, 3517, 3518, 3519, 3520, 3521, 3522, 3523,
+        3524, 3525, 3526, 3527, 3528, 3529, 3530, 3531, 3532, 3533, 3534, 3535, 3536, 3537, 3538, 3539,
+        3540, 3541, 3542, 3543, 3544, 3545, 3546, 3547, 3548, 3549, 3550, 3551, 3552, 3553, 3554, 3555,
+        3556, 3557, 3558, 3559, 3560, 3561, 3562, 3563, 3564, 3565, 3566, 3567, 3568, 3569, 3570, 3571,
+        3572, 3573, 3574, 3575, 3576, 3577, 3578, 3579, 3580, 3581, 3582, 3583, 3584, 3585, 3586, 3587,
+        3588, 3589, 3590, 3591, 3592, 3593, 3495, 3594, 3491, 3496, 3595, 3596, 3500, 3597, 3501, 3502,
+        3598, 3599, 3506, 3600, 3507, 3508, 3601, 3602, 3510, 3603, 3511, 3512, 3541, 3542, 3545, 3546,
+        3547, 3551, 3552, 3553, 3554, 3558, 3559, 3560, 3604, 3564, 3605, 3606, 3570, 3607, 3571, 3572,
+        3585, 3608, 3609, 3580, 3610, 3581, 3582, 3493, 3494, 3611, 3495, 3612, 3497, 3498, 3499, 3500,
+        3613, 3503, 3504, 3505, 3506, 3614, 3510, 3513, 3514, 3515, 3516, 3517, 3519, 3520, 3521, 3522,
+        3523, 3524, 3615, 3525, 3526, 3527, 3528, 3529, 3530, 3532, 3533, 3534, 3535, 3536, 3537, 3538,
+        3539, 3540, 3543, 3544, 3548, 3549, 3550, 3551, 3552, 3555, 3556, 3557, 3558, 3616, 3561, 3562,
+        3563, 3564, 3567, 3568, 3569, 3570, 3617, 3573, 3574, 3618, 3577, 3578, 3579, 3580, 3619, 3495,
+        3612, 3500, 3613, 3506, 3614, 3510, 3620, 3523, 3621, 3622, 3623, 3551, 3552, 3558, 3570, 3617,
+        3580, 3619, 3624, 3625, 3626, 3627, 3628, 3629, 3630, 3631, 3632, 3633, 3634, 3635, 3636, 3637,
+        3638, 3639, 3640, 3641, 3642, 3643, 3644, 3645, 3646, 3647, 3648, 3649, 3622, 3650, 3651, 3652,
+        3653, 3627, 3628, 3629, 3630, 3631, 3632, 3633, 3634, 3635, 3636, 3637, 3638, 3639, 3640, 3641,
+        3642, 3643, 3644, 3645, 3646, 3647, 3648, 3649, 3622, 3650, 3651, 3652, 3653, 3647, 3648, 3649,
+        3622, 3621, 3623, 3531, 3520, 3521, 3522, 3647, 3648, 3649, 3531, 3532, 3654, 3654, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        3655, 3656, 3656, 3657, 3658, 3659, 3660, 3661, 3662, 3662, 3663, 3664, 3665, 3666, 3667, 3668,
+        3668, 3669, 3670, 3670, 3671, 3671, 3672, 3673, 3673, 3674, 3675, 3675, 3676, 3676, 3677, 3678,
+        3678, 3679, 3679, 3680, 3681, 3682, 3683, 3683, 3684, 3685, 3686, 3687, 3688, 3688, 3689, 3690,
+        3691, 3692, 3693, 3694, 3694, 3695, 3695, 3696, 3696, 3697, 3698, 3699, 3700, 3701, 3702, 3703,
+        0, 0, 3704, 3705, 3706, 3707, 3708, 3709, 3709, 3710, 3711, 3712, 3713, 3713, 3714, 3715,
+        3716, 3717, 3718, 3719, 3720, 3721, 3722, 3723, 3724, 3725, 3726, 3727, 3728, 3729, 3730, 3731,
+        3732, 3733, 3734, 3735, 3689, 3691, 3736, 3737, 3738, 3739, 3740, 3741, 3740, 3738, 3742, 3743,
+        3744, 3745, 3746, 3741, 3682, 3672, 3747, 3748, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        3749, 3750, 3751, 3752, 3753, 3754, 3755, 3756, 3757, 3758, 3759, 3760, 3761, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        3762, 3763, 3764, 3765, 3766, 3767, 3768, 3769, 3770, 1523, 0, 0, 0, 0, 0, 0,
+        404, 404, 404, 404, 404, 404, 404, 406, 406, 406, 406, 406, 406, 406, 404, 404,
+        1522, 3771, 3772, 3773, 3773, 1544, 1545, 3774, 3775, 3776, 3777, 3778, 3779, 3780, 3781, 3782,
+        3783, 3784, 3785, 3786, 3787, 0, 0, 3788, 3789, 1529, 1529, 1529, 1529, 3773, 3773, 3773,
+        3762, 3763, 1521, 0, 3766, 3765, 3768, 3767, 3771, 1544, 1545, 3774, 3775, 3776, 3777, 3790,
+        3791, 3792, 1541, 3793, 3794, 3795, 1543, 0, 3796, 3797, 3798, 3799, 0, 0, 0, 0,
+        3800, 3801, 3802, 0, 3803, 0, 3804, 3805, 3806, 3807, 3808, 3809, 3810, 3811, 3812, 3813,
+        3814, 3815, 3815, 3816, 3816, 3817, 3817, 3818, 3818, 3819, 3819, 3819, 3819, 3820, 3820, 3821,
+        3821, 3821, 3821, 3822, 3822, 3823, 3823, 3823, 3823, 3824, 3824, 3824, 3824, 3825, 3825, 3825,
+        3825, 3826, 3826, 3826, 3826, 3827, 3827, 3827, 3827, 3828, 3828, 3829, 3829, 3830, 3830, 3831,
+        3831, 3832, 3832, 3832, 3832, 3833, 3833, 3833, 3833, 3834, 3834, 3834, 3834, 3835, 3835, 3835,
+        3835, 3836, 3836, 3836, 3836, 3837, 3837, 3837, 3837, 3838, 3838, 3838, 3838, 3839, 3839, 3839,
+        3839, 3840, 3840, 3840, 3840, 3841, 3841, 3841, 3841, 3842, 3842, 3842, 3842, 3843, 3843, 3843,
+        3843, 3844, 3844, 3844, 3844, 3845, 3845, 3845, 3845, 3846, 3846, 3846, 3846, 3847, 3847, 3483,
+        3483, 3848, 3848, 3848, 3848, 3849, 3849, 3850, 3850, 3851, 3851, 3852, 3852, 0, 0, 0,
+        0, 3767, 3853, 3790, 3797, 3798, 3791, 3854, 1544, 1545, 3792, 1541, 3762, 3793, 1521, 3855,
+        1534, 36, 31, 32, 1535, 1536, 1537, 1538, 1539, 1540, 3765, 3766, 3794, 1543, 3795, 3768,
+        3799, 3856, 3857, 3858, 3859, 3860, 3861, 3862, 3863, 3864, 3865, 3866, 3867, 3868, 3869, 3870,
+        3871, 3872, 3873, 3874, 3875, 3876, 3877, 3878, 3879, 3880, 3881, 3788, 3796, 3789, 3882, 3773,
+        3883, 29, 970, 999, 971, 972, 1002, 976, 383, 995, 385, 977, 399, 978, 1546, 37,
+        983, 1773, 386, 400, 984, 985, 988, 390, 401, 391, 1029, 3774, 3884, 3775, 3885, 3886,
+        3887, 3764, 3784, 3785, 3763, 3888, 2496, 3889, 3890, 3891, 3892, 3893, 3894, 3895, 3896, 3897,
+        3898, 2450, 2451, 2452, 2453, 2454, 2455, 2456, 2457, 2458, 2459, 2460, 2461, 2462, 2463, 2464,
+        2465, 2466, 2467, 2468, 2469, 2470, 2471, 2472, 2473, 2474, 2475, 2476, 2477, 2478, 2479, 2480,
+        2481, 2482, 2483, 2484, 2485, 2486, 2487, 2488, 2489, 2490, 2491, 2492, 2493, 3899, 3900, 3901,
+        2231, 2180, 2181, 2182, 2183, 2184, 2185, 2186, 2187, 2188, 2189, 2190, 2191, 2192, 2193, 2194,
+        2195, 2196, 2197, 2198, 2199, 2200, 2201, 2202, 2203, 2204, 2205, 2206, 2207, 2208, 2209, 0,
+        0, 0, 2210, 2211, 2212, 2213, 2214, 2215, 0, 0, 2216, 2217, 2218, 2219, 2220, 2221,
+        0, 0, 2222, 2223, 2224, 2225, 2226, 2227, 0, 0, 2228, 2229, 2230, 0, 0, 0,
+        3902, 3903, 3904, 30, 3905, 3906, 3907, 0, 3908, 3909, 3910, 3911, 3912, 3913, 3914, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    };
+
+    /** Per-character properties, see REUnicode::FCharRecord */
+    inline constexpr REUnicode::FCharRecord Records[3915] = {
+        { 0, 0, 0, 0, 0, 0, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 0, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 2, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 3, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 4, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 5, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 6, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 7, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 8, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 9, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 10, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 11, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 12, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 13, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 14, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 15, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 16, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 17, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 18, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 19, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 20, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 21, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 22, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 23, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 24, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 25, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 1, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 6, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 7, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 8, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 10, 0, 1, 26, 1, 0, 0x12, 0x0000 },
+        { 0, 11, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 13, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 14, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 15, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 18, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 21, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 24, 24, 2, 2, 27, 1, 0, 0x03, 0x0041 },
+        { 26, 26, 2, 2, 28, 1, 0, 0x03, 0x0041 },
+        { 28, 28, 2, 2, 29, 1, 0, 0x03, 0x0041 },
+        { 30, 30, 2, 2, 30, 1, 0, 0x03, 0x0041 },
+        { 32, 32, 2, 2, 31, 1, 0, 0x03, 0x0041 },
+        { 34, 34, 2, 2, 32, 1, 0, 0x03, 0x0041 },
+        { 0, 0, 0, 0, 33, 1, 0, 0x00, 0x0000 },
+        { 36, 36, 2, 2, 34, 1, 0, 0x03, 0x0043 },
+        { 38, 38, 2, 2, 35, 1, 0, 0x03, 0x0045 },
+        { 40, 40, 2, 2, 36, 1, 0, 0x03, 0x0045 },
+        { 42, 42, 2, 2, 37, 1, 0, 0x03, 0x0045 },
+        { 44, 44, 2, 2, 38, 1, 0, 0x03, 0x0045 },
+        { 46, 46, 2, 2, 39, 1, 0, 0x03, 0x0049 },
+        { 48, 48, 2, 2, 40, 1, 0, 0x03, 0x0049 },
+        { 50, 50, 2, 2, 41, 1, 0, 0x03, 0x0049 },
+        { 52, 52, 2, 2, 42, 1, 0, 0x03, 0x0049 },
+        { 0, 0, 0, 0, 43, 1, 0, 0x00, 0x0000 },
+        { 54, 54, 2, 2, 44, 1, 0, 0x03, 0x004E },
+        { 56, 56, 2, 2, 45, 1, 0, 0x03, 0x004F },
+        { 58, 58, 2, 2, 46, 1, 0, 0x03, 0x004F },
+        { 60, 60, 2, 2, 47, 1, 0, 0x03, 0x004F },
+        { 62, 62, 2, 2, 48, 1, 0, 0x03, 0x004F },
+        { 64, 64, 2, 2, 49, 1, 0, 0x03, 0x004F },
+        { 0, 0, 0, 0, 50, 1, 0, 0x00, 0x004F },
+        { 66, 66, 2, 2, 51, 1, 0, 0x03, 0x0055 },
+        { 68, 68, 2, 2, 52, 1, 0, 0x03, 0x0055 },
+        { 70, 70, 2, 2, 53, 1, 0, 0x03, 0x0055 },
+        { 72, 72, 2, 2, 54, 1, 0, 0x03, 0x0055 },
+        { 74, 74, 2, 2, 55, 1, 0, 0x03, 0x0059 },
+        { 0, 0, 0, 0, 56, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 57, 2, 0, 0x00, 0x0000 },
+        { 76, 76, 2, 2, 0, 0, 0, 0x03, 0x0061 },
+        { 78, 78, 2, 2, 0, 0, 0, 0x03, 0x0061 },
+        { 80, 80, 2, 2, 0, 0, 0, 0x03, 0x0061 },
+        { 82, 82, 2, 2, 0, 0, 0, 0x03, 0x0061 },
+        { 84, 84, 2, 2, 0, 0, 0, 0x03, 0x0061 },
+        { 86, 86, 2, 2, 0, 0, 0, 0x03, 0x0061 },
+        { 88, 88, 2, 2, 0, 0, 0, 0x03, 0x0063 },
+        { 90, 90, 2, 2, 0, 0, 0, 0x03, 0x0065 },
+        { 92, 92, 2, 2, 0, 0, 0, 0x03, 0x0065 },
+        { 94, 94, 2, 2, 0, 0, 0, 0x03, 0x0065 },
+        { 96, 96, 2, 2, 0, 0, 0, 0x03, 0x0065 },
+        { 98, 98, 2, 2, 0, 0, 0, 0x03, 0x0069 },
+        { 100, 100, 2, 2, 0, 0, 0, 0x03, 0x0069 },
+        { 102, 102, 2, 2, 0, 0, 0, 0x03, 0x0069 },
+        { 104, 104, 2, 2, 0, 0, 0, 0x03, 0x0069 },
+        { 106, 106, 2, 2, 0, 0, 0, 0x03, 0x006E },
+        { 108, 108, 2, 2, 0, 0, 0, 0x03, 0x006F },
+        { 110, 110, 2, 2, 0, 0, 0, 0x03, 0x006F },
+        { 112, 112, 2, 2, 0, 0, 0, 0x03, 0x006F },
+        { 114, 114, 2, 2, 0, 0, 0, 0x03, 0x006F },
+        { 116, 116, 2, 2, 0, 0, 0, 0x03, 0x006F },
+        { 0, 0, 0, 0, 0, 0, 0, 0x00, 0x006F },
+        { 118, 118, 2, 2, 0, 0, 0, 0x03, 0x0075 },
+        { 120, 120, 2, 2, 0, 0, 0, 0x03, 0x0075 },
+        { 122, 122, 2, 2, 0, 0, 0, 0x03, 0x0075 },
+        { 124, 124, 2, 2, 0, 0, 0, 0x03, 0x0075 },
+        { 126, 126, 2, 2, 0, 0, 0, 0x03, 0x0079 },
+        { 128, 128, 2, 2, 0, 0, 0, 0x03, 0x0079 },
+        { 130, 130, 2, 2, 59, 1, 0, 0x03, 0x0041 },
+        { 132, 132, 2, 2, 0, 0, 0, 0x03, 0x0061 },
+        { 134, 134, 2, 2, 60, 1, 0, 0x03, 0x0041 },
+        { 136, 136, 2, 2, 0, 0, 0, 0x03, 0x0061 },
+        { 138, 138, 2, 2, 61, 1, 0, 0x03, 0x0041 },
+        { 140, 140, 2, 2, 0, 0, 0, 0x03, 0x0061 },
+        { 142, 142, 2, 2, 62, 1, 0, 0x03, 0x0043 },
+        { 144, 144, 2, 2, 0, 0, 0, 0x03, 0x0063 },
+        { 146, 146, 2, 2, 63, 1, 0, 0x03, 0x0043 },
+        { 148, 148, 2, 2, 0, 0, 0, 0x03, 0x0063 },
+        { 150, 150, 2, 2, 64, 1, 0, 0x03, 0x0043 },
+        { 152, 152, 2, 2, 0, 0, 0, 0x03, 0x0063 },
+        { 154, 154, 2, 2, 65, 1, 0, 0x03, 0x0043 },
+        { 156, 156, 2, 2, 0, 0, 0, 0x03, 0x0063 },
+        { 158, 158, 2, 2, 66, 1, 0, 0x03, 0x0044 },
+        { 160, 160, 2, 2, 0, 0, 0, 0x03, 0x0064 },
+        { 0, 0, 0, 0, 67, 1, 0, 0x00, 0x0044 },
+        { 0, 0, 0, 0, 0, 0, 0, 0x00, 0x0064 },
+        { 162, 162, 2, 2, 68, 1, 0, 0x03, 0x0045 },
+        { 164, 164, 2, 2, 0, 0, 0, 0x03, 0x0065 },
+        { 166, 166, 2, 2, 69, 1, 0, 0x03, 0x0045 },
+        { 168, 168, 2, 2, 0, 0, 0, 0x03, 0x0065 },
+        { 170, 170, 2, 2, 70, 1, 0, 0x03, 0x0045 },
+        { 172, 172, 2, 2, 0, 0, 0, 0x03, 0x0065 },
+        { 174, 174, 2, 2, 71, 1, 0, 0x03, 0x0045 },
+        { 176, 176, 2, 2, 0, 0, 0, 0x03, 0x0065 },
+        { 178, 178, 2, 2, 72, 1, 0, 0x03, 0x0045 },
+        { 180, 180, 2, 2, 0, 0, 0, 0x03, 0x0065 },
+        { 182, 182, 2, 2, 73, 1, 0, 0x03, 0x0047 },
+        { 184, 184, 2, 2, 0, 0, 0, 0x03, 0x0067 },
+        { 186, 186, 2, 2, 74, 1, 0, 0x03, 0x0047 },
+        { 188, 188, 2, 2, 0, 0, 0, 0x03, 0x0067 },
+        { 190, 190, 2, 2, 75, 1, 0, 0x03, 0x0047 },
+        { 192, 192, 2, 2, 0, 0, 0, 0x03, 0x0067 },
+        { 194, 194, 2, 2, 76, 1, 0, 0x03, 0x0047 },
+        { 196, 196, 2, 2, 0, 0, 0, 0x03, 0x0067 },
+        { 198, 198, 2, 2, 77, 1, 0, 0x03, 0x0048 },
+        { 200, 200, 2, 2, 0, 0, 0, 0x03, 0x0068 },
+        { 0, 0, 0, 0, 78, 1, 0, 0x00, 0x0048 },
+        { 0, 0, 0, 0, 0, 0, 0, 0x00, 0x0068 },
+        { 202, 202, 2, 2, 79, 1, 0, 0x03, 0x0049 },
+        { 204, 204, 2, 2, 0, 0, 0, 0x03, 0x0069 },
+        { 206, 206, 2, 2, 80, 1, 0, 0x03, 0x0049 },
+        { 208, 208, 2, 2, 0, 0, 0, 0x03, 0x0069 },
+        { 210, 210, 2, 2, 81, 1, 0, 0x03, 0x0049 },
+        { 212, 212, 2, 2, 0, 0, 0, 0x03, 0x0069 },
+        { 214, 214, 2, 2, 82, 1, 0, 0x03, 0x0049 },
+        { 216, 216, 2, 2, 0, 0, 0, 0x03, 0x0069 },
+        { 218, 218, 2, 2, 83, 2, 0, 0x03, 0x0049 },
+        { 0, 220, 0, 2, 85, 1, 0, 0x12, 0x0000 },
+        { 0, 222, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 224, 224, 2, 2, 86, 1, 0, 0x03, 0x004A },
+        { 226, 226, 2, 2, 0, 0, 0, 0x03, 0x006A },
+        { 228, 228, 2, 2, 87, 1, 0, 0x03, 0x004B },
+        { 230, 230, 2, 2, 0, 0, 0, 0x03, 0x006B },
+        { 232, 232, 2, 2, 88, 1, 0, 0x03, 0x004C },
+        { 234, 234, 2, 2, 0, 0, 0, 0x03, 0x006C },
+        { 236, 236, 2, 2, 89, 1, 0, 0x03, 0x004C },
+        { 238, 238, 2, 2, 0, 0, 0, 0x03, 0x006C },
+        { 240, 240, 2, 2, 90, 1, 0, 0x03, 0x004C },
+        { 242, 242, 2, 2, 0, 0, 0, 0x03, 0x006C },
+        { 0, 244, 0, 2, 91, 1, 0, 0x12, 0x0000 },
+        { 0, 246, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 0, 0, 0, 92, 1, 0, 0x00, 0x004C },
+        { 0, 0, 0, 0, 0, 0, 0, 0x00, 0x006C },
+        { 248, 248, 2, 2, 93, 1, 0, 0x03, 0x004E },
+        { 250, 250, 2, 2, 0, 0, 0, 0x03, 0x006E },
+        { 252, 252, 2, 2, 94, 1, 0, 0x03, 0x004E },
+        { 254, 254, 2, 2, 0, 0, 0, 0x03, 0x006E },
+        { 256, 256, 2, 2, 95, 1, 0, 0x03, 0x004E },
+        { 258, 258, 2, 2, 0, 0, 0, 0x03, 0x006E },
+        { 0, 260, 0, 2, 96, 2, 0, 0x12, 0x0000 },
+        { 0, 0, 0, 0, 98, 1, 0, 0x00, 0x0000 },
+        { 262, 262, 2, 2, 99, 1, 0, 0x03, 0x004F },
+        { 264, 264, 2, 2, 0, 0, 0, 0x03, 0x006F },
+        { 266, 266, 2, 2, 100, 1, 0, 0x03, 0x004F },
+        { 268, 268, 2, 2, 0, 0, 0, 0x03, 0x006F },
+        { 270, 270, 2, 2, 101, 1, 0, 0x03, 0x004F },
+        { 272, 272, 2, 2, 0, 0, 0, 0x03, 0x006F },
+        { 0, 0, 0, 0, 102, 1, 0, 0x00, 0x0000 },
+        { 274, 274, 2, 2, 103, 1, 0, 0x03, 0x0052 },
+        { 276, 276, 2, 2, 0, 0, 0, 0x03, 0x0072 },
+        { 278, 278, 2, 2, 104, 1, 0, 0x03, 0x0052 },
+        { 280, 280, 2, 2, 0, 0, 0, 0x03, 0x0072 },
+        { 282, 282, 2, 2, 105, 1, 0, 0x03, 0x0052 },
+        { 284, 284, 2, 2, 0, 0, 0, 0x03, 0x0072 },
+        { 286, 286, 2, 2, 106, 1, 0, 0x03, 0x0053 },
+        { 288, 288, 2, 2, 0, 0, 0, 0x03, 0x0073 },
+        { 290, 290, 2, 2, 107, 1, 0, 0x03, 0x0053 },
+        { 292, 292, 2, 2, 0, 0, 0, 0x03, 0x0073 },
+        { 294, 294, 2, 2, 108, 1, 0, 0x03, 0x0053 },
+        { 296, 296, 2, 2, 0, 0, 0, 0x03, 0x0073 },
+        { 298, 298, 2, 2, 109, 1, 0, 0x03, 0x0053 },
+        { 300, 300, 2, 2, 0, 0, 0, 0x03, 0x0073 },
+        { 302, 302, 2, 2, 110, 1, 0, 0x03, 0x0054 },
+        { 304, 304, 2, 2, 0, 0, 0, 0x03, 0x0074 },
+        { 306, 306, 2, 2, 111, 1, 0, 0x03, 0x0054 },
+        { 308, 308, 2, 2, 0, 0, 0, 0x03, 0x0074 },
+        { 0, 0, 0, 0, 112, 1, 0, 0x00, 0x0054 },
+        { 0, 0, 0, 0, 0, 0, 0, 0x00, 0x0074 },
+        { 310, 310, 2, 2, 113, 1, 0, 0x03, 0x0055 },
+        { 312, 312, 2, 2, 0, 0, 0, 0x03, 0x0075 },
+        { 314, 314, 2, 2, 114, 1, 0, 0x03, 0x0055 },
+        { 316, 316, 2, 2, 0, 0, 0, 0x03, 0x0075 },
+        { 318, 318, 2, 2, 115, 1, 0, 0x03, 0x0055 },
+        { 320, 320, 2, 2, 0, 0, 0, 0x03, 0x0075 },
+        { 322, 322, 2, 2, 116, 1, 0, 0x03, 0x0055 },
+        { 324, 324, 2, 2, 0, 0, 0, 0x03, 0x0075 },
+        { 326, 326, 2, 2, 117, 1, 0, 0x03, 0x0055 },
+        { 328, 328, 2, 2, 0, 0, 0, 0x03, 0x0075 },
+        { 330, 330, 2, 2, 118, 1, 0, 0x03, 0x0055 },
+        { 332, 332, 2, 2, 0, 0, 0, 0x03, 0x0075 },
+        { 334, 334, 2, 2, 119, 1, 0, 0x03, 0x0057 },
+        { 336, 336, 2, 2, 0, 0, 0, 0x03, 0x0077 },
+        { 338, 338, 2, 2, 120, 1, 0, 0x03, 0x0059 },
+        { 340, 340, 2, 2, 0, 0, 0, 0x03, 0x0079 },
+        { 342, 342, 2, 2, 121, 1, 0, 0x03, 0x0059 },
+        { 344, 344, 2, 2, 122, 1, 0, 0x03, 0x005A },
+        { 346, 346, 2, 2, 0, 0, 0, 0x03, 0x007A },
+        { 348, 348, 2, 2, 123, 1, 0, 0x03, 0x005A },
+        { 350, 350, 2, 2, 0, 0, 0, 0x03, 0x007A },
+        { 352, 352, 2, 2, 124, 1, 0, 0x03, 0x005A },
+        { 354, 354, 2, 2, 0, 0, 0, 0x03, 0x007A },
+        { 0, 356, 0, 1, 18, 1, 0, 0x12, 0x0000 },
+        { 0, 0, 0, 0, 0, 0, 0, 0x00, 0x0062 },
+        { 0, 0, 0, 0, 125, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 126, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 127, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 128, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 129, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 130, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 131, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 132, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 133, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 134, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 135, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 136, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 137, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 138, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 139, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 140, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 141, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 142, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 143, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 144, 1, 0, 0x00, 0x0000 },
+        { 357, 357, 2, 2, 145, 1, 0, 0x03, 0x004F },
+        { 359, 359, 2, 2, 0, 0, 0, 0x03, 0x006F },
+        { 0, 0, 0, 0, 146, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 147, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 148, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 149, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 150, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 151, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 152, 1, 0, 0x00, 0x0000 },
+        { 361, 361, 2, 2, 153, 1, 0, 0x03, 0x0055 },
+        { 363, 363, 2, 2, 0, 0, 0, 0x03, 0x0075 },
+        { 0, 0, 0, 0, 154, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 155, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 156, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 157, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 158, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 159, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 160, 1, 0, 0x00, 0x0000 },
+        { 0, 365, 0, 3, 161, 1, 0, 0x12, 0x0000 },
+        { 0, 368, 0, 3, 161, 1, 0, 0x12, 0x0000 },
+        { 0, 371, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 374, 0, 2, 162, 1, 0, 0x12, 0x0000 },
+        { 0, 376, 0, 2, 162, 1, 0, 0x12, 0x0000 },
+        { 0, 378, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 380, 0, 2, 163, 1, 0, 0x12, 0x0000 },
+        { 0, 382, 0, 2, 163, 1, 0, 0x12, 0x0000 },
+        { 0, 384, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 386, 386, 2, 2, 164, 1, 0, 0x03, 0x0041 },
+        { 388, 388, 2, 2, 0, 0, 0, 0x03, 0x0061 },
+        { 390, 390, 2, 2, 165, 1, 0, 0x03, 0x0049 },
+        { 392, 392, 2, 2, 0, 0, 0, 0x03, 0x0069 },
+        { 394, 394, 2, 2, 166, 1, 0, 0x03, 0x004F },
+        { 396, 396, 2, 2, 0, 0, 0, 0x03, 0x006F },
+        { 398, 398, 2, 2, 167, 1, 0, 0x03, 0x0055 },
+        { 400, 400, 2, 2, 0, 0, 0, 0x03, 0x0075 },
+        { 402, 402, 3, 3, 168, 1, 0, 0x03, 0x0055 },
+        { 405, 405, 3, 3, 0, 0, 0, 0x03, 0x0075 },
+        { 408, 408, 3, 3, 169, 1, 0, 0x03, 0x0055 },
+        { 411, 411, 3, 3, 0, 0, 0, 0x03, 0x0075 },
+        { 414, 414, 3, 3, 170, 1, 0, 0x03, 0x0055 },
+        { 417, 417, 3, 3, 0, 0, 0, 0x03, 0x0075 },
+        { 420, 420, 3, 3, 171, 1, 0, 0x03, 0x0055 },
+        { 423, 423, 3, 3, 0, 0, 0, 0x03, 0x0075 },
+        { 426, 426, 3, 3, 172, 1, 0, 0x03, 0x0041 },
+        { 429, 429, 3, 3, 0, 0, 0, 0x03, 0x0061 },
+        { 432, 432, 3, 3, 173, 1, 0, 0x03, 0x0041 },
+        { 435, 435, 3, 3, 0, 0, 0, 0x03, 0x0061 },
+        { 438, 438, 2, 2, 174, 1, 0, 0x03, 0x00C6 },
+        { 440, 440, 2, 2, 0, 0, 0, 0x03, 0x00E6 },
+        { 0, 0, 0, 0, 175, 1, 0, 0x00, 0x0000 },
+        { 442, 442, 2, 2, 176, 1, 0, 0x03, 0x0047 },
+        { 444, 444, 2, 2, 0, 0, 0, 0x03, 0x0067 },
+        { 446, 446, 2, 2, 177, 1, 0, 0x03, 0x004B },
+        { 448, 448, 2, 2, 0, 0, 0, 0x03, 0x006B },
+        { 450, 450, 2, 2, 178, 1, 0, 0x03, 0x004F },
+        { 452, 452, 2, 2, 0, 0, 0, 0x03, 0x006F },
+        { 454, 454, 3, 3, 179, 1, 0, 0x03, 0x004F },
+        { 457, 457, 3, 3, 0, 0, 0, 0x03, 0x006F },
+        { 460, 460, 2, 2, 180, 1, 0, 0x03, 0x01B7 },
+        { 462, 462, 2, 2, 0, 0, 0, 0x03, 0x0292 },
+        { 464, 464, 2, 2, 181, 2, 0, 0x03, 0x006A },
+        { 0, 466, 0, 2, 183, 1, 0, 0x12, 0x0000 },
+        { 0, 468, 0, 2, 183, 1, 0, 0x12, 0x0000 },
+        { 0, 470, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 472, 472, 2, 2, 184, 1, 0, 0x03, 0x0047 },
+        { 474, 474, 2, 2, 0, 0, 0, 0x03, 0x0067 },
+        { 0, 0, 0, 0, 185, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 186, 1, 0, 0x00, 0x0000 },
+        { 476, 476, 2, 2, 187, 1, 0, 0x03, 0x004E },
+        { 478, 478, 2, 2, 0, 0, 0, 0x03, 0x006E },
+        { 480, 480, 3, 3, 188, 1, 0, 0x03, 0x0041 },
+        { 483, 483, 3, 3, 0, 0, 0, 0x03, 0x0061 },
+        { 486, 486, 2, 2, 189, 1, 0, 0x03, 0x00C6 },
+        { 488, 488, 2, 2, 0, 0, 0, 0x03, 0x00E6 },
+        { 490, 490, 2, 2, 190, 1, 0, 0x03, 0x00D8 },
+        { 492, 492, 2, 2, 0, 0, 0, 0x03, 0x00F8 },
+        { 494, 494, 2, 2, 191, 1, 0, 0x03, 0x0041 },
+        { 496, 496, 2, 2, 0, 0, 0, 0x03, 0x0061 },
+        { 498, 498, 2, 2, 192, 1, 0, 0x03, 0x0041 },
+        { 500, 500, 2, 2, 0, 0, 0, 0x03, 0x0061 },
+        { 502, 502, 2, 2, 193, 1, 0, 0x03, 0x0045 },
+        { 504, 504, 2, 2, 0, 0, 0, 0x03, 0x0065 },
+        { 506, 506, 2, 2, 194, 1, 0, 0x03, 0x0045 },
+        { 508, 508, 2, 2, 0, 0, 0, 0x03, 0x0065 },
+        { 510, 510, 2, 2, 195, 1, 0, 0x03, 0x0049 },
+        { 512, 512, 2, 2, 0, 0, 0, 0x03, 0x0069 },
+        { 514, 514, 2, 2, 196, 1, 0, 0x03, 0x0049 },
+        { 516, 516, 2, 2, 0, 0, 0, 0x03, 0x0069 },
+        { 518, 518, 2, 2, 197, 1, 0, 0x03, 0x004F },
+        { 520, 520, 2, 2, 0, 0, 0, 0x03, 0x006F },
+        { 522, 522, 2, 2, 198, 1, 0, 0x03, 0x004F },
+        { 524, 524, 2, 2, 0, 0, 0, 0x03, 0x006F },
+        { 526, 526, 2, 2, 199, 1, 0, 0x03, 0x0052 },
+        { 528, 528, 2, 2, 0, 0, 0, 0x03, 0x0072 },
+        { 530, 530, 2, 2, 200, 1, 0, 0x03, 0x0052 },
+        { 532, 532, 2, 2, 0, 0, 0, 0x03, 0x0072 },
+        { 534, 534, 2, 2, 201, 1, 0, 0x03, 0x0055 },
+        { 536, 536, 2, 2, 0, 0, 0, 0x03, 0x0075 },
+        { 538, 538, 2, 2, 202, 1, 0, 0x03, 0x0055 },
+        { 540, 540, 2, 2, 0, 0, 0, 0x03, 0x0075 },
+        { 542, 542, 2, 2, 203, 1, 0, 0x03, 0x0053 },
+        { 544, 544, 2, 2, 0, 0, 0, 0x03, 0x0073 },
+        { 546, 546, 2, 2, 204, 1, 0, 0x03, 0x0054 },
+        { 548, 548, 2, 2, 0, 0, 0, 0x03, 0x0074 },
+        { 0, 0, 0, 0, 205, 1, 0, 0x00, 0x0000 },
+        { 550, 550, 2, 2, 206, 1, 0, 0x03, 0x0048 },
+        { 552, 552, 2, 2, 0, 0, 0, 0x03, 0x0068 },
+        { 0, 0, 0, 0, 207, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 208, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 209, 1, 0, 0x00, 0x0000 },
+        { 554, 554, 2, 2, 210, 1, 0, 0x03, 0x0041 },
+        { 556, 556, 2, 2, 0, 0, 0, 0x03, 0x0061 },
+        { 558, 558, 2, 2, 211, 1, 0, 0x03, 0x0045 },
+        { 560, 560, 2, 2, 0, 0, 0, 0x03, 0x0065 },
+        { 562, 562, 3, 3, 212, 1, 0, 0x03, 0x004F },
+        { 565, 565, 3, 3, 0, 0, 0, 0x03, 0x006F },
+        { 568, 568, 3, 3, 213, 1, 0, 0x03, 0x004F },
+        { 571, 571, 3, 3, 0, 0, 0, 0x03, 0x006F },
+        { 574, 574, 2, 2, 214, 1, 0, 0x03, 0x004F },
+        { 576, 576, 2, 2, 0, 0, 0, 0x03, 0x006F },
+        { 578, 578, 3, 3, 215, 1, 0, 0x03, 0x004F },
+        { 581, 581, 3, 3, 0, 0, 0, 0x03, 0x006F },
+        { 584, 584, 2, 2, 216, 1, 0, 0x03, 0x0059 },
+        { 586, 586, 2, 2, 0, 0, 0, 0x03, 0x0079 },
+        { 0, 0, 0, 0, 217, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 218, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 219, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 220, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 221, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 222, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 223, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 224, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 225, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 226, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 227, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 228, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 229, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 0, 0, 0, 0x00, 0x0069 },
+        { 0, 588, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 589, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 590, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 591, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 592, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 593, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 594, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 595, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 596, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 597, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 599, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 601, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 603, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 605, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 607, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 609, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 610, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 356, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 611, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 612, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 0, 0, 0, 0, 0, 230, 0x28, 0x0000 },
+        { 0, 0, 0, 0, 0, 0, 230, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 0, 0, 232, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 0, 0, 220, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 0, 0, 216, 0x28, 0x0000 },
+        { 0, 0, 0, 0, 0, 0, 202, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 0, 0, 220, 0x28, 0x0000 },
+        { 0, 0, 0, 0, 0, 0, 202, 0x28, 0x0000 },
+        { 0, 0, 0, 0, 0, 0, 1, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 0, 0, 1, 0x28, 0x0000 },
+        { 613, 613, 1, 1, 0, 0, 230, 0x17, 0x0000 },
+        { 614, 614, 1, 1, 0, 0, 230, 0x17, 0x0000 },
+        { 615, 615, 1, 1, 0, 0, 230, 0x17, 0x0000 },
+        { 616, 616, 2, 2, 0, 0, 230, 0x17, 0x0000 },
+        { 0, 0, 0, 0, 230, 1, 240, 0x28, 0x0000 },
+        { 0, 0, 0, 0, 0, 0, 233, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 0, 0, 234, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 231, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 232, 1, 0, 0x00, 0x0000 },
+        { 618, 618, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 0, 0, 0, 0, 233, 1, 0, 0x00, 0x0000 },
+        { 0, 619, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 621, 621, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 0, 0, 0, 0, 234, 1, 0, 0x00, 0x0000 },
+        { 622, 624, 2, 3, 0, 0, 0, 0x13, 0x00A8 },
+        { 627, 627, 2, 2, 235, 1, 0, 0x03, 0x0391 },
+        { 629, 629, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 630, 630, 2, 2, 236, 1, 0, 0x03, 0x0395 },
+        { 632, 632, 2, 2, 237, 1, 0, 0x03, 0x0397 },
+        { 634, 634, 2, 2, 238, 1, 0, 0x03, 0x0399 },
+        { 636, 636, 2, 2, 239, 1, 0, 0x03, 0x039F },
+        { 638, 638, 2, 2, 240, 1, 0, 0x03, 0x03A5 },
+        { 640, 640, 2, 2, 241, 1, 0, 0x03, 0x03A9 },
+        { 642, 642, 3, 3, 242, 3, 0, 0x03, 0x03B9 },
+        { 0, 0, 0, 0, 245, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 246, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 247, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 248, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 249, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 250, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 251, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 252, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 230, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 253, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 254, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 26, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 255, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 256, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 257, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 258, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 259, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 260, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 261, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 262, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 263, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 264, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 265, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 266, 1, 0, 0x00, 0x0000 },
+        { 645, 645, 2, 2, 267, 1, 0, 0x03, 0x0399 },
+        { 647, 647, 2, 2, 268, 1, 0, 0x03, 0x03A5 },
+        { 649, 649, 2, 2, 0, 0, 0, 0x03, 0x03B1 },
+        { 651, 651, 2, 2, 0, 0, 0, 0x03, 0x03B5 },
+        { 653, 653, 2, 2, 0, 0, 0, 0x03, 0x03B7 },
+        { 655, 655, 2, 2, 0, 0, 0, 0x03, 0x03B9 },
+        { 657, 657, 3, 3, 269, 3, 0, 0x03, 0x03C5 },
+        { 660, 660, 2, 2, 0, 0, 0, 0x03, 0x03B9 },
+        { 662, 662, 2, 2, 0, 0, 0, 0x03, 0x03C5 },
+        { 664, 664, 2, 2, 0, 0, 0, 0x03, 0x03BF },
+        { 666, 666, 2, 2, 0, 0, 0, 0x03, 0x03C5 },
+        { 668, 668, 2, 2, 0, 0, 0, 0x03, 0x03C9 },
+        { 0, 0, 0, 0, 272, 1, 0, 0x00, 0x0000 },
+        { 0, 670, 0, 1, 246, 1, 0, 0x12, 0x0000 },
+        { 0, 671, 0, 1, 252, 1, 0, 0x12, 0x0000 },
+        { 0, 672, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 673, 638, 2, 2, 0, 0, 0, 0x13, 0x03D2 },
+        { 675, 647, 2, 2, 0, 0, 0, 0x13, 0x03D2 },
+        { 0, 677, 0, 1, 263, 1, 0, 0x12, 0x0000 },
+        { 0, 678, 0, 1, 258, 1, 0, 0x12, 0x0000 },
+        { 0, 0, 0, 0, 273, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 274, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 275, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 276, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 277, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 278, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 279, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 280, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 281, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 282, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 283, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 284, 1, 0, 0x00, 0x0000 },
+        { 0, 679, 0, 1, 253, 1, 0, 0x12, 0x0000 },
+        { 0, 680, 0, 1, 259, 1, 0, 0x12, 0x0000 },
+        { 0, 681, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 682, 0, 1, 252, 1, 0, 0x12, 0x0000 },
+        { 0, 683, 0, 1, 249, 1, 0, 0x12, 0x0000 },
+        { 0, 0, 0, 0, 285, 1, 0, 0x00, 0x0000 },
+        { 0, 684, 0, 1, 286, 1, 0, 0x12, 0x0000 },
+        { 0, 0, 0, 0, 287, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 288, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 289, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 290, 1, 0, 0x00, 0x0000 },
+        { 685, 685, 2, 2, 291, 1, 0, 0x03, 0x0415 },
+        { 687, 687, 2, 2, 292, 1, 0, 0x03, 0x0415 },
+        { 0, 0, 0, 0, 293, 1, 0, 0x00, 0x0000 },
+        { 689, 689, 2, 2, 294, 1, 0, 0x03, 0x0413 },
+        { 0, 0, 0, 0, 295, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 296, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 297, 1, 0, 0x00, 0x0000 },
+        { 691, 691, 2, 2, 298, 1, 0, 0x03, 0x0406 },
+        { 0, 0, 0, 0, 299, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 300, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 301, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 302, 1, 0, 0x00, 0x0000 },
+        { 693, 693, 2, 2, 303, 1, 0, 0x03, 0x041A },
+        { 695, 695, 2, 2, 304, 1, 0, 0x03, 0x0418 },
+        { 697, 697, 2, 2, 305, 1, 0, 0x03, 0x0423 },
+        { 0, 0, 0, 0, 306, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 307, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 308, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 309, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 310, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 311, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 312, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 313, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 314, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 315, 1, 0, 0x00, 0x0000 },
+        { 699, 699, 2, 2, 316, 1, 0, 0x03, 0x0418 },
+        { 0, 0, 0, 0, 317, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 318, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 319, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 320, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 321, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 322, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 323, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 324, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 325, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 326, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 327, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 328, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 329, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 330, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 331, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 332, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 333, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 334, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 335, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 336, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 337, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 338, 1, 0, 0x00, 0x0000 },
+        { 701, 701, 2, 2, 0, 0, 0, 0x03, 0x0438 },
+        { 703, 703, 2, 2, 0, 0, 0, 0x03, 0x0435 },
+        { 705, 705, 2, 2, 0, 0, 0, 0x03, 0x0435 },
+        { 707, 707, 2, 2, 0, 0, 0, 0x03, 0x0433 },
+        { 709, 709, 2, 2, 0, 0, 0, 0x03, 0x0456 },
+        { 711, 711, 2, 2, 0, 0, 0, 0x03, 0x043A },
+        { 713, 713, 2, 2, 0, 0, 0, 0x03, 0x0438 },
+        { 715, 715, 2, 2, 0, 0, 0, 0x03, 0x0443 },
+        { 0, 0, 0, 0, 339, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 340, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 341, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 342, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 343, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 344, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 345, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 346, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 347, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 348, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 349, 1, 0, 0x00, 0x0000 },
+        { 717, 717, 2, 2, 350, 1, 0, 0x03, 0x0474 },
+        { 719, 719, 2, 2, 0, 0, 0, 0x03, 0x0475 },
+        { 0, 0, 0, 0, 351, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 352, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 353, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 354, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 355, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 356, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 357, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 358, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 359, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 360, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 361, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 362, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 363, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 364, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 365, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 366, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 367, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 368, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 369, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 370, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 371, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 372, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 373, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 374, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 375, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 376, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 377, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 378, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 379, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 380, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 381, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 382, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 383, 1, 0, 0x00, 0x0000 },
+        { 721, 721, 2, 2, 384, 1, 0, 0x03, 0x0416 },
+        { 723, 723, 2, 2, 0, 0, 0, 0x03, 0x0436 },
+        { 0, 0, 0, 0, 385, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 386, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 387, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 388, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 389, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 390, 1, 0, 0x00, 0x0000 },
+        { 725, 725, 2, 2, 391, 1, 0, 0x03, 0x0410 },
+        { 727, 727, 2, 2, 0, 0, 0, 0x03, 0x0430 },
+        { 729, 729, 2, 2, 392, 1, 0, 0x03, 0x0410 },
+        { 731, 731, 2, 2, 0, 0, 0, 0x03, 0x0430 },
+        { 0, 0, 0, 0, 393, 1, 0, 0x00, 0x0000 },
+        { 733, 733, 2, 2, 394, 1, 0, 0x03, 0x0415 },
+        { 735, 735, 2, 2, 0, 0, 0, 0x03, 0x0435 },
+        { 0, 0, 0, 0, 395, 1, 0, 0x00, 0x0000 },
+        { 737, 737, 2, 2, 396, 1, 0, 0x03, 0x04D8 },
+        { 739, 739, 2, 2, 0, 0, 0, 0x03, 0x04D9 },
+        { 741, 741, 2, 2, 397, 1, 0, 0x03, 0x0416 },
+        { 743, 743, 2, 2, 0, 0, 0, 0x03, 0x0436 },
+        { 745, 745, 2, 2, 398, 1, 0, 0x03, 0x0417 },
+        { 747, 747, 2, 2, 0, 0, 0, 0x03, 0x0437 },
+        { 0, 0, 0, 0, 399, 1, 0, 0x00, 0x0000 },
+        { 749, 749, 2, 2, 400, 1, 0, 0x03, 0x0418 },
+        { 751, 751, 2, 2, 0, 0, 0, 0x03, 0x0438 },
+        { 753, 753, 2, 2, 401, 1, 0, 0x03, 0x0418 },
+        { 755, 755, 2, 2, 0, 0, 0, 0x03, 0x0438 },
+        { 757, 757, 2, 2, 402, 1, 0, 0x03, 0x041E },
+        { 759, 759, 2, 2, 0, 0, 0, 0x03, 0x043E },
+        { 0, 0, 0, 0, 403, 1, 0, 0x00, 0x0000 },
+        { 761, 761, 2, 2, 404, 1, 0, 0x03, 0x04E8 },
+        { 763, 763, 2, 2, 0, 0, 0, 0x03, 0x04E9 },
+        { 765, 765, 2, 2, 405, 1, 0, 0x03, 0x042D },
+        { 767, 767, 2, 2, 0, 0, 0, 0x03, 0x044D },
+        { 769, 769, 2, 2, 406, 1, 0, 0x03, 0x0423 },
+        { 771, 771, 2, 2, 0, 0, 0, 0x03, 0x0443 },
+        { 773, 773, 2, 2, 407, 1, 0, 0x03, 0x0423 },
+        { 775, 775, 2, 2, 0, 0, 0, 0x03, 0x0443 },
+        { 777, 777, 2, 2, 408, 1, 0, 0x03, 0x0423 },
+        { 779, 779, 2, 2, 0, 0, 0, 0x03, 0x0443 },
+        { 781, 781, 2, 2, 409, 1, 0, 0x03, 0x0427 },
+        { 783, 783, 2, 2, 0, 0, 0, 0x03, 0x0447 },
+        { 0, 0, 0, 0, 410, 1, 0, 0x00, 0x0000 },
+        { 785, 785, 2, 2, 411, 1, 0, 0x03, 0x042B },
+        { 787, 787, 2, 2, 0, 0, 0, 0x03, 0x044B },
+        { 0, 0, 0, 0, 412, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 413, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 414, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 415, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 416, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 417, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 418, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 419, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 420, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 421, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 422, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 423, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 424, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 425, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 426, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 427, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 428, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 429, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 430, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 431, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 432, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 433, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 434, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 435, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 436, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 437, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 438, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 439, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 440, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 441, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 442, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 443, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 444, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 445, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 446, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 447, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 448, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 449, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 450, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 451, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 452, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 453, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 454, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 455, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 456, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 457, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 458, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 459, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 460, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 461, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 462, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 463, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 464, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 465, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 466, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 467, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 468, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 469, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 470, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 471, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 472, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 473, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 474, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 475, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 476, 1, 0, 0x00, 0x0000 },
+        { 0, 789, 0, 2, 477, 2, 0, 0x12, 0x0000 },
+        { 0, 0, 0, 0, 0, 0, 222, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 0, 0, 228, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 0, 0, 10, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 0, 0, 11, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 0, 0, 12, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 0, 0, 13, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 0, 0, 14, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 0, 0, 15, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 0, 0, 16, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 0, 0, 17, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 0, 0, 18, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 0, 0, 19, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 0, 0, 20, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 0, 0, 21, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 0, 0, 22, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 0, 0, 23, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 0, 0, 24, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 0, 0, 25, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 0, 0, 30, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 0, 0, 31, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 0, 0, 32, 0x00, 0x0000 },
+        { 791, 791, 2, 2, 0, 0, 0, 0x03, 0x0627 },
+        { 793, 793, 2, 2, 0, 0, 0, 0x03, 0x0627 },
+        { 795, 795, 2, 2, 0, 0, 0, 0x03, 0x0648 },
+        { 797, 797, 2, 2, 0, 0, 0, 0x03, 0x0627 },
+        { 799, 799, 2, 2, 0, 0, 0, 0x03, 0x064A },
+        { 0, 0, 0, 0, 0, 0, 27, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 0, 0, 28, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 0, 0, 29, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 0, 0, 33, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 0, 0, 34, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 0, 0, 35, 0x00, 0x0000 },
+        { 0, 801, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 803, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 805, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 807, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 809, 809, 2, 2, 0, 0, 0, 0x03, 0x06D5 },
+        { 811, 811, 2, 2, 0, 0, 0, 0x03, 0x06C1 },
+        { 813, 813, 2, 2, 0, 0, 0, 0x03, 0x06D2 },
+        { 0, 0, 0, 0, 0, 0, 36, 0x00, 0x0000 },
+        { 815, 815, 2, 2, 0, 0, 0, 0x03, 0x0928 },
+        { 817, 817, 2, 2, 0, 0, 0, 0x03, 0x0930 },
+        { 819, 819, 2, 2, 0, 0, 0, 0x03, 0x0933 },
+        { 0, 0, 0, 0, 0, 0, 7, 0x28, 0x0000 },
+        { 0, 0, 0, 0, 0, 0, 9, 0x00, 0x0000 },
+        { 821, 821, 2, 2, 0, 0, 0, 0x17, 0x0915 },
+        { 823, 823, 2, 2, 0, 0, 0, 0x17, 0x0916 },
+        { 825, 825, 2, 2, 0, 0, 0, 0x17, 0x0917 },
+        { 827, 827, 2, 2, 0, 0, 0, 0x17, 0x091C },
+        { 829, 829, 2, 2, 0, 0, 0, 0x17, 0x0921 },
+        { 831, 831, 2, 2, 0, 0, 0, 0x17, 0x0922 },
+        { 833, 833, 2, 2, 0, 0, 0, 0x17, 0x092B },
+        { 835, 835, 2, 2, 0, 0, 0, 0x17, 0x092F },
+        { 0, 0, 0, 0, 0, 0, 7, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 0, 0, 0, 0x28, 0x0000 },
+        { 837, 837, 2, 2, 0, 0, 0, 0x03, 0x0000 },
+        { 839, 839, 2, 2, 0, 0, 0, 0x03, 0x0000 },
+        { 841, 841, 2, 2, 0, 0, 0, 0x17, 0x09A1 },
+        { 843, 843, 2, 2, 0, 0, 0, 0x17, 0x09A2 },
+        { 845, 845, 2, 2, 0, 0, 0, 0x17, 0x09AF },
+        { 847, 847, 2, 2, 0, 0, 0, 0x17, 0x0A32 },
+        { 849, 849, 2, 2, 0, 0, 0, 0x17, 0x0A38 },
+        { 851, 851, 2, 2, 0, 0, 0, 0x17, 0x0A16 },
+        { 853, 853, 2, 2, 0, 0, 0, 0x17, 0x0A17 },
+        { 855, 855, 2, 2, 0, 0, 0, 0x17, 0x0A1C },
+        { 857, 857, 2, 2, 0, 0, 0, 0x17, 0x0A2B },
+        { 859, 859, 2, 2, 0, 0, 0, 0x03, 0x0000 },
+        { 861, 861, 2, 2, 0, 0, 0, 0x03, 0x0000 },
+        { 863, 863, 2, 2, 0, 0, 0, 0x03, 0x0000 },
+        { 865, 865, 2, 2, 0, 0, 0, 0x17, 0x0B21 },
+        { 867, 867, 2, 2, 0, 0, 0, 0x17, 0x0B22 },
+        { 869, 869, 2, 2, 0, 0, 0, 0x03, 0x0000 },
+        { 871, 871, 2, 2, 0, 0, 0, 0x03, 0x0000 },
+        { 873, 873, 2, 2, 0, 0, 0, 0x03, 0x0000 },
+        { 875, 875, 2, 2, 0, 0, 0, 0x03, 0x0000 },
+        { 877, 877, 2, 2, 0, 0, 0, 0x03, 0x0C46 },
+        { 0, 0, 0, 0, 0, 0, 84, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 0, 0, 91, 0x28, 0x0000 },
+        { 879, 879, 2, 2, 0, 0, 0, 0x03, 0x0000 },
+        { 881, 881, 2, 2, 0, 0, 0, 0x03, 0x0000 },
+        { 883, 883, 2, 2, 0, 0, 0, 0x03, 0x0000 },
+        { 885, 885, 2, 2, 0, 0, 0, 0x03, 0x0000 },
+        { 887, 887, 3, 3, 0, 0, 0, 0x03, 0x0000 },
+        { 890, 890, 2, 2, 0, 0, 0, 0x03, 0x0000 },
+        { 892, 892, 2, 2, 0, 0, 0, 0x03, 0x0000 },
+        { 894, 894, 2, 2, 0, 0, 0, 0x03, 0x0000 },
+        { 0, 0, 0, 0, 0, 0, 9, 0x28, 0x0000 },
+        { 896, 896, 2, 2, 0, 0, 0, 0x03, 0x0DD9 },
+        { 898, 898, 2, 2, 0, 0, 0, 0x03, 0x0000 },
+        { 900, 900, 3, 3, 0, 0, 0, 0x03, 0x0000 },
+        { 903, 903, 2, 2, 0, 0, 0, 0x03, 0x0000 },
+        { 0, 905, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 0, 0, 0, 0, 0, 103, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 0, 0, 107, 0x00, 0x0000 },
+        { 0, 907, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 0, 0, 0, 0, 0, 118, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 0, 0, 122, 0x00, 0x0000 },
+        { 0, 909, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 911, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 913, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 0, 0, 0, 0, 0, 216, 0x00, 0x0000 },
+        { 914, 914, 2, 2, 0, 0, 0, 0x17, 0x0000 },
+        { 916, 916, 2, 2, 0, 0, 0, 0x17, 0x0000 },
+        { 918, 918, 2, 2, 0, 0, 0, 0x17, 0x0000 },
+        { 920, 920, 2, 2, 0, 0, 0, 0x17, 0x0000 },
+        { 922, 922, 2, 2, 0, 0, 0, 0x17, 0x0000 },
+        { 924, 924, 2, 2, 0, 0, 0, 0x17, 0x0000 },
+        { 0, 0, 0, 0, 0, 0, 129, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 0, 0, 130, 0x00, 0x0000 },
+        { 926, 926, 2, 2, 0, 0, 0, 0x17, 0x0000 },
+        { 0, 0, 0, 0, 0, 0, 132, 0x00, 0x0000 },
+        { 928, 928, 2, 2, 0, 0, 0, 0x17, 0x0000 },
+        { 930, 930, 2, 2, 0, 0, 0, 0x17, 0x0FB2 },
+        { 0, 932, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 935, 935, 2, 2, 0, 0, 0, 0x17, 0x0FB3 },
+        { 0, 937, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 940, 940, 2, 2, 0, 0, 0, 0x17, 0x0000 },
+        { 942, 942, 2, 2, 0, 0, 0, 0x17, 0x0000 },
+        { 944, 944, 2, 2, 0, 0, 0, 0x17, 0x0000 },
+        { 946, 946, 2, 2, 0, 0, 0, 0x17, 0x0000 },
+        { 948, 948, 2, 2, 0, 0, 0, 0x17, 0x0000 },
+        { 950, 950, 2, 2, 0, 0, 0, 0x17, 0x0000 },
+        { 952, 952, 2, 2, 0, 0, 0, 0x17, 0x0000 },
+        { 954, 954, 2, 2, 0, 0, 0, 0x03, 0x0000 },
+        { 0, 0, 0, 0, 479, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 480, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 481, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 482, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 483, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 484, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 485, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 486, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 487, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 488, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 489, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 490, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 491, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 492, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 493, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 494, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 495, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 496, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 497, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 498, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 499, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 500, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 501, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 502, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 503, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 504, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 505, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 506, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 507, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 508, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 509, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 510, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 511, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 512, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 513, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 514, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 515, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 516, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 517, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 518, 1, 0, 0x00, 0x0000 },
+        { 0, 956, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 0, 0, 0, 519, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 520, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 521, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 522, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 523, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 524, 1, 0, 0x00, 0x0000 },
+        { 957, 957, 2, 2, 0, 0, 0, 0x03, 0x0000 },
+        { 959, 959, 2, 2, 0, 0, 0, 0x03, 0x0000 },
+        { 961, 961, 2, 2, 0, 0, 0, 0x03, 0x0000 },
+        { 963, 963, 2, 2, 0, 0, 0, 0x03, 0x0000 },
+        { 965, 965, 2, 2, 0, 0, 0, 0x03, 0x0000 },
+        { 967, 967, 2, 2, 0, 0, 0, 0x03, 0x0000 },
+        { 969, 969, 2, 2, 0, 0, 0, 0x03, 0x0000 },
+        { 971, 971, 2, 2, 0, 0, 0, 0x03, 0x0000 },
+        { 973, 973, 2, 2, 0, 0, 0, 0x03, 0x0000 },
+        { 975, 975, 2, 2, 0, 0, 0, 0x03, 0x0000 },
+        { 977, 977, 2, 2, 0, 0, 0, 0x03, 0x0000 },
+        { 0, 0, 0, 0, 525, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 526, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 527, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 528, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 529, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 530, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 531, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 532, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 533, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 534, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 535, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 536, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 537, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 538, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 539, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 540, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 541, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 542, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 543, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 544, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 545, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 546, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 547, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 548, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 549, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 550, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 551, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 552, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 553, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 554, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 555, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 556, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 557, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 558, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 559, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 560, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 561, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 562, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 563, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 564, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 565, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 566, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 567, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 568, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 569, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 570, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 571, 1, 0, 0x00, 0x0000 },
+        { 0, 979, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 980, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 981, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 982, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 983, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 984, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 985, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 986, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 987, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 988, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 989, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 990, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 991, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 992, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 993, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 994, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 995, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 996, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 997, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 998, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 999, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 1000, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 1001, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 1002, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 1003, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 1004, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 1005, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 1006, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 1007, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 1008, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 1009, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 1010, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 1011, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 1012, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 1013, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 1014, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 1015, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 1016, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 1017, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 1018, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 1019, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 1020, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 1021, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 1022, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 670, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 1023, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 1024, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 677, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 1025, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 1026, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 680, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 1027, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 1028, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 1029, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 1030, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 1031, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 1032, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 1033, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 1034, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 1035, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 1036, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 1037, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 1038, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 1039, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 1040, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 1041, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 1042, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 1043, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 1044, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 1045, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 1046, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 1047, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 1048, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 1049, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 1050, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 1051, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 1052, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 1053, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 1054, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 1055, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 1056, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 1057, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 1058, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 1059, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 1060, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 1061, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 1062, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 671, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 0, 0, 0, 0, 0, 214, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 0, 0, 218, 0x00, 0x0000 },
+        { 1063, 1063, 2, 2, 572, 1, 0, 0x03, 0x0041 },
+        { 1065, 1065, 2, 2, 0, 0, 0, 0x03, 0x0061 },
+        { 1067, 1067, 2, 2, 573, 1, 0, 0x03, 0x0042 },
+        { 1069, 1069, 2, 2, 0, 0, 0, 0x03, 0x0062 },
+        { 1071, 1071, 2, 2, 574, 1, 0, 0x03, 0x0042 },
+        { 1073, 1073, 2, 2, 0, 0, 0, 0x03, 0x0062 },
+        { 1075, 1075, 2, 2, 575, 1, 0, 0x03, 0x0042 },
+        { 1077, 1077, 2, 2, 0, 0, 0, 0x03, 0x0062 },
+        { 1079, 1079, 3, 3, 576, 1, 0, 0x03, 0x0043 },
+        { 1082, 1082, 3, 3, 0, 0, 0, 0x03, 0x0063 },
+        { 1085, 1085, 2, 2, 577, 1, 0, 0x03, 0x0044 },
+        { 1087, 1087, 2, 2, 0, 0, 0, 0x03, 0x0064 },
+        { 1089, 1089, 2, 2, 578, 1, 0, 0x03, 0x0044 },
+        { 1091, 1091, 2, 2, 0, 0, 0, 0x03, 0x0064 },
+        { 1093, 1093, 2, 2, 579, 1, 0, 0x03, 0x0044 },
+        { 1095, 1095, 2, 2, 0, 0, 0, 0x03, 0x0064 },
+        { 1097, 1097, 2, 2, 580, 1, 0, 0x03, 0x0044 },
+        { 1099, 1099, 2, 2, 0, 0, 0, 0x03, 0x0064 },
+        { 1101, 1101, 2, 2, 581, 1, 0, 0x03, 0x0044 },
+        { 1103, 1103, 2, 2, 0, 0, 0, 0x03, 0x0064 },
+        { 1105, 1105, 3, 3, 582, 1, 0, 0x03, 0x0045 },
+        { 1108, 1108, 3, 3, 0, 0, 0, 0x03, 0x0065 },
+        { 1111, 1111, 3, 3, 583, 1, 0, 0x03, 0x0045 },
+        { 1114, 1114, 3, 3, 0, 0, 0, 0x03, 0x0065 },
+        { 1117, 1117, 2, 2, 584, 1, 0, 0x03, 0x0045 },
+        { 1119, 1119, 2, 2, 0, 0, 0, 0x03, 0x0065 },
+        { 1121, 1121, 2, 2, 585, 1, 0, 0x03, 0x0045 },
+        { 1123, 1123, 2, 2, 0, 0, 0, 0x03, 0x0065 },
+        { 1125, 1125, 3, 3, 586, 1, 0, 0x03, 0x0045 },
+        { 1128, 1128, 3, 3, 0, 0, 0, 0x03, 0x0065 },
+        { 1131, 1131, 2, 2, 587, 1, 0, 0x03, 0x0046 },
+        { 1133, 1133, 2, 2, 0, 0, 0, 0x03, 0x0066 },
+        { 1135, 1135, 2, 2, 588, 1, 0, 0x03, 0x0047 },
+        { 1137, 1137, 2, 2, 0, 0, 0, 0x03, 0x0067 },
+        { 1139, 1139, 2, 2, 589, 1, 0, 0x03, 0x0048 },
+        { 1141, 1141, 2, 2, 0, 0, 0, 0x03, 0x0068 },
+        { 1143, 1143, 2, 2, 590, 1, 0, 0x03, 0x0048 },
+        { 1145, 1145, 2, 2, 0, 0, 0, 0x03, 0x0068 },
+        { 1147, 1147, 2, 2, 591, 1, 0, 0x03, 0x0048 },
+        { 1149, 1149, 2, 2, 0, 0, 0, 0x03, 0x0068 },
+        { 1151, 1151, 2, 2, 592, 1, 0, 0x03, 0x0048 },
+        { 1153, 1153, 2, 2, 0, 0, 0, 0x03, 0x0068 },
+        { 1155, 1155, 2, 2, 593, 1, 0, 0x03, 0x0048 },
+        { 1157, 1157, 2, 2, 0, 0, 0, 0x03, 0x0068 },
+        { 1159, 1159, 2, 2, 594, 1, 0, 0x03, 0x0049 },
+        { 1161, 1161, 2, 2, 0, 0, 0, 0x03, 0x0069 },
+        { 1163, 1163, 3, 3, 595, 1, 0, 0x03, 0x0049 },
+        { 1166, 1166, 3, 3, 0, 0, 0, 0x03, 0x0069 },
+        { 1169, 1169, 2, 2, 596, 1, 0, 0x03, 0x004B },
+        { 1171, 1171, 2, 2, 0, 0, 0, 0x03, 0x006B },
+        { 1173, 1173, 2, 2, 597, 1, 0, 0x03, 0x004B },
+        { 1175, 1175, 2, 2, 0, 0, 0, 0x03, 0x006B },
+        { 1177, 1177, 2, 2, 598, 1, 0, 0x03, 0x004B },
+        { 1179, 1179, 2, 2, 0, 0, 0, 0x03, 0x006B },
+        { 1181, 1181, 2, 2, 599, 1, 0, 0x03, 0x004C },
+        { 1183, 1183, 2, 2, 0, 0, 0, 0x03, 0x006C },
+        { 1185, 1185, 3, 3, 600, 1, 0, 0x03, 0x004C },
+        { 1188, 1188, 3, 3, 0, 0, 0, 0x03, 0x006C },
+        { 1191, 1191, 2, 2, 601, 1, 0, 0x03, 0x004C },
+        { 1193, 1193, 2, 2, 0, 0, 0, 0x03, 0x006C },
+        { 1195, 1195, 2, 2, 602, 1, 0, 0x03, 0x004C },
+        { 1197, 1197, 2, 2, 0, 0, 0, 0x03, 0x006C },
+        { 1199, 1199, 2, 2, 603, 1, 0, 0x03, 0x004D },
+        { 1201, 1201, 2, 2, 0, 0, 0, 0x03, 0x006D },
+        { 1203, 1203, 2, 2, 604, 1, 0, 0x03, 0x004D },
+        { 1205, 1205, 2, 2, 0, 0, 0, 0x03, 0x006D },
+        { 1207, 1207, 2, 2, 605, 1, 0, 0x03, 0x004D },
+        { 1209, 1209, 2, 2, 0, 0, 0, 0x03, 0x006D },
+        { 1211, 1211, 2, 2, 606, 1, 0, 0x03, 0x004E },
+        { 1213, 1213, 2, 2, 0, 0, 0, 0x03, 0x006E },
+        { 1215, 1215, 2, 2, 607, 1, 0, 0x03, 0x004E },
+        { 1217, 1217, 2, 2, 0, 0, 0, 0x03, 0x006E },
+        { 1219, 1219, 2, 2, 608, 1, 0, 0x03, 0x004E },
+        { 1221, 1221, 2, 2, 0, 0, 0, 0x03, 0x006E },
+        { 1223, 1223, 2, 2, 609, 1, 0, 0x03, 0x004E },
+        { 1225, 1225, 2, 2, 0, 0, 0, 0x03, 0x006E },
+        { 1227, 1227, 3, 3, 610, 1, 0, 0x03, 0x004F },
+        { 1230, 1230, 3, 3, 0, 0, 0, 0x03, 0x006F },
+        { 1233, 1233, 3, 3, 611, 1, 0, 0x03, 0x004F },
+        { 1236, 1236, 3, 3, 0, 0, 0, 0x03, 0x006F },
+        { 1239, 1239, 3, 3, 612, 1, 0, 0x03, 0x004F },
+        { 1242, 1242, 3, 3, 0, 0, 0, 0x03, 0x006F },
+        { 1245, 1245, 3, 3, 613, 1, 0, 0x03, 0x004F },
+        { 1248, 1248, 3, 3, 0, 0, 0, 0x03, 0x006F },
+        { 1251, 1251, 2, 2, 614, 1, 0, 0x03, 0x0050 },
+        { 1253, 1253, 2, 2, 0, 0, 0, 0x03, 0x0070 },
+        { 1255, 1255, 2, 2, 615, 1, 0, 0x03, 0x0050 },
+        { 1257, 1257, 2, 2, 0, 0, 0, 0x03, 0x0070 },
+        { 1259, 1259, 2, 2, 616, 1, 0, 0x03, 0x0052 },
+        { 1261, 1261, 2, 2, 0, 0, 0, 0x03, 0x0072 },
+        { 1263, 1263, 2, 2, 617, 1, 0, 0x03, 0x0052 },
+        { 1265, 1265, 2, 2, 0, 0, 0, 0x03, 0x0072 },
+        { 1267, 1267, 3, 3, 618, 1, 0, 0x03, 0x0052 },
+        { 1270, 1270, 3, 3, 0, 0, 0, 0x03, 0x0072 },
+        { 1273, 1273, 2, 2, 619, 1, 0, 0x03, 0x0052 },
+        { 1275, 1275, 2, 2, 0, 0, 0, 0x03, 0x0072 },
+        { 1277, 1277, 2, 2, 620, 1, 0, 0x03, 0x0053 },
+        { 1279, 1279, 2, 2, 0, 0, 0, 0x03, 0x0073 },
+        { 1281, 1281, 2, 2, 621, 1, 0, 0x03, 0x0053 },
+        { 1283, 1283, 2, 2, 0, 0, 0, 0x03, 0x0073 },
+        { 1285, 1285, 3, 3, 622, 1, 0, 0x03, 0x0053 },
+        { 1288, 1288, 3, 3, 0, 0, 0, 0x03, 0x0073 },
+        { 1291, 1291, 3, 3, 623, 1, 0, 0x03, 0x0053 },
+        { 1294, 1294, 3, 3, 0, 0, 0, 0x03, 0x0073 },
+        { 1297, 1297, 3, 3, 624, 1, 0, 0x03, 0x0053 },
+        { 1300, 1300, 3, 3, 0, 0, 0, 0x03, 0x0073 },
+        { 1303, 1303, 2, 2, 625, 1, 0, 0x03, 0x0054 },
+        { 1305, 1305, 2, 2, 0, 0, 0, 0x03, 0x0074 },
+        { 1307, 1307, 2, 2, 626, 1, 0, 0x03, 0x0054 },
+        { 1309, 1309, 2, 2, 0, 0, 0, 0x03, 0x0074 },
+        { 1311, 1311, 2, 2, 627, 1, 0, 0x03, 0x0054 },
+        { 1313, 1313, 2, 2, 0, 0, 0, 0x03, 0x0074 },
+        { 1315, 1315, 2, 2, 628, 1, 0, 0x03, 0x0054 },
+        { 1317, 1317, 2, 2, 0, 0, 0, 0x03, 0x0074 },
+        { 1319, 1319, 2, 2, 629, 1, 0, 0x03, 0x0055 },
+        { 1321, 1321, 2, 2, 0, 0, 0, 0x03, 0x0075 },
+        { 1323, 1323, 2, 2, 630, 1, 0, 0x03, 0x0055 },
+        { 1325, 1325, 2, 2, 0, 0, 0, 0x03, 0x0075 },
+        { 1327, 1327, 2, 2, 631, 1, 0, 0x03, 0x0055 },
+        { 1329, 1329, 2, 2, 0, 0, 0, 0x03, 0x0075 },
+        { 1331, 1331, 3, 3, 632, 1, 0, 0x03, 0x0055 },
+        { 1334, 1334, 3, 3, 0, 0, 0, 0x03, 0x0075 },
+        { 1337, 1337, 3, 3, 633, 1, 0, 0x03, 0x0055 },
+        { 1340, 1340, 3, 3, 0, 0, 0, 0x03, 0x0075 },
+        { 1343, 1343, 2, 2, 634, 1, 0, 0x03, 0x0056 },
+        { 1345, 1345, 2, 2, 0, 0, 0, 0x03, 0x0076 },
+        { 1347, 1347, 2, 2, 635, 1, 0, 0x03, 0x0056 },
+        { 1349, 1349, 2, 2, 0, 0, 0, 0x03, 0x0076 },
+        { 1351, 1351, 2, 2, 636, 1, 0, 0x03, 0x0057 },
+        { 1353, 1353, 2, 2, 0, 0, 0, 0x03, 0x0077 },
+        { 1355, 1355, 2, 2, 637, 1, 0, 0x03, 0x0057 },
+        { 1357, 1357, 2, 2, 0, 0, 0, 0x03, 0x0077 },
+        { 1359, 1359, 2, 2, 638, 1, 0, 0x03, 0x0057 },
+        { 1361, 1361, 2, 2, 0, 0, 0, 0x03, 0x0077 },
+        { 1363, 1363, 2, 2, 639, 1, 0, 0x03, 0x0057 },
+        { 1365, 1365, 2, 2, 0, 0, 0, 0x03, 0x0077 },
+        { 1367, 1367, 2, 2, 640, 1, 0, 0x03, 0x0057 },
+        { 1369, 1369, 2, 2, 0, 0, 0, 0x03, 0x0077 },
+        { 1371, 1371, 2, 2, 641, 1, 0, 0x03, 0x0058 },
+        { 1373, 1373, 2, 2, 0, 0, 0, 0x03, 0x0078 },
+        { 1375, 1375, 2, 2, 642, 1, 0, 0x03, 0x0058 },
+        { 1377, 1377, 2, 2, 0, 0, 0, 0x03, 0x0078 },
+        { 1379, 1379, 2, 2, 643, 1, 0, 0x03, 0x0059 },
+        { 1381, 1381, 2, 2, 0, 0, 0, 0x03, 0x0079 },
+        { 1383, 1383, 2, 2, 644, 1, 0, 0x03, 0x005A },
+        { 1385, 1385, 2, 2, 0, 0, 0, 0x03, 0x007A },
+        { 1387, 1387, 2, 2, 645, 1, 0, 0x03, 0x005A },
+        { 1389, 1389, 2, 2, 0, 0, 0, 0x03, 0x007A },
+        { 1391, 1391, 2, 2, 646, 1, 0, 0x03, 0x005A },
+        { 1393, 1393, 2, 2, 0, 0, 0, 0x03, 0x007A },
+        { 1395, 1395, 2, 2, 647, 2, 0, 0x03, 0x0068 },
+        { 1397, 1397, 2, 2, 649, 2, 0, 0x03, 0x0074 },
+        { 1399, 1399, 2, 2, 651, 2, 0, 0x03, 0x0077 },
+        { 1401, 1401, 2, 2, 653, 2, 0, 0x03, 0x0079 },
+        { 0, 1403, 0, 2, 655, 2, 0, 0x12, 0x0000 },
+        { 1405, 1279, 2, 2, 620, 1, 0, 0x13, 0x017F },
+        { 1407, 1407, 2, 2, 657, 1, 0, 0x03, 0x0041 },
+        { 1409, 1409, 2, 2, 0, 0, 0, 0x03, 0x0061 },
+        { 1411, 1411, 2, 2, 658, 1, 0, 0x03, 0x0041 },
+        { 1413, 1413, 2, 2, 0, 0, 0, 0x03, 0x0061 },
+        { 1415, 1415, 3, 3, 659, 1, 0, 0x03, 0x0041 },
+        { 1418, 1418, 3, 3, 0, 0, 0, 0x03, 0x0061 },
+        { 1421, 1421, 3, 3, 660, 1, 0, 0x03, 0x0041 },
+        { 1424, 1424, 3, 3, 0, 0, 0, 0x03, 0x0061 },
+        { 1427, 1427, 3, 3, 661, 1, 0, 0x03, 0x0041 },
+        { 1430, 1430, 3, 3, 0, 0, 0, 0x03, 0x0061 },
+        { 1433, 1433, 3, 3, 662, 1, 0, 0x03, 0x0041 },
+        { 1436, 1436, 3, 3, 0, 0, 0, 0x03, 0x0061 },
+        { 1439, 1439, 3, 3, 663, 1, 0, 0x03, 0x0041 },
+        { 1442, 1442, 3, 3, 0, 0, 0, 0x03, 0x0061 },
+        { 1445, 1445, 3, 3, 664, 1, 0, 0x03, 0x0041 },
+        { 1448, 1448, 3, 3, 0, 0, 0, 0x03, 0x0061 },
+        { 1451, 1451, 3, 3, 665, 1, 0, 0x03, 0x0041 },
+        { 1454, 1454, 3, 3, 0, 0, 0, 0x03, 0x0061 },
+        { 1457, 1457, 3, 3, 666, 1, 0, 0x03, 0x0041 },
+        { 1460, 1460, 3, 3, 0, 0, 0, 0x03, 0x0061 },
+        { 1463, 1463, 3, 3, 667, 1, 0, 0x03, 0x0041 },
+        { 1466, 1466, 3, 3, 0, 0, 0, 0x03, 0x0061 },
+        { 1469, 1469, 3, 3, 668, 1, 0, 0x03, 0x0041 },
+        { 1472, 1472, 3, 3, 0, 0, 0, 0x03, 0x0061 },
+        { 1475, 1475, 2, 2, 669, 1, 0, 0x03, 0x0045 },
+        { 1477, 1477, 2, 2, 0, 0, 0, 0x03, 0x0065 },
+        { 1479, 1479, 2, 2, 670, 1, 0, 0x03, 0x0045 },
+        { 1481, 1481, 2, 2, 0, 0, 0, 0x03, 0x0065 },
+        { 1483, 1483, 2, 2, 671, 1, 0, 0x03, 0x0045 },
+        { 1485, 1485, 2, 2, 0, 0, 0, 0x03, 0x0065 },
+        { 1487, 1487, 3, 3, 672, 1, 0, 0x03, 0x0045 },
+        { 1490, 1490, 3, 3, 0, 0, 0, 0x03, 0x0065 },
+        { 1493, 1493, 3, 3, 673, 1, 0, 0x03, 0x0045 },
+        { 1496, 1496, 3, 3, 0, 0, 0, 0x03, 0x0065 },
+        { 1499, 1499, 3, 3, 674, 1, 0, 0x03, 0x0045 },
+        { 1502, 1502, 3, 3, 0, 0, 0, 0x03, 0x0065 },
+        { 1505, 1505, 3, 3, 675, 1, 0, 0x03, 0x0045 },
+        { 1508, 1508, 3, 3, 0, 0, 0, 0x03, 0x0065 },
+        { 1511, 1511, 3, 3, 676, 1, 0, 0x03, 0x0045 },
+        { 1514, 1514, 3, 3, 0, 0, 0, 0x03, 0x0065 },
+        { 1517, 1517, 2, 2, 677, 1, 0, 0x03, 0x0049 },
+        { 1519, 1519, 2, 2, 0, 0, 0, 0x03, 0x0069 },
+        { 1521, 1521, 2, 2, 678, 1, 0, 0x03, 0x0049 },
+        { 1523, 1523, 2, 2, 0, 0, 0, 0x03, 0x0069 },
+        { 1525, 1525, 2, 2, 679, 1, 0, 0x03, 0x004F },
+        { 1527, 1527, 2, 2, 0, 0, 0, 0x03, 0x006F },
+        { 1529, 1529, 2, 2, 680, 1, 0, 0x03, 0x004F },
+        { 1531, 1531, 2, 2, 0, 0, 0, 0x03, 0x006F },
+        { 1533, 1533, 3, 3, 681, 1, 0, 0x03, 0x004F },
+        { 1536, 1536, 3, 3, 0, 0, 0, 0x03, 0x006F },
+        { 1539, 1539, 3, 3, 682, 1, 0, 0x03, 0x004F },
+        { 1542, 1542, 3, 3, 0, 0, 0, 0x03, 0x006F },
+        { 1545, 1545, 3, 3, 683, 1, 0, 0x03, 0x004F },
+        { 1548, 1548, 3, 3, 0, 0, 0, 0x03, 0x006F },
+        { 1551, 1551, 3, 3, 684, 1, 0, 0x03, 0x004F },
+        { 1554, 1554, 3, 3, 0, 0, 0, 0x03, 0x006F },
+        { 1557, 1557, 3, 3, 685, 1, 0, 0x03, 0x004F },
+        { 1560, 1560, 3, 3, 0, 0, 0, 0x03, 0x006F },
+        { 1563, 1563, 3, 3, 686, 1, 0, 0x03, 0x004F },
+        { 1566, 1566, 3, 3, 0, 0, 0, 0x03, 0x006F },
+        { 1569, 1569, 3, 3, 687, 1, 0, 0x03, 0x004F },
+        { 1572, 1572, 3, 3, 0, 0, 0, 0x03, 0x006F },
+        { 1575, 1575, 3, 3, 688, 1, 0, 0x03, 0x004F },
+        { 1578, 1578, 3, 3, 0, 0, 0, 0x03, 0x006F },
+        { 1581, 1581, 3, 3, 689, 1, 0, 0x03, 0x004F },
+        { 1584, 1584, 3, 3, 0, 0, 0, 0x03, 0x006F },
+        { 1587, 1587, 3, 3, 690, 1, 0, 0x03, 0x004F },
+        { 1590, 1590, 3, 3, 0, 0, 0, 0x03, 0x006F },
+        { 1593, 1593, 2, 2, 691, 1, 0, 0x03, 0x0055 },
+        { 1595, 1595, 2, 2, 0, 0, 0, 0x03, 0x0075 },
+        { 1597, 1597, 2, 2, 692, 1, 0, 0x03, 0x0055 },
+        { 1599, 1599, 2, 2, 0, 0, 0, 0x03, 0x0075 },
+        { 1601, 1601, 3, 3, 693, 1, 0, 0x03, 0x0055 },
+        { 1604, 1604, 3, 3, 0, 0, 0, 0x03, 0x0075 },
+        { 1607, 1607, 3, 3, 694, 1, 0, 0x03, 0x0055 },
+        { 1610, 1610, 3, 3, 0, 0, 0, 0x03, 0x0075 },
+        { 1613, 1613, 3, 3, 695, 1, 0, 0x03, 0x0055 },
+        { 1616, 1616, 3, 3, 0, 0, 0, 0x03, 0x0075 },
+        { 1619, 1619, 3, 3, 696, 1, 0, 0x03, 0x0055 },
+        { 1622, 1622, 3, 3, 0, 0, 0, 0x03, 0x0075 },
+        { 1625, 1625, 3, 3, 697, 1, 0, 0x03, 0x0055 },
+        { 1628, 1628, 3, 3, 0, 0, 0, 0x03, 0x0075 },
+        { 1631, 1631, 2, 2, 698, 1, 0, 0x03, 0x0059 },
+        { 1633, 1633, 2, 2, 0, 0, 0, 0x03, 0x0079 },
+        { 1635, 1635, 2, 2, 699, 1, 0, 0x03, 0x0059 },
+        { 1637, 1637, 2, 2, 0, 0, 0, 0x03, 0x0079 },
+        { 1639, 1639, 2, 2, 700, 1, 0, 0x03, 0x0059 },
+        { 1641, 1641, 2, 2, 0, 0, 0, 0x03, 0x0079 },
+        { 1643, 1643, 2, 2, 701, 1, 0, 0x03, 0x0059 },
+        { 1645, 1645, 2, 2, 0, 0, 0, 0x03, 0x0079 },
+        { 0, 0, 0, 0, 702, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 703, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 704, 1, 0, 0x00, 0x0000 },
+        { 1647, 1647, 2, 2, 0, 0, 0, 0x03, 0x03B1 },
+        { 1649, 1649, 2, 2, 0, 0, 0, 0x03, 0x03B1 },
+        { 1651, 1651, 3, 3, 0, 0, 0, 0x03, 0x03B1 },
+        { 1654, 1654, 3, 3, 0, 0, 0, 0x03, 0x03B1 },
+        { 1657, 1657, 3, 3, 0, 0, 0, 0x03, 0x03B1 },
+        { 1660, 1660, 3, 3, 0, 0, 0, 0x03, 0x03B1 },
+        { 1663, 1663, 3, 3, 0, 0, 0, 0x03, 0x03B1 },
+        { 1666, 1666, 3, 3, 0, 0, 0, 0x03, 0x03B1 },
+        { 1669, 1669, 2, 2, 705, 1, 0, 0x03, 0x0391 },
+        { 1671, 1671, 2, 2, 706, 1, 0, 0x03, 0x0391 },
+        { 1673, 1673, 3, 3, 707, 1, 0, 0x03, 0x0391 },
+        { 1676, 1676, 3, 3, 708, 1, 0, 0x03, 0x0391 },
+        { 1679, 1679, 3, 3, 709, 1, 0, 0x03, 0x0391 },
+        { 1682, 1682, 3, 3, 710, 1, 0, 0x03, 0x0391 },
+        { 1685, 1685, 3, 3, 711, 1, 0, 0x03, 0x0391 },
+        { 1688, 1688, 3, 3, 712, 1, 0, 0x03, 0x0391 },
+        { 1691, 1691, 2, 2, 0, 0, 0, 0x03, 0x03B5 },
+        { 1693, 1693, 2, 2, 0, 0, 0, 0x03, 0x03B5 },
+        { 1695, 1695, 3, 3, 0, 0, 0, 0x03, 0x03B5 },
+        { 1698, 1698, 3, 3, 0, 0, 0, 0x03, 0x03B5 },
+        { 1701, 1701, 3, 3, 0, 0, 0, 0x03, 0x03B5 },
+        { 1704, 1704, 3, 3, 0, 0, 0, 0x03, 0x03B5 },
+        { 1707, 1707, 2, 2, 713, 1, 0, 0x03, 0x0395 },
+        { 1709, 1709, 2, 2, 714, 1, 0, 0x03, 0x0395 },
+        { 1711, 1711, 3, 3, 715, 1, 0, 0x03, 0x0395 },
+        { 1714, 1714, 3, 3, 716, 1, 0, 0x03, 0x0395 },
+        { 1717, 1717, 3, 3, 717, 1, 0, 0x03, 0x0395 },
+        { 1720, 1720, 3, 3, 718, 1, 0, 0x03, 0x0395 },
+        { 1723, 1723, 2, 2, 0, 0, 0, 0x03, 0x03B7 },
+        { 1725, 1725, 2, 2, 0, 0, 0, 0x03, 0x03B7 },
+        { 1727, 1727, 3, 3, 0, 0, 0, 0x03, 0x03B7 },
+        { 1730, 1730, 3, 3, 0, 0, 0, 0x03, 0x03B7 },
+        { 1733, 1733, 3, 3, 0, 0, 0, 0x03, 0x03B7 },
+        { 1736, 1736, 3, 3, 0, 0, 0, 0x03, 0x03B7 },
+        { 1739, 1739, 3, 3, 0, 0, 0, 0x03, 0x03B7 },
+        { 1742, 1742, 3, 3, 0, 0, 0, 0x03, 0x03B7 },
+        { 1745, 1745, 2, 2, 719, 1, 0, 0x03, 0x0397 },
+        { 1747, 1747, 2, 2, 720, 1, 0, 0x03, 0x0397 },
+        { 1749, 1749, 3, 3, 721, 1, 0, 0x03, 0x0397 },
+        { 1752, 1752, 3, 3, 722, 1, 0, 0x03, 0x0397 },
+        { 1755, 1755, 3, 3, 723, 1, 0, 0x03, 0x0397 },
+        { 1758, 1758, 3, 3, 724, 1, 0, 0x03, 0x0397 },
+        { 1761, 1761, 3, 3, 725, 1, 0, 0x03, 0x0397 },
+        { 1764, 1764, 3, 3, 726, 1, 0, 0x03, 0x0397 },
+        { 1767, 1767, 2, 2, 0, 0, 0, 0x03, 0x03B9 },
+        { 1769, 1769, 2, 2, 0, 0, 0, 0x03, 0x03B9 },
+        { 1771, 1771, 3, 3, 0, 0, 0, 0x03, 0x03B9 },
+        { 1774, 1774, 3, 3, 0, 0, 0, 0x03, 0x03B9 },
+        { 1777, 1777, 3, 3, 0, 0, 0, 0x03, 0x03B9 },
+        { 1780, 1780, 3, 3, 0, 0, 0, 0x03, 0x03B9 },
+        { 1783, 1783, 3, 3, 0, 0, 0, 0x03, 0x03B9 },
+        { 1786, 1786, 3, 3, 0, 0, 0, 0x03, 0x03B9 },
+        { 1789, 1789, 2, 2, 727, 1, 0, 0x03, 0x0399 },
+        { 1791, 1791, 2, 2, 728, 1, 0, 0x03, 0x0399 },
+        { 1793, 1793, 3, 3, 729, 1, 0, 0x03, 0x0399 },
+        { 1796, 1796, 3, 3, 730, 1, 0, 0x03, 0x0399 },
+        { 1799, 1799, 3, 3, 731, 1, 0, 0x03, 0x0399 },
+        { 1802, 1802, 3, 3, 732, 1, 0, 0x03, 0x0399 },
+        { 1805, 1805, 3, 3, 733, 1, 0, 0x03, 0x0399 },
+        { 1808, 1808, 3, 3, 734, 1, 0, 0x03, 0x0399 },
+        { 1811, 1811, 2, 2, 0, 0, 0, 0x03, 0x03BF },
+        { 1813, 1813, 2, 2, 0, 0, 0, 0x03, 0x03BF },
+        { 1815, 1815, 3, 3, 0, 0, 0, 0x03, 0x03BF },
+        { 1818, 1818, 3, 3, 0, 0, 0, 0x03, 0x03BF },
+        { 1821, 1821, 3, 3, 0, 0, 0, 0x03, 0x03BF },
+        { 1824, 1824, 3, 3, 0, 0, 0, 0x03, 0x03BF },
+        { 1827, 1827, 2, 2, 735, 1, 0, 0x03, 0x039F },
+        { 1829, 1829, 2, 2, 736, 1, 0, 0x03, 0x039F },
+        { 1831, 1831, 3, 3, 737, 1, 0, 0x03, 0x039F },
+        { 1834, 1834, 3, 3, 738, 1, 0, 0x03, 0x039F },
+        { 1837, 1837, 3, 3, 739, 1, 0, 0x03, 0x039F },
+        { 1840, 1840, 3, 3, 740, 1, 0, 0x03, 0x039F },
+        { 1843, 1843, 2, 2, 741, 2, 0, 0x03, 0x03C5 },
+        { 1845, 1845, 2, 2, 0, 0, 0, 0x03, 0x03C5 },
+        { 1847, 1847, 3, 3, 743, 3, 0, 0x03, 0x03C5 },
+        { 1850, 1850, 3, 3, 0, 0, 0, 0x03, 0x03C5 },
+        { 1853, 1853, 3, 3, 746, 3, 0, 0x03, 0x03C5 },
+        { 1856, 1856, 3, 3, 0, 0, 0, 0x03, 0x03C5 },
+        { 1859, 1859, 3, 3, 749, 3, 0, 0x03, 0x03C5 },
+        { 1862, 1862, 3, 3, 0, 0, 0, 0x03, 0x03C5 },
+        { 1865, 1865, 2, 2, 752, 1, 0, 0x03, 0x03A5 },
+        { 1867, 1867, 3, 3, 753, 1, 0, 0x03, 0x03A5 },
+        { 1870, 1870, 3, 3, 754, 1, 0, 0x03, 0x03A5 },
+        { 1873, 1873, 3, 3, 755, 1, 0, 0x03, 0x03A5 },
+        { 1876, 1876, 2, 2, 0, 0, 0, 0x03, 0x03C9 },
+        { 1878, 1878, 2, 2, 0, 0, 0, 0x03, 0x03C9 },
+        { 1880, 1880, 3, 3, 0, 0, 0, 0x03, 0x03C9 },
+        { 1883, 1883, 3, 3, 0, 0, 0, 0x03, 0x03C9 },
+        { 1886, 1886, 3, 3, 0, 0, 0, 0x03, 0x03C9 },
+        { 1889, 1889, 3, 3, 0, 0, 0, 0x03, 0x03C9 },
+        { 1892, 1892, 3, 3, 0, 0, 0, 0x03, 0x03C9 },
+        { 1895, 1895, 3, 3, 0, 0, 0, 0x03, 0x03C9 },
+        { 1898, 1898, 2, 2, 756, 1, 0, 0x03, 0x03A9 },
+        { 1900, 1900, 2, 2, 757, 1, 0, 0x03, 0x03A9 },
+        { 1902, 1902, 3, 3, 758, 1, 0, 0x03, 0x03A9 },
+        { 1905, 1905, 3, 3, 759, 1, 0, 0x03, 0x03A9 },
+        { 1908, 1908, 3, 3, 760, 1, 0, 0x03, 0x03A9 },
+        { 1911, 1911, 3, 3, 761, 1, 0, 0x03, 0x03A9 },
+        { 1914, 1914, 3, 3, 762, 1, 0, 0x03, 0x03A9 },
+        { 1917, 1917, 3, 3, 763, 1, 0, 0x03, 0x03A9 },
+        { 1920, 1920, 2, 2, 0, 0, 0, 0x03, 0x03B1 },
+        { 649, 649, 2, 2, 0, 0, 0, 0x17, 0x03B1 },
+        { 1922, 1922, 2, 2, 0, 0, 0, 0x03, 0x03B5 },
+        { 651, 651, 2, 2, 0, 0, 0, 0x17, 0x03B5 },
+        { 1924, 1924, 2, 2, 0, 0, 0, 0x03, 0x03B7 },
+        { 653, 653, 2, 2, 0, 0, 0, 0x17, 0x03B7 },
+        { 1926, 1926, 2, 2, 0, 0, 0, 0x03, 0x03B9 },
+        { 655, 655, 2, 2, 0, 0, 0, 0x17, 0x03B9 },
+        { 1928, 1928, 2, 2, 0, 0, 0, 0x03, 0x03BF },
+        { 664, 664, 2, 2, 0, 0, 0, 0x17, 0x03BF },
+        { 1930, 1930, 2, 2, 0, 0, 0, 0x03, 0x03C5 },
+        { 666, 666, 2, 2, 0, 0, 0, 0x17, 0x03C5 },
+        { 1932, 1932, 2, 2, 0, 0, 0, 0x03, 0x03C9 },
+        { 668, 668, 2, 2, 0, 0, 0, 0x17, 0x03C9 },
+        { 1934, 1934, 3, 3, 764, 2, 0, 0x03, 0x03B1 },
+        { 1937, 1937, 3, 3, 766, 2, 0, 0x03, 0x03B1 },
+        { 1940, 1940, 4, 4, 768, 2, 0, 0x03, 0x03B1 },
+        { 1944, 1944, 4, 4, 770, 2, 0, 0x03, 0x03B1 },
+        { 1948, 1948, 4, 4, 772, 2, 0, 0x03, 0x03B1 },
+        { 1952, 1952, 4, 4, 774, 2, 0, 0x03, 0x03B1 },
+        { 1956, 1956, 4, 4, 776, 2, 0, 0x03, 0x03B1 },
+        { 1960, 1960, 4, 4, 778, 2, 0, 0x03, 0x03B1 },
+        { 1964, 1964, 3, 3, 764, 2, 0, 0x03, 0x0391 },
+        { 1967, 1967, 3, 3, 766, 2, 0, 0x03, 0x0391 },
+        { 1970, 1970, 4, 4, 768, 2, 0, 0x03, 0x0391 },
+        { 1974, 1974, 4, 4, 770, 2, 0, 0x03, 0x0391 },
+        { 1978, 1978, 4, 4, 772, 2, 0, 0x03, 0x0391 },
+        { 1982, 1982, 4, 4, 774, 2, 0, 0x03, 0x0391 },
+        { 1986, 1986, 4, 4, 776, 2, 0, 0x03, 0x0391 },
+        { 1990, 1990, 4, 4, 778, 2, 0, 0x03, 0x0391 },
+        { 1994, 1994, 3, 3, 780, 2, 0, 0x03, 0x03B7 },
+        { 1997, 1997, 3, 3, 782, 2, 0, 0x03, 0x03B7 },
+        { 2000, 2000, 4, 4, 784, 2, 0, 0x03, 0x03B7 },
+        { 2004, 2004, 4, 4, 786, 2, 0, 0x03, 0x03B7 },
+        { 2008, 2008, 4, 4, 788, 2, 0, 0x03, 0x03B7 },
+        { 2012, 2012, 4, 4, 790, 2, 0, 0x03, 0x03B7 },
+        { 2016, 2016, 4, 4, 792, 2, 0, 0x03, 0x03B7 },
+        { 2020, 2020, 4, 4, 794, 2, 0, 0x03, 0x03B7 },
+        { 2024, 2024, 3, 3, 780, 2, 0, 0x03, 0x0397 },
+        { 2027, 2027, 3, 3, 782, 2, 0, 0x03, 0x0397 },
+        { 2030, 2030, 4, 4, 784, 2, 0, 0x03, 0x0397 },
+        { 2034, 2034, 4, 4, 786, 2, 0, 0x03, 0x0397 },
+        { 2038, 2038, 4, 4, 788, 2, 0, 0x03, 0x0397 },
+        { 2042, 2042, 4, 4, 790, 2, 0, 0x03, 0x0397 },
+        { 2046, 2046, 4, 4, 792, 2, 0, 0x03, 0x0397 },
+        { 2050, 2050, 4, 4, 794, 2, 0, 0x03, 0x0397 },
+        { 2054, 2054, 3, 3, 796, 2, 0, 0x03, 0x03C9 },
+        { 2057, 2057, 3, 3, 798, 2, 0, 0x03, 0x03C9 },
+        { 2060, 2060, 4, 4, 800, 2, 0, 0x03, 0x03C9 },
+        { 2064, 2064, 4, 4, 802, 2, 0, 0x03, 0x03C9 },
+        { 2068, 2068, 4, 4, 804, 2, 0, 0x03, 0x03C9 },
+        { 2072, 2072, 4, 4, 806, 2, 0, 0x03, 0x03C9 },
+        { 2076, 2076, 4, 4, 808, 2, 0, 0x03, 0x03C9 },
+        { 2080, 2080, 4, 4, 810, 2, 0, 0x03, 0x03C9 },
+        { 2084, 2084, 3, 3, 796, 2, 0, 0x03, 0x03A9 },
+        { 2087, 2087, 3, 3, 798, 2, 0, 0x03, 0x03A9 },
+        { 2090, 2090, 4, 4, 800, 2, 0, 0x03, 0x03A9 },
+        { 2094, 2094, 4, 4, 802, 2, 0, 0x03, 0x03A9 },
+        { 2098, 2098, 4, 4, 804, 2, 0, 0x03, 0x03A9 },
+        { 2102, 2102, 4, 4, 806, 2, 0, 0x03, 0x03A9 },
+        { 2106, 2106, 4, 4, 808, 2, 0, 0x03, 0x03A9 },
+        { 2110, 2110, 4, 4, 810, 2, 0, 0x03, 0x03A9 },
+        { 2114, 2114, 2, 2, 0, 0, 0, 0x03, 0x03B1 },
+        { 2116, 2116, 2, 2, 0, 0, 0, 0x03, 0x03B1 },
+        { 2118, 2118, 3, 3, 812, 2, 0, 0x03, 0x03B1 },
+        { 2121, 2121, 2, 2, 814, 2, 0, 0x03, 0x03B1 },
+        { 2123, 2123, 3, 3, 816, 2, 0, 0x03, 0x03B1 },
+        { 2126, 2126, 2, 2, 818, 2, 0, 0x03, 0x03B1 },
+        { 2128, 2128, 3, 3, 820, 3, 0, 0x03, 0x03B1 },
+        { 2131, 2131, 2, 2, 823, 1, 0, 0x03, 0x0391 },
+        { 2133, 2133, 2, 2, 824, 1, 0, 0x03, 0x0391 },
+        { 2135, 2135, 2, 2, 825, 1, 0, 0x03, 0x0391 },
+        { 627, 627, 2, 2, 826, 1, 0, 0x17, 0x0391 },
+        { 2137, 2137, 2, 2, 814, 2, 0, 0x03, 0x0391 },
+        { 0, 2139, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 2141, 2141, 1, 1, 230, 1, 0, 0x17, 0x0000 },
+        { 0, 2142, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 2144, 2146, 2, 3, 0, 0, 0, 0x13, 0x00A8 },
+        { 2149, 2149, 3, 3, 827, 2, 0, 0x03, 0x03B7 },
+        { 2152, 2152, 2, 2, 829, 2, 0, 0x03, 0x03B7 },
+        { 2154, 2154, 3, 3, 831, 2, 0, 0x03, 0x03B7 },
+        { 2157, 2157, 2, 2, 833, 2, 0, 0x03, 0x03B7 },
+        { 2159, 2159, 3, 3, 835, 3, 0, 0x03, 0x03B7 },
+        { 2162, 2162, 2, 2, 838, 1, 0, 0x03, 0x0395 },
+        { 630, 630, 2, 2, 839, 1, 0, 0x17, 0x0395 },
+        { 2164, 2164, 2, 2, 840, 1, 0, 0x03, 0x0397 },
+        { 632, 632, 2, 2, 841, 1, 0, 0x17, 0x0397 },
+        { 2166, 2166, 2, 2, 829, 2, 0, 0x03, 0x0397 },
+        { 2168, 2170, 2, 3, 0, 0, 0, 0x13, 0x1FBF },
+        { 2173, 2175, 2, 3, 0, 0, 0, 0x13, 0x1FBF },
+        { 2178, 2180, 2, 3, 0, 0, 0, 0x13, 0x1FBF },
+        { 2183, 2183, 2, 2, 0, 0, 0, 0x03, 0x03B9 },
+        { 2185, 2185, 2, 2, 0, 0, 0, 0x03, 0x03B9 },
+        { 2187, 2187, 3, 3, 842, 3, 0, 0x03, 0x03B9 },
+        { 642, 642, 3, 3, 242, 3, 0, 0x17, 0x03B9 },
+        { 2190, 2190, 2, 2, 845, 2, 0, 0x03, 0x03B9 },
+        { 2192, 2192, 3, 3, 847, 3, 0, 0x03, 0x03B9 },
+        { 2195, 2195, 2, 2, 850, 1, 0, 0x03, 0x0399 },
+        { 2197, 2197, 2, 2, 851, 1, 0, 0x03, 0x0399 },
+        { 2199, 2199, 2, 2, 852, 1, 0, 0x03, 0x0399 },
+        { 634, 634, 2, 2, 853, 1, 0, 0x17, 0x0399 },
+        { 2201, 2203, 2, 3, 0, 0, 0, 0x13, 0x1FFE },
+        { 2206, 2208, 2, 3, 0, 0, 0, 0x13, 0x1FFE },
+        { 2211, 2213, 2, 3, 0, 0, 0, 0x13, 0x1FFE },
+        { 2216, 2216, 2, 2, 0, 0, 0, 0x03, 0x03C5 },
+        { 2218, 2218, 2, 2, 0, 0, 0, 0x03, 0x03C5 },
+        { 2220, 2220, 3, 3, 854, 3, 0, 0x03, 0x03C5 },
+        { 657, 657, 3, 3, 269, 3, 0, 0x17, 0x03C5 },
+        { 2223, 2223, 2, 2, 857, 2, 0, 0x03, 0x03C1 },
+        { 2225, 2225, 2, 2, 0, 0, 0, 0x03, 0x03C1 },
+        { 2227, 2227, 2, 2, 859, 2, 0, 0x03, 0x03C5 },
+        { 2229, 2229, 3, 3, 861, 3, 0, 0x03, 0x03C5 },
+        { 2232, 2232, 2, 2, 864, 1, 0, 0x03, 0x03A5 },
+        { 2234, 2234, 2, 2, 865, 1, 0, 0x03, 0x03A5 },
+        { 2236, 2236, 2, 2, 866, 1, 0, 0x03, 0x03A5 },
+        { 638, 638, 2, 2, 867, 1, 0, 0x17, 0x03A5 },
+        { 2238, 2238, 2, 2, 868, 1, 0, 0x03, 0x03A1 },
+        { 2240, 2242, 2, 3, 0, 0, 0, 0x13, 0x00A8 },
+        { 622, 624, 2, 3, 0, 0, 0, 0x17, 0x00A8 },
+        { 2245, 2245, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 2246, 2246, 3, 3, 869, 2, 0, 0x03, 0x03C9 },
+        { 2249, 2249, 2, 2, 871, 2, 0, 0x03, 0x03C9 },
+        { 2251, 2251, 3, 3, 873, 2, 0, 0x03, 0x03C9 },
+        { 2254, 2254, 2, 2, 875, 2, 0, 0x03, 0x03C9 },
+        { 2256, 2256, 3, 3, 877, 3, 0, 0x03, 0x03C9 },
+        { 2259, 2259, 2, 2, 880, 1, 0, 0x03, 0x039F },
+        { 636, 636, 2, 2, 881, 1, 0, 0x17, 0x039F },
+        { 2261, 2261, 2, 2, 882, 1, 0, 0x03, 0x03A9 },
+        { 640, 640, 2, 2, 883, 1, 0, 0x17, 0x03A9 },
+        { 2263, 2263, 2, 2, 871, 2, 0, 0x03, 0x03A9 },
+        { 2265, 8, 1, 2, 0, 0, 0, 0x17, 0x0000 },
+        { 0, 2266, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 2268, 0, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 2269, 0, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 0, 2270, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2271, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2273, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2274, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2276, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2279, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2281, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2284, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2286, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2289, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2291, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2293, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2295, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2297, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2299, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2303, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2304, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2305, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2306, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2307, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2308, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2309, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2310, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2311, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2312, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2313, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2314, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2315, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2316, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2318, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2321, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2324, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2325, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2327, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2330, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2333, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2334, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2336, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2337, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2339, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2340, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2342, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2345, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2347, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 2348, 2348, 1, 1, 266, 1, 0, 0x17, 0x0000 },
+        { 989, 989, 1, 1, 10, 1, 0, 0x17, 0x0000 },
+        { 34, 34, 2, 2, 32, 1, 0, 0x17, 0x0041 },
+        { 0, 2349, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 0, 0, 0, 884, 1, 0, 0x00, 0x0000 },
+        { 0, 2350, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2351, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2352, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2353, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2354, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 678, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2357, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2358, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2359, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2360, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2363, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2366, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2370, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2373, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2376, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2379, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2382, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2385, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2388, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2391, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2394, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2397, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2400, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2403, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2406, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 987, 0, 1, 885, 1, 0, 0x12, 0x0000 },
+        { 0, 2408, 0, 2, 886, 1, 0, 0x12, 0x0000 },
+        { 0, 2410, 0, 3, 887, 1, 0, 0x12, 0x0000 },
+        { 0, 2413, 0, 2, 888, 1, 0, 0x12, 0x0000 },
+        { 0, 2415, 0, 1, 889, 1, 0, 0x12, 0x0000 },
+        { 0, 2416, 0, 2, 890, 1, 0, 0x12, 0x0000 },
+        { 0, 2418, 0, 3, 891, 1, 0, 0x12, 0x0000 },
+        { 0, 2421, 0, 4, 892, 1, 0, 0x12, 0x0000 },
+        { 0, 2425, 0, 2, 893, 1, 0, 0x12, 0x0000 },
+        { 0, 2427, 0, 1, 894, 1, 0, 0x12, 0x0000 },
+        { 0, 2428, 0, 2, 895, 1, 0, 0x12, 0x0000 },
+        { 0, 2430, 0, 3, 896, 1, 0, 0x12, 0x0000 },
+        { 0, 990, 0, 1, 897, 1, 0, 0x12, 0x0000 },
+        { 0, 2324, 0, 1, 898, 1, 0, 0x12, 0x0000 },
+        { 0, 982, 0, 1, 899, 1, 0, 0x12, 0x0000 },
+        { 0, 991, 0, 1, 900, 1, 0, 0x12, 0x0000 },
+        { 0, 2433, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2435, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2438, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2440, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2442, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2445, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2449, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2451, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2453, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 0, 0, 0, 901, 1, 0, 0x00, 0x0000 },
+        { 0, 2456, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 2459, 2459, 2, 2, 0, 0, 0, 0x03, 0x2190 },
+        { 2461, 2461, 2, 2, 0, 0, 0, 0x03, 0x2192 },
+        { 2463, 2463, 2, 2, 0, 0, 0, 0x03, 0x2194 },
+        { 2465, 2465, 2, 2, 0, 0, 0, 0x03, 0x21D0 },
+        { 2467, 2467, 2, 2, 0, 0, 0, 0x03, 0x21D4 },
+        { 2469, 2469, 2, 2, 0, 0, 0, 0x03, 0x21D2 },
+        { 2471, 2471, 2, 2, 0, 0, 0, 0x03, 0x2203 },
+        { 2473, 2473, 2, 2, 0, 0, 0, 0x03, 0x2208 },
+        { 2475, 2475, 2, 2, 0, 0, 0, 0x03, 0x220B },
+        { 2477, 2477, 2, 2, 0, 0, 0, 0x03, 0x2223 },
+        { 2479, 2479, 2, 2, 0, 0, 0, 0x03, 0x2225 },
+        { 0, 2481, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2483, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2486, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2488, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 2491, 2491, 2, 2, 0, 0, 0, 0x03, 0x223C },
+        { 2493, 2493, 2, 2, 0, 0, 0, 0x03, 0x2243 },
+        { 2495, 2495, 2, 2, 0, 0, 0, 0x03, 0x2245 },
+        { 2497, 2497, 2, 2, 0, 0, 0, 0x03, 0x2248 },
+        { 2499, 2499, 2, 2, 0, 0, 0, 0x03, 0x003D },
+        { 2501, 2501, 2, 2, 0, 0, 0, 0x03, 0x2261 },
+        { 2503, 2503, 2, 2, 0, 0, 0, 0x03, 0x224D },
+        { 2505, 2505, 2, 2, 0, 0, 0, 0x03, 0x003C },
+        { 2507, 2507, 2, 2, 0, 0, 0, 0x03, 0x003E },
+        { 2509, 2509, 2, 2, 0, 0, 0, 0x03, 0x2264 },
+        { 2511, 2511, 2, 2, 0, 0, 0, 0x03, 0x2265 },
+        { 2513, 2513, 2, 2, 0, 0, 0, 0x03, 0x2272 },
+        { 2515, 2515, 2, 2, 0, 0, 0, 0x03, 0x2273 },
+        { 2517, 2517, 2, 2, 0, 0, 0, 0x03, 0x2276 },
+        { 2519, 2519, 2, 2, 0, 0, 0, 0x03, 0x2277 },
+        { 2521, 2521, 2, 2, 0, 0, 0, 0x03, 0x227A },
+        { 2523, 2523, 2, 2, 0, 0, 0, 0x03, 0x227B },
+        { 2525, 2525, 2, 2, 0, 0, 0, 0x03, 0x2282 },
+        { 2527, 2527, 2, 2, 0, 0, 0, 0x03, 0x2283 },
+        { 2529, 2529, 2, 2, 0, 0, 0, 0x03, 0x2286 },
+        { 2531, 2531, 2, 2, 0, 0, 0, 0x03, 0x2287 },
+        { 2533, 2533, 2, 2, 0, 0, 0, 0x03, 0x22A2 },
+        { 2535, 2535, 2, 2, 0, 0, 0, 0x03, 0x22A8 },
+        { 2537, 2537, 2, 2, 0, 0, 0, 0x03, 0x22A9 },
+        { 2539, 2539, 2, 2, 0, 0, 0, 0x03, 0x22AB },
+        { 2541, 2541, 2, 2, 0, 0, 0, 0x03, 0x227C },
+        { 2543, 2543, 2, 2, 0, 0, 0, 0x03, 0x227D },
+        { 2545, 2545, 2, 2, 0, 0, 0, 0x03, 0x2291 },
+        { 2547, 2547, 2, 2, 0, 0, 0, 0x03, 0x2292 },
+        { 2549, 2549, 2, 2, 0, 0, 0, 0x03, 0x22B2 },
+        { 2551, 2551, 2, 2, 0, 0, 0, 0x03, 0x22B3 },
+        { 2553, 2553, 2, 2, 0, 0, 0, 0x03, 0x22B4 },
+        { 2555, 2555, 2, 2, 0, 0, 0, 0x03, 0x22B5 },
+        { 2557, 2557, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 2558, 2558, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 0, 2559, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2561, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2563, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2565, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2567, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2569, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2571, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2573, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2575, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2577, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2579, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2581, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2584, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2587, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2590, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2593, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2596, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2599, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2602, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2605, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2608, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2612, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2616, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2620, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2624, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2628, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2632, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2636, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2640, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2644, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2648, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2652, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2654, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2656, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2658, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2660, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2662, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2664, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2666, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2668, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2670, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2673, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2676, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2679, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2682, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2685, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2688, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2691, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2694, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2697, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2700, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2703, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2706, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2709, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2712, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2715, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2718, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2721, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2724, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2727, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2730, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2733, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2736, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2739, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2742, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2745, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2748, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2751, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2754, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2757, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2760, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2763, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2766, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2769, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2772, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2775, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2778, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 979, 0, 1, 902, 1, 0, 0x12, 0x0000 },
+        { 0, 981, 0, 1, 903, 1, 0, 0x12, 0x0000 },
+        { 0, 2324, 0, 1, 904, 1, 0, 0x12, 0x0000 },
+        { 0, 982, 0, 1, 905, 1, 0, 0x12, 0x0000 },
+        { 0, 983, 0, 1, 906, 1, 0, 0x12, 0x0000 },
+        { 0, 2349, 0, 1, 907, 1, 0, 0x12, 0x0000 },
+        { 0, 985, 0, 1, 908, 1, 0, 0x12, 0x0000 },
+        { 0, 986, 0, 1, 909, 1, 0, 0x12, 0x0000 },
+        { 0, 987, 0, 1, 910, 1, 0, 0x12, 0x0000 },
+        { 0, 988, 0, 1, 911, 1, 0, 0x12, 0x0000 },
+        { 0, 989, 0, 1, 912, 1, 0, 0x12, 0x0000 },
+        { 0, 990, 0, 1, 913, 1, 0, 0x12, 0x0000 },
+        { 0, 991, 0, 1, 914, 1, 0, 0x12, 0x0000 },
+        { 0, 992, 0, 1, 915, 1, 0, 0x12, 0x0000 },
+        { 0, 993, 0, 1, 916, 1, 0, 0x12, 0x0000 },
+        { 0, 995, 0, 1, 917, 1, 0, 0x12, 0x0000 },
+        { 0, 2339, 0, 1, 918, 1, 0, 0x12, 0x0000 },
+        { 0, 996, 0, 1, 919, 1, 0, 0x12, 0x0000 },
+        { 0, 2781, 0, 1, 920, 1, 0, 0x12, 0x0000 },
+        { 0, 997, 0, 1, 921, 1, 0, 0x12, 0x0000 },
+        { 0, 998, 0, 1, 922, 1, 0, 0x12, 0x0000 },
+        { 0, 2415, 0, 1, 923, 1, 0, 0x12, 0x0000 },
+        { 0, 999, 0, 1, 924, 1, 0, 0x12, 0x0000 },
+        { 0, 2427, 0, 1, 925, 1, 0, 0x12, 0x0000 },
+        { 0, 2782, 0, 1, 926, 1, 0, 0x12, 0x0000 },
+        { 0, 2347, 0, 1, 927, 1, 0, 0x12, 0x0000 },
+        { 0, 2783, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2784, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2788, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2791, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2793, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 2796, 2796, 2, 2, 0, 0, 0, 0x17, 0x2ADD },
+        { 0, 0, 0, 0, 928, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 929, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 930, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 931, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 932, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 933, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 934, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 935, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 936, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 937, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 938, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 939, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 940, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 941, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 942, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 943, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 944, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 945, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 946, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 947, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 948, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 949, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 950, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 951, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 952, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 953, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 954, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 955, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 956, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 957, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 958, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 959, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 960, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 961, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 962, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 963, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 964, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 965, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 966, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 967, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 968, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 969, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 970, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 971, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 972, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 973, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 974, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 975, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 976, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 977, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 978, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 979, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 980, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 981, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 982, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 983, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 984, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 985, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 986, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 987, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 988, 1, 0, 0x00, 0x0000 },
+        { 0, 2415, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 0, 0, 0, 989, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 990, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 991, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 992, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 993, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 994, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 995, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 996, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 997, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 998, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 999, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1000, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1001, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1002, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1003, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1004, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1005, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1006, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1007, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1008, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1009, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1010, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1011, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1012, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1013, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1014, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1015, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1016, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1017, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1018, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1019, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1020, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1021, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1022, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1023, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1024, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1025, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1026, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1027, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1028, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1029, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1030, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1031, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1032, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1033, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1034, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1035, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1036, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1037, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1038, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1039, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1040, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1041, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1042, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1043, 1, 0, 0x00, 0x0000 },
+        { 0, 2798, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2799, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2800, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2801, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2802, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2803, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2804, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2805, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2806, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2807, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2808, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2809, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2810, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2811, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2812, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2813, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2814, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2815, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2816, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2817, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2818, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2819, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2820, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2821, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2822, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2823, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2824, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2825, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2826, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2827, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2828, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2829, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2830, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2831, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2832, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2833, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2834, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2835, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2836, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2837, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2838, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2839, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2840, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2841, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2842, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2843, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2844, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2845, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2846, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2847, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2848, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2849, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2850, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2851, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2852, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2853, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2854, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2855, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2856, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2857, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2858, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2859, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2860, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2861, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2862, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2863, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2864, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2865, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2866, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2867, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2868, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2869, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2870, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2871, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2872, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2873, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2874, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2875, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2876, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2877, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2878, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2879, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2880, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2881, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2882, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2883, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2884, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2885, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2886, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2887, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2888, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2889, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2890, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2891, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2892, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2893, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2894, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2895, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2896, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2897, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2898, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2899, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2900, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2901, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2902, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2903, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2904, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2905, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2906, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2907, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2908, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2909, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2910, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2911, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2912, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2913, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2914, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2915, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2916, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2917, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2918, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2919, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2920, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2921, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2922, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2923, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2924, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2925, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2926, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2927, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2928, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2929, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2930, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2931, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2932, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2933, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2934, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2935, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2936, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2937, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2938, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2939, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2940, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2941, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2942, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2943, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2944, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2945, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2946, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2947, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2948, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2949, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2950, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2951, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2952, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2953, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2954, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2955, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2956, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2957, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2958, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2959, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2960, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2961, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2962, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2963, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2964, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2965, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2966, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2967, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2968, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2969, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2970, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2971, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2972, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2973, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2974, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2975, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2976, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2977, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2978, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2979, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2980, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2981, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2982, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2983, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2984, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2985, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2986, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2987, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2988, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2989, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2990, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2991, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2992, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2993, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2994, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2995, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2996, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2997, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2998, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2999, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3000, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3001, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3002, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3003, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3004, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3005, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3006, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3007, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3008, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3009, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3010, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3011, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3012, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3013, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3014, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 0, 0, 0, 0, 0, 224, 0x00, 0x0000 },
+        { 0, 3015, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3016, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3017, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 3018, 3018, 2, 2, 0, 0, 0, 0x03, 0x304B },
+        { 3020, 3020, 2, 2, 0, 0, 0, 0x03, 0x304D },
+        { 3022, 3022, 2, 2, 0, 0, 0, 0x03, 0x304F },
+        { 3024, 3024, 2, 2, 0, 0, 0, 0x03, 0x3051 },
+        { 3026, 3026, 2, 2, 0, 0, 0, 0x03, 0x3053 },
+        { 3028, 3028, 2, 2, 0, 0, 0, 0x03, 0x3055 },
+        { 3030, 3030, 2, 2, 0, 0, 0, 0x03, 0x3057 },
+        { 3032, 3032, 2, 2, 0, 0, 0, 0x03, 0x3059 },
+        { 3034, 3034, 2, 2, 0, 0, 0, 0x03, 0x305B },
+        { 3036, 3036, 2, 2, 0, 0, 0, 0x03, 0x305D },
+        { 3038, 3038, 2, 2, 0, 0, 0, 0x03, 0x305F },
+        { 3040, 3040, 2, 2, 0, 0, 0, 0x03, 0x3061 },
+        { 3042, 3042, 2, 2, 0, 0, 0, 0x03, 0x3064 },
+        { 3044, 3044, 2, 2, 0, 0, 0, 0x03, 0x3066 },
+        { 3046, 3046, 2, 2, 0, 0, 0, 0x03, 0x3068 },
+        { 3048, 3048, 2, 2, 0, 0, 0, 0x03, 0x306F },
+        { 3050, 3050, 2, 2, 0, 0, 0, 0x03, 0x306F },
+        { 3052, 3052, 2, 2, 0, 0, 0, 0x03, 0x3072 },
+        { 3054, 3054, 2, 2, 0, 0, 0, 0x03, 0x3072 },
+        { 3056, 3056, 2, 2, 0, 0, 0, 0x03, 0x3075 },
+        { 3058, 3058, 2, 2, 0, 0, 0, 0x03, 0x3075 },
+        { 3060, 3060, 2, 2, 0, 0, 0, 0x03, 0x3078 },
+        { 3062, 3062, 2, 2, 0, 0, 0, 0x03, 0x3078 },
+        { 3064, 3064, 2, 2, 0, 0, 0, 0x03, 0x307B },
+        { 3066, 3066, 2, 2, 0, 0, 0, 0x03, 0x307B },
+        { 3068, 3068, 2, 2, 0, 0, 0, 0x03, 0x3046 },
+        { 0, 0, 0, 0, 0, 0, 8, 0x28, 0x0000 },
+        { 0, 3070, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3072, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 3074, 3074, 2, 2, 0, 0, 0, 0x03, 0x309D },
+        { 0, 3076, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 3078, 3078, 2, 2, 0, 0, 0, 0x03, 0x30AB },
+        { 3080, 3080, 2, 2, 0, 0, 0, 0x03, 0x30AD },
+        { 3082, 3082, 2, 2, 0, 0, 0, 0x03, 0x30AF },
+        { 3084, 3084, 2, 2, 0, 0, 0, 0x03, 0x30B1 },
+        { 3086, 3086, 2, 2, 0, 0, 0, 0x03, 0x30B3 },
+        { 3088, 3088, 2, 2, 0, 0, 0, 0x03, 0x30B5 },
+        { 3090, 3090, 2, 2, 0, 0, 0, 0x03, 0x30B7 },
+        { 3092, 3092, 2, 2, 0, 0, 0, 0x03, 0x30B9 },
+        { 3094, 3094, 2, 2, 0, 0, 0, 0x03, 0x30BB },
+        { 3096, 3096, 2, 2, 0, 0, 0, 0x03, 0x30BD },
+        { 3098, 3098, 2, 2, 0, 0, 0, 0x03, 0x30BF },
+        { 3100, 3100, 2, 2, 0, 0, 0, 0x03, 0x30C1 },
+        { 3102, 3102, 2, 2, 0, 0, 0, 0x03, 0x30C4 },
+        { 3104, 3104, 2, 2, 0, 0, 0, 0x03, 0x30C6 },
+        { 3106, 3106, 2, 2, 0, 0, 0, 0x03, 0x30C8 },
+        { 3108, 3108, 2, 2, 0, 0, 0, 0x03, 0x30CF },
+        { 3110, 3110, 2, 2, 0, 0, 0, 0x03, 0x30CF },
+        { 3112, 3112, 2, 2, 0, 0, 0, 0x03, 0x30D2 },
+        { 3114, 3114, 2, 2, 0, 0, 0, 0x03, 0x30D2 },
+        { 3116, 3116, 2, 2, 0, 0, 0, 0x03, 0x30D5 },
+        { 3118, 3118, 2, 2, 0, 0, 0, 0x03, 0x30D5 },
+        { 3120, 3120, 2, 2, 0, 0, 0, 0x03, 0x30D8 },
+        { 3122, 3122, 2, 2, 0, 0, 0, 0x03, 0x30D8 },
+        { 3124, 3124, 2, 2, 0, 0, 0, 0x03, 0x30DB },
+        { 3126, 3126, 2, 2, 0, 0, 0, 0x03, 0x30DB },
+        { 3128, 3128, 2, 2, 0, 0, 0, 0x03, 0x30A6 },
+        { 3130, 3130, 2, 2, 0, 0, 0, 0x03, 0x30EF },
+        { 3132, 3132, 2, 2, 0, 0, 0, 0x03, 0x30F0 },
+        { 3134, 3134, 2, 2, 0, 0, 0, 0x03, 0x30F1 },
+        { 3136, 3136, 2, 2, 0, 0, 0, 0x03, 0x30F2 },
+        { 3138, 3138, 2, 2, 0, 0, 0, 0x03, 0x30FD },
+        { 0, 3140, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3142, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3143, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3144, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3145, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3146, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3147, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3148, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3149, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3150, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3151, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3152, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3153, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3154, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3155, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3156, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3157, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3158, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3159, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3160, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3161, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3162, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3163, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3164, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3165, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3166, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3167, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3168, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3169, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3170, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3171, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3172, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3173, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3174, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3175, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3176, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3177, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3178, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3179, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3180, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3181, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3182, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3183, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3184, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3185, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3186, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3187, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3188, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3189, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3190, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3191, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3192, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3193, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3194, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3195, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3196, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3197, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3198, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3199, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3200, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3201, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3202, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3203, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3204, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3205, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3206, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3207, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3208, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3209, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3210, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3211, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3212, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3213, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3214, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3215, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3216, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3217, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3218, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3219, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3220, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3221, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3222, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3223, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3224, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3225, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3226, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3227, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3228, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3229, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3230, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3231, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3232, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3233, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3234, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3235, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3236, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3237, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3238, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3239, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3240, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3241, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3242, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3243, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3244, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3245, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3246, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3249, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3252, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3255, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3258, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3261, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3264, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3267, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3270, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3273, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3276, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3279, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3282, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3285, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3288, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3292, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3296, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3300, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3304, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3308, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3312, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3316, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3320, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3324, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3328, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3332, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3336, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3340, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3344, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3348, 0, 7, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3355, 0, 6, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3361, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3364, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3367, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3370, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3373, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3376, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3379, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3382, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3385, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3388, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3391, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3394, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3397, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3400, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3403, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3406, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3409, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3412, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3415, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3418, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3421, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3424, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3427, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3430, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3433, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3436, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3439, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3442, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3445, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3448, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3451, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3454, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3457, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3460, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3463, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3466, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3469, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3470, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3471, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3472, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3475, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3477, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3479, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3481, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3483, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3485, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3487, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3489, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3491, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3493, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3495, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3497, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3499, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3501, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3503, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3505, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3507, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3509, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3511, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3513, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3515, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3517, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3519, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3521, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3523, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3525, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3527, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3529, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3531, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3533, 0, 5, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3538, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3542, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3544, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3545, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3546, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3547, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3548, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3549, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3550, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3551, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3552, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3553, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3554, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3555, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3556, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3557, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3558, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3559, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3560, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3561, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3562, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3563, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3564, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3565, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3566, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3567, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3568, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3569, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3570, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3571, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3572, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3573, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3574, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3575, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3576, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3578, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3580, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3582, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3584, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3586, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3588, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3590, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3592, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3594, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3596, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3598, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3600, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3602, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3604, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3606, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3608, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3610, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3612, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3614, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3616, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3618, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3620, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3622, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3624, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3627, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3630, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3633, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3635, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3638, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3640, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3643, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3644, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3645, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3646, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3647, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3648, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3649, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3650, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3651, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3652, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3653, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3654, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3655, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3656, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3657, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3658, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3659, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3660, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3661, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3662, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3663, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3664, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3665, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3666, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3667, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3668, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3669, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3670, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3671, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3672, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3673, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3674, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3675, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3676, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3677, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3678, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3679, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3680, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3681, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3682, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3683, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3684, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3685, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3686, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3687, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3688, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3689, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3690, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3692, 0, 5, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3697, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3701, 0, 5, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3706, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3709, 0, 5, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3714, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3717, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3720, 0, 6, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3726, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3730, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3733, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3736, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3739, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3743, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3747, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3751, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3755, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3759, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3763, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3767, 0, 6, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3773, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3775, 0, 6, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3781, 0, 6, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3787, 0, 5, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3792, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3796, 0, 6, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3802, 0, 6, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3808, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3812, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3815, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3818, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3822, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3826, 0, 5, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3831, 0, 5, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3836, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3839, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3842, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3846, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3849, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3852, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3854, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3856, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3859, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3862, 0, 6, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3868, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3872, 0, 5, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3877, 0, 6, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3883, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3887, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3890, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3893, 0, 6, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3899, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3903, 0, 6, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3909, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3912, 0, 5, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3917, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3920, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3924, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3927, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3931, 0, 5, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3936, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3940, 0, 5, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3945, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3949, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3951, 0, 5, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3956, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3959, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3962, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3966, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3969, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3972, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3975, 0, 5, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3980, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3984, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3986, 0, 6, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3992, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 3995, 0, 5, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4000, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4004, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4008, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4011, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4014, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4018, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4020, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4024, 0, 5, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4029, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4031, 0, 6, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4037, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4040, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4042, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4044, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4046, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4048, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4050, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4052, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4054, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4056, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4058, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4060, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4063, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4066, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4069, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4072, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4075, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4078, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4081, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4084, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4087, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4090, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4093, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4096, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4099, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4102, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4105, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4108, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4110, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4112, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4115, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4117, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4119, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4121, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4124, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4127, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4129, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4131, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4133, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4135, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4137, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4141, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4143, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4145, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4147, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4149, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4151, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4153, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4155, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4157, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4160, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4164, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4166, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4168, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4170, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4172, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4174, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4176, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4178, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4181, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4184, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4187, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4190, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4192, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4194, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4196, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4198, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4200, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4202, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4204, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4206, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4208, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4210, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4213, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4216, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4218, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4221, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4224, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4227, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4229, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4232, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4235, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4239, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4241, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4244, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4247, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4250, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4253, 0, 5, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4258, 0, 6, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4264, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4266, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4268, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4270, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4272, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4274, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4276, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4278, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4280, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4282, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4284, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4286, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4288, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4290, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4292, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4294, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4296, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4298, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4300, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4304, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4306, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4308, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4310, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4314, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4317, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4319, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4321, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4323, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4325, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4327, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4329, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4331, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4333, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4335, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4337, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4340, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4342, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4344, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4347, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4350, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4352, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4356, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4359, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4361, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4363, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4365, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4367, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4370, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4373, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4375, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4377, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4379, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4381, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4383, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4385, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4387, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4389, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4391, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4394, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4397, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4400, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4403, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4406, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4409, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4412, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4415, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4418, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4421, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4424, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4427, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4430, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4433, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4436, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4439, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4442, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4445, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4448, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4451, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4454, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4457, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 0, 0, 0, 1044, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1045, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1046, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1047, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1048, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1049, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1050, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1051, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1052, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1053, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1054, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1055, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1056, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1057, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1058, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1059, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1060, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1061, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1062, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1063, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1064, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1065, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1066, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1067, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1068, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1069, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1070, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1071, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1072, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1073, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1074, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1075, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1076, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1077, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1078, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1079, 1, 0, 0x00, 0x0000 },
+        { 0, 4460, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4461, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 0, 0, 0, 1080, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1081, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1082, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1083, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1084, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1085, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1086, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1087, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1088, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1089, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1090, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1091, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1092, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1093, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1094, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1095, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1096, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1097, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1098, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1099, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1100, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1101, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1102, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1103, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1104, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1105, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1106, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1107, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1108, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1109, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1110, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1111, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1112, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1113, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1114, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1115, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1116, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1117, 1, 0, 0x00, 0x0000 },
+        { 0, 4462, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 0, 0, 0, 1118, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1119, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1120, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1121, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1122, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1123, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1124, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1125, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1126, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1127, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1128, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1129, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1130, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1131, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1132, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1133, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1134, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1135, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1136, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1137, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1138, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1139, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1140, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1141, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1142, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1143, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1144, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1145, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1146, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1147, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1148, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1149, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1150, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1151, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1152, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1153, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1154, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1155, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1156, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1157, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1158, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1159, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1160, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1161, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1162, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1163, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1164, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1165, 1, 0, 0x00, 0x0000 },
+        { 0, 4463, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4464, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4465, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4466, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4467, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4468, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4469, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 0, 0, 0, 1166, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1167, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1168, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1169, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1170, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1171, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1172, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1173, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1174, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1175, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1176, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1177, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1178, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1179, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1180, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1181, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1182, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1183, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1184, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1185, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1186, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1187, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1188, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1189, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1190, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1191, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1192, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1193, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1194, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1195, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1196, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1197, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1198, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1199, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1200, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1201, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1202, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1203, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1204, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1205, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1206, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1207, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1208, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1209, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1210, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1211, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1212, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1213, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1214, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1215, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1216, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1217, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1218, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1219, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1220, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1221, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1222, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1223, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1224, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1225, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1226, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1227, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1228, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1229, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1230, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1231, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1232, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1233, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1234, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1235, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1236, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1237, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1238, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1239, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1240, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1241, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1242, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1243, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1244, 1, 0, 0x00, 0x0000 },
+        { 0, 0, 0, 0, 1245, 1, 0, 0x00, 0x0000 },
+        { 4470, 4470, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4471, 4471, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 2959, 2959, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4472, 4472, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4473, 4473, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4474, 4474, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4475, 4475, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 3013, 3013, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4476, 4476, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 2967, 2967, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4477, 4477, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4478, 4478, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4479, 4479, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4480, 4480, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4481, 4481, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4482, 4482, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4483, 4483, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4484, 4484, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4485, 4485, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4486, 4486, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4487, 4487, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4488, 4488, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4489, 4489, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4490, 4490, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4491, 4491, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4492, 4492, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4493, 4493, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4494, 4494, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4495, 4495, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4496, 4496, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4497, 4497, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4498, 4498, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4499, 4499, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4500, 4500, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4501, 4501, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4502, 4502, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4503, 4503, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4504, 4504, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4505, 4505, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4506, 4506, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4507, 4507, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4508, 4508, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4509, 4509, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4510, 4510, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4511, 4511, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4512, 4512, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4513, 4513, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4514, 4514, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4515, 4515, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4516, 4516, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4517, 4517, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 2925, 2925, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4518, 4518, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4519, 4519, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4520, 4520, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4521, 4521, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4522, 4522, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4523, 4523, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4524, 4524, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4525, 4525, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4526, 4526, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4527, 4527, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4528, 4528, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 2998, 2998, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4529, 4529, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4530, 4530, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4531, 4531, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4532, 4532, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4533, 4533, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4534, 4534, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4535, 4535, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4536, 4536, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4537, 4537, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4538, 4538, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4539, 4539, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4540, 4540, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4541, 4541, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4542, 4542, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4543, 4543, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4544, 4544, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4545, 4545, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4546, 4546, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4547, 4547, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4548, 4548, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4549, 4549, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4550, 4550, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4551, 4551, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4552, 4552, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4553, 4553, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4554, 4554, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4555, 4555, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4556, 4556, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4557, 4557, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4558, 4558, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4559, 4559, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4560, 4560, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4561, 4561, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4562, 4562, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4563, 4563, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4564, 4564, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4565, 4565, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4566, 4566, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4567, 4567, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4568, 4568, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4569, 4569, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4570, 4570, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4571, 4571, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4572, 4572, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4573, 4573, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4574, 4574, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4575, 4575, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 2961, 2961, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4576, 4576, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4577, 4577, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4578, 4578, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4579, 4579, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4580, 4580, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4581, 4581, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4582, 4582, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4583, 4583, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4584, 4584, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4585, 4585, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4586, 4586, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4587, 4587, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4588, 4588, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4589, 4589, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4590, 4590, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 2838, 2838, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4591, 4591, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4592, 4592, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4593, 4593, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4594, 4594, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4595, 4595, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4596, 4596, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4597, 4597, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4598, 4598, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 2819, 2819, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4599, 4599, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4600, 4600, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4601, 4601, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4602, 4602, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4603, 4603, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4604, 4604, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4605, 4605, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4606, 4606, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4607, 4607, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4608, 4608, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4609, 4609, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4610, 4610, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4611, 4611, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4612, 4612, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4613, 4613, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4614, 4614, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4615, 4615, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4616, 4616, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4617, 4617, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4618, 4618, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4619, 4619, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4620, 4620, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4621, 4621, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4622, 4622, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4623, 4623, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4624, 4624, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4625, 4625, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4626, 4626, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4627, 4627, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4628, 4628, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4629, 4629, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4630, 4630, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4631, 4631, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4632, 4632, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4633, 4633, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4634, 4634, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4635, 4635, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4636, 4636, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4637, 4637, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4638, 4638, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4639, 4639, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4640, 4640, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4641, 4641, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4642, 4642, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4643, 4643, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4644, 4644, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4645, 4645, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4646, 4646, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4647, 4647, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4648, 4648, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4649, 4649, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4650, 4650, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4651, 4651, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4652, 4652, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 3012, 3012, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4653, 4653, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4654, 4654, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4655, 4655, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4656, 4656, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4657, 4657, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4658, 4658, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4659, 4659, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4660, 4660, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4661, 4661, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4662, 4662, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4663, 4663, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4664, 4664, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 3545, 3545, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4665, 4665, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4666, 4666, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4667, 4667, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4668, 4668, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4669, 4669, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4670, 4670, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4671, 4671, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4672, 4672, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4673, 4673, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4674, 4674, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4675, 4675, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4676, 4676, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4677, 4677, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4678, 4678, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4679, 4679, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4680, 4680, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4681, 4681, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4682, 4682, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4683, 4683, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4684, 4684, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4685, 4685, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4686, 4686, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 2966, 2966, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4687, 4687, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4688, 4688, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4689, 4689, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4690, 4690, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4691, 4691, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4692, 4692, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4693, 4693, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4694, 4694, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4695, 4695, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4696, 4696, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4697, 4697, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4698, 4698, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4699, 4699, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 2917, 2917, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4700, 4700, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4701, 4701, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4702, 4702, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4703, 4703, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4704, 4704, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4705, 4705, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4706, 4706, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4707, 4707, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4708, 4708, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4709, 4709, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4710, 4710, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4711, 4711, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4712, 4712, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4713, 4713, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4714, 4714, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4715, 4715, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 2944, 2944, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4716, 4716, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 2947, 2947, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4717, 4717, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4718, 4718, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4719, 4719, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4720, 4720, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4721, 4721, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4722, 4722, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4723, 4723, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4724, 4724, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4725, 4725, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4726, 4726, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4727, 4727, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4728, 4728, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4729, 4729, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4730, 4730, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 2924, 2924, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4731, 4731, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4732, 4732, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4733, 4733, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4734, 4734, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4735, 4735, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4736, 4736, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4737, 4737, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4738, 4738, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4739, 4739, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4740, 4740, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4741, 4741, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4742, 4742, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4743, 4743, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4744, 4744, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4745, 4745, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4746, 4746, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4747, 4747, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4748, 4748, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4749, 4749, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4750, 4750, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4751, 4751, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4752, 4752, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 2845, 2845, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4753, 4753, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4754, 4754, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4755, 4755, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4756, 4756, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4757, 4757, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4758, 4758, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4759, 4759, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4760, 4760, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4761, 4761, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4762, 4762, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4763, 4763, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4764, 4764, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4765, 4765, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4766, 4766, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4767, 4767, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 3550, 3550, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4768, 4768, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4769, 4769, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4770, 4770, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4771, 4771, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 3554, 3554, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4772, 4772, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4773, 4773, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4774, 4774, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4775, 4775, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4776, 4776, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4777, 4777, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4778, 4778, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4779, 4779, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4780, 4780, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4781, 4781, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4782, 4782, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4783, 4783, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4784, 4784, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4785, 4785, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4786, 4786, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4787, 4787, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4788, 4788, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4789, 4789, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4790, 4790, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4791, 4791, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4792, 4792, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4793, 4793, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4794, 4794, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4795, 4795, 2, 2, 0, 0, 0, 0x17, 0x0000 },
+        { 4797, 4797, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4798, 4798, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4799, 4799, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4800, 4800, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4801, 4801, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4802, 4802, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4803, 4803, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4804, 4804, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4805, 4805, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4806, 4806, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4807, 4807, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4808, 4808, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4809, 4809, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4810, 4810, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4811, 4811, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4812, 4812, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4813, 4813, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4814, 4814, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4815, 4815, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4816, 4816, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4817, 4817, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4818, 4818, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4819, 4819, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4820, 4820, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4821, 4821, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4822, 4822, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4823, 4823, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4824, 4824, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4825, 4825, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4826, 4826, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4827, 4827, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4828, 4828, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 2878, 2878, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4829, 4829, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4830, 4830, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4831, 4831, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4832, 4832, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4833, 4833, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4834, 4834, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4835, 4835, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4836, 4836, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4837, 4837, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4838, 4838, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4839, 4839, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4840, 4840, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4841, 4841, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4842, 4842, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4843, 4843, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4844, 4844, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4845, 4845, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4846, 4846, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4847, 4847, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4848, 4848, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4849, 4849, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4850, 4850, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4851, 4851, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4852, 4852, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4853, 4853, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4854, 4854, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4855, 4855, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4856, 4856, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4857, 4857, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4858, 4858, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4859, 4859, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4860, 4860, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4861, 4861, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4862, 4862, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4863, 4863, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4864, 4864, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4865, 4865, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4866, 4866, 2, 2, 0, 0, 0, 0x17, 0x0000 },
+        { 4868, 4868, 2, 2, 0, 0, 0, 0x17, 0x0000 },
+        { 4870, 4870, 2, 2, 0, 0, 0, 0x17, 0x0000 },
+        { 4872, 4872, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4873, 4873, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4874, 4874, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4875, 4875, 2, 2, 0, 0, 0, 0x17, 0x0000 },
+        { 4877, 4877, 2, 2, 0, 0, 0, 0x17, 0x0000 },
+        { 4879, 4879, 2, 2, 0, 0, 0, 0x17, 0x0000 },
+        { 4881, 4881, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 4882, 4882, 1, 1, 0, 0, 0, 0x17, 0x0000 },
+        { 0, 4883, 0, 2, 1246, 2, 0, 0x12, 0x0000 },
+        { 0, 4885, 0, 2, 1248, 2, 0, 0x12, 0x0000 },
+        { 0, 4887, 0, 2, 1250, 2, 0, 0x12, 0x0000 },
+        { 0, 4889, 0, 3, 1252, 3, 0, 0x12, 0x0000 },
+        { 0, 4892, 0, 3, 1255, 3, 0, 0x12, 0x0000 },
+        { 0, 4895, 0, 2, 1258, 2, 0, 0x12, 0x0000 },
+        { 0, 4897, 0, 2, 1260, 2, 0, 0x12, 0x0000 },
+        { 0, 4899, 0, 2, 1262, 2, 0, 0x12, 0x0000 },
+        { 0, 4901, 0, 2, 1264, 2, 0, 0x12, 0x0000 },
+        { 0, 4903, 0, 2, 1266, 2, 0, 0x12, 0x0000 },
+        { 0, 4905, 0, 2, 1268, 2, 0, 0x12, 0x0000 },
+        { 4907, 4907, 2, 2, 0, 0, 0, 0x17, 0x05D9 },
+        { 0, 0, 0, 0, 0, 0, 26, 0x00, 0x0000 },
+        { 4909, 4909, 2, 2, 0, 0, 0, 0x17, 0x05F2 },
+        { 0, 4911, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4912, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4913, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4914, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4915, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4916, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4917, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 4918, 4918, 2, 2, 0, 0, 0, 0x17, 0x05E9 },
+        { 4920, 4920, 2, 2, 0, 0, 0, 0x17, 0x05E9 },
+        { 4922, 4922, 3, 3, 0, 0, 0, 0x17, 0x05E9 },
+        { 4925, 4925, 3, 3, 0, 0, 0, 0x17, 0x05E9 },
+        { 4928, 4928, 2, 2, 0, 0, 0, 0x17, 0x05D0 },
+        { 4930, 4930, 2, 2, 0, 0, 0, 0x17, 0x05D0 },
+        { 4932, 4932, 2, 2, 0, 0, 0, 0x17, 0x05D0 },
+        { 4934, 4934, 2, 2, 0, 0, 0, 0x17, 0x05D1 },
+        { 4936, 4936, 2, 2, 0, 0, 0, 0x17, 0x05D2 },
+        { 4938, 4938, 2, 2, 0, 0, 0, 0x17, 0x05D3 },
+        { 4940, 4940, 2, 2, 0, 0, 0, 0x17, 0x05D4 },
+        { 4942, 4942, 2, 2, 0, 0, 0, 0x17, 0x05D5 },
+        { 4944, 4944, 2, 2, 0, 0, 0, 0x17, 0x05D6 },
+        { 4946, 4946, 2, 2, 0, 0, 0, 0x17, 0x05D8 },
+        { 4948, 4948, 2, 2, 0, 0, 0, 0x17, 0x05D9 },
+        { 4950, 4950, 2, 2, 0, 0, 0, 0x17, 0x05DA },
+        { 4952, 4952, 2, 2, 0, 0, 0, 0x17, 0x05DB },
+        { 4954, 4954, 2, 2, 0, 0, 0, 0x17, 0x05DC },
+        { 4956, 4956, 2, 2, 0, 0, 0, 0x17, 0x05DE },
+        { 4958, 4958, 2, 2, 0, 0, 0, 0x17, 0x05E0 },
+        { 4960, 4960, 2, 2, 0, 0, 0, 0x17, 0x05E1 },
+        { 4962, 4962, 2, 2, 0, 0, 0, 0x17, 0x05E3 },
+        { 4964, 4964, 2, 2, 0, 0, 0, 0x17, 0x05E4 },
+        { 4966, 4966, 2, 2, 0, 0, 0, 0x17, 0x05E6 },
+        { 4968, 4968, 2, 2, 0, 0, 0, 0x17, 0x05E7 },
+        { 4970, 4970, 2, 2, 0, 0, 0, 0x17, 0x05E8 },
+        { 4972, 4972, 2, 2, 0, 0, 0, 0x17, 0x05E9 },
+        { 4974, 4974, 2, 2, 0, 0, 0, 0x17, 0x05EA },
+        { 4976, 4976, 2, 2, 0, 0, 0, 0x17, 0x05D5 },
+        { 4978, 4978, 2, 2, 0, 0, 0, 0x17, 0x05D1 },
+        { 4980, 4980, 2, 2, 0, 0, 0, 0x17, 0x05DB },
+        { 4982, 4982, 2, 2, 0, 0, 0, 0x17, 0x05E4 },
+        { 0, 4984, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4986, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4987, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4988, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4989, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4990, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4991, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4992, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4993, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4994, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4995, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4996, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4997, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4998, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 4999, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5000, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5001, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5002, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5003, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5004, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5005, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5006, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5007, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5008, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5009, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5010, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 809, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5011, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5012, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5013, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 813, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5014, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5015, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5016, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5017, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5018, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5019, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5020, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5021, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5022, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5023, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5026, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5029, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5032, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5035, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5038, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5041, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5044, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5047, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5048, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5051, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5054, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5057, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5060, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5062, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5064, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5066, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5068, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5070, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5072, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5074, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5076, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5078, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5080, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5082, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5084, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5086, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5088, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5090, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5092, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5094, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5096, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5098, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5100, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5102, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5104, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5106, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5108, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5110, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5112, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5114, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5116, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5118, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5120, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5122, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5124, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5126, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5128, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5130, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5132, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5134, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5136, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5138, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5140, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5142, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5144, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5146, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5148, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5150, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5152, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5154, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5156, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5158, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5160, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5162, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5164, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5166, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5168, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5170, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5172, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5174, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5176, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5178, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5180, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5182, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5184, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5186, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5188, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5190, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5192, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5194, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5196, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5198, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5200, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5202, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5204, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5206, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5208, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5210, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5212, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5214, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5216, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5218, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5220, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5222, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5224, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5226, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5228, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5230, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5232, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5234, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5236, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5238, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5241, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5244, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5247, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5250, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5253, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5256, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5259, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5262, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5265, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5267, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5269, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5271, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5273, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5275, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5277, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5279, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5281, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5283, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5285, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5287, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5289, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5291, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5293, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5295, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5297, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5300, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5303, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5305, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5307, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5309, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5311, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5313, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5315, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5317, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5319, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5321, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5323, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5325, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5328, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5331, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5334, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5336, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5338, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5340, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5342, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5344, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5346, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5348, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5350, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5352, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5354, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5356, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5358, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5360, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5362, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5364, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5366, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5368, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5370, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5372, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5374, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5376, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5378, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5380, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5382, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5384, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5386, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5388, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5390, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5393, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5396, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5399, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5402, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5405, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5408, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5411, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5414, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5417, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5420, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5423, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5426, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5429, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5432, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5435, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5438, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5441, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5444, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5447, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5450, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5453, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5456, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5459, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5462, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5465, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5468, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5471, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5474, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5477, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5480, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5483, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5486, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5489, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5492, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5495, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5498, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5501, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5504, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5507, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5510, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5513, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5516, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5519, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5522, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5525, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5528, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5531, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5534, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5537, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5540, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5543, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5546, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5549, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5552, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5555, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5558, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5561, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5564, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5567, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5570, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5573, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5576, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5579, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5582, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5585, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5588, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5591, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5594, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5597, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5600, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5603, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5606, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5609, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5612, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5615, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5618, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5621, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5624, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5627, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5630, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5633, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5636, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5639, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5642, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5645, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5648, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5651, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5654, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5657, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5660, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5663, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5666, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5669, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5672, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5675, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5678, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5682, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5686, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5690, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5694, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5698, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5702, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5706, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5709, 0, 18, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5727, 0, 8, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5735, 0, 4, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5739, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5740, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5741, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5742, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 621, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5743, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5744, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5745, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5746, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5747, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5748, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5749, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5750, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5751, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5752, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5753, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5754, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5755, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5756, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5757, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2557, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2558, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5758, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5759, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5760, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5761, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5762, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5763, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5764, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5765, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5766, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5767, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5768, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5769, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5770, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5771, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5772, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5773, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5774, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5776, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5778, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5780, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5782, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5784, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5786, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5788, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5790, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5792, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5794, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5796, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5798, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5800, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5802, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 791, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 793, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 795, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 797, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 799, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5803, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5804, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5805, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5806, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5807, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5808, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5809, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5810, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5811, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5812, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5813, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5814, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5815, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5816, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5817, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5818, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5819, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5820, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5821, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5822, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5823, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5824, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5825, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5826, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5827, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5828, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5829, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5830, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5831, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5832, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5835, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5838, 0, 3, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5841, 0, 2, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5843, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5844, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5845, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 979, 0, 1, 1270, 1, 0, 0x12, 0x0000 },
+        { 0, 981, 0, 1, 1271, 1, 0, 0x12, 0x0000 },
+        { 0, 2324, 0, 1, 1272, 1, 0, 0x12, 0x0000 },
+        { 0, 982, 0, 1, 1273, 1, 0, 0x12, 0x0000 },
+        { 0, 983, 0, 1, 1274, 1, 0, 0x12, 0x0000 },
+        { 0, 2349, 0, 1, 1275, 1, 0, 0x12, 0x0000 },
+        { 0, 985, 0, 1, 1276, 1, 0, 0x12, 0x0000 },
+        { 0, 986, 0, 1, 1277, 1, 0, 0x12, 0x0000 },
+        { 0, 987, 0, 1, 1278, 1, 0, 0x12, 0x0000 },
+        { 0, 988, 0, 1, 1279, 1, 0, 0x12, 0x0000 },
+        { 0, 989, 0, 1, 1280, 1, 0, 0x12, 0x0000 },
+        { 0, 990, 0, 1, 1281, 1, 0, 0x12, 0x0000 },
+        { 0, 991, 0, 1, 1282, 1, 0, 0x12, 0x0000 },
+        { 0, 992, 0, 1, 1283, 1, 0, 0x12, 0x0000 },
+        { 0, 993, 0, 1, 1284, 1, 0, 0x12, 0x0000 },
+        { 0, 995, 0, 1, 1285, 1, 0, 0x12, 0x0000 },
+        { 0, 2339, 0, 1, 1286, 1, 0, 0x12, 0x0000 },
+        { 0, 996, 0, 1, 1287, 1, 0, 0x12, 0x0000 },
+        { 0, 2781, 0, 1, 1288, 1, 0, 0x12, 0x0000 },
+        { 0, 997, 0, 1, 1289, 1, 0, 0x12, 0x0000 },
+        { 0, 998, 0, 1, 1290, 1, 0, 0x12, 0x0000 },
+        { 0, 2415, 0, 1, 1291, 1, 0, 0x12, 0x0000 },
+        { 0, 999, 0, 1, 1292, 1, 0, 0x12, 0x0000 },
+        { 0, 2427, 0, 1, 1293, 1, 0, 0x12, 0x0000 },
+        { 0, 2782, 0, 1, 1294, 1, 0, 0x12, 0x0000 },
+        { 0, 2347, 0, 1, 1295, 1, 0, 0x12, 0x0000 },
+        { 0, 5846, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 2245, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5847, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5848, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5849, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5850, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5851, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5852, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5853, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5854, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5855, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5856, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5857, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5858, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5859, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5860, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5861, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5862, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5863, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5864, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5865, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5866, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5867, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5868, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5869, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5870, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5871, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5872, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5873, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5874, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5875, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5876, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+        { 0, 5877, 0, 1, 0, 0, 0, 0x12, 0x0000 },
+    };
+
+    /** Full canonical and compatibility decompositions (UTF-16) */
+    inline constexpr uint16 DecompositionPool[5878] = {
+        0x0020, 0x0020, 0x0308, 0x0061, 0x0020, 0x0304, 0x0032, 0x0033, 0x0020, 0x0301, 0x03BC, 0x0020, 0x0327, 0x0031, 0x006F, 0x0031,
+        0x2044, 0x0034, 0x0031, 0x2044, 0x0032, 0x0033, 0x2044, 0x0034, 0x0041, 0x0300, 0x0041, 0x0301, 0x0041, 0x0302, 0x0041, 0x0303,
+        0x0041, 0x0308, 0x0041, 0x030A, 0x0043, 0x0327, 0x0045, 0x0300, 0x0045, 0x0301, 0x0045, 0x0302, 0x0045, 0x0308, 0x0049, 0x0300,
+        0x0049, 0x0301, 0x0049, 0x0302, 0x0049, 0x0308, 0x004E, 0x0303, 0x004F, 0x0300, 0x004F, 0x0301, 0x004F, 0x0302, 0x004F, 0x0303,
+        0x004F, 0x0308, 0x0055, 0x0300, 0x0055, 0x0301, 0x0055, 0x0302, 0x0055, 0x0308, 0x0059, 0x0301, 0x0061, 0x0300, 0x0061, 0x0301,
+        0x0061, 0x0302, 0x0061, 0x0303, 0x0061, 0x0308, 0x0061, 0x030A, 0x0063, 0x0327, 0x0065, 0x0300, 0x0065, 0x0301, 0x0065, 0x0302,
+        0x0065, 0x0308, 0x0069, 0x0300, 0x0069, 0x0301, 0x0069, 0x0302, 0x0069, 0x0308, 0x006E, 0x0303, 0x006F, 0x0300, 0x006F, 0x0301,
+        0x006F, 0x0302, 0x006F, 0x0303, 0x006F, 0x0308, 0x0075, 0x0300, 0x0075, 0x0301, 0x0075, 0x0302, 0x0075, 0x0308, 0x0079, 0x0301,
+        0x0079, 0x0308, 0x0041, 0x0304, 0x0061, 0x0304, 0x0041, 0x0306, 0x0061, 0x0306, 0x0041, 0x0328, 0x0061, 0x0328, 0x0043, 0x0301,
+        0x0063, 0x0301, 0x0043, 0x0302, 0x0063, 0x0302, 0x0043, 0x0307, 0x0063, 0x0307, 0x0043, 0x030C, 0x0063, 0x030C, 0x0044, 0x030C,
+        0x0064, 0x030C, 0x0045, 0x0304, 0x0065, 0x0304, 0x0045, 0x0306, 0x0065, 0x0306, 0x0045, 0x0307, 0x0065, 0x0307, 0x0045, 0x0328,
+        0x0065, 0x0328, 0x0045, 0x030C, 0x0065, 0x030C, 0x0047, 0x0302, 0x0067, 0x0302, 0x0047, 0x0306, 0x0067, 0x0306, 0x0047, 0x0307,
+        0x0067, 0x0307, 0x0047, 0x0327, 0x0067, 0x0327, 0x0048, 0x0302, 0x0068, 0x0302, 0x0049, 0x0303, 0x0069, 0x0303, 0x0049, 0x0304,
+        0x0069, 0x0304, 0x0049, 0x0306, 0x0069, 0x0306, 0x0049, 0x0328, 0x0069, 0x0328, 0x0049, 0x0307, 0x0049, 0x004A, 0x0069, 0x006A,
+        0x004A, 0x0302, 0x006A, 0x0302, 0x004B, 0x0327, 0x006B, 0x0327, 0x004C, 0x0301, 0x006C, 0x0301, 0x004C, 0x0327, 0x006C, 0x0327,
+        0x004C, 0x030C, 0x006C, 0x030C, 0x004C, 0x00B7, 0x006C, 0x00B7, 0x004E, 0x0301, 0x006E, 0x0301, 0x004E, 0x0327, 0x006E, 0x0327,
+        0x004E, 0x030C, 0x006E, 0x030C, 0x02BC, 0x006E, 0x004F, 0x0304, 0x006F, 0x0304, 0x004F, 0x0306, 0x006F, 0x0306, 0x004F, 0x030B,
+        0x006F, 0x030B, 0x0052, 0x0301, 0x0072, 0x0301, 0x0052, 0x0327, 0x0072, 0x0327, 0x0052, 0x030C, 0x0072, 0x030C, 0x0053, 0x0301,
+        0x0073, 0x0301, 0x0053, 0x0302, 0x0073, 0x0302, 0x0053, 0x0327, 0x0073, 0x0327, 0x0053, 0x030C, 0x0073, 0x030C, 0x0054, 0x0327,
+        0x0074, 0x0327, 0x0054, 0x030C, 0x0074, 0x030C, 0x0055, 0x0303, 0x0075, 0x0303, 0x0055, 0x0304, 0x0075, 0x0304, 0x0055, 0x0306,
+        0x0075, 0x0306, 0x0055, 0x030A, 0x0075, 0x030A, 0x0055, 0x030B, 0x0075, 0x030B, 0x0055, 0x0328, 0x0075, 0x0328, 0x0057, 0x0302,
+        0x0077, 0x0302, 0x0059, 0x0302, 0x0079, 0x0302, 0x0059, 0x0308, 0x005A, 0x0301, 0x007A, 0x0301, 0x005A, 0x0307, 0x007A, 0x0307,
+        0x005A, 0x030C, 0x007A, 0x030C, 0x0073, 0x004F, 0x031B, 0x006F, 0x031B, 0x0055, 0x031B, 0x0075, 0x031B, 0x0044, 0x005A, 0x030C,
+        0x0044, 0x007A, 0x030C, 0x0064, 0x007A, 0x030C, 0x004C, 0x004A, 0x004C, 0x006A, 0x006C, 0x006A, 0x004E, 0x004A, 0x004E, 0x006A,
+        0x006E, 0x006A, 0x0041, 0x030C, 0x0061, 0x030C, 0x0049, 0x030C, 0x0069, 0x030C, 0x004F, 0x030C, 0x006F, 0x030C, 0x0055, 0x030C,
+        0x0075, 0x030C, 0x0055, 0x0308, 0x0304, 0x0075, 0x0308, 0x0304, 0x0055, 0x0308, 0x0301, 0x0075, 0x0308, 0x0301, 0x0055, 0x0308,
+        0x030C, 0x0075, 0x0308, 0x030C, 0x0055, 0x0308, 0x0300, 0x0075, 0x0308, 0x0300, 0x0041, 0x0308, 0x0304, 0x0061, 0x0308, 0x0304,
+        0x0041, 0x0307, 0x0304, 0x0061, 0x0307, 0x0304, 0x00C6, 0x0304, 0x00E6, 0x0304, 0x0047, 0x030C, 0x0067, 0x030C, 0x004B, 0x030C,
+        0x006B, 0x030C, 0x004F, 0x0328, 0x006F, 0x0328, 0x004F, 0x0328, 0x0304, 0x006F, 0x0328, 0x0304, 0x01B7, 0x030C, 0x0292, 0x030C,
+        0x006A, 0x030C, 0x0044, 0x005A, 0x0044, 0x007A, 0x0064, 0x007A, 0x0047, 0x0301, 0x0067, 0x0301, 0x004E, 0x0300, 0x006E, 0x0300,
+        0x0041, 0x030A, 0x0301, 0x0061, 0x030A, 0x0301, 0x00C6, 0x0301, 0x00E6, 0x0301, 0x00D8, 0x0301, 0x00F8, 0x0301, 0x0041, 0x030F,
+        0x0061, 0x030F, 0x0041, 0x0311, 0x0061, 0x0311, 0x0045, 0x030F, 0x0065, 0x030F, 0x0045, 0x0311, 0x0065, 0x0311, 0x0049, 0x030F,
+        0x0069, 0x030F, 0x0049, 0x0311, 0x0069, 0x0311, 0x004F, 0x030F, 0x006F, 0x030F, 0x004F, 0x0311, 0x006F, 0x0311, 0x0052, 0x030F,
+        0x0072, 0x030F, 0x0052, 0x0311, 0x0072, 0x0311, 0x0055, 0x030F, 0x0075, 0x030F, 0x0055, 0x0311, 0x0075, 0x0311, 0x0053, 0x0326,
+        0x0073, 0x0326, 0x0054, 0x0326, 0x0074, 0x0326, 0x0048, 0x030C, 0x0068, 0x030C, 0x0041, 0x0307, 0x0061, 0x0307, 0x0045, 0x0327,
+        0x0065, 0x0327, 0x004F, 0x0308, 0x0304, 0x006F, 0x0308, 0x0304, 0x004F, 0x0303, 0x0304, 0x006F, 0x0303, 0x0304, 0x004F, 0x0307,
+        0x006F, 0x0307, 0x004F, 0x0307, 0x0304, 0x006F, 0x0307, 0x0304, 0x0059, 0x0304, 0x0079, 0x0304, 0x0068, 0x0266, 0x006A, 0x0072,
+        0x0279, 0x027B, 0x0281, 0x0077, 0x0079, 0x0020, 0x0306, 0x0020, 0x0307, 0x0020, 0x030A, 0x0020, 0x0328, 0x0020, 0x0303, 0x0020,
+        0x030B, 0x0263, 0x006C, 0x0078, 0x0295, 0x0300, 0x0301, 0x0313, 0x0308, 0x0301, 0x02B9, 0x0020, 0x0345, 0x003B, 0x00A8, 0x0301,
+        0x0020, 0x0308, 0x0301, 0x0391, 0x0301, 0x00B7, 0x0395, 0x0301, 0x0397, 0x0301, 0x0399, 0x0301, 0x039F, 0x0301, 0x03A5, 0x0301,
+        0x03A9, 0x0301, 0x03B9, 0x0308, 0x0301, 0x0399, 0x0308, 0x03A5, 0x0308, 0x03B1, 0x0301, 0x03B5, 0x0301, 0x03B7, 0x0301, 0x03B9,
+        0x0301, 0x03C5, 0x0308, 0x0301, 0x03B9, 0x0308, 0x03C5, 0x0308, 0x03BF, 0x0301, 0x03C5, 0x0301, 0x03C9, 0x0301, 0x03B2, 0x03B8,
+        0x03A5, 0x03D2, 0x0301, 0x03D2, 0x0308, 0x03C6, 0x03C0, 0x03BA, 0x03C1, 0x03C2, 0x0398, 0x03B5, 0x03A3, 0x0415, 0x0300, 0x0415,
+        0x0308, 0x0413, 0x0301, 0x0406, 0x0308, 0x041A, 0x0301, 0x0418, 0x0300, 0x0423, 0x0306, 0x0418, 0x0306, 0x0438, 0x0306, 0x0435,
+        0x0300, 0x0435, 0x0308, 0x0433, 0x0301, 0x0456, 0x0308, 0x043A, 0x0301, 0x0438, 0x0300, 0x0443, 0x0306, 0x0474, 0x030F, 0x0475,
+        0x030F, 0x0416, 0x0306, 0x0436, 0x0306, 0x0410, 0x0306, 0x0430, 0x0306, 0x0410, 0x0308, 0x0430, 0x0308, 0x0415, 0x0306, 0x0435,
+        0x0306, 0x04D8, 0x0308, 0x04D9, 0x0308, 0x0416, 0x0308, 0x0436, 0x0308, 0x0417, 0x0308, 0x0437, 0x0308, 0x0418, 0x0304, 0x0438,
+        0x0304, 0x0418, 0x0308, 0x0438, 0x0308, 0x041E, 0x0308, 0x043E, 0x0308, 0x04E8, 0x0308, 0x04E9, 0x0308, 0x042D, 0x0308, 0x044D,
+        0x0308, 0x0423, 0x0304, 0x0443, 0x0304, 0x0423, 0x0308, 0x0443, 0x0308, 0x0423, 0x030B, 0x0443, 0x030B, 0x0427, 0x0308, 0x0447,
+        0x0308, 0x042B, 0x0308, 0x044B, 0x0308, 0x0565, 0x0582, 0x0627, 0x0653, 0x0627, 0x0654, 0x0648, 0x0654, 0x0627, 0x0655, 0x064A,
+        0x0654, 0x0627, 0x0674, 0x0648, 0x0674, 0x06C7, 0x0674, 0x064A, 0x0674, 0x06D5, 0x0654, 0x06C1, 0x0654, 0x06D2, 0x0654, 0x0928,
+        0x093C, 0x0930, 0x093C, 0x0933, 0x093C, 0x0915, 0x093C, 0x0916, 0x093C, 0x0917, 0x093C, 0x091C, 0x093C, 0x0921, 0x093C, 0x0922,
+        0x093C, 0x092B, 0x093C, 0x092F, 0x093C, 0x09C7, 0x09BE, 0x09C7, 0x09D7, 0x09A1, 0x09BC, 0x09A2, 0x09BC, 0x09AF, 0x09BC, 0x0A32,
+        0x0A3C, 0x0A38, 0x0A3C, 0x0A16, 0x0A3C, 0x0A17, 0x0A3C, 0x0A1C, 0x0A3C, 0x0A2B, 0x0A3C, 0x0B47, 0x0B56, 0x0B47, 0x0B3E, 0x0B47,
+        0x0B57, 0x0B21, 0x0B3C, 0x0B22, 0x0B3C, 0x0B92, 0x0BD7, 0x0BC6, 0x0BBE, 0x0BC7, 0x0BBE, 0x0BC6, 0x0BD7, 0x0C46, 0x0C56, 0x0CBF,
+        0x0CD5, 0x0CC6, 0x0CD5, 0x0CC6, 0x0CD6, 0x0CC6, 0x0CC2, 0x0CC6, 0x0CC2, 0x0CD5, 0x0D46, 0x0D3E, 0x0D47, 0x0D3E, 0x0D46, 0x0D57,
+        0x0DD9, 0x0DCA, 0x0DD9, 0x0DCF, 0x0DD9, 0x0DCF, 0x0DCA, 0x0DD9, 0x0DDF, 0x0E4D, 0x0E32, 0x0ECD, 0x0EB2, 0x0EAB, 0x0E99, 0x0EAB,
+        0x0EA1, 0x0F0B, 0x0F42, 0x0FB7, 0x0F4C, 0x0FB7, 0x0F51, 0x0FB7, 0x0F56, 0x0FB7, 0x0F5B, 0x0FB7, 0x0F40, 0x0FB5, 0x0F71, 0x0F72,
+        0x0F71, 0x0F74, 0x0FB2, 0x0F80, 0x0FB2, 0x0F71, 0x0F80, 0x0FB3, 0x0F80, 0x0FB3, 0x0F71, 0x0F80, 0x0F71, 0x0F80, 0x0F92, 0x0FB7,
+        0x0F9C, 0x0FB7, 0x0FA1, 0x0FB7, 0x0FA6, 0x0FB7, 0x0FAB, 0x0FB7, 0x0F90, 0x0FB5, 0x1025, 0x102E, 0x10DC, 0x1B05, 0x1B35, 0x1B07,
+        0x1B35, 0x1B09, 0x1B35, 0x1B0B, 0x1B35, 0x1B0D, 0x1B35, 0x1B11, 0x1B35, 0x1B3A, 0x1B35, 0x1B3C, 0x1B35, 0x1B3E, 0x1B35, 0x1B3F,
+        0x1B35, 0x1B42, 0x1B35, 0x0041, 0x00C6, 0x0042, 0x0044, 0x0045, 0x018E, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D,
+        0x004E, 0x004F, 0x0222, 0x0050, 0x0052, 0x0054, 0x0055, 0x0057, 0x0250, 0x0251, 0x1D02, 0x0062, 0x0064, 0x0065, 0x0259, 0x025B,
+        0x025C, 0x0067, 0x006B, 0x006D, 0x014B, 0x0254, 0x1D16, 0x1D17, 0x0070, 0x0074, 0x0075, 0x1D1D, 0x026F, 0x0076, 0x1D25, 0x03B3,
+        0x03B4, 0x03C7, 0x0069, 0x043D, 0x0252, 0x0063, 0x0255, 0x00F0, 0x0066, 0x025F, 0x0261, 0x0265, 0x0268, 0x0269, 0x026A, 0x1D7B,
+        0x029D, 0x026D, 0x1D85, 0x029F, 0x0271, 0x0270, 0x0272, 0x0273, 0x0274, 0x0275, 0x0278, 0x0282, 0x0283, 0x01AB, 0x0289, 0x028A,
+        0x1D1C, 0x028B, 0x028C, 0x007A, 0x0290, 0x0291, 0x0292, 0x0041, 0x0325, 0x0061, 0x0325, 0x0042, 0x0307, 0x0062, 0x0307, 0x0042,
+        0x0323, 0x0062, 0x0323, 0x0042, 0x0331, 0x0062, 0x0331, 0x0043, 0x0327, 0x0301, 0x0063, 0x0327, 0x0301, 0x0044, 0x0307, 0x0064,
+        0x0307, 0x0044, 0x0323, 0x0064, 0x0323, 0x0044, 0x0331, 0x0064, 0x0331, 0x0044, 0x0327, 0x0064, 0x0327, 0x0044, 0x032D, 0x0064,
+        0x032D, 0x0045, 0x0304, 0x0300, 0x0065, 0x0304, 0x0300, 0x0045, 0x0304, 0x0301, 0x0065, 0x0304, 0x0301, 0x0045, 0x032D, 0x0065,
+        0x032D, 0x0045, 0x0330, 0x0065, 0x0330, 0x0045, 0x0327, 0x0306, 0x0065, 0x0327, 0x0306, 0x0046, 0x0307, 0x0066, 0x0307, 0x0047,
+        0x0304, 0x0067, 0x0304, 0x0048, 0x0307, 0x0068, 0x0307, 0x0048, 0x0323, 0x0068, 0x0323, 0x0048, 0x0308, 0x0068, 0x0308, 0x0048,
+        0x0327, 0x0068, 0x0327, 0x0048, 0x032E, 0x0068, 0x032E, 0x0049, 0x0330, 0x0069, 0x0330, 0x0049, 0x0308, 0x0301, 0x0069, 0x0308,
+        0x0301, 0x004B, 0x0301, 0x006B, 0x0301, 0x004B, 0x0323, 0x006B, 0x0323, 0x004B, 0x0331, 0x006B, 0x0331, 0x004C, 0x0323, 0x006C,
+        0x0323, 0x004C, 0x0323, 0x0304, 0x006C, 0x0323, 0x0304, 0x004C, 0x0331, 0x006C, 0x0331, 0x004C, 0x032D, 0x006C, 0x032D, 0x004D,
+        0x0301, 0x006D, 0x0301, 0x004D, 0x0307, 0x006D, 0x0307, 0x004D, 0x0323, 0x006D, 0x0323, 0x004E, 0x0307, 0x006E, 0x0307, 0x004E,
+        0x0323, 0x006E, 0x0323, 0x004E, 0x0331, 0x006E, 0x0331, 0x004E, 0x032D, 0x006E, 0x032D, 0x004F, 0x0303, 0x0301, 0x006F, 0x0303,
+        0x0301, 0x004F, 0x0303, 0x0308, 0x006F, 0x0303, 0x0308, 0x004F, 0x0304, 0x0300, 0x006F, 0x0304, 0x0300, 0x004F, 0x0304, 0x0301,
+        0x006F, 0x0304, 0x0301, 0x0050, 0x0301, 0x0070, 0x0301, 0x0050, 0x0307, 0x0070, 0x0307, 0x0052, 0x0307, 0x0072, 0x0307, 0x0052,
+        0x0323, 0x0072, 0x0323, 0x0052, 0x0323, 0x0304, 0x0072, 0x0323, 0x0304, 0x0052, 0x0331, 0x0072, 0x0331, 0x0053, 0x0307, 0x0073,
+        0x0307, 0x0053, 0x0323, 0x0073, 0x0323, 0x0053, 0x0301, 0x0307, 0x0073, 0x0301, 0x0307, 0x0053, 0x030C, 0x0307, 0x0073, 0x030C,
+        0x0307, 0x0053, 0x0323, 0x0307, 0x0073, 0x0323, 0x0307, 0x0054, 0x0307, 0x0074, 0x0307, 0x0054, 0x0323, 0x0074, 0x0323, 0x0054,
+        0x0331, 0x0074, 0x0331, 0x0054, 0x032D, 0x0074, 0x032D, 0x0055, 0x0324, 0x0075, 0x0324, 0x0055, 0x0330, 0x0075, 0x0330, 0x0055,
+        0x032D, 0x0075, 0x032D, 0x0055, 0x0303, 0x0301, 0x0075, 0x0303, 0x0301, 0x0055, 0x0304, 0x0308, 0x0075, 0x0304, 0x0308, 0x0056,
+        0x0303, 0x0076, 0x0303, 0x0056, 0x0323, 0x0076, 0x0323, 0x0057, 0x0300, 0x0077, 0x0300, 0x0057, 0x0301, 0x0077, 0x0301, 0x0057,
+        0x0308, 0x0077, 0x0308, 0x0057, 0x0307, 0x0077, 0x0307, 0x0057, 0x0323, 0x0077, 0x0323, 0x0058, 0x0307, 0x0078, 0x0307, 0x0058,
+        0x0308, 0x0078, 0x0308, 0x0059, 0x0307, 0x0079, 0x0307, 0x005A, 0x0302, 0x007A, 0x0302, 0x005A, 0x0323, 0x007A, 0x0323, 0x005A,
+        0x0331, 0x007A, 0x0331, 0x0068, 0x0331, 0x0074, 0x0308, 0x0077, 0x030A, 0x0079, 0x030A, 0x0061, 0x02BE, 0x017F, 0x0307, 0x0041,
+        0x0323, 0x0061, 0x0323, 0x0041, 0x0309, 0x0061, 0x0309, 0x0041, 0x0302, 0x0301, 0x0061, 0x0302, 0x0301, 0x0041, 0x0302, 0x0300,
+        0x0061, 0x0302, 0x0300, 0x0041, 0x0302, 0x0309, 0x0061, 0x0302, 0x0309, 0x0041, 0x0302, 0x0303, 0x0061, 0x0302, 0x0303, 0x0041,
+        0x0323, 0x0302, 0x0061, 0x0323, 0x0302, 0x0041, 0x0306, 0x0301, 0x0061, 0x0306, 0x0301, 0x0041, 0x0306, 0x0300, 0x0061, 0x0306,
+        0x0300, 0x0041, 0x0306, 0x0309, 0x0061, 0x0306, 0x0309, 0x0041, 0x0306, 0x0303, 0x0061, 0x0306, 0x0303, 0x0041, 0x0323, 0x0306,
+        0x0061, 0x0323, 0x0306, 0x0045, 0x0323, 0x0065, 0x0323, 0x0045, 0x0309, 0x0065, 0x0309, 0x0045, 0x0303, 0x0065, 0x0303, 0x0045,
+        0x0302, 0x0301, 0x0065, 0x0302, 0x0301, 0x0045, 0x0302, 0x0300, 0x0065, 0x0302, 0x0300, 0x0045, 0x0302, 0x0309, 0x0065, 0x0302,
+        0x0309, 0x0045, 0x0302, 0x0303, 0x0065, 0x0302, 0x0303, 0x0045, 0x0323, 0x0302, 0x0065, 0x0323, 0x0302, 0x0049, 0x0309, 0x0069,
+        0x0309, 0x0049, 0x0323, 0x0069, 0x0323, 0x004F, 0x0323, 0x006F, 0x0323, 0x004F, 0x0309, 0x006F, 0x0309, 0x004F, 0x0302, 0x0301,
+        0x006F, 0x0302, 0x0301, 0x004F, 0x0302, 0x0300, 0x006F, 0x0302, 0x0300, 0x004F, 0x0302, 0x0309, 0x006F, 0x0302, 0x0309, 0x004F,
+        0x0302, 0x0303, 0x006F, 0x0302, 0x0303, 0x004F, 0x0323, 0x0302, 0x006F, 0x0323, 0x0302, 0x004F, 0x031B, 0x0301, 0x006F, 0x031B,
+        0x0301, 0x004F, 0x031B, 0x0300, 0x006F, 0x031B, 0x0300, 0x004F, 0x031B, 0x0309, 0x006F, 0x031B, 0x0309, 0x004F, 0x031B, 0x0303,
+        0x006F, 0x031B, 0x0303, 0x004F, 0x031B, 0x0323, 0x006F, 0x031B, 0x0323, 0x0055, 0x0323, 0x0075, 0x0323, 0x0055, 0x0309, 0x0075,
+        0x0309, 0x0055, 0x031B, 0x0301, 0x0075, 0x031B, 0x0301, 0x0055, 0x031B, 0x0300, 0x0075, 0x031B, 0x0300, 0x0055, 0x031B, 0x0309,
+        0x0075, 0x031B, 0x0309, 0x0055, 0x031B, 0x0303, 0x0075, 0x031B, 0x0303, 0x0055, 0x031B, 0x0323, 0x0075, 0x031B, 0x0323, 0x0059,
+        0x0300, 0x0079, 0x0300, 0x0059, 0x0323, 0x0079, 0x0323, 0x0059, 0x0309, 0x0079, 0x0309, 0x0059, 0x0303, 0x0079, 0x0303, 0x03B1,
+        0x0313, 0x03B1, 0x0314, 0x03B1, 0x0313, 0x0300, 0x03B1, 0x0314, 0x0300, 0x03B1, 0x0313, 0x0301, 0x03B1, 0x0314, 0x0301, 0x03B1,
+        0x0313, 0x0342, 0x03B1, 0x0314, 0x0342, 0x0391, 0x0313, 0x0391, 0x0314, 0x0391, 0x0313, 0x0300, 0x0391, 0x0314, 0x0300, 0x0391,
+        0x0313, 0x0301, 0x0391, 0x0314, 0x0301, 0x0391, 0x0313, 0x0342, 0x0391, 0x0314, 0x0342, 0x03B5, 0x0313, 0x03B5, 0x0314, 0x03B5,
+        0x0313, 0x0300, 0x03B5, 0x0314, 0x0300, 0x03B5, 0x0313, 0x0301, 0x03B5, 0x0314, 0x0301, 0x0395, 0x0313, 0x0395, 0x0314, 0x0395,
+        0x0313, 0x0300, 0x0395, 0x0314, 0x0300, 0x0395, 0x0313, 0x0301, 0x0395, 0x0314, 0x0301, 0x03B7, 0x0313, 0x03B7, 0x0314, 0x03B7,
+        0x0313, 0x0300, 0x03B7, 0x0314, 0x0300, 0x03B7, 0x0313, 0x0301, 0x03B7, 0x0314, 0x0301, 0x03B7, 0x0313, 0x0342, 0x03B7, 0x0314,
+        0x0342, 0x0397, 0x0313, 0x0397, 0x0314, 0x0397, 0x0313, 0x0300, 0x0397, 0x0314, 0x0300, 0x0397, 0x0313, 0x0301, 0x0397, 0x0314,
+        0x0301, 0x0397, 0x0313, 0x0342, 0x0397, 0x0314, 0x0342, 0x03B9, 0x0313, 0x03B9, 0x0314, 0x03B9, 0x0313, 0x0300, 0x03B9, 0x0314,
+        0x0300, 0x03B9, 0x0313, 0x0301, 0x03B9, 0x0314, 0x0301, 0x03B9, 0x0313, 0x0342, 0x03B9, 0x0314, 0x0342, 0x0399, 0x0313, 0x0399,
+        0x0314, 0x0399, 0x0313, 0x0300, 0x0399, 0x0314, 0x0300, 0x0399, 0x0313, 0x0301, 0x0399, 0x0314, 0x0301, 0x0399, 0x0313, 0x0342,
+        0x0399, 0x0314, 0x0342, 0x03BF, 0x0313, 0x03BF, 0x0314, 0x03BF, 0x0313, 0x0300, 0x03BF, 0x0314, 0x0300, 0x03BF, 0x0313, 0x0301,
+        0x03BF, 0x0314, 0x0301, 0x039F, 0x0313, 0x039F, 0x0314, 0x039F, 0x0313, 0x0300, 0x039F, 0x0314, 0x0300, 0x039F, 0x0313, 0x0301,
+        0x039F, 0x0314, 0x0301, 0x03C5, 0x0313, 0x03C5, 0x0314, 0x03C5, 0x0313, 0x0300, 0x03C5, 0x0314, 0x0300, 0x03C5, 0x0313, 0x0301,
+        0x03C5, 0x0314, 0x0301, 0x03C5, 0x0313, 0x0342, 0x03C5, 0x0314, 0x0342, 0x03A5, 0x0314, 0x03A5, 0x0314, 0x0300, 0x03A5, 0x0314,
+        0x0301, 0x03A5, 0x0314, 0x0342, 0x03C9, 0x0313, 0x03C9, 0x0314, 0x03C9, 0x0313, 0x0300, 0x03C9, 0x0314, 0x0300, 0x03C9, 0x0313,
+        0x0301, 0x03C9, 0x0314, 0x0301, 0x03C9, 0x0313, 0x0342, 0x03C9, 0x0314, 0x0342, 0x03A9, 0x0313, 0x03A9, 0x0314, 0x03A9, 0x0313,
+        0x0300, 0x03A9, 0x0314, 0x0300, 0x03A9, 0x0313, 0x0301, 0x03A9, 0x0314, 0x0301, 0x03A9, 0x0313, 0x0342, 0x03A9, 0x0314, 0x0342,
+        0x03B1, 0x0300, 0x03B5, 0x0300, 0x03B7, 0x0300, 0x03B9, 0x0300, 0x03BF, 0x0300, 0x03C5, 0x0300, 0x03C9, 0x0300, 0x03B1, 0x0313,
+        0x0345, 0x03B1, 0x0314, 0x0345, 0x03B1, 0x0313, 0x0300, 0x0345, 0x03B1, 0x0314, 0x0300, 0x0345, 0x03B1, 0x0313, 0x0301, 0x0345,
+        0x03B1, 0x0314, 0x0301, 0x0345, 0x03B1, 0x0313, 0x0342, 0x0345, 0x03B1, 0x0314, 0x0342, 0x0345, 0x0391, 0x0313, 0x0345, 0x0391,
+        0x0314, 0x0345, 0x0391, 0x0313, 0x0300, 0x0345, 0x0391, 0x0314, 0x0300, 0x0345, 0x0391, 0x0313, 0x0301, 0x0345, 0x0391, 0x0314,
+        0x0301, 0x0345, 0x0391, 0x0313, 0x0342, 0x0345, 0x0391, 0x0314, 0x0342, 0x0345, 0x03B7, 0x0313, 0x0345, 0x03B7, 0x0314, 0x0345,
+        0x03B7, 0x0313, 0x0300, 0x0345, 0x03B7, 0x0314, 0x0300, 0x0345, 0x03B7, 0x0313, 0x0301, 0x0345, 0x03B7, 0x0314, 0x0301, 0x0345,
+        0x03B7, 0x0313, 0x0342, 0x0345, 0x03B7, 0x0314, 0x0342, 0x0345, 0x0397, 0x0313, 0x0345, 0x0397, 0x0314, 0x0345, 0x0397, 0x0313,
+        0x0300, 0x0345, 0x0397, 0x0314, 0x0300, 0x0345, 0x0397, 0x0313, 0x0301, 0x0345, 0x0397, 0x0314, 0x0301, 0x0345, 0x0397, 0x0313,
+        0x0342, 0x0345, 0x0397, 0x0314, 0x0342, 0x0345, 0x03C9, 0x0313, 0x0345, 0x03C9, 0x0314, 0x0345, 0x03C9, 0x0313, 0x0300, 0x0345,
+        0x03C9, 0x0314, 0x0300, 0x0345, 0x03C9, 0x0313, 0x0301, 0x0345, 0x03C9, 0x0314, 0x0301, 0x0345, 0x03C9, 0x0313, 0x0342, 0x0345,
+        0x03C9, 0x0314, 0x0342, 0x0345, 0x03A9, 0x0313, 0x0345, 0x03A9, 0x0314, 0x0345, 0x03A9, 0x0313, 0x0300, 0x0345, 0x03A9, 0x0314,
+        0x0300, 0x0345, 0x03A9, 0x0313, 0x0301, 0x0345, 0x03A9, 0x0314, 0x0301, 0x0345, 0x03A9, 0x0313, 0x0342, 0x0345, 0x03A9, 0x0314,
+        0x0342, 0x0345, 0x03B1, 0x0306, 0x03B1, 0x0304, 0x03B1, 0x0300, 0x0345, 0x03B1, 0x0345, 0x03B1, 0x0301, 0x0345, 0x03B1, 0x0342,
+        0x03B1, 0x0342, 0x0345, 0x0391, 0x0306, 0x0391, 0x0304, 0x0391, 0x0300, 0x0391, 0x0345, 0x0020, 0x0313, 0x03B9, 0x0020, 0x0342,
+        0x00A8, 0x0342, 0x0020, 0x0308, 0x0342, 0x03B7, 0x0300, 0x0345, 0x03B7, 0x0345, 0x03B7, 0x0301, 0x0345, 0x03B7, 0x0342, 0x03B7,
+        0x0342, 0x0345, 0x0395, 0x0300, 0x0397, 0x0300, 0x0397, 0x0345, 0x1FBF, 0x0300, 0x0020, 0x0313, 0x0300, 0x1FBF, 0x0301, 0x0020,
+        0x0313, 0x0301, 0x1FBF, 0x0342, 0x0020, 0x0313, 0x0342, 0x03B9, 0x0306, 0x03B9, 0x0304, 0x03B9, 0x0308, 0x0300, 0x03B9, 0x0342,
+        0x03B9, 0x0308, 0x0342, 0x0399, 0x0306, 0x0399, 0x0304, 0x0399, 0x0300, 0x1FFE, 0x0300, 0x0020, 0x0314, 0x0300, 0x1FFE, 0x0301,
+        0x0020, 0x0314, 0x0301, 0x1FFE, 0x0342, 0x0020, 0x0314, 0x0342, 0x03C5, 0x0306, 0x03C5, 0x0304, 0x03C5, 0x0308, 0x0300, 0x03C1,
+        0x0313, 0x03C1, 0x0314, 0x03C5, 0x0342, 0x03C5, 0x0308, 0x0342, 0x03A5, 0x0306, 0x03A5, 0x0304, 0x03A5, 0x0300, 0x03A1, 0x0314,
+        0x00A8, 0x0300, 0x0020, 0x0308, 0x0300, 0x0060, 0x03C9, 0x0300, 0x0345, 0x03C9, 0x0345, 0x03C9, 0x0301, 0x0345, 0x03C9, 0x0342,
+        0x03C9, 0x0342, 0x0345, 0x039F, 0x0300, 0x03A9, 0x0300, 0x03A9, 0x0345, 0x00B4, 0x0020, 0x0314, 0x2002, 0x2003, 0x2010, 0x0020,
+        0x0333, 0x002E, 0x002E, 0x002E, 0x002E, 0x002E, 0x002E, 0x2032, 0x2032, 0x2032, 0x2032, 0x2032, 0x2035, 0x2035, 0x2035, 0x2035,
+        0x2035, 0x0021, 0x0021, 0x0020, 0x0305, 0x003F, 0x003F, 0x003F, 0x0021, 0x0021, 0x003F, 0x2032, 0x2032, 0x2032, 0x2032, 0x0030,
+        0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x002B, 0x2212, 0x003D, 0x0028, 0x0029, 0x006E, 0x0052, 0x0073, 0x0061, 0x002F,
+        0x0063, 0x0061, 0x002F, 0x0073, 0x0043, 0x00B0, 0x0043, 0x0063, 0x002F, 0x006F, 0x0063, 0x002F, 0x0075, 0x0190, 0x00B0, 0x0046,
+        0x0127, 0x004E, 0x006F, 0x0051, 0x0053, 0x004D, 0x0054, 0x0045, 0x004C, 0x0054, 0x004D, 0x005A, 0x03A9, 0x0046, 0x05D0, 0x05D1,
+        0x05D2, 0x05D3, 0x0046, 0x0041, 0x0058, 0x0393, 0x03A0, 0x2211, 0x0031, 0x2044, 0x0037, 0x0031, 0x2044, 0x0039, 0x0031, 0x2044,
+        0x0031, 0x0030, 0x0031, 0x2044, 0x0033, 0x0032, 0x2044, 0x0033, 0x0031, 0x2044, 0x0035, 0x0032, 0x2044, 0x0035, 0x0033, 0x2044,
+        0x0035, 0x0034, 0x2044, 0x0035, 0x0031, 0x2044, 0x0036, 0x0035, 0x2044, 0x0036, 0x0031, 0x2044, 0x0038, 0x0033, 0x2044, 0x0038,
+        0x0035, 0x2044, 0x0038, 0x0037, 0x2044, 0x0038, 0x0031, 0x2044, 0x0049, 0x0049, 0x0049, 0x0049, 0x0049, 0x0049, 0x0056, 0x0056,
+        0x0056, 0x0049, 0x0056, 0x0049, 0x0049, 0x0056, 0x0049, 0x0049, 0x0049, 0x0049, 0x0058, 0x0058, 0x0058, 0x0049, 0x0058, 0x0049,
+        0x0049, 0x0069, 0x0069, 0x0069, 0x0069, 0x0069, 0x0069, 0x0076, 0x0076, 0x0069, 0x0076, 0x0069, 0x0069, 0x0076, 0x0069, 0x0069,
+        0x0069, 0x0069, 0x0078, 0x0078, 0x0069, 0x0078, 0x0069, 0x0069, 0x0030, 0x2044, 0x0033, 0x2190, 0x0338, 0x2192, 0x0338, 0x2194,
+        0x0338, 0x21D0, 0x0338, 0x21D4, 0x0338, 0x21D2, 0x0338, 0x2203, 0x0338, 0x2208, 0x0338, 0x220B, 0x0338, 0x2223, 0x0338, 0x2225,
+        0x0338, 0x222B, 0x222B, 0x222B, 0x222B, 0x222B, 0x222E, 0x222E, 0x222E, 0x222E, 0x222E, 0x223C, 0x0338, 0x2243, 0x0338, 0x2245,
+        0x0338, 0x2248, 0x0338, 0x003D, 0x0338, 0x2261, 0x0338, 0x224D, 0x0338, 0x003C, 0x0338, 0x003E, 0x0338, 0x2264, 0x0338, 0x2265,
+        0x0338, 0x2272, 0x0338, 0x2273, 0x0338, 0x2276, 0x0338, 0x2277, 0x0338, 0x227A, 0x0338, 0x227B, 0x0338, 0x2282, 0x0338, 0x2283,
+        0x0338, 0x2286, 0x0338, 0x2287, 0x0338, 0x22A2, 0x0338, 0x22A8, 0x0338, 0x22A9, 0x0338, 0x22AB, 0x0338, 0x227C, 0x0338, 0x227D,
+        0x0338, 0x2291, 0x0338, 0x2292, 0x0338, 0x22B2, 0x0338, 0x22B3, 0x0338, 0x22B4, 0x0338, 0x22B5, 0x0338, 0x3008, 0x3009, 0x0031,
+        0x0030, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0033, 0x0031, 0x0034, 0x0031, 0x0035, 0x0031, 0x0036, 0x0031, 0x0037, 0x0031,
+        0x0038, 0x0031, 0x0039, 0x0032, 0x0030, 0x0028, 0x0031, 0x0029, 0x0028, 0x0032, 0x0029, 0x0028, 0x0033, 0x0029, 0x0028, 0x0034,
+        0x0029, 0x0028, 0x0035, 0x0029, 0x0028, 0x0036, 0x0029, 0x0028, 0x0037, 0x0029, 0x0028, 0x0038, 0x0029, 0x0028, 0x0039, 0x0029,
+        0x0028, 0x0031, 0x0030, 0x0029, 0x0028, 0x0031, 0x0031, 0x0029, 0x0028, 0x0031, 0x0032, 0x0029, 0x0028, 0x0031, 0x0033, 0x0029,
+        0x0028, 0x0031, 0x0034, 0x0029, 0x0028, 0x0031, 0x0035, 0x0029, 0x0028, 0x0031, 0x0036, 0x0029, 0x0028, 0x0031, 0x0037, 0x0029,
+        0x0028, 0x0031, 0x0038, 0x0029, 0x0028, 0x0031, 0x0039, 0x0029, 0x0028, 0x0032, 0x0030, 0x0029, 0x0031, 0x002E, 0x0032, 0x002E,
+        0x0033, 0x002E, 0x0034, 0x002E, 0x0035, 0x002E, 0x0036, 0x002E, 0x0037, 0x002E, 0x0038, 0x002E, 0x0039, 0x002E, 0x0031, 0x0030,
+        0x002E, 0x0031, 0x0031, 0x002E, 0x0031, 0x0032, 0x002E, 0x0031, 0x0033, 0x002E, 0x0031, 0x0034, 0x002E, 0x0031, 0x0035, 0x002E,
+        0x0031, 0x0036, 0x002E, 0x0031, 0x0037, 0x002E, 0x0031, 0x0038, 0x002E, 0x0031, 0x0039, 0x002E, 0x0032, 0x0030, 0x002E, 0x0028,
+        0x0061, 0x0029, 0x0028, 0x0062, 0x0029, 0x0028, 0x0063, 0x0029, 0x0028, 0x0064, 0x0029, 0x0028, 0x0065, 0x0029, 0x0028, 0x0066,
+        0x0029, 0x0028, 0x0067, 0x0029, 0x0028, 0x0068, 0x0029, 0x0028, 0x0069, 0x0029, 0x0028, 0x006A, 0x0029, 0x0028, 0x006B, 0x0029,
+        0x0028, 0x006C, 0x0029, 0x0028, 0x006D, 0x0029, 0x0028, 0x006E, 0x0029, 0x0028, 0x006F, 0x0029, 0x0028, 0x0070, 0x0029, 0x0028,
+        0x0071, 0x0029, 0x0028, 0x0072, 0x0029, 0x0028, 0x0073, 0x0029, 0x0028, 0x0074, 0x0029, 0x0028, 0x0075, 0x0029, 0x0028, 0x0076,
+        0x0029, 0x0028, 0x0077, 0x0029, 0x0028, 0x0078, 0x0029, 0x0028, 0x0079, 0x0029, 0x0028, 0x007A, 0x0029, 0x0053, 0x0059, 0x0071,
+        0x222B, 0x222B, 0x222B, 0x222B, 0x003A, 0x003A, 0x003D, 0x003D, 0x003D, 0x003D, 0x003D, 0x003D, 0x2ADD, 0x0338, 0x2D61, 0x6BCD,
+        0x9F9F, 0x4E00, 0x4E28, 0x4E36, 0x4E3F, 0x4E59, 0x4E85, 0x4E8C, 0x4EA0, 0x4EBA, 0x513F, 0x5165, 0x516B, 0x5182, 0x5196, 0x51AB,
+        0x51E0, 0x51F5, 0x5200, 0x529B, 0x52F9, 0x5315, 0x531A, 0x5338, 0x5341, 0x535C, 0x5369, 0x5382, 0x53B6, 0x53C8, 0x53E3, 0x56D7,
+        0x571F, 0x58EB, 0x5902, 0x590A, 0x5915, 0x5927, 0x5973, 0x5B50, 0x5B80, 0x5BF8, 0x5C0F, 0x5C22, 0x5C38, 0x5C6E, 0x5C71, 0x5DDB,
+        0x5DE5, 0x5DF1, 0x5DFE, 0x5E72, 0x5E7A, 0x5E7F, 0x5EF4, 0x5EFE, 0x5F0B, 0x5F13, 0x5F50, 0x5F61, 0x5F73, 0x5FC3, 0x6208, 0x6236,
+        0x624B, 0x652F, 0x6534, 0x6587, 0x6597, 0x65A4, 0x65B9, 0x65E0, 0x65E5, 0x66F0, 0x6708, 0x6728, 0x6B20, 0x6B62, 0x6B79, 0x6BB3,
+        0x6BCB, 0x6BD4, 0x6BDB, 0x6C0F, 0x6C14, 0x6C34, 0x706B, 0x722A, 0x7236, 0x723B, 0x723F, 0x7247, 0x7259, 0x725B, 0x72AC, 0x7384,
+        0x7389, 0x74DC, 0x74E6, 0x7518, 0x751F, 0x7528, 0x7530, 0x758B, 0x7592, 0x7676, 0x767D, 0x76AE, 0x76BF, 0x76EE, 0x77DB, 0x77E2,
+        0x77F3, 0x793A, 0x79B8, 0x79BE, 0x7A74, 0x7ACB, 0x7AF9, 0x7C73, 0x7CF8, 0x7F36, 0x7F51, 0x7F8A, 0x7FBD, 0x8001, 0x800C, 0x8012,
+        0x8033, 0x807F, 0x8089, 0x81E3, 0x81EA, 0x81F3, 0x81FC, 0x820C, 0x821B, 0x821F, 0x826E, 0x8272, 0x8278, 0x864D, 0x866B, 0x8840,
+        0x884C, 0x8863, 0x897E, 0x898B, 0x89D2, 0x8A00, 0x8C37, 0x8C46, 0x8C55, 0x8C78, 0x8C9D, 0x8D64, 0x8D70, 0x8DB3, 0x8EAB, 0x8ECA,
+        0x8F9B, 0x8FB0, 0x8FB5, 0x9091, 0x9149, 0x91C6, 0x91CC, 0x91D1, 0x9577, 0x9580, 0x961C, 0x96B6, 0x96B9, 0x96E8, 0x9751, 0x975E,
+        0x9762, 0x9769, 0x97CB, 0x97ED, 0x97F3, 0x9801, 0x98A8, 0x98DB, 0x98DF, 0x9996, 0x9999, 0x99AC, 0x9AA8, 0x9AD8, 0x9ADF, 0x9B25,
+        0x9B2F, 0x9B32, 0x9B3C, 0x9B5A, 0x9CE5, 0x9E75, 0x9E7F, 0x9EA5, 0x9EBB, 0x9EC3, 0x9ECD, 0x9ED1, 0x9EF9, 0x9EFD, 0x9F0E, 0x9F13,
+        0x9F20, 0x9F3B, 0x9F4A, 0x9F52, 0x9F8D, 0x9F9C, 0x9FA0, 0x3012, 0x5344, 0x5345, 0x304B, 0x3099, 0x304D, 0x3099, 0x304F, 0x3099,
+        0x3051, 0x3099, 0x3053, 0x3099, 0x3055, 0x3099, 0x3057, 0x3099, 0x3059, 0x3099, 0x305B, 0x3099, 0x305D, 0x3099, 0x305F, 0x3099,
+        0x3061, 0x3099, 0x3064, 0x3099, 0x3066, 0x3099, 0x3068, 0x3099, 0x306F, 0x3099, 0x306F, 0x309A, 0x3072, 0x3099, 0x3072, 0x309A,
+        0x3075, 0x3099, 0x3075, 0x309A, 0x3078, 0x3099, 0x3078, 0x309A, 0x307B, 0x3099, 0x307B, 0x309A, 0x3046, 0x3099, 0x0020, 0x3099,
+        0x0020, 0x309A, 0x309D, 0x3099, 0x3088, 0x308A, 0x30AB, 0x3099, 0x30AD, 0x3099, 0x30AF, 0x3099, 0x30B1, 0x3099, 0x30B3, 0x3099,
+        0x30B5, 0x3099, 0x30B7, 0x3099, 0x30B9, 0x3099, 0x30BB, 0x3099, 0x30BD, 0x3099, 0x30BF, 0x3099, 0x30C1, 0x3099, 0x30C4, 0x3099,
+        0x30C6, 0x3099, 0x30C8, 0x3099, 0x30CF, 0x3099, 0x30CF, 0x309A, 0x30D2, 0x3099, 0x30D2, 0x309A, 0x30D5, 0x3099, 0x30D5, 0x309A,
+        0x30D8, 0x3099, 0x30D8, 0x309A, 0x30DB, 0x3099, 0x30DB, 0x309A, 0x30A6, 0x3099, 0x30EF, 0x3099, 0x30F0, 0x3099, 0x30F1, 0x3099,
+        0x30F2, 0x3099, 0x30FD, 0x3099, 0x30B3, 0x30C8, 0x1100, 0x1101, 0x11AA, 0x1102, 0x11AC, 0x11AD, 0x1103, 0x1104, 0x1105, 0x11B0,
+        0x11B1, 0x11B2, 0x11B3, 0x11B4, 0x11B5, 0x111A, 0x1106, 0x1107, 0x1108, 0x1121, 0x1109, 0x110A, 0x110B, 0x110C, 0x110D, 0x110E,
+        0x110F, 0x1110, 0x1111, 0x1112, 0x1161, 0x1162, 0x1163, 0x1164, 0x1165, 0x1166, 0x1167, 0x1168, 0x1169, 0x116A, 0x116B, 0x116C,
+        0x116D, 0x116E, 0x116F, 0x1170, 0x1171, 0x1172, 0x1173, 0x1174, 0x1175, 0x1160, 0x1114, 0x1115, 0x11C7, 0x11C8, 0x11CC, 0x11CE,
+        0x11D3, 0x11D7, 0x11D9, 0x111C, 0x11DD, 0x11DF, 0x111D, 0x111E, 0x1120, 0x1122, 0x1123, 0x1127, 0x1129, 0x112B, 0x112C, 0x112D,
+        0x112E, 0x112F, 0x1132, 0x1136, 0x1140, 0x1147, 0x114C, 0x11F1, 0x11F2, 0x1157, 0x1158, 0x1159, 0x1184, 0x1185, 0x1188, 0x1191,
+        0x1192, 0x1194, 0x119E, 0x11A1, 0x4E09, 0x56DB, 0x4E0A, 0x4E2D, 0x4E0B, 0x7532, 0x4E19, 0x4E01, 0x5929, 0x5730, 0x0028, 0x1100,
+        0x0029, 0x0028, 0x1102, 0x0029, 0x0028, 0x1103, 0x0029, 0x0028, 0x1105, 0x0029, 0x0028, 0x1106, 0x0029, 0x0028, 0x1107, 0x0029,
+        0x0028, 0x1109, 0x0029, 0x0028, 0x110B, 0x0029, 0x0028, 0x110C, 0x0029, 0x0028, 0x110E, 0x0029, 0x0028, 0x110F, 0x0029, 0x0028,
+        0x1110, 0x0029, 0x0028, 0x1111, 0x0029, 0x0028, 0x1112, 0x0029, 0x0028, 0x1100, 0x1161, 0x0029, 0x0028, 0x1102, 0x1161, 0x0029,
+        0x0028, 0x1103, 0x1161, 0x0029, 0x0028, 0x1105, 0x1161, 0x0029, 0x0028, 0x1106, 0x1161, 0x0029, 0x0028, 0x1107, 0x1161, 0x0029,
+        0x0028, 0x1109, 0x1161, 0x0029, 0x0028, 0x110B, 0x1161, 0x0029, 0x0028, 0x110C, 0x1161, 0x0029, 0x0028, 0x110E, 0x1161, 0x0029,
+        0x0028, 0x110F, 0x1161, 0x0029, 0x0028, 0x1110, 0x1161, 0x0029, 0x0028, 0x1111, 0x1161, 0x0029, 0x0028, 0x1112, 0x1161, 0x0029,
+        0x0028, 0x110C, 0x116E, 0x0029, 0x0028, 0x110B, 0x1169, 0x110C, 0x1165, 0x11AB, 0x0029, 0x0028, 0x110B, 0x1169, 0x1112, 0x116E,
+        0x0029, 0x0028, 0x4E00, 0x0029, 0x0028, 0x4E8C, 0x0029, 0x0028, 0x4E09, 0x0029, 0x0028, 0x56DB, 0x0029, 0x0028, 0x4E94, 0x0029,
+        0x0028, 0x516D, 0x0029, 0x0028, 0x4E03, 0x0029, 0x0028, 0x516B, 0x0029, 0x0028, 0x4E5D, 0x0029, 0x0028, 0x5341, 0x0029, 0x0028,
+        0x6708, 0x0029, 0x0028, 0x706B, 0x0029, 0x0028, 0x6C34, 0x0029, 0x0028, 0x6728, 0x0029, 0x0028, 0x91D1, 0x0029, 0x0028, 0x571F,
+        0x0029, 0x0028, 0x65E5, 0x0029, 0x0028, 0x682A, 0x0029, 0x0028, 0x6709, 0x0029, 0x0028, 0x793E, 0x0029, 0x0028, 0x540D, 0x0029,
+        0x0028, 0x7279, 0x0029, 0x0028, 0x8CA1, 0x0029, 0x0028, 0x795D, 0x0029, 0x0028, 0x52B4, 0x0029, 0x0028, 0x4EE3, 0x0029, 0x0028,
+        0x547C, 0x0029, 0x0028, 0x5B66, 0x0029, 0x0028, 0x76E3, 0x0029, 0x0028, 0x4F01, 0x0029, 0x0028, 0x8CC7, 0x0029, 0x0028, 0x5354,
+        0x0029, 0x0028, 0x796D, 0x0029, 0x0028, 0x4F11, 0x0029, 0x0028, 0x81EA, 0x0029, 0x0028, 0x81F3, 0x0029, 0x554F, 0x5E7C, 0x7B8F,
+        0x0050, 0x0054, 0x0045, 0x0032, 0x0031, 0x0032, 0x0032, 0x0032, 0x0033, 0x0032, 0x0034, 0x0032, 0x0035, 0x0032, 0x0036, 0x0032,
+        0x0037, 0x0032, 0x0038, 0x0032, 0x0039, 0x0033, 0x0030, 0x0033, 0x0031, 0x0033, 0x0032, 0x0033, 0x0033, 0x0033, 0x0034, 0x0033,
+        0x0035, 0x1100, 0x1161, 0x1102, 0x1161, 0x1103, 0x1161, 0x1105, 0x1161, 0x1106, 0x1161, 0x1107, 0x1161, 0x1109, 0x1161, 0x110B,
+        0x1161, 0x110C, 0x1161, 0x110E, 0x1161, 0x110F, 0x1161, 0x1110, 0x1161, 0x1111, 0x1161, 0x1112, 0x1161, 0x110E, 0x1161, 0x11B7,
+        0x1100, 0x1169, 0x110C, 0x116E, 0x110B, 0x1174, 0x110B, 0x116E, 0x4E94, 0x516D, 0x4E03, 0x4E5D, 0x682A, 0x6709, 0x793E, 0x540D,
+        0x7279, 0x8CA1, 0x795D, 0x52B4, 0x79D8, 0x7537, 0x9069, 0x512A, 0x5370, 0x6CE8, 0x9805, 0x4F11, 0x5199, 0x6B63, 0x5DE6, 0x53F3,
+        0x533B, 0x5B97, 0x5B66, 0x76E3, 0x4F01, 0x8CC7, 0x5354, 0x591C, 0x0033, 0x0036, 0x0033, 0x0037, 0x0033, 0x0038, 0x0033, 0x0039,
+        0x0034, 0x0030, 0x0034, 0x0031, 0x0034, 0x0032, 0x0034, 0x0033, 0x0034, 0x0034, 0x0034, 0x0035, 0x0034, 0x0036, 0x0034, 0x0037,
+        0x0034, 0x0038, 0x0034, 0x0039, 0x0035, 0x0030, 0x0031, 0x6708, 0x0032, 0x6708, 0x0033, 0x6708, 0x0034, 0x6708, 0x0035, 0x6708,
+        0x0036, 0x6708, 0x0037, 0x6708, 0x0038, 0x6708, 0x0039, 0x6708, 0x0031, 0x0030, 0x6708, 0x0031, 0x0031, 0x6708, 0x0031, 0x0032,
+        0x6708, 0x0048, 0x0067, 0x0065, 0x0072, 0x0067, 0x0065, 0x0056, 0x004C, 0x0054, 0x0044, 0x30A2, 0x30A4, 0x30A6, 0x30A8, 0x30AA,
+        0x30AB, 0x30AD, 0x30AF, 0x30B1, 0x30B3, 0x30B5, 0x30B7, 0x30B9, 0x30BB, 0x30BD, 0x30BF, 0x30C1, 0x30C4, 0x30C6, 0x30C8, 0x30CA,
+        0x30CB, 0x30CC, 0x30CD, 0x30CE, 0x30CF, 0x30D2, 0x30D5, 0x30D8, 0x30DB, 0x30DE, 0x30DF, 0x30E0, 0x30E1, 0x30E2, 0x30E4, 0x30E6,
+        0x30E8, 0x30E9, 0x30EA, 0x30EB, 0x30EC, 0x30ED, 0x30EF, 0x30F0, 0x30F1, 0x30F2, 0x4EE4, 0x548C, 0x30A2, 0x30CF, 0x309A, 0x30FC,
+        0x30C8, 0x30A2, 0x30EB, 0x30D5, 0x30A1, 0x30A2, 0x30F3, 0x30D8, 0x309A, 0x30A2, 0x30A2, 0x30FC, 0x30EB, 0x30A4, 0x30CB, 0x30F3,
+        0x30AF, 0x3099, 0x30A4, 0x30F3, 0x30C1, 0x30A6, 0x30A9, 0x30F3, 0x30A8, 0x30B9, 0x30AF, 0x30FC, 0x30C8, 0x3099, 0x30A8, 0x30FC,
+        0x30AB, 0x30FC, 0x30AA, 0x30F3, 0x30B9, 0x30AA, 0x30FC, 0x30E0, 0x30AB, 0x30A4, 0x30EA, 0x30AB, 0x30E9, 0x30C3, 0x30C8, 0x30AB,
+        0x30ED, 0x30EA, 0x30FC, 0x30AB, 0x3099, 0x30ED, 0x30F3, 0x30AB, 0x3099, 0x30F3, 0x30DE, 0x30AD, 0x3099, 0x30AB, 0x3099, 0x30AD,
+        0x3099, 0x30CB, 0x30FC, 0x30AD, 0x30E5, 0x30EA, 0x30FC, 0x30AD, 0x3099, 0x30EB, 0x30BF, 0x3099, 0x30FC, 0x30AD, 0x30ED, 0x30AD,
+        0x30ED, 0x30AF, 0x3099, 0x30E9, 0x30E0, 0x30AD, 0x30ED, 0x30E1, 0x30FC, 0x30C8, 0x30EB, 0x30AD, 0x30ED, 0x30EF, 0x30C3, 0x30C8,
+        0x30AF, 0x3099, 0x30E9, 0x30E0, 0x30AF, 0x3099, 0x30E9, 0x30E0, 0x30C8, 0x30F3, 0x30AF, 0x30EB, 0x30BB, 0x3099, 0x30A4, 0x30ED,
+        0x30AF, 0x30ED, 0x30FC, 0x30CD, 0x30B1, 0x30FC, 0x30B9, 0x30B3, 0x30EB, 0x30CA, 0x30B3, 0x30FC, 0x30DB, 0x309A, 0x30B5, 0x30A4,
+        0x30AF, 0x30EB, 0x30B5, 0x30F3, 0x30C1, 0x30FC, 0x30E0, 0x30B7, 0x30EA, 0x30F3, 0x30AF, 0x3099, 0x30BB, 0x30F3, 0x30C1, 0x30BB,
+        0x30F3, 0x30C8, 0x30BF, 0x3099, 0x30FC, 0x30B9, 0x30C6, 0x3099, 0x30B7, 0x30C8, 0x3099, 0x30EB, 0x30C8, 0x30F3, 0x30CA, 0x30CE,
+        0x30CE, 0x30C3, 0x30C8, 0x30CF, 0x30A4, 0x30C4, 0x30CF, 0x309A, 0x30FC, 0x30BB, 0x30F3, 0x30C8, 0x30CF, 0x309A, 0x30FC, 0x30C4,
+        0x30CF, 0x3099, 0x30FC, 0x30EC, 0x30EB, 0x30D2, 0x309A, 0x30A2, 0x30B9, 0x30C8, 0x30EB, 0x30D2, 0x309A, 0x30AF, 0x30EB, 0x30D2,
+        0x309A, 0x30B3, 0x30D2, 0x3099, 0x30EB, 0x30D5, 0x30A1, 0x30E9, 0x30C3, 0x30C8, 0x3099, 0x30D5, 0x30A3, 0x30FC, 0x30C8, 0x30D5,
+        0x3099, 0x30C3, 0x30B7, 0x30A7, 0x30EB, 0x30D5, 0x30E9, 0x30F3, 0x30D8, 0x30AF, 0x30BF, 0x30FC, 0x30EB, 0x30D8, 0x309A, 0x30BD,
+        0x30D8, 0x309A, 0x30CB, 0x30D2, 0x30D8, 0x30EB, 0x30C4, 0x30D8, 0x309A, 0x30F3, 0x30B9, 0x30D8, 0x309A, 0x30FC, 0x30B7, 0x3099,
+        0x30D8, 0x3099, 0x30FC, 0x30BF, 0x30DB, 0x309A, 0x30A4, 0x30F3, 0x30C8, 0x30DB, 0x3099, 0x30EB, 0x30C8, 0x30DB, 0x30F3, 0x30DB,
+        0x309A, 0x30F3, 0x30C8, 0x3099, 0x30DB, 0x30FC, 0x30EB, 0x30DB, 0x30FC, 0x30F3, 0x30DE, 0x30A4, 0x30AF, 0x30ED, 0x30DE, 0x30A4,
+        0x30EB, 0x30DE, 0x30C3, 0x30CF, 0x30DE, 0x30EB, 0x30AF, 0x30DE, 0x30F3, 0x30B7, 0x30E7, 0x30F3, 0x30DF, 0x30AF, 0x30ED, 0x30F3,
+        0x30DF, 0x30EA, 0x30DF, 0x30EA, 0x30CF, 0x3099, 0x30FC, 0x30EB, 0x30E1, 0x30AB, 0x3099, 0x30E1, 0x30AB, 0x3099, 0x30C8, 0x30F3,
+        0x30E1, 0x30FC, 0x30C8, 0x30EB, 0x30E4, 0x30FC, 0x30C8, 0x3099, 0x30E4, 0x30FC, 0x30EB, 0x30E6, 0x30A2, 0x30F3, 0x30EA, 0x30C3,
+        0x30C8, 0x30EB, 0x30EA, 0x30E9, 0x30EB, 0x30D2, 0x309A, 0x30FC, 0x30EB, 0x30FC, 0x30D5, 0x3099, 0x30EB, 0x30EC, 0x30E0, 0x30EC,
+        0x30F3, 0x30C8, 0x30B1, 0x3099, 0x30F3, 0x30EF, 0x30C3, 0x30C8, 0x0030, 0x70B9, 0x0031, 0x70B9, 0x0032, 0x70B9, 0x0033, 0x70B9,
+        0x0034, 0x70B9, 0x0035, 0x70B9, 0x0036, 0x70B9, 0x0037, 0x70B9, 0x0038, 0x70B9, 0x0039, 0x70B9, 0x0031, 0x0030, 0x70B9, 0x0031,
+        0x0031, 0x70B9, 0x0031, 0x0032, 0x70B9, 0x0031, 0x0033, 0x70B9, 0x0031, 0x0034, 0x70B9, 0x0031, 0x0035, 0x70B9, 0x0031, 0x0036,
+        0x70B9, 0x0031, 0x0037, 0x70B9, 0x0031, 0x0038, 0x70B9, 0x0031, 0x0039, 0x70B9, 0x0032, 0x0030, 0x70B9, 0x0032, 0x0031, 0x70B9,
+        0x0032, 0x0032, 0x70B9, 0x0032, 0x0033, 0x70B9, 0x0032, 0x0034, 0x70B9, 0x0068, 0x0050, 0x0061, 0x0064, 0x0061, 0x0041, 0x0055,
+        0x0062, 0x0061, 0x0072, 0x006F, 0x0056, 0x0070, 0x0063, 0x0064, 0x006D, 0x0064, 0x006D, 0x0032, 0x0064, 0x006D, 0x0033, 0x0049,
+        0x0055, 0x5E73, 0x6210, 0x662D, 0x548C, 0x5927, 0x6B63, 0x660E, 0x6CBB, 0x682A, 0x5F0F, 0x4F1A, 0x793E, 0x0070, 0x0041, 0x006E,
+        0x0041, 0x03BC, 0x0041, 0x006D, 0x0041, 0x006B, 0x0041, 0x004B, 0x0042, 0x004D, 0x0042, 0x0047, 0x0042, 0x0063, 0x0061, 0x006C,
+        0x006B, 0x0063, 0x0061, 0x006C, 0x0070, 0x0046, 0x006E, 0x0046, 0x03BC, 0x0046, 0x03BC, 0x0067, 0x006D, 0x0067, 0x006B, 0x0067,
+        0x0048, 0x007A, 0x006B, 0x0048, 0x007A, 0x004D, 0x0048, 0x007A, 0x0047, 0x0048, 0x007A, 0x0054, 0x0048, 0x007A, 0x03BC, 0x006C,
+        0x006D, 0x006C, 0x0064, 0x006C, 0x006B, 0x006C, 0x0066, 0x006D, 0x006E, 0x006D, 0x03BC, 0x006D, 0x006D, 0x006D, 0x0063, 0x006D,
+        0x006B, 0x006D, 0x006D, 0x006D, 0x0032, 0x0063, 0x006D, 0x0032, 0x006D, 0x0032, 0x006B, 0x006D, 0x0032, 0x006D, 0x006D, 0x0033,
+        0x0063, 0x006D, 0x0033, 0x006D, 0x0033, 0x006B, 0x006D, 0x0033, 0x006D, 0x2215, 0x0073, 0x006D, 0x2215, 0x0073, 0x0032, 0x0050,
+        0x0061, 0x006B, 0x0050, 0x0061, 0x004D, 0x0050, 0x0061, 0x0047, 0x0050, 0x0061, 0x0072, 0x0061, 0x0064, 0x0072, 0x0061, 0x0064,
+        0x2215, 0x0073, 0x0072, 0x0061, 0x0064, 0x2215, 0x0073, 0x0032, 0x0070, 0x0073, 0x006E, 0x0073, 0x03BC, 0x0073, 0x006D, 0x0073,
+        0x0070, 0x0056, 0x006E, 0x0056, 0x03BC, 0x0056, 0x006D, 0x0056, 0x006B, 0x0056, 0x004D, 0x0056, 0x0070, 0x0057, 0x006E, 0x0057,
+        0x03BC, 0x0057, 0x006D, 0x0057, 0x006B, 0x0057, 0x004D, 0x0057, 0x006B, 0x03A9, 0x004D, 0x03A9, 0x0061, 0x002E, 0x006D, 0x002E,
+        0x0042, 0x0071, 0x0063, 0x0063, 0x0063, 0x0064, 0x0043, 0x2215, 0x006B, 0x0067, 0x0043, 0x006F, 0x002E, 0x0064, 0x0042, 0x0047,
+        0x0079, 0x0068, 0x0061, 0x0048, 0x0050, 0x0069, 0x006E, 0x004B, 0x004B, 0x004B, 0x004D, 0x006B, 0x0074, 0x006C, 0x006D, 0x006C,
+        0x006E, 0x006C, 0x006F, 0x0067, 0x006C, 0x0078, 0x006D, 0x0062, 0x006D, 0x0069, 0x006C, 0x006D, 0x006F, 0x006C, 0x0050, 0x0048,
+        0x0070, 0x002E, 0x006D, 0x002E, 0x0050, 0x0050, 0x004D, 0x0050, 0x0052, 0x0073, 0x0072, 0x0053, 0x0076, 0x0057, 0x0062, 0x0056,
+        0x2215, 0x006D, 0x0041, 0x2215, 0x006D, 0x0031, 0x65E5, 0x0032, 0x65E5, 0x0033, 0x65E5, 0x0034, 0x65E5, 0x0035, 0x65E5, 0x0036,
+        0x65E5, 0x0037, 0x65E5, 0x0038, 0x65E5, 0x0039, 0x65E5, 0x0031, 0x0030, 0x65E5, 0x0031, 0x0031, 0x65E5, 0x0031, 0x0032, 0x65E5,
+        0x0031, 0x0033, 0x65E5, 0x0031, 0x0034, 0x65E5, 0x0031, 0x0035, 0x65E5, 0x0031, 0x0036, 0x65E5, 0x0031, 0x0037, 0x65E5, 0x0031,
+        0x0038, 0x65E5, 0x0031, 0x0039, 0x65E5, 0x0032, 0x0030, 0x65E5, 0x0032, 0x0031, 0x65E5, 0x0032, 0x0032, 0x65E5, 0x0032, 0x0033,
+        0x65E5, 0x0032, 0x0034, 0x65E5, 0x0032, 0x0035, 0x65E5, 0x0032, 0x0036, 0x65E5, 0x0032, 0x0037, 0x65E5, 0x0032, 0x0038, 0x65E5,
+        0x0032, 0x0039, 0x65E5, 0x0033, 0x0030, 0x65E5, 0x0033, 0x0031, 0x65E5, 0x0067, 0x0061, 0x006C, 0x044A, 0x044C, 0xA76F, 0x0126,
+        0x0153, 0xA727, 0xAB37, 0x026B, 0xAB52, 0x028D, 0x8C48, 0x66F4, 0x8CC8, 0x6ED1, 0x4E32, 0x53E5, 0x5951, 0x5587, 0x5948, 0x61F6,
+        0x7669, 0x7F85, 0x863F, 0x87BA, 0x88F8, 0x908F, 0x6A02, 0x6D1B, 0x70D9, 0x73DE, 0x843D, 0x916A, 0x99F1, 0x4E82, 0x5375, 0x6B04,
+        0x721B, 0x862D, 0x9E1E, 0x5D50, 0x6FEB, 0x85CD, 0x8964, 0x62C9, 0x81D8, 0x881F, 0x5ECA, 0x6717, 0x6D6A, 0x72FC, 0x90CE, 0x4F86,
+        0x51B7, 0x52DE, 0x64C4, 0x6AD3, 0x7210, 0x76E7, 0x8606, 0x865C, 0x8DEF, 0x9732, 0x9B6F, 0x9DFA, 0x788C, 0x797F, 0x7DA0, 0x83C9,
+        0x9304, 0x8AD6, 0x58DF, 0x5F04, 0x7C60, 0x807E, 0x7262, 0x78CA, 0x8CC2, 0x96F7, 0x58D8, 0x5C62, 0x6A13, 0x6DDA, 0x6F0F, 0x7D2F,
+        0x7E37, 0x964B, 0x52D2, 0x808B, 0x51DC, 0x51CC, 0x7A1C, 0x7DBE, 0x83F1, 0x9675, 0x8B80, 0x62CF, 0x8AFE, 0x4E39, 0x5BE7, 0x6012,
+        0x7387, 0x7570, 0x5317, 0x78FB, 0x4FBF, 0x5FA9, 0x4E0D, 0x6CCC, 0x6578, 0x7D22, 0x53C3, 0x585E, 0x7701, 0x8449, 0x8AAA, 0x6BBA,
+        0x6C88, 0x62FE, 0x82E5, 0x63A0, 0x7565, 0x4EAE, 0x5169, 0x51C9, 0x6881, 0x7CE7, 0x826F, 0x8AD2, 0x91CF, 0x52F5, 0x5442, 0x5EEC,
+        0x65C5, 0x6FFE, 0x792A, 0x95AD, 0x9A6A, 0x9E97, 0x9ECE, 0x66C6, 0x6B77, 0x8F62, 0x5E74, 0x6190, 0x6200, 0x649A, 0x6F23, 0x7149,
+        0x7489, 0x79CA, 0x7DF4, 0x806F, 0x8F26, 0x84EE, 0x9023, 0x934A, 0x5217, 0x52A3, 0x54BD, 0x70C8, 0x88C2, 0x5EC9, 0x5FF5, 0x637B,
+        0x6BAE, 0x7C3E, 0x7375, 0x4EE4, 0x56F9, 0x5DBA, 0x601C, 0x73B2, 0x7469, 0x7F9A, 0x8046, 0x9234, 0x96F6, 0x9748, 0x9818, 0x4F8B,
+        0x79AE, 0x91B4, 0x96B8, 0x60E1, 0x4E86, 0x50DA, 0x5BEE, 0x5C3F, 0x6599, 0x71CE, 0x7642, 0x84FC, 0x907C, 0x6688, 0x962E, 0x5289,
+        0x677B, 0x67F3, 0x6D41, 0x6E9C, 0x7409, 0x7559, 0x786B, 0x7D10, 0x985E, 0x622E, 0x9678, 0x502B, 0x5D19, 0x6DEA, 0x8F2A, 0x5F8B,
+        0x6144, 0x6817, 0x9686, 0x5229, 0x540F, 0x5C65, 0x6613, 0x674E, 0x68A8, 0x6CE5, 0x7406, 0x75E2, 0x7F79, 0x88CF, 0x88E1, 0x96E2,
+        0x533F, 0x6EBA, 0x541D, 0x71D0, 0x7498, 0x85FA, 0x96A3, 0x9C57, 0x9E9F, 0x6797, 0x6DCB, 0x81E8, 0x7B20, 0x7C92, 0x72C0, 0x7099,
+        0x8B58, 0x4EC0, 0x8336, 0x523A, 0x5207, 0x5EA6, 0x62D3, 0x7CD6, 0x5B85, 0x6D1E, 0x66B4, 0x8F3B, 0x964D, 0x5ED3, 0x5140, 0x55C0,
+        0x585A, 0x6674, 0x51DE, 0x732A, 0x76CA, 0x793C, 0x795E, 0x7965, 0x798F, 0x9756, 0x7CBE, 0x8612, 0x8AF8, 0x9038, 0x90FD, 0x98EF,
+        0x98FC, 0x9928, 0x9DB4, 0x90DE, 0x96B7, 0x4FAE, 0x50E7, 0x514D, 0x52C9, 0x52E4, 0x5351, 0x559D, 0x5606, 0x5668, 0x5840, 0x58A8,
+        0x5C64, 0x6094, 0x6168, 0x618E, 0x61F2, 0x654F, 0x65E2, 0x6691, 0x6885, 0x6D77, 0x6E1A, 0x6F22, 0x716E, 0x722B, 0x7422, 0x7891,
+        0x7949, 0x7948, 0x7950, 0x7956, 0x798D, 0x798E, 0x7A40, 0x7A81, 0x7BC0, 0x7E09, 0x7E41, 0x7F72, 0x8005, 0x81ED, 0x8279, 0x8457,
+        0x8910, 0x8996, 0x8B01, 0x8B39, 0x8CD3, 0x8D08, 0x8FB6, 0x96E3, 0x97FF, 0x983B, 0x6075, 0xD850, 0xDEEE, 0x8218, 0x4E26, 0x51B5,
+        0x5168, 0x4F80, 0x5145, 0x5180, 0x52C7, 0x52FA, 0x5555, 0x5599, 0x55E2, 0x58B3, 0x5944, 0x5954, 0x5A62, 0x5B28, 0x5ED2, 0x5ED9,
+        0x5F69, 0x5FAD, 0x60D8, 0x614E, 0x6108, 0x6160, 0x6234, 0x63C4, 0x641C, 0x6452, 0x6556, 0x671B, 0x6756, 0x6EDB, 0x6ECB, 0x701E,
+        0x77A7, 0x7235, 0x72AF, 0x7471, 0x7506, 0x753B, 0x761D, 0x761F, 0x76DB, 0x76F4, 0x774A, 0x7740, 0x78CC, 0x7AB1, 0x7C7B, 0x7D5B,
+        0x7F3E, 0x8352, 0x83EF, 0x8779, 0x8941, 0x8986, 0x8ABF, 0x8ACB, 0x8AED, 0x8B8A, 0x8F38, 0x9072, 0x9199, 0x9276, 0x967C, 0x97DB,
+        0x980B, 0x9B12, 0xD84A, 0xDC4A, 0xD84A, 0xDC44, 0xD84C, 0xDFD5, 0x3B9D, 0x4018, 0x4039, 0xD854, 0xDE49, 0xD857, 0xDCD0, 0xD85F,
+        0xDED3, 0x9F43, 0x9F8E, 0x0066, 0x0066, 0x0066, 0x0069, 0x0066, 0x006C, 0x0066, 0x0066, 0x0069, 0x0066, 0x0066, 0x006C, 0x0073,
+        0x0074, 0x0574, 0x0576, 0x0574, 0x0565, 0x0574, 0x056B, 0x057E, 0x0576, 0x0574, 0x056D, 0x05D9, 0x05B4, 0x05F2, 0x05B7, 0x05E2,
+        0x05D4, 0x05DB, 0x05DC, 0x05DD, 0x05E8, 0x05EA, 0x05E9, 0x05C1, 0x05E9, 0x05C2, 0x05E9, 0x05BC, 0x05C1, 0x05E9, 0x05BC, 0x05C2,
+        0x05D0, 0x05B7, 0x05D0, 0x05B8, 0x05D0, 0x05BC, 0x05D1, 0x05BC, 0x05D2, 0x05BC, 0x05D3, 0x05BC, 0x05D4, 0x05BC, 0x05D5, 0x05BC,
+        0x05D6, 0x05BC, 0x05D8, 0x05BC, 0x05D9, 0x05BC, 0x05DA, 0x05BC, 0x05DB, 0x05BC, 0x05DC, 0x05BC, 0x05DE, 0x05BC, 0x05E0, 0x05BC,
+        0x05E1, 0x05BC, 0x05E3, 0x05BC, 0x05E4, 0x05BC, 0x05E6, 0x05BC, 0x05E7, 0x05BC, 0x05E8, 0x05BC, 0x05E9, 0x05BC, 0x05EA, 0x05BC,
+        0x05D5, 0x05B9, 0x05D1, 0x05BF, 0x05DB, 0x05BF, 0x05E4, 0x05BF, 0x05D0, 0x05DC, 0x0671, 0x067B, 0x067E, 0x0680, 0x067A, 0x067F,
+        0x0679, 0x06A4, 0x06A6, 0x0684, 0x0683, 0x0686, 0x0687, 0x068D, 0x068C, 0x068E, 0x0688, 0x0698, 0x0691, 0x06A9, 0x06AF, 0x06B3,
+        0x06B1, 0x06BA, 0x06BB, 0x06C1, 0x06BE, 0x06D2, 0x06AD, 0x06C7, 0x06C6, 0x06C8, 0x06CB, 0x06C5, 0x06C9, 0x06D0, 0x0649, 0x064A,
+        0x0654, 0x0627, 0x064A, 0x0654, 0x06D5, 0x064A, 0x0654, 0x0648, 0x064A, 0x0654, 0x06C7, 0x064A, 0x0654, 0x06C6, 0x064A, 0x0654,
+        0x06C8, 0x064A, 0x0654, 0x06D0, 0x064A, 0x0654, 0x0649, 0x06CC, 0x064A, 0x0654, 0x062C, 0x064A, 0x0654, 0x062D, 0x064A, 0x0654,
+        0x0645, 0x064A, 0x0654, 0x064A, 0x0628, 0x062C, 0x0628, 0x062D, 0x0628, 0x062E, 0x0628, 0x0645, 0x0628, 0x0649, 0x0628, 0x064A,
+        0x062A, 0x062C, 0x062A, 0x062D, 0x062A, 0x062E, 0x062A, 0x0645, 0x062A, 0x0649, 0x062A, 0x064A, 0x062B, 0x062C, 0x062B, 0x0645,
+        0x062B, 0x0649, 0x062B, 0x064A, 0x062C, 0x062D, 0x062C, 0x0645, 0x062D, 0x062C, 0x062D, 0x0645, 0x062E, 0x062C, 0x062E, 0x062D,
+        0x062E, 0x0645, 0x0633, 0x062C, 0x0633, 0x062D, 0x0633, 0x062E, 0x0633, 0x0645, 0x0635, 0x062D, 0x0635, 0x0645, 0x0636, 0x062C,
+        0x0636, 0x062D, 0x0636, 0x062E, 0x0636, 0x0645, 0x0637, 0x062D, 0x0637, 0x0645, 0x0638, 0x0645, 0x0639, 0x062C, 0x0639, 0x0645,
+        0x063A, 0x062C, 0x063A, 0x0645, 0x0641, 0x062C, 0x0641, 0x062D, 0x0641, 0x062E, 0x0641, 0x0645, 0x0641, 0x0649, 0x0641, 0x064A,
+        0x0642, 0x062D, 0x0642, 0x0645, 0x0642, 0x0649, 0x0642, 0x064A, 0x0643, 0x0627, 0x0643, 0x062C, 0x0643, 0x062D, 0x0643, 0x062E,
+        0x0643, 0x0644, 0x0643, 0x0645, 0x0643, 0x0649, 0x0643, 0x064A, 0x0644, 0x062C, 0x0644, 0x062D, 0x0644, 0x062E, 0x0644, 0x0645,
+        0x0644, 0x0649, 0x0644, 0x064A, 0x0645, 0x062C, 0x0645, 0x062D, 0x0645, 0x062E, 0x0645, 0x0645, 0x0645, 0x0649, 0x0645, 0x064A,
+        0x0646, 0x062C, 0x0646, 0x062D, 0x0646, 0x062E, 0x0646, 0x0645, 0x0646, 0x0649, 0x0646, 0x064A, 0x0647, 0x062C, 0x0647, 0x0645,
+        0x0647, 0x0649, 0x0647, 0x064A, 0x064A, 0x062C, 0x064A, 0x062D, 0x064A, 0x062E, 0x064A, 0x0645, 0x064A, 0x0649, 0x064A, 0x064A,
+        0x0630, 0x0670, 0x0631, 0x0670, 0x0649, 0x0670, 0x0020, 0x064C, 0x0651, 0x0020, 0x064D, 0x0651, 0x0020, 0x064E, 0x0651, 0x0020,
+        0x064F, 0x0651, 0x0020, 0x0650, 0x0651, 0x0020, 0x0651, 0x0670, 0x064A, 0x0654, 0x0631, 0x064A, 0x0654, 0x0632, 0x064A, 0x0654,
+        0x0646, 0x0628, 0x0631, 0x0628, 0x0632, 0x0628, 0x0646, 0x062A, 0x0631, 0x062A, 0x0632, 0x062A, 0x0646, 0x062B, 0x0631, 0x062B,
+        0x0632, 0x062B, 0x0646, 0x0645, 0x0627, 0x0646, 0x0631, 0x0646, 0x0632, 0x0646, 0x0646, 0x064A, 0x0631, 0x064A, 0x0632, 0x064A,
+        0x0646, 0x064A, 0x0654, 0x062E, 0x064A, 0x0654, 0x0647, 0x0628, 0x0647, 0x062A, 0x0647, 0x0635, 0x062E, 0x0644, 0x0647, 0x0646,
+        0x0647, 0x0647, 0x0670, 0x064A, 0x0647, 0x062B, 0x0647, 0x0633, 0x0647, 0x0634, 0x0645, 0x0634, 0x0647, 0x0640, 0x064E, 0x0651,
+        0x0640, 0x064F, 0x0651, 0x0640, 0x0650, 0x0651, 0x0637, 0x0649, 0x0637, 0x064A, 0x0639, 0x0649, 0x0639, 0x064A, 0x063A, 0x0649,
+        0x063A, 0x064A, 0x0633, 0x0649, 0x0633, 0x064A, 0x0634, 0x0649, 0x0634, 0x064A, 0x062D, 0x0649, 0x062D, 0x064A, 0x062C, 0x0649,
+        0x062C, 0x064A, 0x062E, 0x0649, 0x062E, 0x064A, 0x0635, 0x0649, 0x0635, 0x064A, 0x0636, 0x0649, 0x0636, 0x064A, 0x0634, 0x062C,
+        0x0634, 0x062D, 0x0634, 0x062E, 0x0634, 0x0631, 0x0633, 0x0631, 0x0635, 0x0631, 0x0636, 0x0631, 0x0627, 0x064B, 0x062A, 0x062C,
+        0x0645, 0x062A, 0x062D, 0x062C, 0x062A, 0x062D, 0x0645, 0x062A, 0x062E, 0x0645, 0x062A, 0x0645, 0x062C, 0x062A, 0x0645, 0x062D,
+        0x062A, 0x0645, 0x062E, 0x062C, 0x0645, 0x062D, 0x062D, 0x0645, 0x064A, 0x062D, 0x0645, 0x0649, 0x0633, 0x062D, 0x062C, 0x0633,
+        0x062C, 0x062D, 0x0633, 0x062C, 0x0649, 0x0633, 0x0645, 0x062D, 0x0633, 0x0645, 0x062C, 0x0633, 0x0645, 0x0645, 0x0635, 0x062D,
+        0x062D, 0x0635, 0x0645, 0x0645, 0x0634, 0x062D, 0x0645, 0x0634, 0x062C, 0x064A, 0x0634, 0x0645, 0x062E, 0x0634, 0x0645, 0x0645,
+        0x0636, 0x062D, 0x0649, 0x0636, 0x062E, 0x0645, 0x0637, 0x0645, 0x062D, 0x0637, 0x0645, 0x0645, 0x0637, 0x0645, 0x064A, 0x0639,
+        0x062C, 0x0645, 0x0639, 0x0645, 0x0645, 0x0639, 0x0645, 0x0649, 0x063A, 0x0645, 0x0645, 0x063A, 0x0645, 0x064A, 0x063A, 0x0645,
+        0x0649, 0x0641, 0x062E, 0x0645, 0x0642, 0x0645, 0x062D, 0x0642, 0x0645, 0x0645, 0x0644, 0x062D, 0x0645, 0x0644, 0x062D, 0x064A,
+        0x0644, 0x062D, 0x0649, 0x0644, 0x062C, 0x062C, 0x0644, 0x062E, 0x0645, 0x0644, 0x0645, 0x062D, 0x0645, 0x062D, 0x062C, 0x0645,
+        0x062D, 0x0645, 0x0645, 0x062D, 0x064A, 0x0645, 0x062C, 0x062D, 0x0645, 0x062C, 0x0645, 0x0645, 0x062E, 0x062C, 0x0645, 0x062E,
+        0x0645, 0x0645, 0x062C, 0x062E, 0x0647, 0x0645, 0x062C, 0x0647, 0x0645, 0x0645, 0x0646, 0x062D, 0x0645, 0x0646, 0x062D, 0x0649,
+        0x0646, 0x062C, 0x0645, 0x0646, 0x062C, 0x0649, 0x0646, 0x0645, 0x064A, 0x0646, 0x0645, 0x0649, 0x064A, 0x0645, 0x0645, 0x0628,
+        0x062E, 0x064A, 0x062A, 0x062C, 0x064A, 0x062A, 0x062C, 0x0649, 0x062A, 0x062E, 0x064A, 0x062A, 0x062E, 0x0649, 0x062A, 0x0645,
+        0x064A, 0x062A, 0x0645, 0x0649, 0x062C, 0x0645, 0x064A, 0x062C, 0x062D, 0x0649, 0x062C, 0x0645, 0x0649, 0x0633, 0x062E, 0x0649,
+        0x0635, 0x062D, 0x064A, 0x0634, 0x062D, 0x064A, 0x0636, 0x062D, 0x064A, 0x0644, 0x062C, 0x064A, 0x0644, 0x0645, 0x064A, 0x064A,
+        0x062D, 0x064A, 0x064A, 0x062C, 0x064A, 0x064A, 0x0645, 0x064A, 0x0645, 0x0645, 0x064A, 0x0642, 0x0645, 0x064A, 0x0646, 0x062D,
+        0x064A, 0x0639, 0x0645, 0x064A, 0x0643, 0x0645, 0x064A, 0x0646, 0x062C, 0x062D, 0x0645, 0x062E, 0x064A, 0x0644, 0x062C, 0x0645,
+        0x0643, 0x0645, 0x0645, 0x062C, 0x062D, 0x064A, 0x062D, 0x062C, 0x064A, 0x0645, 0x062C, 0x064A, 0x0641, 0x0645, 0x064A, 0x0628,
+        0x062D, 0x064A, 0x0633, 0x062E, 0x064A, 0x0646, 0x062C, 0x064A, 0x0635, 0x0644, 0x06D2, 0x0642, 0x0644, 0x06D2, 0x0627, 0x0644,
+        0x0644, 0x0647, 0x0627, 0x0643, 0x0628, 0x0631, 0x0645, 0x062D, 0x0645, 0x062F, 0x0635, 0x0644, 0x0639, 0x0645, 0x0631, 0x0633,
+        0x0648, 0x0644, 0x0639, 0x0644, 0x064A, 0x0647, 0x0648, 0x0633, 0x0644, 0x0645, 0x0635, 0x0644, 0x0649, 0x0635, 0x0644, 0x0649,
+        0x0020, 0x0627, 0x0644, 0x0644, 0x0647, 0x0020, 0x0639, 0x0644, 0x064A, 0x0647, 0x0020, 0x0648, 0x0633, 0x0644, 0x0645, 0x062C,
+        0x0644, 0x0020, 0x062C, 0x0644, 0x0627, 0x0644, 0x0647, 0x0631, 0x06CC, 0x0627, 0x0644, 0x002C, 0x3001, 0x3002, 0x003A, 0x0021,
+        0x003F, 0x3016, 0x3017, 0x2014, 0x2013, 0x005F, 0x007B, 0x007D, 0x3014, 0x3015, 0x3010, 0x3011, 0x300A, 0x300B, 0x300C, 0x300D,
+        0x300E, 0x300F, 0x005B, 0x005D, 0x0023, 0x0026, 0x002A, 0x002D, 0x003C, 0x003E, 0x005C, 0x0024, 0x0025, 0x0040, 0x0020, 0x064B,
+        0x0640, 0x064B, 0x0020, 0x064C, 0x0020, 0x064D, 0x0020, 0x064E, 0x0640, 0x064E, 0x0020, 0x064F, 0x0640, 0x064F, 0x0020, 0x0650,
+        0x0640, 0x0650, 0x0020, 0x0651, 0x0640, 0x0651, 0x0020, 0x0652, 0x0640, 0x0652, 0x0621, 0x0627, 0x0628, 0x0629, 0x062A, 0x062B,
+        0x062C, 0x062D, 0x062E, 0x062F, 0x0630, 0x0631, 0x0632, 0x0633, 0x0634, 0x0635, 0x0636, 0x0637, 0x0638, 0x0639, 0x063A, 0x0641,
+        0x0642, 0x0643, 0x0644, 0x0645, 0x0646, 0x0647, 0x0648, 0x064A, 0x0644, 0x0627, 0x0653, 0x0644, 0x0627, 0x0654, 0x0644, 0x0627,
+        0x0655, 0x0644, 0x0627, 0x0022, 0x0027, 0x002F, 0x005E, 0x007C, 0x007E, 0x2985, 0x2986, 0x30FB, 0x30A1, 0x30A3, 0x30A5, 0x30A7,
+        0x30A9, 0x30E3, 0x30E5, 0x30E7, 0x30C3, 0x30FC, 0x30F3, 0x3099, 0x309A, 0x00A2, 0x00A3, 0x00AC, 0x00A6, 0x00A5, 0x20A9, 0x2502,
+        0x2190, 0x2191, 0x2192, 0x2193, 0x25A0, 0x25CB,
+    };
+
+    /** Full case folding results (UTF-16) */
+    inline constexpr uint16 FoldPool[1296] = {
+        0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070,
+        0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x03BC, 0x00E0, 0x00E1, 0x00E2, 0x00E3, 0x00E4,
+        0x00E5, 0x00E6, 0x00E7, 0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x00EC, 0x00ED, 0x00EE, 0x00EF, 0x00F0, 0x00F1, 0x00F2, 0x00F3, 0x00F4,
+        0x00F5, 0x00F6, 0x00F8, 0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x00FD, 0x00FE, 0x0073, 0x0073, 0x0101, 0x0103, 0x0105, 0x0107, 0x0109,
+        0x010B, 0x010D, 0x010F, 0x0111, 0x0113, 0x0115, 0x0117, 0x0119, 0x011B, 0x011D, 0x011F, 0x0121, 0x0123, 0x0125, 0x0127, 0x0129,
+        0x012B, 0x012D, 0x012F, 0x0069, 0x0307, 0x0133, 0x0135, 0x0137, 0x013A, 0x013C, 0x013E, 0x0140, 0x0142, 0x0144, 0x0146, 0x0148,
+        0x02BC, 0x006E, 0x014B, 0x014D, 0x014F, 0x0151, 0x0153, 0x0155, 0x0157, 0x0159, 0x015B, 0x015D, 0x015F, 0x0161, 0x0163, 0x0165,
+        0x0167, 0x0169, 0x016B, 0x016D, 0x016F, 0x0171, 0x0173, 0x0175, 0x0177, 0x00FF, 0x017A, 0x017C, 0x017E, 0x0253, 0x0183, 0x0185,
+        0x0254, 0x0188, 0x0256, 0x0257, 0x018C, 0x01DD, 0x0259, 0x025B, 0x0192, 0x0260, 0x0263, 0x0269, 0x0268, 0x0199, 0x026F, 0x0272,
+        0x0275, 0x01A1, 0x01A3, 0x01A5, 0x0280, 0x01A8, 0x0283, 0x01AD, 0x0288, 0x01B0, 0x028A, 0x028B, 0x01B4, 0x01B6, 0x0292, 0x01B9,
+        0x01BD, 0x01C6, 0x01C9, 0x01CC, 0x01CE, 0x01D0, 0x01D2, 0x01D4, 0x01D6, 0x01D8, 0x01DA, 0x01DC, 0x01DF, 0x01E1, 0x01E3, 0x01E5,
+        0x01E7, 0x01E9, 0x01EB, 0x01ED, 0x01EF, 0x006A, 0x030C, 0x01F3, 0x01F5, 0x0195, 0x01BF, 0x01F9, 0x01FB, 0x01FD, 0x01FF, 0x0201,
+        0x0203, 0x0205, 0x0207, 0x0209, 0x020B, 0x020D, 0x020F, 0x0211, 0x0213, 0x0215, 0x0217, 0x0219, 0x021B, 0x021D, 0x021F, 0x019E,
+        0x0223, 0x0225, 0x0227, 0x0229, 0x022B, 0x022D, 0x022F, 0x0231, 0x0233, 0x2C65, 0x023C, 0x019A, 0x2C66, 0x0242, 0x0180, 0x0289,
+        0x028C, 0x0247, 0x0249, 0x024B, 0x024D, 0x024F, 0x03B9, 0x0371, 0x0373, 0x0377, 0x03F3, 0x03AC, 0x03AD, 0x03AE, 0x03AF, 0x03CC,
+        0x03CD, 0x03CE, 0x03B9, 0x0308, 0x0301, 0x03B1, 0x03B2, 0x03B3, 0x03B4, 0x03B5, 0x03B6, 0x03B7, 0x03B8, 0x03BA, 0x03BB, 0x03BD,
+        0x03BE, 0x03BF, 0x03C0, 0x03C1, 0x03C3, 0x03C4, 0x03C5, 0x03C6, 0x03C7, 0x03C8, 0x03C9, 0x03CA, 0x03CB, 0x03C5, 0x0308, 0x0301,
+        0x03D7, 0x03D9, 0x03DB, 0x03DD, 0x03DF, 0x03E1, 0x03E3, 0x03E5, 0x03E7, 0x03E9, 0x03EB, 0x03ED, 0x03EF, 0x03F8, 0x03F2, 0x03FB,
+        0x037B, 0x037C, 0x037D, 0x0450, 0x0451, 0x0452, 0x0453, 0x0454, 0x0455, 0x0456, 0x0457, 0x0458, 0x0459, 0x045A, 0x045B, 0x045C,
+        0x045D, 0x045E, 0x045F, 0x0430, 0x0431, 0x0432, 0x0433, 0x0434, 0x0435, 0x0436, 0x0437, 0x0438, 0x0439, 0x043A, 0x043B, 0x043C,
+        0x043D, 0x043E, 0x043F, 0x0440, 0x0441, 0x0442, 0x0443, 0x0444, 0x0445, 0x0446, 0x0447, 0x0448, 0x0449, 0x044A, 0x044B, 0x044C,
+        0x044D, 0x044E, 0x044F, 0x0461, 0x0463, 0x0465, 0x0467, 0x0469, 0x046B, 0x046D, 0x046F, 0x0471, 0x0473, 0x0475, 0x0477, 0x0479,
+        0x047B, 0x047D, 0x047F, 0x0481, 0x048B, 0x048D, 0x048F, 0x0491, 0x0493, 0x0495, 0x0497, 0x0499, 0x049B, 0x049D, 0x049F, 0x04A1,
+        0x04A3, 0x04A5, 0x04A7, 0x04A9, 0x04AB, 0x04AD, 0x04AF, 0x04B1, 0x04B3, 0x04B5, 0x04B7, 0x04B9, 0x04BB, 0x04BD, 0x04BF, 0x04CF,
+        0x04C2, 0x04C4, 0x04C6, 0x04C8, 0x04CA, 0x04CC, 0x04CE, 0x04D1, 0x04D3, 0x04D5, 0x04D7, 0x04D9, 0x04DB, 0x04DD, 0x04DF, 0x04E1,
+        0x04E3, 0x04E5, 0x04E7, 0x04E9, 0x04EB, 0x04ED, 0x04EF, 0x04F1, 0x04F3, 0x04F5, 0x04F7, 0x04F9, 0x04FB, 0x04FD, 0x04FF, 0x0501,
+        0x0503, 0x0505, 0x0507, 0x0509, 0x050B, 0x050D, 0x050F, 0x0511, 0x0513, 0x0515, 0x0517, 0x0519, 0x051B, 0x051D, 0x051F, 0x0521,
+        0x0523, 0x0525, 0x0527, 0x0529, 0x052B, 0x052D, 0x052F, 0x0561, 0x0562, 0x0563, 0x0564, 0x0565, 0x0566, 0x0567, 0x0568, 0x0569,
+        0x056A, 0x056B, 0x056C, 0x056D, 0x056E, 0x056F, 0x0570, 0x0571, 0x0572, 0x0573, 0x0574, 0x0575, 0x0576, 0x0577, 0x0578, 0x0579,
+        0x057A, 0x057B, 0x057C, 0x057D, 0x057E, 0x057F, 0x0580, 0x0581, 0x0582, 0x0583, 0x0584, 0x0585, 0x0586, 0x0565, 0x0582, 0x2D00,
+        0x2D01, 0x2D02, 0x2D03, 0x2D04, 0x2D05, 0x2D06, 0x2D07, 0x2D08, 0x2D09, 0x2D0A, 0x2D0B, 0x2D0C, 0x2D0D, 0x2D0E, 0x2D0F, 0x2D10,
+        0x2D11, 0x2D12, 0x2D13, 0x2D14, 0x2D15, 0x2D16, 0x2D17, 0x2D18, 0x2D19, 0x2D1A, 0x2D1B, 0x2D1C, 0x2D1D, 0x2D1E, 0x2D1F, 0x2D20,
+        0x2D21, 0x2D22, 0x2D23, 0x2D24, 0x2D25, 0x2D27, 0x2D2D, 0x13F0, 0x13F1, 0x13F2, 0x13F3, 0x13F4, 0x13F5, 0xA64B, 0x10D0, 0x10D1,
+        0x10D2, 0x10D3, 0x10D4, 0x10D5, 0x10D6, 0x10D7, 0x10D8, 0x10D9, 0x10DA, 0x10DB, 0x10DC, 0x10DD, 0x10DE, 0x10DF, 0x10E0, 0x10E1,
+        0x10E2, 0x10E3, 0x10E4, 0x10E5, 0x10E6, 0x10E7, 0x10E8, 0x10E9, 0x10EA, 0x10EB, 0x10EC, 0x10ED, 0x10EE, 0x10EF, 0x10F0, 0x10F1,
+        0x10F2, 0x10F3, 0x10F4, 0x10F5, 0x10F6, 0x10F7, 0x10F8, 0x10F9, 0x10FA, 0x10FD, 0x10FE, 0x10FF, 0x1E01, 0x1E03, 0x1E05, 0x1E07,
+        0x1E09, 0x1E0B, 0x1E0D, 0x1E0F, 0x1E11, 0x1E13, 0x1E15, 0x1E17, 0x1E19, 0x1E1B, 0x1E1D, 0x1E1F, 0x1E21, 0x1E23, 0x1E25, 0x1E27,
+        0x1E29, 0x1E2B, 0x1E2D, 0x1E2F, 0x1E31, 0x1E33, 0x1E35, 0x1E37, 0x1E39, 0x1E3B, 0x1E3D, 0x1E3F, 0x1E41, 0x1E43, 0x1E45, 0x1E47,
+        0x1E49, 0x1E4B, 0x1E4D, 0x1E4F, 0x1E51, 0x1E53, 0x1E55, 0x1E57, 0x1E59, 0x1E5B, 0x1E5D, 0x1E5F, 0x1E61, 0x1E63, 0x1E65, 0x1E67,
+        0x1E69, 0x1E6B, 0x1E6D, 0x1E6F, 0x1E71, 0x1E73, 0x1E75, 0x1E77, 0x1E79, 0x1E7B, 0x1E7D, 0x1E7F, 0x1E81, 0x1E83, 0x1E85, 0x1E87,
+        0x1E89, 0x1E8B, 0x1E8D, 0x1E8F, 0x1E91, 0x1E93, 0x1E95, 0x0068, 0x0331, 0x0074, 0x0308, 0x0077, 0x030A, 0x0079, 0x030A, 0x0061,
+        0x02BE, 0x1EA1, 0x1EA3, 0x1EA5, 0x1EA7, 0x1EA9, 0x1EAB, 0x1EAD, 0x1EAF, 0x1EB1, 0x1EB3, 0x1EB5, 0x1EB7, 0x1EB9, 0x1EBB, 0x1EBD,
+        0x1EBF, 0x1EC1, 0x1EC3, 0x1EC5, 0x1EC7, 0x1EC9, 0x1ECB, 0x1ECD, 0x1ECF, 0x1ED1, 0x1ED3, 0x1ED5, 0x1ED7, 0x1ED9, 0x1EDB, 0x1EDD,
+        0x1EDF, 0x1EE1, 0x1EE3, 0x1EE5, 0x1EE7, 0x1EE9, 0x1EEB, 0x1EED, 0x1EEF, 0x1EF1, 0x1EF3, 0x1EF5, 0x1EF7, 0x1EF9, 0x1EFB, 0x1EFD,
+        0x1EFF, 0x1F00, 0x1F01, 0x1F02, 0x1F03, 0x1F04, 0x1F05, 0x1F06, 0x1F07, 0x1F10, 0x1F11, 0x1F12, 0x1F13, 0x1F14, 0x1F15, 0x1F20,
+        0x1F21, 0x1F22, 0x1F23, 0x1F24, 0x1F25, 0x1F26, 0x1F27, 0x1F30, 0x1F31, 0x1F32, 0x1F33, 0x1F34, 0x1F35, 0x1F36, 0x1F37, 0x1F40,
+        0x1F41, 0x1F42, 0x1F43, 0x1F44, 0x1F45, 0x03C5, 0x0313, 0x03C5, 0x0313, 0x0300, 0x03C5, 0x0313, 0x0301, 0x03C5, 0x0313, 0x0342,
+        0x1F51, 0x1F53, 0x1F55, 0x1F57, 0x1F60, 0x1F61, 0x1F62, 0x1F63, 0x1F64, 0x1F65, 0x1F66, 0x1F67, 0x1F00, 0x03B9, 0x1F01, 0x03B9,
+        0x1F02, 0x03B9, 0x1F03, 0x03B9, 0x1F04, 0x03B9, 0x1F05, 0x03B9, 0x1F06, 0x03B9, 0x1F07, 0x03B9, 0x1F20, 0x03B9, 0x1F21, 0x03B9,
+        0x1F22, 0x03B9, 0x1F23, 0x03B9, 0x1F24, 0x03B9, 0x1F25, 0x03B9, 0x1F26, 0x03B9, 0x1F27, 0x03B9, 0x1F60, 0x03B9, 0x1F61, 0x03B9,
+        0x1F62, 0x03B9, 0x1F63, 0x03B9, 0x1F64, 0x03B9, 0x1F65, 0x03B9, 0x1F66, 0x03B9, 0x1F67, 0x03B9, 0x1F70, 0x03B9, 0x03B1, 0x03B9,
+        0x03AC, 0x03B9, 0x03B1, 0x0342, 0x03B1, 0x0342, 0x03B9, 0x1FB0, 0x1FB1, 0x1F70, 0x1F71, 0x1F74, 0x03B9, 0x03B7, 0x03B9, 0x03AE,
+        0x03B9, 0x03B7, 0x0342, 0x03B7, 0x0342, 0x03B9, 0x1F72, 0x1F73, 0x1F74, 0x1F75, 0x03B9, 0x0308, 0x0300, 0x03B9, 0x0342, 0x03B9,
+        0x0308, 0x0342, 0x1FD0, 0x1FD1, 0x1F76, 0x1F77, 0x03C5, 0x0308, 0x0300, 0x03C1, 0x0313, 0x03C5, 0x0342, 0x03C5, 0x0308, 0x0342,
+        0x1FE0, 0x1FE1, 0x1F7A, 0x1F7B, 0x1FE5, 0x1F7C, 0x03B9, 0x03C9, 0x03B9, 0x03CE, 0x03B9, 0x03C9, 0x0342, 0x03C9, 0x0342, 0x03B9,
+        0x1F78, 0x1F79, 0x1F7C, 0x1F7D, 0x214E, 0x2170, 0x2171, 0x2172, 0x2173, 0x2174, 0x2175, 0x2176, 0x2177, 0x2178, 0x2179, 0x217A,
+        0x217B, 0x217C, 0x217D, 0x217E, 0x217F, 0x2184, 0x24D0, 0x24D1, 0x24D2, 0x24D3, 0x24D4, 0x24D5, 0x24D6, 0x24D7, 0x24D8, 0x24D9,
+        0x24DA, 0x24DB, 0x24DC, 0x24DD, 0x24DE, 0x24DF, 0x24E0, 0x24E1, 0x24E2, 0x24E3, 0x24E4, 0x24E5, 0x24E6, 0x24E7, 0x24E8, 0x24E9,
+        0x2C30, 0x2C31, 0x2C32, 0x2C33, 0x2C34, 0x2C35, 0x2C36, 0x2C37, 0x2C38, 0x2C39, 0x2C3A, 0x2C3B, 0x2C3C, 0x2C3D, 0x2C3E, 0x2C3F,
+        0x2C40, 0x2C41, 0x2C42, 0x2C43, 0x2C44, 0x2C45, 0x2C46, 0x2C47, 0x2C48, 0x2C49, 0x2C4A, 0x2C4B, 0x2C4C, 0x2C4D, 0x2C4E, 0x2C4F,
+        0x2C50, 0x2C51, 0x2C52, 0x2C53, 0x2C54, 0x2C55, 0x2C56, 0x2C57, 0x2C58, 0x2C59, 0x2C5A, 0x2C5B, 0x2C5C, 0x2C5D, 0x2C5E, 0x2C5F,
+        0x2C61, 0x026B, 0x1D7D, 0x027D, 0x2C68, 0x2C6A, 0x2C6C, 0x0251, 0x0271, 0x0250, 0x0252, 0x2C73, 0x2C76, 0x023F, 0x0240, 0x2C81,
+        0x2C83, 0x2C85, 0x2C87, 0x2C89, 0x2C8B, 0x2C8D, 0x2C8F, 0x2C91, 0x2C93, 0x2C95, 0x2C97, 0x2C99, 0x2C9B, 0x2C9D, 0x2C9F, 0x2CA1,
+        0x2CA3, 0x2CA5, 0x2CA7, 0x2CA9, 0x2CAB, 0x2CAD, 0x2CAF, 0x2CB1, 0x2CB3, 0x2CB5, 0x2CB7, 0x2CB9, 0x2CBB, 0x2CBD, 0x2CBF, 0x2CC1,
+        0x2CC3, 0x2CC5, 0x2CC7, 0x2CC9, 0x2CCB, 0x2CCD, 0x2CCF, 0x2CD1, 0x2CD3, 0x2CD5, 0x2CD7, 0x2CD9, 0x2CDB, 0x2CDD, 0x2CDF, 0x2CE1,
+        0x2CE3, 0x2CEC, 0x2CEE, 0x2CF3, 0xA641, 0xA643, 0xA645, 0xA647, 0xA649, 0xA64D, 0xA64F, 0xA651, 0xA653, 0xA655, 0xA657, 0xA659,
+        0xA65B, 0xA65D, 0xA65F, 0xA661, 0xA663, 0xA665, 0xA667, 0xA669, 0xA66B, 0xA66D, 0xA681, 0xA683, 0xA685, 0xA687, 0xA689, 0xA68B,
+        0xA68D, 0xA68F, 0xA691, 0xA693, 0xA695, 0xA697, 0xA699, 0xA69B, 0xA723, 0xA725, 0xA727, 0xA729, 0xA72B, 0xA72D, 0xA72F, 0xA733,
+        0xA735, 0xA737, 0xA739, 0xA73B, 0xA73D, 0xA73F, 0xA741, 0xA743, 0xA745, 0xA747, 0xA749, 0xA74B, 0xA74D, 0xA74F, 0xA751, 0xA753,
+        0xA755, 0xA757, 0xA759, 0xA75B, 0xA75D, 0xA75F, 0xA761, 0xA763, 0xA765, 0xA767, 0xA769, 0xA76B, 0xA76D, 0xA76F, 0xA77A, 0xA77C,
+        0x1D79, 0xA77F, 0xA781, 0xA783, 0xA785, 0xA787, 0xA78C, 0x0265, 0xA791, 0xA793, 0xA797, 0xA799, 0xA79B, 0xA79D, 0xA79F, 0xA7A1,
+        0xA7A3, 0xA7A5, 0xA7A7, 0xA7A9, 0x0266, 0x025C, 0x0261, 0x026C, 0x026A, 0x029E, 0x0287, 0x029D, 0xAB53, 0xA7B5, 0xA7B7, 0xA7B9,
+        0xA7BB, 0xA7BD, 0xA7BF, 0xA7C1, 0xA7C3, 0xA794, 0x0282, 0x1D8E, 0xA7C8, 0xA7CA, 0xA7D1, 0xA7D7, 0xA7D9, 0xA7F6, 0x13A0, 0x13A1,
+        0x13A2, 0x13A3, 0x13A4, 0x13A5, 0x13A6, 0x13A7, 0x13A8, 0x13A9, 0x13AA, 0x13AB, 0x13AC, 0x13AD, 0x13AE, 0x13AF, 0x13B0, 0x13B1,
+        0x13B2, 0x13B3, 0x13B4, 0x13B5, 0x13B6, 0x13B7, 0x13B8, 0x13B9, 0x13BA, 0x13BB, 0x13BC, 0x13BD, 0x13BE, 0x13BF, 0x13C0, 0x13C1,
+        0x13C2, 0x13C3, 0x13C4, 0x13C5, 0x13C6, 0x13C7, 0x13C8, 0x13C9, 0x13CA, 0x13CB, 0x13CC, 0x13CD, 0x13CE, 0x13CF, 0x13D0, 0x13D1,
+        0x13D2, 0x13D3, 0x13D4, 0x13D5, 0x13D6, 0x13D7, 0x13D8, 0x13D9, 0x13DA, 0x13DB, 0x13DC, 0x13DD, 0x13DE, 0x13DF, 0x13E0, 0x13E1,
+        0x13E2, 0x13E3, 0x13E4, 0x13E5, 0x13E6, 0x13E7, 0x13E8, 0x13E9, 0x13EA, 0x13EB, 0x13EC, 0x13ED, 0x13EE, 0x13EF, 0x0066, 0x0066,
+        0x0066, 0x0069, 0x0066, 0x006C, 0x0066, 0x0066, 0x0069, 0x0066, 0x0066, 0x006C, 0x0073, 0x0074, 0x0574, 0x0576, 0x0574, 0x0565,
+        0x0574, 0x056B, 0x057E, 0x0576, 0x0574, 0x056D, 0xFF41, 0xFF42, 0xFF43, 0xFF44, 0xFF45, 0xFF46, 0xFF47, 0xFF48, 0xFF49, 0xFF4A,
+        0xFF4B, 0xFF4C, 0xFF4D, 0xFF4E, 0xFF4F, 0xFF50, 0xFF51, 0xFF52, 0xFF53, 0xFF54, 0xFF55, 0xFF56, 0xFF57, 0xFF58, 0xFF59, 0xFF5A,
+    };
+
+    /** Sorted (First << 16 | Second) keys of primary composites */
+    inline constexpr uint32 CompositionKeys[928] = {
+        0x003C0338, 0x003D0338, 0x003E0338, 0x00410300, 0x00410301, 0x00410302, 0x00410303, 0x00410304,
+        0x00410306, 0x00410307, 0x00410308, 0x00410309, 0x0041030A, 0x0041030C, 0x0041030F, 0x00410311,
+        0x00410323, 0x00410325, 0x00410328, 0x00420307, 0x00420323, 0x00420331, 0x00430301, 0x00430302,
+        0x00430307, 0x0043030C, 0x00430327, 0x00440307, 0x0044030C, 0x00440323, 0x00440327, 0x0044032D,
+        0x00440331, 0x00450300, 0x00450301, 0x00450302, 0x00450303, 0x00450304, 0x00450306, 0x00450307,
+        0x00450308, 0x00450309, 0x0045030C, 0x0045030F, 0x00450311, 0x00450323, 0x00450327, 0x00450328,
+        0x0045032D, 0x00450330, 0x00460307, 0x00470301, 0x00470302, 0x00470304, 0x00470306, 0x00470307,
+        0x0047030C, 0x00470327, 0x00480302, 0x00480307, 0x00480308, 0x0048030C, 0x00480323, 0x00480327,
+        0x0048032E, 0x00490300, 0x00490301, 0x00490302, 0x00490303, 0x00490304, 0x00490306, 0x00490307,
+        0x00490308, 0x00490309, 0x0049030C, 0x0049030F, 0x00490311, 0x00490323, 0x00490328, 0x00490330,
+        0x004A0302, 0x004B0301, 0x004B030C, 0x004B0323, 0x004B0327, 0x004B0331, 0x004C0301, 0x004C030C,
+        0x004C0323, 0x004C0327, 0x004C032D, 0x004C0331, 0x004D0301, 0x004D0307, 0x004D0323, 0x004E0300,
+        0x004E0301, 0x004E0303, 0x004E0307, 0x004E030C, 0x004E0323, 0x004E0327, 0x004E032D, 0x004E0331,
+        0x004F0300, 0x004F0301, 0x004F0302, 0x004F0303, 0x004F0304, 0x004F0306, 0x004F0307, 0x004F0308,
+        0x004F0309, 0x004F030B, 0x004F030C, 0x004F030F, 0x004F0311, 0x004F031B, 0x004F0323, 0x004F0328,
+        0x00500301, 0x00500307, 0x00520301, 0x00520307, 0x0052030C, 0x0052030F, 0x00520311, 0x00520323,
+        0x00520327, 0x00520331, 0x00530301, 0x00530302, 0x00530307, 0x0053030C, 0x00530323, 0x00530326,
+        0x00530327, 0x00540307, 0x0054030C, 0x00540323, 0x00540326, 0x00540327, 0x0054032D, 0x00540331,
+        0x00550300, 0x00550301, 0x00550302, 0x00550303, 0x00550304, 0x00550306, 0x00550308, 0x00550309,
+        0x0055030A, 0x0055030B, 0x0055030C, 0x0055030F, 0x00550311, 0x0055031B, 0x00550323, 0x00550324,
+        0x00550328, 0x0055032D, 0x00550330, 0x00560303, 0x00560323, 0x00570300, 0x00570301, 0x00570302,
+        0x00570307, 0x00570308, 0x00570323, 0x00580307, 0x00580308, 0x00590300, 0x00590301, 0x00590302,
+        0x00590303, 0x00590304, 0x00590307, 0x00590308, 0x00590309, 0x00590323, 0x005A0301, 0x005A0302,
+        0x005A0307, 0x005A030C, 0x005A0323, 0x005A0331, 0x00610300, 0x00610301, 0x00610302, 0x00610303,
+        0x00610304, 0x00610306, 0x00610307, 0x00610308, 0x00610309, 0x0061030A, 0x0061030C, 0x0061030F,
+        0x00610311, 0x00610323, 0x00610325, 0x00610328, 0x00620307, 0x00620323, 0x00620331, 0x00630301,
+        0x00630302, 0x00630307, 0x0063030C, 0x00630327, 0x00640307, 0x0064030C, 0x00640323, 0x00640327,
+        0x0064032D, 0x00640331, 0x00650300, 0x00650301, 0x00650302, 0x00650303, 0x00650304, 0x00650306,
+        0x00650307, 0x00650308, 0x00650309, 0x0065030C, 0x0065030F, 0x00650311, 0x00650323, 0x00650327,
+        0x00650328, 0x0065032D, 0x00650330, 0x00660307, 0x00670301, 0x00670302, 0x00670304, 0x00670306,
+        0x00670307, 0x0067030C, 0x00670327, 0x00680302, 0x00680307, 0x00680308, 0x0068030C, 0x00680323,
+        0x00680327, 0x0068032E, 0x00680331, 0x00690300, 0x00690301, 0x00690302, 0x00690303, 0x00690304,
+        0x00690306, 0x00690308, 0x00690309, 0x0069030C, 0x0069030F, 0x00690311, 0x00690323, 0x00690328,
+        0x00690330, 0x006A0302, 0x006A030C, 0x006B0301, 0x006B030C, 0x006B0323, 0x006B0327, 0x006B0331,
+        0x006C0301, 0x006C030C, 0x006C0323, 0x006C0327, 0x006C032D, 0x006C0331, 0x006D0301, 0x006D0307,
+        0x006D0323, 0x006E0300, 0x006E0301, 0x006E0303, 0x006E0307, 0x006E030C, 0x006E0323, 0x006E0327,
+        0x006E032D, 0x006E0331, 0x006F0300, 0x006F0301, 0x006F0302, 0x006F0303, 0x006F0304, 0x006F0306,
+        0x006F0307, 0x006F0308, 0x006F0309, 0x006F030B, 0x006F030C, 0x006F030F, 0x006F0311, 0x006F031B,
+        0x006F0323, 0x006F0328, 0x00700301, 0x00700307, 0x00720301, 0x00720307, 0x0072030C, 0x0072030F,
+        0x00720311, 0x00720323, 0x00720327, 0x00720331, 0x00730301, 0x00730302, 0x00730307, 0x0073030C,
+        0x00730323, 0x00730326, 0x00730327, 0x00740307, 0x00740308, 0x0074030C, 0x00740323, 0x00740326,
+        0x00740327, 0x0074032D, 0x00740331, 0x00750300, 0x00750301, 0x00750302, 0x00750303, 0x00750304,
+        0x00750306, 0x00750308, 0x00750309, 0x0075030A, 0x0075030B, 0x0075030C, 0x0075030F, 0x00750311,
+        0x0075031B, 0x00750323, 0x00750324, 0x00750328, 0x0075032D, 0x00750330, 0x00760303, 0x00760323,
+        0x00770300, 0x00770301, 0x00770302, 0x00770307, 0x00770308, 0x0077030A, 0x00770323, 0x00780307,
+        0x00780308, 0x00790300, 0x00790301, 0x00790302, 0x00790303, 0x00790304, 0x00790307, 0x00790308,
+        0x00790309, 0x0079030A, 0x00790323, 0x007A0301, 0x007A0302, 0x007A0307, 0x007A030C, 0x007A0323,
+        0x007A0331, 0x00A80300, 0x00A80301, 0x00A80342, 0x00C20300, 0x00C20301, 0x00C20303, 0x00C20309,
+        0x00C40304, 0x00C50301, 0x00C60301, 0x00C60304, 0x00C70301, 0x00CA0300, 0x00CA0301, 0x00CA0303,
+        0x00CA0309, 0x00CF0301, 0x00D40300, 0x00D40301, 0x00D40303, 0x00D40309, 0x00D50301, 0x00D50304,
+        0x00D50308, 0x00D60304, 0x00D80301, 0x00DC0300, 0x00DC0301, 0x00DC0304, 0x00DC030C, 0x00E20300,
+        0x00E20301, 0x00E20303, 0x00E20309, 0x00E40304, 0x00E50301, 0x00E60301, 0x00E60304, 0x00E70301,
+        0x00EA0300, 0x00EA0301, 0x00EA0303, 0x00EA0309, 0x00EF0301, 0x00F40300, 0x00F40301, 0x00F40303,
+        0x00F40309, 0x00F50301, 0x00F50304, 0x00F50308, 0x00F60304, 0x00F80301, 0x00FC0300, 0x00FC0301,
+        0x00FC0304, 0x00FC030C, 0x01020300, 0x01020301, 0x01020303, 0x01020309, 0x01030300, 0x01030301,
+        0x01030303, 0x01030309, 0x01120300, 0x01120301, 0x01130300, 0x01130301, 0x014C0300, 0x014C0301,
+        0x014D0300, 0x014D0301, 0x015A0307, 0x015B0307, 0x01600307, 0x01610307, 0x01680301, 0x01690301,
+        0x016A0308, 0x016B0308, 0x017F0307, 0x01A00300, 0x01A00301, 0x01A00303, 0x01A00309, 0x01A00323,
+        0x01A10300, 0x01A10301, 0x01A10303, 0x01A10309, 0x01A10323, 0x01AF0300, 0x01AF0301, 0x01AF0303,
+        0x01AF0309, 0x01AF0323, 0x01B00300, 0x01B00301, 0x01B00303, 0x01B00309, 0x01B00323, 0x01B7030C,
+        0x01EA0304, 0x01EB0304, 0x02260304, 0x02270304, 0x02280306, 0x02290306, 0x022E0304, 0x022F0304,
+        0x0292030C, 0x03910300, 0x03910301, 0x03910304, 0x03910306, 0x03910313, 0x03910314, 0x03910345,
+        0x03950300, 0x03950301, 0x03950313, 0x03950314, 0x03970300, 0x03970301, 0x03970313, 0x03970314,
+        0x03970345, 0x03990300, 0x03990301, 0x03990304, 0x03990306, 0x03990308, 0x03990313, 0x03990314,
+        0x039F0300, 0x039F0301, 0x039F0313, 0x039F0314, 0x03A10314, 0x03A50300, 0x03A50301, 0x03A50304,
+        0x03A50306, 0x03A50308, 0x03A50314, 0x03A90300, 0x03A90301, 0x03A90313, 0x03A90314, 0x03A90345,
+        0x03AC0345, 0x03AE0345, 0x03B10300, 0x03B10301, 0x03B10304, 0x03B10306, 0x03B10313, 0x03B10314,
+        0x03B10342, 0x03B10345, 0x03B50300, 0x03B50301, 0x03B50313, 0x03B50314, 0x03B70300, 0x03B70301,
+        0x03B70313, 0x03B70314, 0x03B70342, 0x03B70345, 0x03B90300, 0x03B90301, 0x03B90304, 0x03B90306,
+        0x03B90308, 0x03B90313, 0x03B90314, 0x03B90342, 0x03BF0300, 0x03BF0301, 0x03BF0313, 0x03BF0314,
+        0x03C10313, 0x03C10314, 0x03C50300, 0x03C50301, 0x03C50304, 0x03C50306, 0x03C50308, 0x03C50313,
+        0x03C50314, 0x03C50342, 0x03C90300, 0x03C90301, 0x03C90313, 0x03C90314, 0x03C90342, 0x03C90345,
+        0x03CA0300, 0x03CA0301, 0x03CA0342, 0x03CB0300, 0x03CB0301, 0x03CB0342, 0x03CE0345, 0x03D20301,
+        0x03D20308, 0x04060308, 0x04100306, 0x04100308, 0x04130301, 0x04150300, 0x04150306, 0x04150308,
+        0x04160306, 0x04160308, 0x04170308, 0x04180300, 0x04180304, 0x04180306, 0x04180308, 0x041A0301,
+        0x041E0308, 0x04230304, 0x04230306, 0x04230308, 0x0423030B, 0x04270308, 0x042B0308, 0x042D0308,
+        0x04300306, 0x04300308, 0x04330301, 0x04350300, 0x04350306, 0x04350308, 0x04360306, 0x04360308,
+        0x04370308, 0x04380300, 0x04380304, 0x04380306, 0x04380308, 0x043A0301, 0x043E0308, 0x04430304,
+        0x04430306, 0x04430308, 0x0443030B, 0x04470308, 0x044B0308, 0x044D0308, 0x04560308, 0x0474030F,
+        0x0475030F, 0x04D80308, 0x04D90308, 0x04E80308, 0x04E90308, 0x06270653, 0x06270654, 0x06270655,
+        0x06480654, 0x064A0654, 0x06C10654, 0x06D20654, 0x06D50654, 0x0928093C, 0x0930093C, 0x0933093C,
+        0x09C709BE, 0x09C709D7, 0x0B470B3E, 0x0B470B56, 0x0B470B57, 0x0B920BD7, 0x0BC60BBE, 0x0BC60BD7,
+        0x0BC70BBE, 0x0C460C56, 0x0CBF0CD5, 0x0CC60CC2, 0x0CC60CD5, 0x0CC60CD6, 0x0CCA0CD5, 0x0D460D3E,
+        0x0D460D57, 0x0D470D3E, 0x0DD90DCA, 0x0DD90DCF, 0x0DD90DDF, 0x0DDC0DCA, 0x1025102E, 0x1B051B35,
+        0x1B071B35, 0x1B091B35, 0x1B0B1B35, 0x1B0D1B35, 0x1B111B35, 0x1B3A1B35, 0x1B3C1B35, 0x1B3E1B35,
+        0x1B3F1B35, 0x1B421B35, 0x1E360304, 0x1E370304, 0x1E5A0304, 0x1E5B0304, 0x1E620307, 0x1E630307,
+        0x1EA00302, 0x1EA00306, 0x1EA10302, 0x1EA10306, 0x1EB80302, 0x1EB90302, 0x1ECC0302, 0x1ECD0302,
+        0x1F000300, 0x1F000301, 0x1F000342, 0x1F000345, 0x1F010300, 0x1F010301, 0x1F010342, 0x1F010345,
+        0x1F020345, 0x1F030345, 0x1F040345, 0x1F050345, 0x1F060345, 0x1F070345, 0x1F080300, 0x1F080301,
+        0x1F080342, 0x1F080345, 0x1F090300, 0x1F090301, 0x1F090342, 0x1F090345, 0x1F0A0345, 0x1F0B0345,
+        0x1F0C0345, 0x1F0D0345, 0x1F0E0345, 0x1F0F0345, 0x1F100300, 0x1F100301, 0x1F110300, 0x1F110301,
+        0x1F180300, 0x1F180301, 0x1F190300, 0x1F190301, 0x1F200300, 0x1F200301, 0x1F200342, 0x1F200345,
+        0x1F210300, 0x1F210301, 0x1F210342, 0x1F210345, 0x1F220345, 0x1F230345, 0x1F240345, 0x1F250345,
+        0x1F260345, 0x1F270345, 0x1F280300, 0x1F280301, 0x1F280342, 0x1F280345, 0x1F290300, 0x1F290301,
+        0x1F290342, 0x1F290345, 0x1F2A0345, 0x1F2B0345, 0x1F2C0345, 0x1F2D0345, 0x1F2E0345, 0x1F2F0345,
+        0x1F300300, 0x1F300301, 0x1F300342, 0x1F310300, 0x1F310301, 0x1F310342, 0x1F380300, 0x1F380301,
+        0x1F380342, 0x1F390300, 0x1F390301, 0x1F390342, 0x1F400300, 0x1F400301, 0x1F410300, 0x1F410301,
+        0x1F480300, 0x1F480301, 0x1F490300, 0x1F490301, 0x1F500300, 0x1F500301, 0x1F500342, 0x1F510300,
+        0x1F510301, 0x1F510342, 0x1F590300, 0x1F590301, 0x1F590342, 0x1F600300, 0x1F600301, 0x1F600342,
+        0x1F600345, 0x1F610300, 0x1F610301, 0x1F610342, 0x1F610345, 0x1F620345, 0x1F630345, 0x1F640345,
+        0x1F650345, 0x1F660345, 0x1F670345, 0x1F680300, 0x1F680301, 0x1F680342, 0x1F680345, 0x1F690300,
+        0x1F690301, 0x1F690342, 0x1F690345, 0x1F6A0345, 0x1F6B0345, 0x1F6C0345, 0x1F6D0345, 0x1F6E0345,
+        0x1F6F0345, 0x1F700345, 0x1F740345, 0x1F7C0345, 0x1FB60345, 0x1FBF0300, 0x1FBF0301, 0x1FBF0342,
+        0x1FC60345, 0x1FF60345, 0x1FFE0300, 0x1FFE0301, 0x1FFE0342, 0x21900338, 0x21920338, 0x21940338,
+        0x21D00338, 0x21D20338, 0x21D40338, 0x22030338, 0x22080338, 0x220B0338, 0x22230338, 0x22250338,
+        0x223C0338, 0x22430338, 0x22450338, 0x22480338, 0x224D0338, 0x22610338, 0x22640338, 0x22650338,
+        0x22720338, 0x22730338, 0x22760338, 0x22770338, 0x227A0338, 0x227B0338, 0x227C0338, 0x227D0338,
+        0x22820338, 0x22830338, 0x22860338, 0x22870338, 0x22910338, 0x22920338, 0x22A20338, 0x22A80338,
+        0x22A90338, 0x22AB0338, 0x22B20338, 0x22B30338, 0x22B40338, 0x22B50338, 0x30463099, 0x304B3099,
+        0x304D3099, 0x304F3099, 0x30513099, 0x30533099, 0x30553099, 0x30573099, 0x30593099, 0x305B3099,
+        0x305D3099, 0x305F3099, 0x30613099, 0x30643099, 0x30663099, 0x30683099, 0x306F3099, 0x306F309A,
+        0x30723099, 0x3072309A, 0x30753099, 0x3075309A, 0x30783099, 0x3078309A, 0x307B3099, 0x307B309A,
+        0x309D3099, 0x30A63099, 0x30AB3099, 0x30AD3099, 0x30AF3099, 0x30B13099, 0x30B33099, 0x30B53099,
+        0x30B73099, 0x30B93099, 0x30BB3099, 0x30BD3099, 0x30BF3099, 0x30C13099, 0x30C43099, 0x30C63099,
+        0x30C83099, 0x30CF3099, 0x30CF309A, 0x30D23099, 0x30D2309A, 0x30D53099, 0x30D5309A, 0x30D83099,
+        0x30D8309A, 0x30DB3099, 0x30DB309A, 0x30EF3099, 0x30F03099, 0x30F13099, 0x30F23099, 0x30FD3099,
+    };
+
+    /** Composite for each entry of CompositionKeys */
+    inline constexpr uint16 CompositionValues[928] = {
+        0x226E, 0x2260, 0x226F, 0x00C0, 0x00C1, 0x00C2, 0x00C3, 0x0100, 0x0102, 0x0226, 0x00C4, 0x1EA2, 0x00C5, 0x01CD, 0x0200, 0x0202,
+        0x1EA0, 0x1E00, 0x0104, 0x1E02, 0x1E04, 0x1E06, 0x0106, 0x0108, 0x010A, 0x010C, 0x00C7, 0x1E0A, 0x010E, 0x1E0C, 0x1E10, 0x1E12,
+        0x1E0E, 0x00C8, 0x00C9, 0x00CA, 0x1EBC, 0x0112, 0x0114, 0x0116, 0x00CB, 0x1EBA, 0x011A, 0x0204, 0x0206, 0x1EB8, 0x0228, 0x0118,
+        0x1E18, 0x1E1A, 0x1E1E, 0x01F4, 0x011C, 0x1E20, 0x011E, 0x0120, 0x01E6, 0x0122, 0x0124, 0x1E22, 0x1E26, 0x021E, 0x1E24, 0x1E28,
+        0x1E2A, 0x00CC, 0x00CD, 0x00CE, 0x0128, 0x012A, 0x012C, 0x0130, 0x00CF, 0x1EC8, 0x01CF, 0x0208, 0x020A, 0x1ECA, 0x012E, 0x1E2C,
+        0x0134, 0x1E30, 0x01E8, 0x1E32, 0x0136, 0x1E34, 0x0139, 0x013D, 0x1E36, 0x013B, 0x1E3C, 0x1E3A, 0x1E3E, 0x1E40, 0x1E42, 0x01F8,
+        0x0143, 0x00D1, 0x1E44, 0x0147, 0x1E46, 0x0145, 0x1E4A, 0x1E48, 0x00D2, 0x00D3, 0x00D4, 0x00D5, 0x014C, 0x014E, 0x022E, 0x00D6,
+        0x1ECE, 0x0150, 0x01D1, 0x020C, 0x020E, 0x01A0, 0x1ECC, 0x01EA, 0x1E54, 0x1E56, 0x0154, 0x1E58, 0x0158, 0x0210, 0x0212, 0x1E5A,
+        0x0156, 0x1E5E, 0x015A, 0x015C, 0x1E60, 0x0160, 0x1E62, 0x0218, 0x015E, 0x1E6A, 0x0164, 0x1E6C, 0x021A, 0x0162, 0x1E70, 0x1E6E,
+        0x00D9, 0x00DA, 0x00DB, 0x0168, 0x016A, 0x016C, 0x00DC, 0x1EE6, 0x016E, 0x0170, 0x01D3, 0x0214, 0x0216, 0x01AF, 0x1EE4, 0x1E72,
+        0x0172, 0x1E76, 0x1E74, 0x1E7C, 0x1E7E, 0x1E80, 0x1E82, 0x0174, 0x1E86, 0x1E84, 0x1E88, 0x1E8A, 0x1E8C, 0x1EF2, 0x00DD, 0x0176,
+        0x1EF8, 0x0232, 0x1E8E, 0x0178, 0x1EF6, 0x1EF4, 0x0179, 0x1E90, 0x017B, 0x017D, 0x1E92, 0x1E94, 0x00E0, 0x00E1, 0x00E2, 0x00E3,
+        0x0101, 0x0103, 0x0227, 0x00E4, 0x1EA3, 0x00E5, 0x01CE, 0x0201, 0x0203, 0x1EA1, 0x1E01, 0x0105, 0x1E03, 0x1E05, 0x1E07, 0x0107,
+        0x0109, 0x010B, 0x010D, 0x00E7, 0x1E0B, 0x010F, 0x1E0D, 0x1E11, 0x1E13, 0x1E0F, 0x00E8, 0x00E9, 0x00EA, 0x1EBD, 0x0113, 0x0115,
+        0x0117, 0x00EB, 0x1EBB, 0x011B, 0x0205, 0x0207, 0x1EB9, 0x0229, 0x0119, 0x1E19, 0x1E1B, 0x1E1F, 0x01F5, 0x011D, 0x1E21, 0x011F,
+        0x0121, 0x01E7, 0x0123, 0x0125, 0x1E23, 0x1E27, 0x021F, 0x1E25, 0x1E29, 0x1E2B, 0x1E96, 0x00EC, 0x00ED, 0x00EE, 0x0129, 0x012B,
+        0x012D, 0x00EF, 0x1EC9, 0x01D0, 0x0209, 0x020B, 0x1ECB, 0x012F, 0x1E2D, 0x0135, 0x01F0, 0x1E31, 0x01E9, 0x1E33, 0x0137, 0x1E35,
+        0x013A, 0x013E, 0x1E37, 0x013C, 0x1E3D, 0x1E3B, 0x1E3F, 0x1E41, 0x1E43, 0x01F9, 0x0144, 0x00F1, 0x1E45, 0x0148, 0x1E47, 0x0146,
+        0x1E4B, 0x1E49, 0x00F2, 0x00F3, 0x00F4, 0x00F5, 0x014D, 0x014F, 0x022F, 0x00F6, 0x1ECF, 0x0151, 0x01D2, 0x020D, 0x020F, 0x01A1,
+        0x1ECD, 0x01EB, 0x1E55, 0x1E57, 0x0155, 0x1E59, 0x0159, 0x0211, 0x0213, 0x1E5B, 0x0157, 0x1E5F, 0x015B, 0x015D, 0x1E61, 0x0161,
+        0x1E63, 0x0219, 0x015F, 0x1E6B, 0x1E97, 0x0165, 0x1E6D, 0x021B, 0x0163, 0x1E71, 0x1E6F, 0x00F9, 0x00FA, 0x00FB, 0x0169, 0x016B,
+        0x016D, 0x00FC, 0x1EE7, 0x016F, 0x0171, 0x01D4, 0x0215, 0x0217, 0x01B0, 0x1EE5, 0x1E73, 0x0173, 0x1E77, 0x1E75, 0x1E7D, 0x1E7F,
+        0x1E81, 0x1E83, 0x0175, 0x1E87, 0x1E85, 0x1E98, 0x1E89, 0x1E8B, 0x1E8D, 0x1EF3, 0x00FD, 0x0177, 0x1EF9, 0x0233, 0x1E8F, 0x00FF,
+        0x1EF7, 0x1E99, 0x1EF5, 0x017A, 0x1E91, 0x017C, 0x017E, 0x1E93, 0x1E95, 0x1FED, 0x0385, 0x1FC1, 0x1EA6, 0x1EA4, 0x1EAA, 0x1EA8,
+        0x01DE, 0x01FA, 0x01FC, 0x01E2, 0x1E08, 0x1EC0, 0x1EBE, 0x1EC4, 0x1EC2, 0x1E2E, 0x1ED2, 0x1ED0, 0x1ED6, 0x1ED4, 0x1E4C, 0x022C,
+        0x1E4E, 0x022A, 0x01FE, 0x01DB, 0x01D7, 0x01D5, 0x01D9, 0x1EA7, 0x1EA5, 0x1EAB, 0x1EA9, 0x01DF, 0x01FB, 0x01FD, 0x01E3, 0x1E09,
+        0x1EC1, 0x1EBF, 0x1EC5, 0x1EC3, 0x1E2F, 0x1ED3, 0x1ED1, 0x1ED7, 0x1ED5, 0x1E4D, 0x022D, 0x1E4F, 0x022B, 0x01FF, 0x01DC, 0x01D8,
+        0x01D6, 0x01DA, 0x1EB0, 0x1EAE, 0x1EB4, 0x1EB2, 0x1EB1, 0x1EAF, 0x1EB5, 0x1EB3, 0x1E14, 0x1E16, 0x1E15, 0x1E17, 0x1E50, 0x1E52,
+        0x1E51, 0x1E53, 0x1E64, 0x1E65, 0x1E66, 0x1E67, 0x1E78, 0x1E79, 0x1E7A, 0x1E7B, 0x1E9B, 0x1EDC, 0x1EDA, 0x1EE0, 0x1EDE, 0x1EE2,
+        0x1EDD, 0x1EDB, 0x1EE1, 0x1EDF, 0x1EE3, 0x1EEA, 0x1EE8, 0x1EEE, 0x1EEC, 0x1EF0, 0x1EEB, 0x1EE9, 0x1EEF, 0x1EED, 0x1EF1, 0x01EE,
+        0x01EC, 0x01ED, 0x01E0, 0x01E1, 0x1E1C, 0x1E1D, 0x0230, 0x0231, 0x01EF, 0x1FBA, 0x0386, 0x1FB9, 0x1FB8, 0x1F08, 0x1F09, 0x1FBC,
+        0x1FC8, 0x0388, 0x1F18, 0x1F19, 0x1FCA, 0x0389, 0x1F28, 0x1F29, 0x1FCC, 0x1FDA, 0x038A, 0x1FD9, 0x1FD8, 0x03AA, 0x1F38, 0x1F39,
+        0x1FF8, 0x038C, 0x1F48, 0x1F49, 0x1FEC, 0x1FEA, 0x038E, 0x1FE9, 0x1FE8, 0x03AB, 0x1F59, 0x1FFA, 0x038F, 0x1F68, 0x1F69, 0x1FFC,
+        0x1FB4, 0x1FC4, 0x1F70, 0x03AC, 0x1FB1, 0x1FB0, 0x1F00, 0x1F01, 0x1FB6, 0x1FB3, 0x1F72, 0x03AD, 0x1F10, 0x1F11, 0x1F74, 0x03AE,
+        0x1F20, 0x1F21, 0x1FC6, 0x1FC3, 0x1F76, 0x03AF, 0x1FD1, 0x1FD0, 0x03CA, 0x1F30, 0x1F31, 0x1FD6, 0x1F78, 0x03CC, 0x1F40, 0x1F41,
+        0x1FE4, 0x1FE5, 0x1F7A, 0x03CD, 0x1FE1, 0x1FE0, 0x03CB, 0x1F50, 0x1F51, 0x1FE6, 0x1F7C, 0x03CE, 0x1F60, 0x1F61, 0x1FF6, 0x1FF3,
+        0x1FD2, 0x0390, 0x1FD7, 0x1FE2, 0x03B0, 0x1FE7, 0x1FF4, 0x03D3, 0x03D4, 0x0407, 0x04D0, 0x04D2, 0x0403, 0x0400, 0x04D6, 0x0401,
+        0x04C1, 0x04DC, 0x04DE, 0x040D, 0x04E2, 0x0419, 0x04E4, 0x040C, 0x04E6, 0x04EE, 0x040E, 0x04F0, 0x04F2, 0x04F4, 0x04F8, 0x04EC,
+        0x04D1, 0x04D3, 0x0453, 0x0450, 0x04D7, 0x0451, 0x04C2, 0x04DD, 0x04DF, 0x045D, 0x04E3, 0x0439, 0x04E5, 0x045C, 0x04E7, 0x04EF,
+        0x045E, 0x04F1, 0x04F3, 0x04F5, 0x04F9, 0x04ED, 0x0457, 0x0476, 0x0477, 0x04DA, 0x04DB, 0x04EA, 0x04EB, 0x0622, 0x0623, 0x0625,
+        0x0624, 0x0626, 0x06C2, 0x06D3, 0x06C0, 0x0929, 0x0931, 0x0934, 0x09CB, 0x09CC, 0x0B4B, 0x0B48, 0x0B4C, 0x0B94, 0x0BCA, 0x0BCC,
+        0x0BCB, 0x0C48, 0x0CC0, 0x0CCA, 0x0CC7, 0x0CC8, 0x0CCB, 0x0D4A, 0x0D4C, 0x0D4B, 0x0DDA, 0x0DDC, 0x0DDE, 0x0DDD, 0x1026, 0x1B06,
+        0x1B08, 0x1B0A, 0x1B0C, 0x1B0E, 0x1B12, 0x1B3B, 0x1B3D, 0x1B40, 0x1B41, 0x1B43, 0x1E38, 0x1E39, 0x1E5C, 0x1E5D, 0x1E68, 0x1E69,
+        0x1EAC, 0x1EB6, 0x1EAD, 0x1EB7, 0x1EC6, 0x1EC7, 0x1ED8, 0x1ED9, 0x1F02, 0x1F04, 0x1F06, 0x1F80, 0x1F03, 0x1F05, 0x1F07, 0x1F81,
+        0x1F82, 0x1F83, 0x1F84, 0x1F85, 0x1F86, 0x1F87, 0x1F0A, 0x1F0C, 0x1F0E, 0x1F88, 0x1F0B, 0x1F0D, 0x1F0F, 0x1F89, 0x1F8A, 0x1F8B,
+        0x1F8C, 0x1F8D, 0x1F8E, 0x1F8F, 0x1F12, 0x1F14, 0x1F13, 0x1F15, 0x1F1A, 0x1F1C, 0x1F1B, 0x1F1D, 0x1F22, 0x1F24, 0x1F26, 0x1F90,
+        0x1F23, 0x1F25, 0x1F27, 0x1F91, 0x1F92, 0x1F93, 0x1F94, 0x1F95, 0x1F96, 0x1F97, 0x1F2A, 0x1F2C, 0x1F2E, 0x1F98, 0x1F2B, 0x1F2D,
+        0x1F2F, 0x1F99, 0x1F9A, 0x1F9B, 0x1F9C, 0x1F9D, 0x1F9E, 0x1F9F, 0x1F32, 0x1F34, 0x1F36, 0x1F33, 0x1F35, 0x1F37, 0x1F3A, 0x1F3C,
+        0x1F3E, 0x1F3B, 0x1F3D, 0x1F3F, 0x1F42, 0x1F44, 0x1F43, 0x1F45, 0x1F4A, 0x1F4C, 0x1F4B, 0x1F4D, 0x1F52, 0x1F54, 0x1F56, 0x1F53,
+        0x1F55, 0x1F57, 0x1F5B, 0x1F5D, 0x1F5F, 0x1F62, 0x1F64, 0x1F66, 0x1FA0, 0x1F63, 0x1F65, 0x1F67, 0x1FA1, 0x1FA2, 0x1FA3, 0x1FA4,
+        0x1FA5, 0x1FA6, 0x1FA7, 0x1F6A, 0x1F6C, 0x1F6E, 0x1FA8, 0x1F6B, 0x1F6D, 0x1F6F, 0x1FA9, 0x1FAA, 0x1FAB, 0x1FAC, 0x1FAD, 0x1FAE,
+        0x1FAF, 0x1FB2, 0x1FC2, 0x1FF2, 0x1FB7, 0x1FCD, 0x1FCE, 0x1FCF, 0x1FC7, 0x1FF7, 0x1FDD, 0x1FDE, 0x1FDF, 0x219A, 0x219B, 0x21AE,
+        0x21CD, 0x21CF, 0x21CE, 0x2204, 0x2209, 0x220C, 0x2224, 0x2226, 0x2241, 0x2244, 0x2247, 0x2249, 0x226D, 0x2262, 0x2270, 0x2271,
+        0x2274, 0x2275, 0x2278, 0x2279, 0x2280, 0x2281, 0x22E0, 0x22E1, 0x2284, 0x2285, 0x2288, 0x2289, 0x22E2, 0x22E3, 0x22AC, 0x22AD,
+        0x22AE, 0x22AF, 0x22EA, 0x22EB, 0x22EC, 0x22ED, 0x3094, 0x304C, 0x304E, 0x3050, 0x3052, 0x3054, 0x3056, 0x3058, 0x305A, 0x305C,
+        0x305E, 0x3060, 0x3062, 0x3065, 0x3067, 0x3069, 0x3070, 0x3071, 0x3073, 0x3074, 0x3076, 0x3077, 0x3079, 0x307A, 0x307C, 0x307D,
+        0x309E, 0x30F4, 0x30AC, 0x30AE, 0x30B0, 0x30B2, 0x30B4, 0x30B6, 0x30B8, 0x30BA, 0x30BC, 0x30BE, 0x30C0, 0x30C2, 0x30C5, 0x30C7,
+        0x30C9, 0x30D0, 0x30D1, 0x30D3, 0x30D4, 0x30D6, 0x30D7, 0x30D9, 0x30DA, 0x30DC, 0x30DD, 0x30F7, 0x30F8, 0x30F9, 0x30FA, 0x30FE,
+    };
+}
@@ -0,0 +1,175 @@
+// Source/ReasoningEngine/Private/Infrastructure/REVocabularyMatcher.cpp
+#include "Infrastructure/REVocabularyMatcher.h"
+#include "Infrastructure/RENormalizer.h"
+#include "Infrastructure/REPackedTokenStream.h"
+#include "Algo/BinarySearch.h"
+
+FREVocabularyMatcher::FREVocabularyMatcher(const TArray<FREVocabularyEntry>& Entries)
+{
+    Compile(Entries);
+}
+
+void FREVocabularyMatcher::Compile(const TArray<FREVocabularyEntry>& Entries)
+{
+    Nodes.Reset();
+    Edges.Reset();
+    Terms.Reset(Entries.Num());
+    
+    Nodes.AddDefaulted();  // Root
+    
+    // Parent and character of each node, for the breadth-first pass
+    TArray<int32> Parents = { INDEX_NONE };
+    TArray<TCHAR> Chars = { 0 };
+    
+    for (int32 EntryIndex = 0; EntryIndex < Entries.Num(); EntryIndex++)
+    {
+        Terms.Add(Entries[EntryIndex].Term);
+        
+        int32 Node = 0;
+        for (TCHAR Char : RENormalizer::ToLowercase(Entries[EntryIndex].Term))
+        {
+            if (IsSeparator(Char))
+            {
+                continue;
+            }
+            
+            const uint64 Key = EdgeKey(Node, Char);
+            if (const int32* Child = Edges.Find(Key))
+            {
+                Node = *Child;
+                continue;
+            }
+            
+            const int32 Child = Nodes.AddDefaulted();
+            Nodes[Child].Depth = Nodes[Node].Depth + 1;
+            Parents.Add(Node);
+            Chars.Add(Char);
+            Edges.Add(Key, Child);
+            Node = Child;
+        }
+        
+        if (Node != 0 && Nodes[Node].Output == INDEX_NONE)
+        {
+            Nodes[Node].Output = EntryIndex;
+        }
+    }
+    
+    // Nodes were created in insertion order, not by depth - sort for BFS
+    TArray<int32> Order;
+    Order.Reserve(Nodes.Num() - 1);
+    for (int32 Node = 1; Node < Nodes.Num(); Node++)
+    {
+        Order.Add(Node);
+    }
+    Order.Sort([this](int32 A, int32 B) { return Nodes[A].Depth < Nodes[B].Depth; });
+    
+    for (int32 Node : Order)
+    {
+        const int32 Parent = Parents[Node];
+        FNode& Current = Nodes[Node];
+        
+        Current.Fail = Parent == 0 ? 0 : Step(Nodes[Parent].Fail, Chars[Node]);
+        
+        const FNode& Fail = Nodes[Current.Fail];
+        Current.OutputLink = Fail.Output != INDEX_NONE ? Current.Fail : Fail.OutputLink;
+    }
+}
+
+int32 FREVocabularyMatcher::Step(int32 Node, TCHAR Char) const
+{
+    while (true)
+    {
+        if (const int32* Child = Edges.Find(EdgeKey(Node, Char)))
+        {
+            return *Child;
+        }
+        if (Node == 0)
+        {
+            return 0;
+        }
+        Node = Nodes[Node].Fail;
+    }
+}
+
+void FREVocabularyMatcher::FindMatches(
+    TArrayView<const FREToken> Tokens,
+    int32 MinTokens,
+    TArray<FMatch>& OutMatches) const
+{
+    FindMatches(Tokens.Num(), [Tokens](int32 TokenIndex) { return FStringView(Tokens[TokenIndex].NormalizedText); }, MinTokens, OutMatches);
+}
+
+void FREVocabularyMatcher::FindMatches(
+    const FREPackedTokenStream& Stream,
+    int32 MinTokens,
+    TArray<FMatch>& OutMatches) const
+{
+    FindMatches(Stream.Num(), [&Stream](int32 TokenIndex) { return FStringView(Stream.GetNormalizedText(TokenIndex)); }, MinTokens, OutMatches);
+}
+
+void FREVocabularyMatcher::FindMatches(
+    int32 NumTokens,
+    TFunctionRef<FStringView(int32 TokenIndex)> GetText,
+    int32 MinTokens,
+    TArray<FMatch>& OutMatches) const
+{
+    OutMatches.Reset();
+    
+    if (IsEmpty() || NumTokens == 0)
+    {
+        return;
+    }
+    
+    // Start offset of each token in the separator-free character stream
+    TArray<int32> TokenStarts;
+    TokenStarts.Reserve(NumTokens);
+    
+    int32 Position = 0;
+    int32 Node = 0;
+    
+    for (int32 TokenIndex = 0; TokenIndex < NumTokens; TokenIndex++)
+    {
+        TokenStarts.Add(Position);
+        
+        const int32 TokenStart = Position;
+        for (TCHAR Char : GetText(TokenIndex))
+        {
+            if (!IsSeparator(Char))
+            {
+                Node = Step(Node, Char);
+                Position++;
+            }
+        }
+        
+        if (Position == TokenStart)
+        {
+            continue;
+        }
+        
+        // Matches only count when they end on a token boundary
+        for (int32 Out = Nodes[Node].Output != INDEX_NONE ? Node : Nodes[Node].OutputLink;
+             Out != INDEX_NONE;
+             Out = Nodes[Out].OutputLink)
+        {
+            const int32 MatchStart = Position - Nodes[Out].Depth;
+            const int32 FirstToken = Algo::UpperBound(TokenStarts, MatchStart) - 1;
+            
+            if (FirstToken >= 0 && TokenStarts[FirstToken] == MatchStart)
+            {
+                const int32 RunLength = TokenIndex - FirstToken + 1;
+                if (RunLength >= MinTokens)
+                {
+                    FMatch& Match = OutMatches.AddDefaulted_GetRef();
+                    Match.EntryIndex = Nodes[Out].Output;
+                    Match.FirstToken = FirstToken;
+                    Match.NumTokens = RunLength;
+                }
+            }
+        }
+    }
+    
+    OutMatches.Sort([](const FMatch& A, const FMatch& B)
+    {
+        return A.FirstToken != B.FirstToken ? A.FirstToken < B.FirstToken : A.NumTokens < B.NumTokens;
+    });
+}
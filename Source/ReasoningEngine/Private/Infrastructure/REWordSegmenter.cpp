@@ -0,0 +1,246 @@
+// Source/ReasoningEngine/Private/Infrastructure/REWordSegmenter.cpp
+#include "Infrastructure/REWordSegmenter.h"
+#include "Misc/ScopeRWLock.h"
+#include "Algo/Reverse.h"
+#include "Hash/CityHash.h"
+
+namespace
+{
+    uint64 HashWordCount(FStringView LowerWord, uint32 Count)
+    {
+        return CityHash64WithSeed(reinterpret_cast<const char*>(LowerWord.GetData()), LowerWord.Len() * sizeof(TCHAR), Count);
+    }
+}
+
+FREWordSegmenter::FREWordSegmenter()
+{
+    Nodes.AddDefaulted();  // Root
+}
+
+FREWordSegmenter& FREWordSegmenter::GetDefault()
+{
+    static FREWordSegmenter Default;
+    static const bool bSeeded = []()
+    {
+        // Rough relative frequencies in animation asset names
+        static const TPair<const TCHAR*, uint32> Seed[] = {
+            // Locomotion
+            {TEXT("walk"), 400}, {TEXT("run"), 400}, {TEXT("jog"), 150}, {TEXT("sprint"), 150},
+            {TEXT("idle"), 400}, {TEXT("jump"), 300}, {TEXT("land"), 200}, {TEXT("fall"), 200},
+            {TEXT("crouch"), 150}, {TEXT("crawl"), 80}, {TEXT("climb"), 100}, {TEXT("swim"), 80},
+            {TEXT("turn"), 250}, {TEXT("strafe"), 120}, {TEXT("stop"), 200}, {TEXT("start"), 200},
+            {TEXT("step"), 120}, {TEXT("slide"), 80}, {TEXT("roll"), 100}, {TEXT("dodge"), 100},
+            {TEXT("pivot"), 80}, {TEXT("lean"), 60}, {TEXT("stand"), 120}, {TEXT("sit"), 80},
+            // Direction and modifiers
+            {TEXT("forward"), 300}, {TEXT("backward"), 200}, {TEXT("back"), 150}, {TEXT("left"), 300},
+            {TEXT("right"), 300}, {TEXT("up"), 150}, {TEXT("down"), 150}, {TEXT("fast"), 120},
+            {TEXT("slow"), 120}, {TEXT("loop"), 300}, {TEXT("in"), 100}, {TEXT("out"), 100},
+            {TEXT("to"), 60}, {TEXT("from"), 40}, {TEXT("end"), 100}, {TEXT("mid"), 40},
+            {TEXT("high"), 60}, {TEXT("low"), 60}, {TEXT("heavy"), 50}, {TEXT("light"), 50},
+            // Actions
+            {TEXT("attack"), 200}, {TEXT("hit"), 150}, {TEXT("death"), 100}, {TEXT("die"), 60},
+            {TEXT("react"), 80}, {TEXT("block"), 80}, {TEXT("fire"), 80}, {TEXT("reload"), 80},
+            {TEXT("aim"), 80}, {TEXT("equip"), 60}, {TEXT("punch"), 60}, {TEXT("kick"), 60},
+            {TEXT("swing"), 60}, {TEXT("throw"), 60}, {TEXT("grab"), 60}, {TEXT("pick"), 40},
+            {TEXT("open"), 40}, {TEXT("close"), 40}, {TEXT("use"), 40}, {TEXT("talk"), 40},
+            // Subjects and common abbreviations
+            {TEXT("anim"), 150}, {TEXT("pose"), 100}, {TEXT("blend"), 80}, {TEXT("space"), 60},
+            {TEXT("mm"), 200}, {TEXT("bs"), 80}, {TEXT("fwd"), 120}, {TEXT("bwd"), 80},
+            {TEXT("lf"), 40}, {TEXT("rf"), 40}, {TEXT("rifle"), 80}, {TEXT("pistol"), 60},
+            {TEXT("sword"), 60}, {TEXT("shield"), 40}, {TEXT("unarmed"), 60}, {TEXT("weapon"), 40},
+            {TEXT("char"), 40}, {TEXT("character"), 40}, {TEXT("root"), 60}, {TEXT("motion"), 60},
+            {TEXT("additive"), 40}, {TEXT("base"), 40}, {TEXT("full"), 40}, {TEXT("body"), 40},
+            {TEXT("upper"), 40}, {TEXT("lower"), 40}, {TEXT("head"), 40}, {TEXT("hand"), 40},
+            {TEXT("foot"), 40}, {TEXT("arm"), 40}, {TEXT("leg"), 40}
+        };
+        
+        for (const TPair<const TCHAR*, uint32>& Word : Seed)
+        {
+            Default.AddWord(Word.Key, Word.Value);
+        }
+        return true;
+    }();
+    
+    (void)bSeeded;
+    return Default;
+}
+
+void FREWordSegmenter::AddWord(FStringView Word, uint32 Count)
+{
+    if (Word.IsEmpty() || Count == 0)
+    {
+        return;
+    }
+    
+    TStringBuilder<64> Lower;
+    for (TCHAR Char : Word)
+    {
+        Lower.AppendChar(FChar::ToLower(Char));
+    }
+    
+    FWriteScopeLock WriteLock(Lock);
+    
+    int32 Node = 0;
+    for (TCHAR Char : Lower.ToView())
+    {
+        const uint64 Key = EdgeKey(Node, Char);
+        if (const int32* Child = Edges.Find(Key))
+        {
+            Node = *Child;
+        }
+        else
+        {
+            const int32 Child = Nodes.AddDefaulted();
+            Edges.Add(Key, Child);
+            Node = Child;
+        }
+    }
+    
+    if (Nodes[Node].Count == 0)
+    {
+        NumWords++;
+    }
+    else
+    {
+        VocabularyHash -= HashWordCount(Lower.ToView(), Nodes[Node].Count);
+    }
+    Nodes[Node].Count += Count;
+    VocabularyHash += HashWordCount(Lower.ToView(), Nodes[Node].Count);
+    TotalCount += Count;
+    MaxWordLength = FMath::Max(MaxWordLength, Word.Len());
+}
+
+void FREWordSegmenter::AddVocabulary(const TArray<FREVocabularyEntry>& Entries, uint32 Count)
+{
+    for (const FREVocabularyEntry& Entry : Entries)
+    {
+        TArray<FString> Words;
+        Entry.Term.ParseIntoArrayWS(Words, TEXT("_-"));
+        for (const FString& Word : Words)
+        {
+            AddWord(Word, Count);
+        }
+    }
+}
+
+bool FREWordSegmenter::Segment(FStringView Text, TArray<FSegment>& OutSegments) const
+{
+    OutSegments.Reset();
+    
+    const int32 Len = Text.Len();
+    if (Len == 0)
+    {
+        return false;
+    }
+    
+    FReadScopeLock ReadLock(Lock);
+    
+    if (TotalCount == 0)
+    {
+        OutSegments.Add(FSegment{ 0, Len, false });
+        return false;
+    }
+    
+    // An unknown character is ten times less likely than the rarest word,
+    // so any covering word beats spelling it out
+    const double LogTotal = FMath::Loge(static_cast<double>(TotalCount));
+    const double UnknownScore = -LogTotal - FMath::Loge(10.0);
+    
+    // Best[i] = best score for Text[0, i); Back[i] = start of its last segment
+    TArray<double, TInlineAllocator<64>> Best;
+    TArray<int32, TInlineAllocator<64>> Back;
+    TArray<bool, TInlineAllocator<64>> Known;
+    Best.Init(-DBL_MAX, Len + 1);
+    Back.Init(0, Len + 1);
+    Known.Init(false, Len + 1);
+    Best[0] = 0.0;
+    
+    for (int32 Start = 0; Start < Len; Start++)
+    {
+        const double Base = Best[Start];
+        
+        // Unknown single character
+        if (Base + UnknownScore > Best[Start + 1])
+        {
+            Best[Start + 1] = Base + UnknownScore;
+            Back[Start + 1] = Start;
+            Known[Start + 1] = false;
+        }
+        
+        // Every vocabulary word starting here
+        const int32 Limit = FMath::Min(Len, Start + MaxWordLength);
+        int32 Node = 0;
+        for (int32 End = Start; End < Limit; End++)
+        {
+            const int32* Child = Edges.Find(EdgeKey(Node, FChar::ToLower(Text[End])));
+            if (!Child)
+            {
+                break;
+            }
+            Node = *Child;
+            
+            if (const uint32 Count = Nodes[Node].Count)
+            {
+                const double Score = Base + FMath::Loge(static_cast<double>(Count)) - LogTotal;
+                if (Score > Best[End + 1])
+                {
+                    Best[End + 1] = Score;
+                    Back[End + 1] = Start;
+                    Known[End + 1] = true;
+                }
+            }
+        }
+    }
+    
+    // Walk back, merging adjacent unknown characters
+    for (int32 End = Len; End > 0; End = Back[End])
+    {
+        const int32 Start = Back[End];
+        if (!Known[End] && OutSegments.Num() > 0 && !OutSegments.Last().bKnown)
+        {
+            FSegment& Merged = OutSegments.Last();
+            Merged.Len += Merged.Start - Start;
+            Merged.Start = Start;
+        }
+        else
+        {
+            OutSegments.Add(FSegment{ Start, End - Start, Known[End] });
+        }
+    }
+    Algo::Reverse(OutSegments);
+    
+    return OutSegments.Num() > 1;
+}
+
+TArray<FString> FREWordSegmenter::SegmentToStrings(const FString& Text) const
+{
+    TArray<FString> Result;
+    TArray<FSegment> Segments;
+    
+    // Only split names the vocabulary fully explains; a stray unknown run
+    // usually means the name holds a word the vocabulary lacks
+    if (!Segment(Text, Segments) || Segments.ContainsByPredicate([](const FSegment& Piece) { return !Piece.bKnown; }))
+    {
+        Result.Add(Text);
+        return Result;
+    }
+    
+    Result.Reserve(Segments.Num());
+    for (const FSegment& Piece : Segments)
+    {
+        Result.Add(Text.Mid(Piece.Start, Piece.Len));
+    }
+    return Result;
+}
+
+int32 FREWordSegmenter::Num() const
+{
+    FReadScopeLock ReadLock(Lock);
+    return NumWords;
+}
+
+uint64 FREWordSegmenter::GetVocabularyHash() const
+{
+    FReadScopeLock ReadLock(Lock);
+    return VocabularyHash;
+}
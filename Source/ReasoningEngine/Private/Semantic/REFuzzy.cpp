@@ -1,5 +1,6 @@
 #include "Semantic/REFuzzy.h"
 #include "Infrastructure/RENormalizer.h"
+#include "Infrastructure/RENormalizedFormTable.h"
 #include "ReasoningEngine.h"
 #include "Algo/LevenshteinDistance.h"  // Unreal's built-in for optimization
 
@@ -103,10 +104,29 @@ void REFuzzy::InitializePhoneticMaps()
 }
 
 FString REFuzzy::PrepareString(const FString& Input, bool bNormalize)
+{
+    return bNormalize ? RENormalizer::NormalizeText(Input) : Input;
+}
+
+FRENormalizedHandle REFuzzy::PrepareHandle(const FString& Input, FRENormalizedFormTable& Forms)
+{
+    return Forms.Intern(Input);
+}
+
+const FString& REFuzzy::ResolvePrepared(FRENormalizedHandle Handle, const FRENormalizedFormTable& Forms)
+{
+    // Invalid handles (full table) compare as empty text
+    static const FString Empty;
+    return Handle.IsValid() ? Forms.Resolve(Handle) : Empty;
+}
+
+const FString& REFuzzy::PrepareStringRef(const FString& Input, bool bNormalize, FString& Storage)
 {
     if (bNormalize)
     {
-        return URENormalizer::Normalize(Input);
+        // Not interned - arbitrary comparison inputs would grow a shared table without bound
+        Storage = RENormalizer::NormalizeText(Input);
+        return Storage;
     }
     return Input;
 }
@@ -121,12 +141,36 @@ FREStringMatch REFuzzy::CompareStrings(const FString& A, const FString& B, bool
     Result.StringA = A;
     Result.StringB = B;
     
-    // Prepare strings
-    FString PreparedA = PrepareString(A, bNormalize);
-    FString PreparedB = PrepareString(B, bNormalize);
+    // Prepare strings (copied only when normalizing)
+    FString StorageA, StorageB;
+    const FString& PreparedA = PrepareStringRef(A, bNormalize, StorageA);
+    const FString& PreparedB = PrepareStringRef(B, bNormalize, StorageB);
+    
+    ComparePrepared(PreparedA, PreparedB, PreparedA.Equals(PreparedB), StartTime, Result);
+    return Result;
+}
+
+FREStringMatch REFuzzy::CompareStrings(FRENormalizedHandle A, FRENormalizedHandle B, const FRENormalizedFormTable& Forms)
+{
+    double StartTime = FPlatformTime::Seconds();
+    
+    // Already normalized by the table - no preparation pass
+    const FString& PreparedA = ResolvePrepared(A, Forms);
+    const FString& PreparedB = ResolvePrepared(B, Forms);
+    
+    FREStringMatch Result;
+    Result.StringA = PreparedA;
+    Result.StringB = PreparedB;
     
+    ComparePrepared(PreparedA, PreparedB, A.IsValid() && A == B, StartTime, Result);
+    return Result;
+}
+
+void REFuzzy::ComparePrepared(const FString& PreparedA, const FString& PreparedB, bool bEqual,
+                              double StartTime, FREStringMatch& Result)
+{
     // Special cases
-    if (PreparedA.Equals(PreparedB))
+    if (bEqual)
     {
         Result.NormalizedLevenshtein = 1.0f;
         Result.JaroWinklerSimilarity = 1.0f;
@@ -136,13 +180,13 @@ FREStringMatch REFuzzy::CompareStrings(const FString& A, const FString& B, bool
         Result.bSoundexMatch = true;
         Result.bMetaphoneMatch = true;
         Result.ComputationTimeMS = (FPlatformTime::Seconds() - StartTime) * 1000.0f;
-        return Result;
+        return;
     }
     
     if (PreparedA.IsEmpty() || PreparedB.IsEmpty())
     {
         Result.ComputationTimeMS = (FPlatformTime::Seconds() - StartTime) * 1000.0f;
-        return Result;
+        return;
     }
     
     // Calculate all metrics
@@ -191,8 +235,6 @@ FREStringMatch REFuzzy::CompareStrings(const FString& A, const FString& B, bool
     Result.KeyboardDistance = CalculateKeyboardDistance(PreparedA, PreparedB);
     
     Result.ComputationTimeMS = (FPlatformTime::Seconds() - StartTime) * 1000.0f;
-    
-    return Result;
 }
 
 FREStringMatch REFuzzy::CompareStringsWithAlgo(
@@ -248,10 +290,24 @@ FREStringMatch REFuzzy::CompareStringsWithAlgo(
 float REFuzzy::GetSimilarity(const FString& A, const FString& B, 
                               EREFuzzyAlgorithm Algorithm, bool bNormalize)
 {
-    FString PreparedA = PrepareString(A, bNormalize);
-    FString PreparedB = PrepareString(B, bNormalize);
+    FString StorageA, StorageB;
+    const FString& PreparedA = PrepareStringRef(A, bNormalize, StorageA);
+    const FString& PreparedB = PrepareStringRef(B, bNormalize, StorageB);
     
-    if (PreparedA.Equals(PreparedB))
+    return GetPreparedSimilarity(PreparedA, PreparedB, PreparedA.Equals(PreparedB), Algorithm);
+}
+
+float REFuzzy::GetSimilarity(FRENormalizedHandle A, FRENormalizedHandle B,
+                              const FRENormalizedFormTable& Forms, EREFuzzyAlgorithm Algorithm)
+{
+    return GetPreparedSimilarity(ResolvePrepared(A, Forms), ResolvePrepared(B, Forms),
+                                 A.IsValid() && A == B, Algorithm);
+}
+
+float REFuzzy::GetPreparedSimilarity(const FString& PreparedA, const FString& PreparedB, bool bEqual,
+                                     EREFuzzyAlgorithm Algorithm)
+{
+    if (bEqual)
         return 1.0f;
     
     if (PreparedA.IsEmpty() || PreparedB.IsEmpty())
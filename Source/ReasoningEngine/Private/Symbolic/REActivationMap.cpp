@@ -0,0 +1,282 @@
+// Source/ReasoningEngine/Private/Symbolic/REActivationMap.cpp
+#include "Symbolic/REActivationMap.h"
+#include "Symbolic/REConceptGraph.h"
+#include "Algo/Sort.h"
+#include "Async/ParallelFor.h"
+
+namespace
+{
+    /** Frontier entries expanded by one task when pushing */
+    constexpr int32 PushBatchSize = 64;
+
+    /** Nodes gathered by one task when pulling */
+    constexpr int32 PullBatchSize = 1024;
+
+    /** Pull once the frontier holds more than 1/PullFraction of the nodes */
+    constexpr int32 PullFraction = 16;
+}
+
+// ========== ACTIVATION ==========
+
+void FREActivationMap::Spread(const FREConceptGraph& Graph, int32 Start, float Strength, int32 MaxHops,
+                              TFunctionRef<void(int32 Node, float Activation)> OnChanged)
+{
+    if (Start < 0 || Start >= Graph.NumNodes() || !(Strength > 0.0f))
+    {
+        return;
+    }
+
+    Reserve(Graph.NumNodes());
+    const float Transfer = 1.0f - DecayRate;
+
+    Frontier.Reset();
+    Frontier.Add(FEntry{ Start, Strength });
+
+    for (int32 Hop = 0; ; ++Hop)
+    {
+        Apply(OnChanged);
+        if (Hop >= MaxHops || Transfer <= 0.0f)
+        {
+            break;
+        }
+
+        // Pushing costs the frontier's out-degree, pulling the whole graph's
+        // in-degree; pull only once the frontier is a sizeable share of it
+        if (static_cast<int64>(Frontier.Num()) * PullFraction > Graph.NumNodes())
+        {
+            Pull(Graph, Transfer);
+        }
+        else
+        {
+            Push(Graph, Transfer);
+        }
+
+        Swap(Frontier, Next);
+        if (Frontier.Num() == 0)
+        {
+            break;
+        }
+    }
+}
+
+void FREActivationMap::Set(int32 Node, float Level)
+{
+    if (Node < 0)
+    {
+        return;
+    }
+
+    Reserve(Node + 1);
+    const float Old = Activation[Node];
+    const float New = FMath::Clamp(Level, 0.0f, 1.0f);
+    if (Old == 0.0f && New > 0.0f)
+    {
+        ActiveNodes.Add(Node);
+    }
+    else if (Old > 0.0f && New == 0.0f)
+    {
+        ActiveNodes.RemoveSingleSwap(Node, EAllowShrinking::No);
+    }
+    Activation[Node] = New;
+}
+
+void FREActivationMap::GetMostActive(int32 Count, TFunctionRef<bool(int32 Node)> Filter, TArray<int32>& OutNodes) const
+{
+    OutNodes.Reset();
+    if (Count <= 0)
+    {
+        return;
+    }
+
+    // Ties go to the lower node id so results are deterministic
+    auto Stronger = [this](int32 A, int32 B)
+    {
+        return Activation[A] != Activation[B] ? Activation[A] > Activation[B] : A < B;
+    };
+    auto Weaker = [&Stronger](int32 A, int32 B)
+    {
+        return Stronger(B, A);
+    };
+
+    // Min-heap of the best Count so far; its top is the weakest kept node
+    for (int32 Node : ActiveNodes)
+    {
+        if (!Filter(Node))
+        {
+            continue;
+        }
+
+        if (OutNodes.Num() < Count)
+        {
+            OutNodes.HeapPush(Node, Weaker);
+        }
+        else if (Stronger(Node, OutNodes.HeapTop()))
+        {
+            OutNodes.HeapPopDiscard(Weaker, EAllowShrinking::No);
+            OutNodes.HeapPush(Node, Weaker);
+        }
+    }
+
+    Algo::Sort(OutNodes, Stronger);
+}
+
+// ========== MAINTENANCE ==========
+
+void FREActivationMap::Reset()
+{
+    Activation.Empty();
+    ActiveNodes.Empty();
+    Frontier.Empty();
+    Next.Empty();
+    FrontierValue.Empty();
+    NextValue.Empty();
+    TaskOutputs.Empty();
+}
+
+SIZE_T FREActivationMap::GetAllocatedSize() const
+{
+    SIZE_T Size = Activation.GetAllocatedSize() + ActiveNodes.GetAllocatedSize()
+                + Frontier.GetAllocatedSize() + Next.GetAllocatedSize()
+                + FrontierValue.GetAllocatedSize() + NextValue.GetAllocatedSize()
+                + TaskOutputs.GetAllocatedSize();
+    for (const TArray<FEntry>& Output : TaskOutputs)
+    {
+        Size += Output.GetAllocatedSize();
+    }
+    return Size;
+}
+
+// ========== SPREADING ==========
+
+void FREActivationMap::Reserve(int32 NumNodes)
+{
+    if (Activation.Num() < NumNodes)
+    {
+        Activation.SetNumZeroed(NumNodes);
+        FrontierValue.SetNumZeroed(NumNodes);
+        NextValue.SetNumZeroed(NumNodes);
+    }
+}
+
+void FREActivationMap::Apply(TFunctionRef<void(int32 Node, float Activation)> OnChanged)
+{
+    for (const FEntry& Entry : Frontier)
+    {
+        float& Level = Activation[Entry.Node];
+        const float New = FMath::Min(1.0f, Level + Entry.Value);
+        if (New == Level)
+        {
+            continue;
+        }
+
+        if (Level == 0.0f)
+        {
+            ActiveNodes.Add(Entry.Node);
+        }
+        Level = New;
+        OnChanged(Entry.Node, New);
+    }
+}
+
+void FREActivationMap::Push(const FREConceptGraph& Graph, float Transfer)
+{
+    const int32 NumTasks = FMath::DivideAndRoundUp(Frontier.Num(), PushBatchSize);
+    if (TaskOutputs.Num() < NumTasks)
+    {
+        TaskOutputs.SetNum(NumTasks);
+    }
+
+    ParallelFor(NumTasks, [&](int32 Task)
+    {
+        TArray<FEntry>& Output = TaskOutputs[Task];
+        Output.Reset();
+
+        const int32 Last = FMath::Min((Task + 1) * PushBatchSize, Frontier.Num());
+        for (int32 Index = Task * PushBatchSize; Index < Last; ++Index)
+        {
+            const FEntry Source = Frontier[Index];
+            Graph.ForEachOutEdge(Source.Node, FREConceptGraph::AnyType, [&](const FREConceptGraph::FEdge& Edge)
+            {
+                const float Passed = Source.Value * Edge.Strength * Transfer;
+                if (Passed >= Threshold)
+                {
+                    Output.Add(FEntry{ Edge.Node, Passed });
+                }
+                return true;
+            });
+        }
+    }, NumTasks <= 1);
+
+    // Several sources may reach a node; the strongest arrival counts
+    Next.Reset();
+    for (int32 Task = 0; Task < NumTasks; ++Task)
+    {
+        for (const FEntry& Entry : TaskOutputs[Task])
+        {
+            float& Best = NextValue[Entry.Node];
+            if (Best == 0.0f)
+            {
+                Next.Add(FEntry{ Entry.Node, 0.0f });
+            }
+            Best = FMath::Max(Best, Entry.Value);
+        }
+    }
+    for (FEntry& Entry : Next)
+    {
+        Entry.Value = NextValue[Entry.Node];
+        NextValue[Entry.Node] = 0.0f;
+    }
+}
+
+void FREActivationMap::Pull(const FREConceptGraph& Graph, float Transfer)
+{
+    for (const FEntry& Entry : Frontier)
+    {
+        FrontierValue[Entry.Node] = Entry.Value;
+    }
+
+    // Every node gathers from its in-edges, so each task writes only its own nodes
+    const int32 NumNodes = Graph.NumNodes();
+    const int32 NumTasks = FMath::DivideAndRoundUp(NumNodes, PullBatchSize);
+    if (TaskOutputs.Num() < NumTasks)
+    {
+        TaskOutputs.SetNum(NumTasks);
+    }
+
+    ParallelFor(NumTasks, [&](int32 Task)
+    {
+        TArray<FEntry>& Output = TaskOutputs[Task];
+        Output.Reset();
+
+        const int32 Last = FMath::Min((Task + 1) * PullBatchSize, NumNodes);
+        for (int32 Node = Task * PullBatchSize; Node < Last; ++Node)
+        {
+            float Best = 0.0f;
+            Graph.ForEachInEdge(Node, FREConceptGraph::AnyType, [&](const FREConceptGraph::FEdge& Edge)
+            {
+                const float Source = FrontierValue[Edge.Node];
+                if (Source > 0.0f)
+                {
+                    Best = FMath::Max(Best, Source * Edge.Strength * Transfer);
+                }
+                return true;
+            });
+
+            if (Best >= Threshold)
+            {
+                Output.Add(FEntry{ Node, Best });
+            }
+        }
+    }, NumTasks <= 1);
+
+    for (const FEntry& Entry : Frontier)
+    {
+        FrontierValue[Entry.Node] = 0.0f;
+    }
+
+    Next.Reset();
+    for (int32 Task = 0; Task < NumTasks; ++Task)
+    {
+        Next.Append(TaskOutputs[Task]);
+    }
+}
@@ -0,0 +1,609 @@
+// Source/ReasoningEngine/Private/Symbolic/REConceptGraph.cpp
+#include "Symbolic/REConceptGraph.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/Reverse.h"
+
+namespace
+{
+    /** Compact once pending edges exceed this, or 1/PendingFraction of the CSR edges */
+    constexpr int32 MinPendingEdges = 1024;
+    constexpr int32 PendingFraction = 32;
+
+    /** Compact once tombstones exceed this, or 1/RemovedFraction of the CSR edges */
+    constexpr int32 MinRemovedEdges = 1024;
+    constexpr int32 RemovedFraction = 8;
+
+    /** Order of edges within a row: by type, then by the node at the other end */
+    FORCEINLINE bool RowLess(const FREConceptGraph::FEdge& A, const FREConceptGraph::FEdge& B)
+    {
+        return A.Type != B.Type ? A.Type < B.Type : A.Node < B.Node;
+    }
+
+    FORCEINLINE bool SameEnds(const FREConceptGraph::FEdge& A, const FREConceptGraph::FEdge& B)
+    {
+        return A.Type == B.Type && A.Node == B.Node;
+    }
+
+    template<typename PendingType>
+    bool PendingLess(const PendingType& A, const PendingType& B)
+    {
+        return A.Source != B.Source ? A.Source < B.Source : RowLess(A.Edge, B.Edge);
+    }
+
+    /** Probe that sorts before every edge of (Type, Node) */
+    FREConceptGraph::FEdge MakeProbe(int32 Node, int32 Type)
+    {
+        return FREConceptGraph::FEdge{ Node, Type, 0.0f, INDEX_NONE };
+    }
+}
+
+// ========== NODES AND TYPES ==========
+
+int32 FREConceptGraph::AddNode(FName Name)
+{
+    if (const int32* Existing = NodeIds.Find(Name))
+    {
+        return *Existing;
+    }
+
+    const int32 Node = NodeNames.Add(Name);
+    NodeIds.Add(Name, Node);
+    return Node;
+}
+
+int32 FREConceptGraph::FindNode(FName Name) const
+{
+    const int32* Node = NodeIds.Find(Name);
+    return Node ? *Node : InvalidNode;
+}
+
+int32 FREConceptGraph::AddType(const FString& TypeName)
+{
+    if (const int32* Existing = TypeIds.Find(TypeName))
+    {
+        return *Existing;
+    }
+
+    const int32 Type = TypeNames.Add(TypeName);
+    TypeIds.Add(TypeName, Type);
+    return Type;
+}
+
+int32 FREConceptGraph::FindType(const FString& TypeName) const
+{
+    const int32* Type = TypeIds.Find(TypeName);
+    return Type ? *Type : InvalidType;
+}
+
+// ========== EDGES ==========
+
+void FREConceptGraph::AddEdge(int32 From, int32 To, int32 Type, float Strength, int32 Relation)
+{
+    check(NodeNames.IsValidIndex(From) && NodeNames.IsValidIndex(To) && TypeNames.IsValidIndex(Type));
+
+    Out.Add(From, FEdge{ To, Type, Strength, Relation });
+    In.Add(To, FEdge{ From, Type, Strength, Relation });
+    ++NumLiveEdges;
+
+    CompactIfNeeded();
+}
+
+bool FREConceptGraph::RemoveEdge(int32 From, int32 To, int32 Type, int32 Relation)
+{
+    if (!Out.Remove(From, To, Type, Relation))
+    {
+        return false;
+    }
+
+    verify(In.Remove(To, From, Type, Relation));
+    --NumLiveEdges;
+
+    CompactIfNeeded();
+    return true;
+}
+
+bool FREConceptGraph::RemapEdge(int32 From, int32 To, int32 Type, int32 OldRelation, int32 NewRelation)
+{
+    FEdge* Forward = Out.Find(From, To, Type, OldRelation);
+    FEdge* Backward = In.Find(To, From, Type, OldRelation);
+    if (!Forward || !Backward)
+    {
+        return false;
+    }
+
+    Forward->Relation = NewRelation;
+    Backward->Relation = NewRelation;
+    return true;
+}
+
+void FREConceptGraph::ForEachOutEdge(int32 Node, int32 Type, TFunctionRef<bool(const FEdge&)> Visitor) const
+{
+    Out.ForEach(Node, Type, Visitor);
+}
+
+void FREConceptGraph::ForEachInEdge(int32 Node, int32 Type, TFunctionRef<bool(const FEdge&)> Visitor) const
+{
+    In.ForEach(Node, Type, Visitor);
+}
+
+// ========== TRAVERSAL ==========
+
+void FREConceptGraph::BreadthFirst(int32 Start, int32 MaxDepth, int32 Type,
+                                   TFunctionRef<bool(int32 Node, int32 Depth, int32 Parent)> Visitor) const
+{
+    if (!NodeNames.IsValidIndex(Start) || !Visitor(Start, 0, InvalidNode))
+    {
+        return;
+    }
+
+    TBitArray<> Visited(false, NumNodes());
+    Visited[Start] = true;
+
+    TArray<int32> Frontier;
+    TArray<int32> Next;
+    Frontier.Add(Start);
+
+    bool bStopped = false;
+    for (int32 Depth = 1; Depth <= MaxDepth && Frontier.Num() > 0 && !bStopped; ++Depth)
+    {
+        Next.Reset();
+        for (int32 Node : Frontier)
+        {
+            Out.ForEach(Node, Type, [&](const FEdge& Edge)
+            {
+                if (Visited[Edge.Node])
+                {
+                    return true;
+                }
+
+                Visited[Edge.Node] = true;
+                if (!Visitor(Edge.Node, Depth, Node))
+                {
+                    bStopped = true;
+                    return false;
+                }
+                Next.Add(Edge.Node);
+                return true;
+            });
+
+            if (bStopped)
+            {
+                break;
+            }
+        }
+        Swap(Frontier, Next);
+    }
+}
+
+bool FREConceptGraph::FindShortestPath(int32 From, int32 To, int32 MaxDepth, int32 Type, TArray<int32>& OutPath) const
+{
+    OutPath.Reset();
+    if (!NodeNames.IsValidIndex(From) || !NodeNames.IsValidIndex(To))
+    {
+        return false;
+    }
+    if (From == To)
+    {
+        OutPath.Add(From);
+        return true;
+    }
+
+    struct FVisit
+    {
+        int32 Parent;
+        int32 Depth;
+    };
+
+    // Side 0 walks outgoing edges from From, side 1 incoming edges from To.
+    // Visited sets are dense bitmaps; parents are kept only for reached nodes
+    struct FSide
+    {
+        const FAdjacency* Adjacency;
+        TBitArray<> Visited;
+        TMap<int32, FVisit> Visits;
+        TArray<int32> Frontier;
+        int32 Depth = 0;
+    };
+
+    FSide Sides[2];
+    const int32 Roots[2] = { From, To };
+    Sides[0].Adjacency = &Out;
+    Sides[1].Adjacency = &In;
+    for (int32 Index = 0; Index < 2; ++Index)
+    {
+        Sides[Index].Visited.Init(false, NumNodes());
+        Sides[Index].Visited[Roots[Index]] = true;
+        Sides[Index].Visits.Add(Roots[Index], FVisit{ InvalidNode, 0 });
+        Sides[Index].Frontier.Add(Roots[Index]);
+    }
+
+    TArray<int32> Next;
+    int32 Meeting = InvalidNode;
+
+    while (Sides[0].Depth + Sides[1].Depth < MaxDepth && Sides[0].Frontier.Num() > 0 && Sides[1].Frontier.Num() > 0)
+    {
+        // Expand one whole level of the smaller frontier; the best meeting
+        // found during that level is a shortest path
+        FSide& Grow = Sides[Sides[0].Frontier.Num() <= Sides[1].Frontier.Num() ? 0 : 1];
+        FSide& Other = &Grow == &Sides[0] ? Sides[1] : Sides[0];
+        int32 BestLength = MAX_int32;
+
+        Next.Reset();
+        for (int32 Node : Grow.Frontier)
+        {
+            Grow.Adjacency->ForEach(Node, Type, [&](const FEdge& Edge)
+            {
+                if (Grow.Visited[Edge.Node])
+                {
+                    return true;
+                }
+
+                Grow.Visited[Edge.Node] = true;
+                Grow.Visits.Add(Edge.Node, FVisit{ Node, Grow.Depth + 1 });
+                Next.Add(Edge.Node);
+
+                if (Other.Visited[Edge.Node])
+                {
+                    const int32 Length = Grow.Depth + 1 + Other.Visits[Edge.Node].Depth;
+                    if (Length < BestLength)
+                    {
+                        BestLength = Length;
+                        Meeting = Edge.Node;
+                    }
+                }
+                return true;
+            });
+        }
+
+        ++Grow.Depth;
+        Swap(Grow.Frontier, Next);
+
+        if (Meeting != InvalidNode)
+        {
+            break;
+        }
+    }
+
+    if (Meeting == InvalidNode)
+    {
+        return false;
+    }
+
+    for (int32 Node = Meeting; Node != InvalidNode; Node = Sides[0].Visits[Node].Parent)
+    {
+        OutPath.Add(Node);
+    }
+    Algo::Reverse(OutPath);
+    for (int32 Node = Sides[1].Visits[Meeting].Parent; Node != InvalidNode; Node = Sides[1].Visits[Node].Parent)
+    {
+        OutPath.Add(Node);
+    }
+    return true;
+}
+
+bool FREConceptGraph::FindWeightedPath(int32 From, int32 To, int32 Type, float MaxCost,
+                                       TFunctionRef<float(int32 Node)> Heuristic,
+                                       TArray<int32>& OutPath, float& OutCost) const
+{
+    OutPath.Reset();
+    OutCost = 0.0f;
+    if (!NodeNames.IsValidIndex(From) || !NodeNames.IsValidIndex(To))
+    {
+        return false;
+    }
+
+    struct FLabel
+    {
+        float Cost;
+        int32 Parent;
+    };
+
+    struct FOpen
+    {
+        float Priority;
+        int32 Node;
+    };
+
+    auto OpenLess = [](const FOpen& A, const FOpen& B)
+    {
+        return A.Priority < B.Priority;
+    };
+
+    TBitArray<> Settled(false, NumNodes());
+    TMap<int32, FLabel> Labels;
+    TArray<FOpen> Open;
+
+    Labels.Add(From, FLabel{ 0.0f, InvalidNode });
+    Open.HeapPush(FOpen{ Heuristic(From), From }, OpenLess);
+
+    while (Open.Num() > 0)
+    {
+        FOpen Top;
+        Open.HeapPop(Top, OpenLess, EAllowShrinking::No);
+
+        // Stale queue entries of already settled nodes are skipped
+        if (Settled[Top.Node])
+        {
+            continue;
+        }
+        Settled[Top.Node] = true;
+
+        if (Top.Node == To)
+        {
+            OutCost = Labels[To].Cost;
+            for (int32 Node = To; Node != InvalidNode; Node = Labels[Node].Parent)
+            {
+                OutPath.Add(Node);
+            }
+            Algo::Reverse(OutPath);
+            return true;
+        }
+
+        const float Cost = Labels[Top.Node].Cost;
+        Out.ForEach(Top.Node, Type, [&](const FEdge& Edge)
+        {
+            if (Edge.Strength <= 0.0f || Settled[Edge.Node])
+            {
+                return true;
+            }
+
+            const float NextCost = Cost + EdgeCost(Edge.Strength);
+            if (NextCost > MaxCost)
+            {
+                return true;
+            }
+
+            FLabel* Label = Labels.Find(Edge.Node);
+            if (!Label || NextCost < Label->Cost)
+            {
+                Labels.Add(Edge.Node, FLabel{ NextCost, Top.Node });
+                Open.HeapPush(FOpen{ NextCost + Heuristic(Edge.Node), Edge.Node }, OpenLess);
+            }
+            return true;
+        });
+    }
+    return false;
+}
+
+bool FREConceptGraph::FindWeightedPath(int32 From, int32 To, int32 Type, float MaxCost,
+                                       TArray<int32>& OutPath, float& OutCost) const
+{
+    return FindWeightedPath(From, To, Type, MaxCost, [](int32) { return 0.0f; }, OutPath, OutCost);
+}
+
+// ========== MAINTENANCE ==========
+
+void FREConceptGraph::Compact()
+{
+    Out.Compact(NumNodes());
+    In.Compact(NumNodes());
+}
+
+void FREConceptGraph::CompactIfNeeded()
+{
+    if (Out.NeedsCompaction() || In.NeedsCompaction())
+    {
+        Compact();
+    }
+}
+
+void FREConceptGraph::Reset()
+{
+    Out.Reset();
+    In.Reset();
+    NumLiveEdges = 0;
+    NodeIds.Empty();
+    NodeNames.Empty();
+    TypeIds.Empty();
+    TypeNames.Empty();
+}
+
+SIZE_T FREConceptGraph::GetAllocatedSize() const
+{
+    SIZE_T Size = Out.GetAllocatedSize() + In.GetAllocatedSize();
+    Size += NodeIds.GetAllocatedSize() + NodeNames.GetAllocatedSize();
+    Size += TypeIds.GetAllocatedSize() + TypeNames.GetAllocatedSize();
+    for (const FString& TypeName : TypeNames)
+    {
+        // Each type string is stored twice: as a key and by id
+        Size += TypeName.GetAllocatedSize() * 2;
+    }
+    return Size;
+}
+
+// ========== ADJACENCY ==========
+
+void FREConceptGraph::FAdjacency::Add(int32 Source, const FEdge& Edge)
+{
+    const FPendingEdge Entry{ Source, Edge };
+    Pending.Insert(Entry, Algo::UpperBound(Pending, Entry, &PendingLess<FPendingEdge>));
+}
+
+int32 FREConceptGraph::FAdjacency::FindInRows(int32 Source, int32 Node, int32 Type, int32 Relation) const
+{
+    if (Source + 1 >= Offsets.Num())
+    {
+        return INDEX_NONE;
+    }
+
+    const int32 First = Offsets[Source];
+    const int32 Last = Offsets[Source + 1];
+    const FEdge Probe = MakeProbe(Node, Type);
+
+    for (int32 Index = First + Algo::LowerBound(MakeArrayView(Edges.GetData() + First, Last - First), Probe, &RowLess);
+         Index < Last && SameEnds(Edges[Index], Probe); ++Index)
+    {
+        if (Edges[Index].Relation == Relation && !Removed[Index])
+        {
+            return Index;
+        }
+    }
+    return INDEX_NONE;
+}
+
+int32 FREConceptGraph::FAdjacency::FindInPending(int32 Source, int32 Node, int32 Type, int32 Relation) const
+{
+    const FPendingEdge Probe{ Source, MakeProbe(Node, Type) };
+
+    for (int32 Index = Algo::LowerBound(Pending, Probe, &PendingLess<FPendingEdge>);
+         Index < Pending.Num() && Pending[Index].Source == Source && SameEnds(Pending[Index].Edge, Probe.Edge); ++Index)
+    {
+        if (Pending[Index].Edge.Relation == Relation)
+        {
+            return Index;
+        }
+    }
+    return INDEX_NONE;
+}
+
+FREConceptGraph::FEdge* FREConceptGraph::FAdjacency::Find(int32 Source, int32 Node, int32 Type, int32 Relation)
+{
+    const int32 RowIndex = FindInRows(Source, Node, Type, Relation);
+    if (RowIndex != INDEX_NONE)
+    {
+        return &Edges[RowIndex];
+    }
+
+    const int32 PendingIndex = FindInPending(Source, Node, Type, Relation);
+    return PendingIndex != INDEX_NONE ? &Pending[PendingIndex].Edge : nullptr;
+}
+
+bool FREConceptGraph::FAdjacency::Remove(int32 Source, int32 Node, int32 Type, int32 Relation)
+{
+    const int32 RowIndex = FindInRows(Source, Node, Type, Relation);
+    if (RowIndex != INDEX_NONE)
+    {
+        Removed[RowIndex] = true;
+        ++NumRemoved;
+        return true;
+    }
+
+    const int32 PendingIndex = FindInPending(Source, Node, Type, Relation);
+    if (PendingIndex != INDEX_NONE)
+    {
+        Pending.RemoveAt(PendingIndex, 1, EAllowShrinking::No);
+        return true;
+    }
+    return false;
+}
+
+void FREConceptGraph::FAdjacency::ForEach(int32 Source, int32 Type, TFunctionRef<bool(const FEdge&)> Visitor) const
+{
+    if (Type == InvalidType)
+    {
+        return;
+    }
+
+    // Compacted row; a typed lookup starts at the type's first edge
+    if (Source + 1 < Offsets.Num())
+    {
+        int32 Index = Offsets[Source];
+        const int32 Last = Offsets[Source + 1];
+        if (Type != AnyType)
+        {
+            Index += Algo::LowerBoundBy(MakeArrayView(Edges.GetData() + Index, Last - Index), Type,
+                                        [](const FEdge& Edge) { return Edge.Type; });
+        }
+
+        for (; Index < Last; ++Index)
+        {
+            const FEdge& Edge = Edges[Index];
+            if (Type != AnyType && Edge.Type != Type)
+            {
+                break;
+            }
+            if (NumRemoved > 0 && Removed[Index])
+            {
+                continue;
+            }
+            if (!Visitor(Edge))
+            {
+                return;
+            }
+        }
+    }
+
+    // Edges added since the last compaction
+    if (Pending.Num() > 0)
+    {
+        const FPendingEdge Probe{ Source, MakeProbe(MIN_int32, Type == AnyType ? MIN_int32 : Type) };
+        for (int32 Index = Algo::LowerBound(Pending, Probe, &PendingLess<FPendingEdge>);
+             Index < Pending.Num() && Pending[Index].Source == Source; ++Index)
+        {
+            const FEdge& Edge = Pending[Index].Edge;
+            if (Type != AnyType && Edge.Type != Type)
+            {
+                break;
+            }
+            if (!Visitor(Edge))
+            {
+                return;
+            }
+        }
+    }
+}
+
+bool FREConceptGraph::FAdjacency::NeedsCompaction() const
+{
+    return Pending.Num() > FMath::Max(MinPendingEdges, Edges.Num() / PendingFraction)
+        || NumRemoved > FMath::Max(MinRemovedEdges, Edges.Num() / RemovedFraction);
+}
+
+void FREConceptGraph::FAdjacency::Compact(int32 NumNodes)
+{
+    TArray<int32> NewOffsets;
+    TArray<FEdge> NewEdges;
+    NewOffsets.SetNumUninitialized(NumNodes + 1);
+    NewEdges.Reserve(Edges.Num() - NumRemoved + Pending.Num());
+
+    // Merge each compacted row with its pending edges; both are in row order
+    int32 Next = 0;
+    for (int32 Node = 0; Node < NumNodes; ++Node)
+    {
+        NewOffsets[Node] = NewEdges.Num();
+
+        if (Node + 1 < Offsets.Num())
+        {
+            for (int32 Index = Offsets[Node]; Index < Offsets[Node + 1]; ++Index)
+            {
+                if (Removed[Index])
+                {
+                    continue;
+                }
+
+                while (Next < Pending.Num() && Pending[Next].Source == Node && RowLess(Pending[Next].Edge, Edges[Index]))
+                {
+                    NewEdges.Add(Pending[Next++].Edge);
+                }
+                NewEdges.Add(Edges[Index]);
+            }
+        }
+
+        while (Next < Pending.Num() && Pending[Next].Source == Node)
+        {
+            NewEdges.Add(Pending[Next++].Edge);
+        }
+    }
+    NewOffsets[NumNodes] = NewEdges.Num();
+
+    Offsets = MoveTemp(NewOffsets);
+    Edges = MoveTemp(NewEdges);
+    Removed.Init(false, Edges.Num());
+    NumRemoved = 0;
+    Pending.Reset();
+}
+
+void FREConceptGraph::FAdjacency::Reset()
+{
+    Offsets.Empty();
+    Edges.Empty();
+    Removed.Empty();
+    NumRemoved = 0;
+    Pending.Empty();
+}
+
+SIZE_T FREConceptGraph::FAdjacency::GetAllocatedSize() const
+{
+    return Offsets.GetAllocatedSize() + Edges.GetAllocatedSize()
+        + Removed.GetAllocatedSize() + Pending.GetAllocatedSize();
+}
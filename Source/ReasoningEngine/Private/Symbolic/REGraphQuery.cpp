@@ -0,0 +1,503 @@
+// Source/ReasoningEngine/Private/Symbolic/REGraphQuery.cpp
+#include "Symbolic/REGraphQuery.h"
+#include "Symbolic/RETripleStore.h"
+#include "Algo/BinarySearch.h"
+
+namespace
+{
+    constexpr uint32 Unbound = FRETripleSnapshot::InvalidId;
+
+    /** A triple pattern with constants resolved to term ids */
+    struct FCompiledPattern
+    {
+        /** Constant term ids; InvalidId at variable and wildcard positions */
+        FRETriple Constants;
+
+        /** Variable slot per position, INDEX_NONE for constants and wildcards */
+        int32 Variables[3] = { INDEX_NONE, INDEX_NONE, INDEX_NONE };
+
+        int32 NumConstants() const
+        {
+            return (Constants.Subject != Unbound) + (Constants.Predicate != Unbound) + (Constants.Object != Unbound);
+        }
+
+        /** The variable of a pattern with two constants and one variable, else INDEX_NONE */
+        int32 GetSingleVariable(int32& OutPosition) const
+        {
+            if (NumConstants() != 2)
+            {
+                return INDEX_NONE;
+            }
+            for (int32 Position = 0; Position < 3; ++Position)
+            {
+                if (Variables[Position] != INDEX_NONE)
+                {
+                    OutPosition = Position;
+                    return Variables[Position];
+                }
+            }
+            return INDEX_NONE;
+        }
+    };
+
+    struct FCompiledQuery
+    {
+        TArray<FCompiledPattern> Patterns;
+        TArray<FString> VariableNames;
+
+        /** Evaluation order and how many leading patterns form the merge-joined star */
+        TArray<int32> Plan;
+        int32 NumStarPatterns = 0;
+    };
+
+    /**
+     * Resolve constants and number the variables
+     * @return false if a constant was never stored
+     */
+    bool CompileQuery(const FRETripleSnapshot& Snapshot, const FREGraphPatternQuery& Query, FCompiledQuery& Out)
+    {
+        for (const FRETriplePattern& Pattern : Query.Patterns)
+        {
+            FCompiledPattern& Compiled = Out.Patterns.AddDefaulted_GetRef();
+            const FString* Terms[3] = { &Pattern.Subject, &Pattern.Predicate, &Pattern.Object };
+
+            for (int32 Position = 0; Position < 3; ++Position)
+            {
+                const FString& Term = *Terms[Position];
+                if (Term.IsEmpty())
+                {
+                    continue;
+                }
+
+                if (FRETriplePattern::IsVariable(Term))
+                {
+                    const FString Name = Term.RightChop(1);
+                    int32 Slot = Out.VariableNames.IndexOfByPredicate([&Name](const FString& Existing)
+                    {
+                        return Existing.Equals(Name, ESearchCase::CaseSensitive);
+                    });
+                    if (Slot == INDEX_NONE)
+                    {
+                        Slot = Out.VariableNames.Add(Name);
+                    }
+                    Compiled.Variables[Position] = Slot;
+                    continue;
+                }
+
+                Compiled.Constants[Position] = Snapshot.FindTerm(Term);
+                if (Compiled.Constants[Position] == Unbound)
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Estimated matches of a pattern once the variables in Bound are fixed
+     */
+    double EstimateCardinality(const FRETripleSnapshot& Snapshot, const FCompiledPattern& Pattern, const TBitArray<>& Bound)
+    {
+        double Rows;
+        const int32 NumConstants = Pattern.NumConstants();
+        if (NumConstants >= 2)
+        {
+            Rows = Snapshot.CountMatches(Pattern.Constants);
+        }
+        else if (NumConstants == 1)
+        {
+            const int32 Position = Pattern.Constants.Subject != Unbound ? 0 : (Pattern.Constants.Predicate != Unbound ? 1 : 2);
+            Rows = Snapshot.GetTermFrequency(Position, Pattern.Constants[Position]);
+        }
+        else
+        {
+            Rows = Snapshot.Num();
+        }
+
+        // Each bound position keeps roughly one of its distinct values
+        for (int32 Position = 0; Position < 3; ++Position)
+        {
+            const int32 Variable = Pattern.Variables[Position];
+            if (Variable != INDEX_NONE && Bound[Variable])
+            {
+                Rows /= FMath::Max(1, Snapshot.GetNumDistinctTerms(Position));
+            }
+        }
+        return Rows;
+    }
+
+    /**
+     * Greedy join order: cheapest pattern first, then repeatedly the
+     * cheapest pattern sharing a bound variable (cross products last)
+     */
+    void PlanQuery(const FRETripleSnapshot& Snapshot, FCompiledQuery& Query)
+    {
+        const int32 NumPatterns = Query.Patterns.Num();
+        TBitArray<> Bound(false, Query.VariableNames.Num());
+        TBitArray<> Used(false, NumPatterns);
+
+        for (int32 Step = 0; Step < NumPatterns; ++Step)
+        {
+            int32 Best = INDEX_NONE;
+            bool bBestConnected = false;
+            double BestRows = 0.0;
+
+            for (int32 Index = 0; Index < NumPatterns; ++Index)
+            {
+                if (Used[Index])
+                {
+                    continue;
+                }
+
+                const FCompiledPattern& Pattern = Query.Patterns[Index];
+                bool bConnected = Step == 0;
+                bool bHasVariable = false;
+                for (int32 Variable : Pattern.Variables)
+                {
+                    bHasVariable |= Variable != INDEX_NONE;
+                    bConnected |= Variable != INDEX_NONE && Bound[Variable];
+                }
+                // Variable-free patterns are existence checks and never widen the result
+                bConnected |= !bHasVariable;
+
+                const double Rows = EstimateCardinality(Snapshot, Pattern, Bound);
+                if (Best == INDEX_NONE || (bConnected && !bBestConnected) || (bConnected == bBestConnected && Rows < BestRows))
+                {
+                    Best = Index;
+                    bBestConnected = bConnected;
+                    BestRows = Rows;
+                }
+            }
+
+            Used[Best] = true;
+            Query.Plan.Add(Best);
+            for (int32 Variable : Query.Patterns[Best].Variables)
+            {
+                if (Variable != INDEX_NONE)
+                {
+                    Bound[Variable] = true;
+                }
+            }
+        }
+
+        // If the first pattern with variables binds a single variable, pull
+        // every two-constant pattern on that variable to the front; their
+        // matches are all sorted by it
+        const int32* First = Query.Plan.FindByPredicate([&Query](int32 Index)
+        {
+            const FCompiledPattern& Pattern = Query.Patterns[Index];
+            return Pattern.Variables[0] != INDEX_NONE || Pattern.Variables[1] != INDEX_NONE || Pattern.Variables[2] != INDEX_NONE;
+        });
+
+        int32 StarPosition = 0;
+        const int32 StarVariable = First ? Query.Patterns[*First].GetSingleVariable(StarPosition) : INDEX_NONE;
+        if (StarVariable == INDEX_NONE)
+        {
+            return;
+        }
+
+        TArray<int32> Star;
+        TArray<int32> Rest;
+        for (int32 Index : Query.Plan)
+        {
+            int32 Position = 0;
+            (Query.Patterns[Index].GetSingleVariable(Position) == StarVariable ? Star : Rest).Add(Index);
+        }
+
+        if (Star.Num() >= 2)
+        {
+            Query.NumStarPatterns = Star.Num();
+            Query.Plan = MoveTemp(Star);
+            Query.Plan.Append(Rest);
+        }
+    }
+
+    /**
+     * Evaluates a planned query, depth-first over the plan
+     */
+    class FQueryExecutor
+    {
+    public:
+        FQueryExecutor(const FRETripleSnapshot& InSnapshot, const FREGraphPatternQuery& InQuery,
+                       const FCompiledQuery& InCompiled, TArray<FREGraphPatternResult>& OutResults)
+            : Snapshot(InSnapshot)
+            , Query(InQuery)
+            , Compiled(InCompiled)
+            , Results(OutResults)
+        {
+            Values.Init(Unbound, Compiled.VariableNames.Num());
+        }
+
+        void Run()
+        {
+            if (Compiled.NumStarPatterns > 0)
+            {
+                RunStar();
+            }
+            else
+            {
+                Extend(0, 1.0f);
+            }
+        }
+
+    private:
+        struct FStarValue
+        {
+            uint32 Value;
+            float Confidence;
+        };
+
+        bool Accept(uint32 FactId) const
+        {
+            const FRETripleSnapshot::FAttributes& Attr = Snapshot.GetAttributes(FactId);
+            return Attr.Confidence >= Query.MinConfidence
+                && (Query.Namespace.IsNone() || Attr.Namespace == Query.Namespace);
+        }
+
+        bool IsFull() const
+        {
+            return Query.MaxResults > 0 && Results.Num() >= Query.MaxResults;
+        }
+
+        /** Index nested loop: scan the pattern with bound variables substituted */
+        void Extend(int32 Step, float Confidence)
+        {
+            if (Step == Compiled.Plan.Num())
+            {
+                Emit(Confidence);
+                return;
+            }
+
+            const FCompiledPattern& Pattern = Compiled.Patterns[Compiled.Plan[Step]];
+            FRETriple Probe = Pattern.Constants;
+            for (int32 Position = 0; Position < 3; ++Position)
+            {
+                const int32 Variable = Pattern.Variables[Position];
+                if (Variable != INDEX_NONE)
+                {
+                    Probe[Position] = Values[Variable];
+                }
+            }
+
+            Snapshot.QueryIds(Probe, [this, &Pattern, Step, Confidence](uint32 FactId)
+            {
+                if (!Accept(FactId))
+                {
+                    return true;
+                }
+
+                // Bind free variables; a variable repeated within the
+                // pattern must see the same term at each position
+                const FRETriple& Triple = Snapshot.GetTriple(FactId);
+                int32 NewlyBound[3];
+                int32 NumNewlyBound = 0;
+                bool bConsistent = true;
+
+                for (int32 Position = 0; Position < 3 && bConsistent; ++Position)
+                {
+                    const int32 Variable = Pattern.Variables[Position];
+                    if (Variable == INDEX_NONE)
+                    {
+                        continue;
+                    }
+                    if (Values[Variable] == Unbound)
+                    {
+                        Values[Variable] = Triple[Position];
+                        NewlyBound[NumNewlyBound++] = Variable;
+                    }
+                    else
+                    {
+                        bConsistent = Values[Variable] == Triple[Position];
+                    }
+                }
+
+                if (bConsistent)
+                {
+                    Extend(Step + 1, FMath::Min(Confidence, Snapshot.GetAttributes(FactId).Confidence));
+                }
+
+                for (int32 Index = 0; Index < NumNewlyBound; ++Index)
+                {
+                    Values[NewlyBound[Index]] = Unbound;
+                }
+                return !IsFull();
+            });
+        }
+
+        /**
+         * Merge join of the leading star patterns, then nested loops for the rest
+         * Like Extend, every combination of matching facts is one solution, so
+         * a triple stored in several namespaces contributes one row per fact
+         */
+        void RunStar()
+        {
+            const int32 NumStar = Compiled.NumStarPatterns;
+            int32 StarPosition = 0;
+            const int32 StarVariable = Compiled.Patterns[Compiled.Plan[0]].GetSingleVariable(StarPosition);
+
+            // Each list comes out of the index sorted by the variable,
+            // since it is the third key after the two constants
+            TArray<TArray<FStarValue>> Lists;
+            Lists.SetNum(NumStar);
+            for (int32 Step = 0; Step < NumStar; ++Step)
+            {
+                const FCompiledPattern& Pattern = Compiled.Patterns[Compiled.Plan[Step]];
+                int32 Position = 0;
+                Pattern.GetSingleVariable(Position);
+
+                TArray<FStarValue>& List = Lists[Step];
+                Snapshot.QueryIds(Pattern.Constants, [this, &List, Position](uint32 FactId)
+                {
+                    if (Accept(FactId))
+                    {
+                        List.Add({ Snapshot.GetTriple(FactId)[Position], Snapshot.GetAttributes(FactId).Confidence });
+                    }
+                    return true;
+                });
+
+                if (List.Num() == 0)
+                {
+                    return;
+                }
+            }
+
+            // Drive from the shortest list; the others only move forward
+            int32 Driver = 0;
+            for (int32 Step = 1; Step < NumStar; ++Step)
+            {
+                Driver = Lists[Step].Num() < Lists[Driver].Num() ? Step : Driver;
+            }
+
+            // Run of entries holding the current value in each list
+            TArray<int32> RunStarts;
+            TArray<int32> RunEnds;
+            RunStarts.Init(0, NumStar);
+            RunEnds.Init(0, NumStar);
+
+            const TArray<FStarValue>& DriverList = Lists[Driver];
+            for (int32 Start = 0; Start < DriverList.Num(); Start = RunEnds[Driver])
+            {
+                const uint32 Value = DriverList[Start].Value;
+                RunStarts[Driver] = Start;
+                RunEnds[Driver] = FindRunEnd(DriverList, Start, Value);
+
+                bool bInAll = true;
+                for (int32 Step = 0; Step < NumStar && bInAll; ++Step)
+                {
+                    if (Step == Driver)
+                    {
+                        continue;
+                    }
+
+                    const TArray<FStarValue>& List = Lists[Step];
+                    const TArrayView<const FStarValue> Remaining(List.GetData() + RunStarts[Step], List.Num() - RunStarts[Step]);
+                    RunStarts[Step] += Algo::LowerBoundBy(Remaining, Value, &FStarValue::Value);
+                    RunEnds[Step] = FindRunEnd(List, RunStarts[Step], Value);
+                    bInAll = RunEnds[Step] > RunStarts[Step];
+                }
+
+                if (bInAll)
+                {
+                    Values[StarVariable] = Value;
+                    const bool bContinue = ExtendStarRuns(Lists, RunStarts, RunEnds, 0, 1.0f);
+                    Values[StarVariable] = Unbound;
+                    if (!bContinue)
+                    {
+                        return;
+                    }
+                }
+            }
+        }
+
+        /** End of the run of entries equal to Value starting at Start */
+        static int32 FindRunEnd(const TArray<FStarValue>& List, int32 Start, uint32 Value)
+        {
+            int32 End = Start;
+            while (End < List.Num() && List[End].Value == Value)
+            {
+                ++End;
+            }
+            return End;
+        }
+
+        /**
+         * Continue with the remaining patterns once per combination of
+         * star facts in the current runs
+         * @return false once MaxResults is reached
+         */
+        bool ExtendStarRuns(const TArray<TArray<FStarValue>>& Lists, const TArray<int32>& RunStarts,
+                            const TArray<int32>& RunEnds, int32 Step, float Confidence)
+        {
+            if (Step == Lists.Num())
+            {
+                Extend(Compiled.NumStarPatterns, Confidence);
+                return !IsFull();
+            }
+
+            for (int32 Index = RunStarts[Step]; Index < RunEnds[Step]; ++Index)
+            {
+                if (!ExtendStarRuns(Lists, RunStarts, RunEnds, Step + 1, FMath::Min(Confidence, Lists[Step][Index].Confidence)))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        void Emit(float Confidence)
+        {
+            FREGraphPatternResult& Result = Results.AddDefaulted_GetRef();
+            Result.Confidence = Confidence;
+            for (int32 Variable = 0; Variable < Values.Num(); ++Variable)
+            {
+                Result.Bindings.Add(Compiled.VariableNames[Variable], Snapshot.ResolveTerm(Values[Variable]));
+            }
+        }
+
+        const FRETripleSnapshot& Snapshot;
+        const FREGraphPatternQuery& Query;
+        const FCompiledQuery& Compiled;
+        TArray<FREGraphPatternResult>& Results;
+
+        /** Current term id per variable slot */
+        TArray<uint32> Values;
+    };
+}
+
+TArray<FREGraphPatternResult> REGraphQuery::Execute(const FRETripleSnapshot& Snapshot, const FREGraphPatternQuery& Query)
+{
+    TArray<FREGraphPatternResult> Results;
+
+    FCompiledQuery Compiled;
+    if (Query.Patterns.Num() == 0 || !CompileQuery(Snapshot, Query, Compiled))
+    {
+        return Results;
+    }
+
+    PlanQuery(Snapshot, Compiled);
+    FQueryExecutor(Snapshot, Query, Compiled, Results).Run();
+    return Results;
+}
+
+TArray<int32> REGraphQuery::PlanJoinOrder(const FRETripleSnapshot& Snapshot, const FREGraphPatternQuery& Query)
+{
+    FCompiledQuery Compiled;
+    if (!CompileQuery(Snapshot, Query, Compiled))
+    {
+        return TArray<int32>();
+    }
+
+    PlanQuery(Snapshot, Compiled);
+    return Compiled.Plan;
+}
+
+TArray<FREGraphPatternResult> REGraphQuery::Execute(const FRETripleStore& Store, const FREGraphPatternQuery& Query)
+{
+    return Execute(*Store.GetSnapshot(), Query);
+}
+
+TArray<int32> REGraphQuery::PlanJoinOrder(const FRETripleStore& Store, const FREGraphPatternQuery& Query)
+{
+    return PlanJoinOrder(*Store.GetSnapshot(), Query);
+}
@@ -0,0 +1,236 @@
+// Source/ReasoningEngine/Private/Symbolic/REHierarchyIndex.cpp
+#include "Symbolic/REHierarchyIndex.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/Sort.h"
+#include "Algo/Unique.h"
+
+void FREHierarchyIndex::Build(const TMultiMap<FName, FName>& ChildToParents)
+{
+    Reset();
+    bBuilt = true;
+
+    // Dense ids in first-seen order, then parent -> children adjacency
+    TMap<FName, int32> Dense;
+    TArray<FName> DenseNames;
+    auto GetDense = [&Dense, &DenseNames](FName Name)
+    {
+        if (const int32* Existing = Dense.Find(Name))
+        {
+            return *Existing;
+        }
+        const int32 Id = DenseNames.Add(Name);
+        Dense.Add(Name, Id);
+        return Id;
+    };
+
+    TArray<TPair<int32, int32>> Links;
+    for (const TPair<FName, FName>& Link : ChildToParents)
+    {
+        const int32 Child = GetDense(Link.Key);
+        const int32 Parent = GetDense(Link.Value);
+        if (Child != Parent)
+        {
+            Links.Emplace(Parent, Child);
+        }
+    }
+
+    const int32 NumNodes = DenseNames.Num();
+    Algo::Sort(Links);
+    Links.SetNum(Algo::Unique(Links));
+
+    TArray<int32> ChildOffsets;
+    ChildOffsets.Init(0, NumNodes + 1);
+    TBitArray<> HasParent(false, NumNodes);
+    for (const TPair<int32, int32>& Link : Links)
+    {
+        ++ChildOffsets[Link.Key + 1];
+        HasParent[Link.Value] = true;
+    }
+    for (int32 Node = 0; Node < NumNodes; ++Node)
+    {
+        ChildOffsets[Node + 1] += ChildOffsets[Node];
+    }
+
+    // Depth-first from the roots: pre-order ids give each node's spanning
+    // subtree as one range, and children finish before their parents
+    TArray<int32> Pre;
+    Pre.Init(INDEX_NONE, NumNodes);
+    TArray<int32> SubtreeLast;
+    SubtreeLast.SetNumUninitialized(NumNodes);
+    TArray<int32> PostOrder;
+    PostOrder.Reserve(NumNodes);
+
+    struct FFrame
+    {
+        int32 Node;
+        int32 NextLink;
+    };
+    TArray<FFrame> Stack;
+    int32 NextPre = 0;
+
+    auto Visit = [&](int32 Root)
+    {
+        Pre[Root] = NextPre++;
+        Stack.Add(FFrame{ Root, ChildOffsets[Root] });
+        while (Stack.Num() > 0)
+        {
+            FFrame& Top = Stack.Last();
+            if (Top.NextLink == ChildOffsets[Top.Node + 1])
+            {
+                SubtreeLast[Top.Node] = NextPre - 1;
+                PostOrder.Add(Top.Node);
+                Stack.Pop(EAllowShrinking::No);
+                continue;
+            }
+
+            const int32 Child = Links[Top.NextLink++].Value;
+            if (Pre[Child] == INDEX_NONE)
+            {
+                Pre[Child] = NextPre++;
+                Stack.Add(FFrame{ Child, ChildOffsets[Child] });
+            }
+        }
+    };
+
+    for (int32 Node = 0; Node < NumNodes; ++Node)
+    {
+        if (!HasParent[Node])
+        {
+            Visit(Node);
+        }
+    }
+    for (int32 Node = 0; Node < NumNodes; ++Node)
+    {
+        if (Pre[Node] == INDEX_NONE)
+        {
+            Visit(Node);
+        }
+    }
+
+    // Interval lists in post-order: the own subtree plus every child's
+    // list, merged; only children reached by extra links fall outside it
+    TArray<TArray<FInterval>> NodeIntervals;
+    NodeIntervals.SetNum(NumNodes);
+    TArray<FInterval> Gathered;
+    for (int32 Node : PostOrder)
+    {
+        const FInterval Own{ Pre[Node], SubtreeLast[Node] };
+        Gathered.Reset();
+        for (int32 Link = ChildOffsets[Node]; Link < ChildOffsets[Node + 1]; ++Link)
+        {
+            for (const FInterval& Interval : NodeIntervals[Links[Link].Value])
+            {
+                if (Interval.First < Own.First || Interval.Last > Own.Last)
+                {
+                    Gathered.Add(Interval);
+                }
+            }
+        }
+
+        TArray<FInterval>& Merged = NodeIntervals[Node];
+        if (Gathered.Num() == 0)
+        {
+            Merged.Add(Own);
+            continue;
+        }
+
+        Gathered.Add(Own);
+        Algo::Sort(Gathered, [](const FInterval& A, const FInterval& B) { return A.First < B.First; });
+        for (const FInterval& Interval : Gathered)
+        {
+            if (Merged.Num() > 0 && Interval.First <= Merged.Last().Last + 1)
+            {
+                Merged.Last().Last = FMath::Max(Merged.Last().Last, Interval.Last);
+            }
+            else
+            {
+                Merged.Add(Interval);
+            }
+        }
+    }
+
+    // Renumber everything by pre-order id
+    Names.SetNum(NumNodes);
+    Ids.Reserve(NumNodes);
+    TArray<int32> ByPre;
+    ByPre.SetNumUninitialized(NumNodes);
+    for (int32 Node = 0; Node < NumNodes; ++Node)
+    {
+        Names[Pre[Node]] = DenseNames[Node];
+        Ids.Add(DenseNames[Node], Pre[Node]);
+        ByPre[Pre[Node]] = Node;
+    }
+
+    IntervalOffsets.Reserve(NumNodes + 1);
+    IntervalOffsets.Add(0);
+    for (int32 Id = 0; Id < NumNodes; ++Id)
+    {
+        Intervals.Append(NodeIntervals[ByPre[Id]]);
+        IntervalOffsets.Add(Intervals.Num());
+    }
+}
+
+bool FREHierarchyIndex::IsDescendant(FName Concept, FName Ancestor) const
+{
+    if (Concept == Ancestor)
+    {
+        return true;
+    }
+
+    const int32* ConceptId = Ids.Find(Concept);
+    const int32* AncestorId = Ids.Find(Ancestor);
+    if (!ConceptId || !AncestorId)
+    {
+        return false;
+    }
+
+    const int32 Begin = IntervalOffsets[*AncestorId];
+    const int32 End = IntervalOffsets[*AncestorId + 1];
+    if (End - Begin == 1)
+    {
+        return Intervals[Begin].First <= *ConceptId && *ConceptId <= Intervals[Begin].Last;
+    }
+
+    // Last interval starting at or before the concept
+    const TArrayView<const FInterval> Own(Intervals.GetData() + Begin, End - Begin);
+    const int32 Index = Algo::UpperBoundBy(Own, *ConceptId, &FInterval::First) - 1;
+    return Index >= 0 && *ConceptId <= Own[Index].Last;
+}
+
+void FREHierarchyIndex::GetDescendants(FName Ancestor, TArray<FName>& OutDescendants) const
+{
+    OutDescendants.Reset();
+
+    const int32* AncestorId = Ids.Find(Ancestor);
+    if (!AncestorId)
+    {
+        return;
+    }
+
+    for (int32 Index = IntervalOffsets[*AncestorId]; Index < IntervalOffsets[*AncestorId + 1]; ++Index)
+    {
+        const FInterval& Interval = Intervals[Index];
+        for (int32 Id = Interval.First; Id <= Interval.Last; ++Id)
+        {
+            if (Id != *AncestorId)
+            {
+                OutDescendants.Add(Names[Id]);
+            }
+        }
+    }
+}
+
+void FREHierarchyIndex::Reset()
+{
+    Ids.Reset();
+    Names.Reset();
+    IntervalOffsets.Reset();
+    Intervals.Reset();
+    bBuilt = false;
+}
+
+SIZE_T FREHierarchyIndex::GetAllocatedSize() const
+{
+    return Ids.GetAllocatedSize() + Names.GetAllocatedSize()
+         + IntervalOffsets.GetAllocatedSize() + Intervals.GetAllocatedSize();
+}
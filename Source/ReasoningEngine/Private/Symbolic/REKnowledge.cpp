@@ -1,22 +1,181 @@
 #include "Symbolic//REKnowledge.h"
+#include "Symbolic/REGraphQuery.h"
+#include "ReasoningEngine.h"
+#include "Algo/Sort.h"
+#include "Algo/Unique.h"
+#include "Misc/ScopeRWLock.h"
+
+namespace
+{
+    /** Landmarks picked when the distance oracle is first needed */
+    constexpr int32 DefaultLandmarks = 256;
+}
 
 void UREKnowledge::AddFact(const FREFact& Fact, FName Namespace)
 {
-	FREFactCollection& Collection = FactsByNamespace.FindOrAdd(Namespace);
-	Collection.Facts.Add(Fact);  // Access through wrapper
+    if (!Fact.IsValid())
+    {
+        UE_LOG(LogReasoningEngine, Warning, TEXT("AddFact: ignoring incomplete fact '%s'"), *Fact.ToString());
+        return;
+    }
+    
+    FactStore.Add(Fact, Namespace.IsNone() ? Fact.Namespace : Namespace);
+    TotalFacts.Set(FactStore.Num());
+}
+
+int32 UREKnowledge::AddFactsBulk(TArrayView<const FREFact> Facts, FName Namespace)
+{
+    const int32 NumAdded = FactStore.AddBulk(Facts, Namespace);
+    TotalFacts.Set(FactStore.Num());
+    
+    UE_LOG(LogReasoningEngine, Verbose, TEXT("AddFactsBulk: %d facts in, %d new, %d total"),
+           Facts.Num(), NumAdded, FactStore.Num());
+    return NumAdded;
 }
 
 void UREKnowledge::RebuildIndices()
 {
+    FactStore.RebuildIndexes();
+    
+    FWriteScopeLock Lock(GraphLock);
+    ConceptGraph.Compact();
+    if (DistanceOracle.IsBuilt())
+    {
+        DistanceOracle.Build(ConceptGraph, DistanceOracle.GetLandmarkBudget());
+    }
 }
 
 TArray<FName> UREKnowledge::FindConceptPath(FName FromConcept, FName ToConcept, int32 MaxDepth) const
 {
-    return TArray<FName>();
+    FReadScopeLock Lock(GraphLock);
+    
+    TArray<FName> Path;
+    TArray<int32> Nodes;
+    if (ConceptGraph.FindShortestPath(ConceptGraph.FindNode(FromConcept), ConceptGraph.FindNode(ToConcept),
+                                      MaxDepth, FREConceptGraph::AnyType, Nodes))
+    {
+        Path.Reserve(Nodes.Num());
+        for (int32 Node : Nodes)
+        {
+            Path.Add(ConceptGraph.GetNodeName(Node));
+        }
+    }
+    return Path;
+}
+
+TArray<FName> UREKnowledge::FindWeightedConceptPath(FName FromConcept, FName ToConcept, float& OutCost, float MaxCost) const
+{
+    EnsureDistanceOracle();
+    
+    FReadScopeLock Lock(GraphLock);
+    
+    TArray<FName> Path;
+    TArray<int32> Nodes;
+    // Landmark lower bounds on hops never exceed the cost, since every relation costs at least 1
+    const int32 To = ConceptGraph.FindNode(ToConcept);
+    if (ConceptGraph.FindWeightedPath(ConceptGraph.FindNode(FromConcept), To, FREConceptGraph::AnyType, MaxCost,
+                                      [this, To](int32 Node) { return static_cast<float>(DistanceOracle.GetLowerBound(Node, To)); },
+                                      Nodes, OutCost))
+    {
+        Path.Reserve(Nodes.Num());
+        for (int32 Node : Nodes)
+        {
+            Path.Add(ConceptGraph.GetNodeName(Node));
+        }
+    }
+    return Path;
 }
 
 void UREKnowledge::SpreadActivation(FName StartNode, float ActivationStrength, int32 MaxHops)
 {
+    FWriteScopeLock Lock(GraphLock);
+    
+    ConceptActivation.Spread(ConceptGraph, ConceptGraph.FindNode(StartNode), ActivationStrength, MaxHops,
+        [this](int32 Node, float Level)
+        {
+            if (FREKnowledgeNode* KnowledgeNode = KnowledgeGraph.Find(ConceptGraph.GetNodeName(Node)))
+            {
+                KnowledgeNode->ActivationLevel = Level;
+                KnowledgeNode->Concept.ActivationLevel = Level;
+            }
+        });
+}
+
+void UREKnowledge::LinkRelation(int32 RelationIndex)
+{
+    const FRERelation& Relation = Relations[RelationIndex];
+    const int32 From = ConceptGraph.AddNode(Relation.FromConcept);
+    const int32 To = ConceptGraph.AddNode(Relation.ToConcept);
+    const int32 Type = ConceptGraph.AddType(Relation.RelationType);
+    
+    ConceptGraph.AddEdge(From, To, Type, Relation.Strength, RelationIndex);
+    if (Relation.bBidirectional && From != To)
+    {
+        ConceptGraph.AddEdge(To, From, Type, Relation.Strength, RelationIndex);
+    }
+}
+
+void UREKnowledge::UnlinkRelation(int32 RelationIndex)
+{
+    const FRERelation& Relation = Relations[RelationIndex];
+    const int32 From = ConceptGraph.FindNode(Relation.FromConcept);
+    const int32 To = ConceptGraph.FindNode(Relation.ToConcept);
+    const int32 Type = ConceptGraph.FindType(Relation.RelationType);
+    
+    ConceptGraph.RemoveEdge(From, To, Type, RelationIndex);
+    if (Relation.bBidirectional && From != To)
+    {
+        ConceptGraph.RemoveEdge(To, From, Type, RelationIndex);
+    }
+}
+
+void UREKnowledge::RemoveRelationAt(int32 RelationIndex)
+{
+    UnlinkRelation(RelationIndex);
+    DistanceOracle.OnEdgeRemoved(ConceptGraph, ConceptGraph.FindNode(Relations[RelationIndex].FromConcept),
+                                 ConceptGraph.FindNode(Relations[RelationIndex].ToConcept));
+    
+    // Edges of the relation that moves into the freed slot follow it
+    const int32 LastIndex = Relations.Num() - 1;
+    if (RelationIndex != LastIndex)
+    {
+        const FRERelation& Moved = Relations[LastIndex];
+        const int32 From = ConceptGraph.FindNode(Moved.FromConcept);
+        const int32 To = ConceptGraph.FindNode(Moved.ToConcept);
+        const int32 Type = ConceptGraph.FindType(Moved.RelationType);
+        
+        ConceptGraph.RemapEdge(From, To, Type, LastIndex, RelationIndex);
+        if (Moved.bBidirectional && From != To)
+        {
+            ConceptGraph.RemapEdge(To, From, Type, LastIndex, RelationIndex);
+        }
+    }
+    
+    Relations.RemoveAtSwap(RelationIndex, 1, EAllowShrinking::No);
+}
+
+int32 UREKnowledge::FindRelationIndex(const FRERelation& Relation) const
+{
+    const int32 From = ConceptGraph.FindNode(Relation.FromConcept);
+    const int32 To = ConceptGraph.FindNode(Relation.ToConcept);
+    if (From == FREConceptGraph::InvalidNode || To == FREConceptGraph::InvalidNode)
+    {
+        return INDEX_NONE;
+    }
+    
+    // Skip the reverse edges of bidirectional relations declared the other way
+    int32 Found = INDEX_NONE;
+    ConceptGraph.ForEachOutEdge(From, ConceptGraph.FindType(Relation.RelationType),
+        [this, &Relation, &Found, To](const FREConceptGraph::FEdge& Edge)
+        {
+            if (Edge.Node == To && Relations[Edge.Relation].FromConcept == Relation.FromConcept)
+            {
+                Found = Edge.Relation;
+                return false;
+            }
+            return true;
+        });
+    return Found;
 }
 
 void UREKnowledge::Initialize()
@@ -33,74 +192,476 @@ void UREKnowledge::SetCacheManager(URECache* InCacheManager)
 
 bool UREKnowledge::RemoveFact(const FREFact& Fact, FName Namespace)
 {
-    return false;
+    const bool bRemoved = FactStore.Remove(Fact.Subject, Fact.Predicate, Fact.Object,
+                                           Namespace.IsNone() ? Fact.Namespace : Namespace);
+    TotalFacts.Set(FactStore.Num());
+    return bRemoved;
 }
 
 TArray<FREFact> UREKnowledge::QueryFacts(const FREKnowledgeQuery& Query)
 {
-    return TArray<FREFact>();
+    QueryCount.Increment();
+    
+    TArray<FREFact> Results;
+    if (Query.Type == EREKnowledgeQueryType::Concepts || Query.Type == EREKnowledgeQueryType::Relations)
+    {
+        return Results;
+    }
+    
+    // Range lookup on the index matching the bound fields; only facts
+    // that pass the side-table filters are materialized. One snapshot
+    // keeps the whole scan consistent while writers continue
+    const TSharedRef<const FRETripleSnapshot> Snapshot = FactStore.GetSnapshot();
+    Snapshot->Query(Query.Subject, Query.Predicate, Query.Object, [&Snapshot, &Query, &Results](uint32 FactId)
+    {
+        const FRETripleSnapshot::FAttributes& Attr = Snapshot->GetAttributes(FactId);
+        if (Attr.Confidence < Query.MinConfidence)
+        {
+            return true;
+        }
+        if (!Query.Namespace.IsNone() && Attr.Namespace != Query.Namespace)
+        {
+            return true;
+        }
+        
+        Results.Add(Snapshot->GetFact(FactId));
+        return Query.MaxResults <= 0 || Results.Num() < Query.MaxResults;
+    });
+    
+    return Results;
 }
 
 bool UREKnowledge::HasFact(const FString& Subject, const FString& Predicate, const FString& Object) const
 {
-    return false;
+    return FactStore.Contains(Subject, Predicate, Object);
+}
+
+TArray<FREGraphPatternResult> UREKnowledge::QueryPattern(const FREGraphPatternQuery& Query)
+{
+    QueryCount.Increment();
+    return REGraphQuery::Execute(*FactStore.GetSnapshot(), Query);
 }
 
 void UREKnowledge::AddConcept(const FREConcept& Concept)
 {
+    if (Concept.ConceptID.IsNone())
+    {
+        UE_LOG(LogReasoningEngine, Warning, TEXT("AddConcept: ignoring concept '%s' without an id"), *Concept.Name);
+        return;
+    }
+    
+    FWriteScopeLock Lock(GraphLock);
+    
+    FREKnowledgeNode& Node = KnowledgeGraph.FindOrAdd(Concept.ConceptID);
+    Node.NodeID = Concept.ConceptID;
+    Node.Concept = Concept;
+    Node.ActivationLevel = FMath::Clamp(Concept.ActivationLevel, 0.0f, 1.0f);
+    Node.Concept.ActivationLevel = Node.ActivationLevel;
+    ConceptActivation.Set(ConceptGraph.AddNode(Concept.ConceptID), Node.ActivationLevel);
+    
+    TotalConcepts.Set(KnowledgeGraph.Num());
 }
 
 bool UREKnowledge::RemoveConcept(FName ConceptID)
 {
-    return false;
+    FWriteScopeLock Lock(GraphLock);
+    
+    if (KnowledgeGraph.Remove(ConceptID) == 0)
+    {
+        return false;
+    }
+    // Hierarchy links go with the concept; a built index already knows
+    // whether it has any, so most removals skip the scan and keep the labels
+    int32 NumUnlinked = 0;
+    if (!HierarchyIndex.IsBuilt() || HierarchyIndex.Contains(ConceptID))
+    {
+        NumUnlinked = ConceptHierarchy.Remove(ConceptID);
+        for (auto It = ConceptHierarchy.CreateIterator(); It; ++It)
+        {
+            if (It.Value() == ConceptID)
+            {
+                It.RemoveCurrent();
+                ++NumUnlinked;
+            }
+        }
+    }
+    if (NumUnlinked > 0)
+    {
+        HierarchyIndex.Reset();
+    }
+    
+    // Relations touching the concept go with it; highest index first so
+    // the relations moved into freed slots are never ones still to remove
+    const int32 Node = ConceptGraph.FindNode(ConceptID);
+    TArray<int32> Touching;
+    auto Collect = [&Touching](const FREConceptGraph::FEdge& Edge)
+    {
+        Touching.Add(Edge.Relation);
+        return true;
+    };
+    if (Node != FREConceptGraph::InvalidNode)
+    {
+        ConceptActivation.Set(Node, 0.0f);
+        ConceptGraph.ForEachOutEdge(Node, FREConceptGraph::AnyType, Collect);
+        ConceptGraph.ForEachInEdge(Node, FREConceptGraph::AnyType, Collect);
+    }
+    
+    Algo::Sort(Touching, TGreater<int32>());
+    Touching.SetNum(Algo::Unique(Touching));
+    for (int32 RelationIndex : Touching)
+    {
+        RemoveRelationAt(RelationIndex);
+    }
+    DistanceOracle.Refresh(ConceptGraph);
+    
+    TotalConcepts.Set(KnowledgeGraph.Num());
+    TotalRelations.Set(Relations.Num());
+    return true;
 }
 
 bool UREKnowledge::GetConcept(FName ConceptID, FREConcept& OutConcept) const
 {
-    return false;
+    FReadScopeLock Lock(GraphLock);
+    
+    const FREKnowledgeNode* Node = KnowledgeGraph.Find(ConceptID);
+    if (!Node)
+    {
+        return false;
+    }
+    
+    OutConcept = Node->Concept;
+    return true;
 }
 
 TArray<FREConcept> UREKnowledge::FindConcepts(const FString& SearchText, int32 MaxResults)
 {
-    return TArray<FREConcept>();
+    FReadScopeLock Lock(GraphLock);
+    
+    TArray<FREConcept> Results;
+    for (const TPair<FName, FREKnowledgeNode>& Entry : KnowledgeGraph)
+    {
+        const FREConcept& Concept = Entry.Value.Concept;
+        const bool bMatches = Concept.ConceptID.ToString().Contains(SearchText)
+            || Concept.Name.Contains(SearchText)
+            || Concept.Description.Contains(SearchText)
+            || Concept.Synonyms.ContainsByPredicate([&SearchText](const FString& Synonym) { return Synonym.Contains(SearchText); });
+        
+        if (bMatches)
+        {
+            Results.Add(Concept);
+            if (MaxResults > 0 && Results.Num() >= MaxResults)
+            {
+                break;
+            }
+        }
+    }
+    return Results;
+}
+
+bool UREKnowledge::AddConceptParent(FName ConceptID, FName ParentID)
+{
+    if (ConceptID.IsNone() || ParentID.IsNone())
+    {
+        return false;
+    }
+    
+    FWriteScopeLock Lock(GraphLock);
+    
+    if (ConceptHierarchy.FindPair(ConceptID, ParentID))
+    {
+        return true;
+    }
+    
+    // Reject links closing a cycle: the parent must not already be below the concept.
+    // Walks the parent's ancestors only, which stays cheap while edits are interleaved
+    TArray<FName> Pending{ ParentID };
+    TSet<FName> Seen{ ParentID };
+    while (Pending.Num() > 0)
+    {
+        const FName Current = Pending.Pop(EAllowShrinking::No);
+        if (Current == ConceptID)
+        {
+            UE_LOG(LogReasoningEngine, Warning, TEXT("AddConceptParent: '%s' is already below '%s'"),
+                   *ParentID.ToString(), *ConceptID.ToString());
+            return false;
+        }
+        for (auto It = ConceptHierarchy.CreateConstKeyIterator(Current); It; ++It)
+        {
+            if (!Seen.Contains(It.Value()))
+            {
+                Seen.Add(It.Value());
+                Pending.Add(It.Value());
+            }
+        }
+    }
+    
+    ConceptHierarchy.Add(ConceptID, ParentID);
+    HierarchyIndex.Reset();
+    return true;
+}
+
+bool UREKnowledge::RemoveConceptParent(FName ConceptID, FName ParentID)
+{
+    FWriteScopeLock Lock(GraphLock);
+    
+    if (ConceptHierarchy.RemoveSingle(ConceptID, ParentID) == 0)
+    {
+        return false;
+    }
+    HierarchyIndex.Reset();
+    return true;
+}
+
+bool UREKnowledge::IsA(FName ConceptID, FName AncestorID) const
+{
+    EnsureHierarchyIndex();
+    
+    FReadScopeLock Lock(GraphLock);
+    return HierarchyIndex.IsDescendant(ConceptID, AncestorID);
+}
+
+TArray<FName> UREKnowledge::GetDescendants(FName ConceptID) const
+{
+    EnsureHierarchyIndex();
+    
+    FReadScopeLock Lock(GraphLock);
+    TArray<FName> Descendants;
+    HierarchyIndex.GetDescendants(ConceptID, Descendants);
+    return Descendants;
+}
+
+void UREKnowledge::EnsureHierarchyIndex() const
+{
+    {
+        FReadScopeLock Lock(GraphLock);
+        if (HierarchyIndex.IsBuilt())
+        {
+            return;
+        }
+    }
+    
+    FWriteScopeLock Lock(GraphLock);
+    if (!HierarchyIndex.IsBuilt())
+    {
+        HierarchyIndex.Build(ConceptHierarchy);
+    }
 }
 
 void UREKnowledge::AddRelation(const FRERelation& Relation)
 {
+    if (!Relation.IsValid())
+    {
+        UE_LOG(LogReasoningEngine, Warning, TEXT("AddRelation: ignoring incomplete relation '%s' -> '%s'"),
+               *Relation.FromConcept.ToString(), *Relation.ToConcept.ToString());
+        return;
+    }
+    
+    FWriteScopeLock Lock(GraphLock);
+    
+    // Same ends and type replace the stored relation
+    const int32 Existing = FindRelationIndex(Relation);
+    if (Existing != INDEX_NONE)
+    {
+        UnlinkRelation(Existing);
+        Relations[Existing] = Relation;
+        LinkRelation(Existing);
+    }
+    else
+    {
+        LinkRelation(Relations.Add(Relation));
+        DistanceOracle.OnEdgeAdded(ConceptGraph, ConceptGraph.FindNode(Relation.FromConcept),
+                                   ConceptGraph.FindNode(Relation.ToConcept));
+    }
+    
+    TotalRelations.Set(Relations.Num());
 }
 
 int32 UREKnowledge::RemoveRelation(FName FromConcept, FName ToConcept, const FString& RelationType)
 {
-    return 0;
+    FWriteScopeLock Lock(GraphLock);
+    
+    const int32 From = ConceptGraph.FindNode(FromConcept);
+    const int32 To = ConceptGraph.FindNode(ToConcept);
+    if (From == FREConceptGraph::InvalidNode || To == FREConceptGraph::InvalidNode)
+    {
+        return 0;
+    }
+    
+    TArray<int32> Matches;
+    const int32 Type = RelationType.IsEmpty() ? FREConceptGraph::AnyType : ConceptGraph.FindType(RelationType);
+    ConceptGraph.ForEachOutEdge(From, Type, [this, &Matches, FromConcept, To](const FREConceptGraph::FEdge& Edge)
+    {
+        if (Edge.Node == To && Relations[Edge.Relation].FromConcept == FromConcept)
+        {
+            Matches.Add(Edge.Relation);
+        }
+        return true;
+    });
+    
+    Algo::Sort(Matches, TGreater<int32>());
+    for (int32 RelationIndex : Matches)
+    {
+        RemoveRelationAt(RelationIndex);
+    }
+    DistanceOracle.Refresh(ConceptGraph);
+    
+    TotalRelations.Set(Relations.Num());
+    return Matches.Num();
 }
 
 TArray<FRERelation> UREKnowledge::GetRelationsFrom(FName ConceptID, const FString& RelationType) const
 {
-    return TArray<FRERelation>();
+    FReadScopeLock Lock(GraphLock);
+    
+    TArray<FRERelation> Results;
+    const int32 Node = ConceptGraph.FindNode(ConceptID);
+    if (Node == FREConceptGraph::InvalidNode)
+    {
+        return Results;
+    }
+    
+    // Bidirectional relations are listed from both ends
+    const int32 Type = RelationType.IsEmpty() ? FREConceptGraph::AnyType : ConceptGraph.FindType(RelationType);
+    ConceptGraph.ForEachOutEdge(Node, Type, [this, &Results](const FREConceptGraph::FEdge& Edge)
+    {
+        Results.Add(Relations[Edge.Relation]);
+        return true;
+    });
+    return Results;
 }
 
 TArray<FRERelation> UREKnowledge::GetRelationsTo(FName ConceptID, const FString& RelationType) const
 {
-    return TArray<FRERelation>();
+    FReadScopeLock Lock(GraphLock);
+    
+    TArray<FRERelation> Results;
+    const int32 Node = ConceptGraph.FindNode(ConceptID);
+    if (Node == FREConceptGraph::InvalidNode)
+    {
+        return Results;
+    }
+    
+    const int32 Type = RelationType.IsEmpty() ? FREConceptGraph::AnyType : ConceptGraph.FindType(RelationType);
+    ConceptGraph.ForEachInEdge(Node, Type, [this, &Results](const FREConceptGraph::FEdge& Edge)
+    {
+        Results.Add(Relations[Edge.Relation]);
+        return true;
+    });
+    return Results;
 }
 
 TArray<FREConcept> UREKnowledge::FindRelatedConcepts(FName ConceptID, int32 MaxDepth, const FString& RelationType)
 {
-    return TArray<FREConcept>();
+    FReadScopeLock Lock(GraphLock);
+    
+    TArray<FREConcept> Results;
+    const int32 Start = ConceptGraph.FindNode(ConceptID);
+    if (Start == FREConceptGraph::InvalidNode)
+    {
+        return Results;
+    }
+    
+    // Nearest first; names that appear only in relations are walked through but not returned
+    const int32 Type = RelationType.IsEmpty() ? FREConceptGraph::AnyType : ConceptGraph.FindType(RelationType);
+    ConceptGraph.BreadthFirst(Start, MaxDepth, Type, [this, &Results](int32 Node, int32 Depth, int32 Parent)
+    {
+        if (Depth > 0)
+        {
+            if (const FREKnowledgeNode* Related = KnowledgeGraph.Find(ConceptGraph.GetNodeName(Node)))
+            {
+                Results.Add(Related->Concept);
+            }
+        }
+        return true;
+    });
+    return Results;
 }
 
 float UREKnowledge::CalculateSemanticDistance(FName ConceptA, FName ConceptB) const
 {
-    return 0.0f;
+    int32 Lower = 0;
+    int32 Upper = FRELandmarkOracle::UnknownDistance;
+    if (!GetSemanticDistanceBounds(ConceptA, ConceptB, Lower, Upper) || Upper == FRELandmarkOracle::UnknownDistance)
+    {
+        return TNumericLimits<float>::Max();
+    }
+    return static_cast<float>(Upper);
+}
+
+bool UREKnowledge::GetSemanticDistanceBounds(FName ConceptA, FName ConceptB, int32& OutLower, int32& OutUpper) const
+{
+    EnsureDistanceOracle();
+    
+    FReadScopeLock Lock(GraphLock);
+    
+    OutLower = 0;
+    OutUpper = FRELandmarkOracle::UnknownDistance;
+    const int32 NodeA = ConceptGraph.FindNode(ConceptA);
+    const int32 NodeB = ConceptGraph.FindNode(ConceptB);
+    if (NodeA == FREConceptGraph::InvalidNode || NodeB == FREConceptGraph::InvalidNode)
+    {
+        return false;
+    }
+    
+    DistanceOracle.GetBounds(NodeA, NodeB, OutLower, OutUpper);
+    return true;
+}
+
+void UREKnowledge::BuildDistanceIndex(int32 NumLandmarks)
+{
+    FWriteScopeLock Lock(GraphLock);
+    DistanceOracle.Build(ConceptGraph, NumLandmarks);
+    
+    UE_LOG(LogReasoningEngine, Verbose, TEXT("BuildDistanceIndex: %d landmarks over %d concepts"),
+           DistanceOracle.NumLandmarks(), ConceptGraph.NumNodes());
+}
+
+void UREKnowledge::EnsureDistanceOracle() const
+{
+    {
+        FReadScopeLock Lock(GraphLock);
+        if (!DistanceOracle.IsStale(ConceptGraph))
+        {
+            return;
+        }
+    }
+    
+    FWriteScopeLock Lock(GraphLock);
+    if (DistanceOracle.IsStale(ConceptGraph))
+    {
+        DistanceOracle.Build(ConceptGraph, DistanceOracle.IsBuilt() ? DistanceOracle.GetLandmarkBudget() : DefaultLandmarks);
+    }
 }
 
 void UREKnowledge::ActivateConcept(FName ConceptID, float ActivationStrength, int32 SpreadDepth)
 {
+    SpreadActivation(ConceptID, ActivationStrength, SpreadDepth);
 }
 
 TArray<FREConcept> UREKnowledge::GetActivatedConcepts(int32 Count) const
 {
-    return TArray<FREConcept>();
+    FReadScopeLock Lock(GraphLock);
+    
+    // Activation also passes through relation ends that are not concepts; skip those
+    TArray<int32> Nodes;
+    ConceptActivation.GetMostActive(Count, [this](int32 Node)
+    {
+        return KnowledgeGraph.Contains(ConceptGraph.GetNodeName(Node));
+    }, Nodes);
+    
+    TArray<FREConcept> Results;
+    Results.Reserve(Nodes.Num());
+    for (int32 Node : Nodes)
+    {
+        Results.Add(KnowledgeGraph[ConceptGraph.GetNodeName(Node)].Concept);
+    }
+    return Results;
+}
+
+void UREKnowledge::SetActivationDecayRate(float DecayRate)
+{
+    FWriteScopeLock Lock(GraphLock);
+    ConceptActivation.SetDecayRate(DecayRate);
 }
 
 bool UREKnowledge::LoadFromJSON(const FString& JsonString)
@@ -119,15 +680,36 @@ void UREKnowledge::LoadFromAsset(class UDataAsset* KnowledgeAsset)
 
 void UREKnowledge::ClearAll()
 {
+    FactStore.Reset();
+    {
+        FWriteScopeLock Lock(GraphLock);
+        KnowledgeGraph.Empty();
+        Relations.Empty();
+        ConceptHierarchy.Empty();
+        HierarchyIndex.Reset();
+        ConceptGraph.Reset();
+        DistanceOracle.Reset();
+        ConceptActivation.Reset();
+    }
+    
+    TotalFacts.Reset();
+    TotalConcepts.Reset();
+    TotalRelations.Reset();
 }
 
 int64 UREKnowledge::GetMemoryUsage() const
 {
-    return 0;
+    FReadScopeLock Lock(GraphLock);
+    return static_cast<int64>(FactStore.GetAllocatedSize() + ConceptGraph.GetAllocatedSize()
+                              + DistanceOracle.GetAllocatedSize() + HierarchyIndex.GetAllocatedSize()
+                              + ConceptActivation.GetAllocatedSize() + KnowledgeGraph.GetAllocatedSize() + Relations.GetAllocatedSize());
 }
 
 void UREKnowledge::GetStatistics(int32& OutFactCount, int32& OutConceptCount, int32& OutRelationCount) const
 {
+    OutFactCount = TotalFacts.GetValue();
+    OutConceptCount = TotalConcepts.GetValue();
+    OutRelationCount = TotalRelations.GetValue();
 }
 
 bool UREKnowledge::ValidateKnowledge(TArray<FString>& OutErrors)
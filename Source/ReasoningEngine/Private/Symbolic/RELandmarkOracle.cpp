@@ -0,0 +1,375 @@
+// Source/ReasoningEngine/Private/Symbolic/RELandmarkOracle.cpp
+#include "Symbolic/RELandmarkOracle.h"
+#include "Symbolic/REConceptGraph.h"
+#include "Algo/Sort.h"
+#include "Async/ParallelFor.h"
+
+namespace
+{
+    /** Visit the neighbours of a node along edges of any type and direction; return false to stop */
+    template<typename VisitorType>
+    void ForEachNeighbour(const FREConceptGraph& Graph, int32 Node, VisitorType&& Visitor)
+    {
+        bool bContinue = true;
+        auto Visit = [&Visitor, &bContinue](const FREConceptGraph::FEdge& Edge)
+        {
+            bContinue = Visitor(Edge.Node);
+            return bContinue;
+        };
+
+        Graph.ForEachOutEdge(Node, FREConceptGraph::AnyType, Visit);
+        if (bContinue)
+        {
+            Graph.ForEachInEdge(Node, FREConceptGraph::AnyType, Visit);
+        }
+    }
+}
+
+// ========== BUILD ==========
+
+void FRELandmarkOracle::Build(const FREConceptGraph& Graph, int32 NumLandmarks)
+{
+    Reset();
+    bBuilt = true;
+    BuiltNodes = Graph.NumNodes();
+    RequestedLandmarks = NumLandmarks;
+
+    const int32 NumNodes = Graph.NumNodes();
+    TArray<int32> Degree;
+    Degree.Init(0, NumNodes);
+    TArray<int32> Candidates;
+    for (int32 Node = 0; Node < NumNodes; ++Node)
+    {
+        ForEachNeighbour(Graph, Node, [&Degree, Node](int32)
+        {
+            ++Degree[Node];
+            return true;
+        });
+        if (Degree[Node] > 0)
+        {
+            Candidates.Add(Node);
+        }
+    }
+    Algo::Sort(Candidates, [&Degree](int32 A, int32 B)
+    {
+        return Degree[A] != Degree[B] ? Degree[A] > Degree[B] : A < B;
+    });
+
+    NumLandmarks = FMath::Min(NumLandmarks, Candidates.Num());
+    if (NumLandmarks <= 0)
+    {
+        return;
+    }
+
+    // First the best-connected node of each component, so every node with
+    // an edge gets an upper bound while the budget lasts
+    TArray<TArray<uint8>> Columns;
+    TBitArray<> Covered(false, NumNodes);
+    TBitArray<> Picked(false, NumNodes);
+    TArray<int32> Reached;
+    for (int32 Node : Candidates)
+    {
+        if (Landmarks.Num() == NumLandmarks)
+        {
+            break;
+        }
+        if (Covered[Node])
+        {
+            continue;
+        }
+
+        Landmarks.Add(Node);
+        Picked[Node] = true;
+        ComputeColumn(Graph, Node, Columns.AddDefaulted_GetRef(), Reached);
+        for (int32 Other : Reached)
+        {
+            Covered[Other] = true;
+        }
+    }
+
+    // Then the remaining hubs, searched in parallel
+    const int32 NumComponentLandmarks = Landmarks.Num();
+    for (int32 Node : Candidates)
+    {
+        if (Landmarks.Num() == NumLandmarks)
+        {
+            break;
+        }
+        if (!Picked[Node])
+        {
+            Landmarks.Add(Node);
+        }
+    }
+
+    Columns.SetNum(Landmarks.Num());
+    ParallelFor(Landmarks.Num() - NumComponentLandmarks, [&](int32 Offset)
+    {
+        const int32 Index = NumComponentLandmarks + Offset;
+        TArray<int32> LocalReached;
+        ComputeColumn(Graph, Landmarks[Index], Columns[Index], LocalReached);
+    });
+
+    NumRows = NumNodes;
+    Distances.SetNumUninitialized(NumNodes * Landmarks.Num());
+    ParallelFor(NumNodes, [&](int32 Node)
+    {
+        for (int32 Index = 0; Index < Landmarks.Num(); ++Index)
+        {
+            Distance(Node, Index) = Columns[Index][Node];
+        }
+    });
+
+    Dirty.Init(false, Landmarks.Num());
+}
+
+bool FRELandmarkOracle::IsStale(const FREConceptGraph& Graph) const
+{
+    if (!bBuilt)
+    {
+        return true;
+    }
+
+    // Small graphs are re-picked as they grow until the budget is used;
+    // large ones only after doubling, so rebuilds stay amortized
+    const int32 NumNodes = Graph.NumNodes();
+    return NumNodes > 2 * BuiltNodes || (NumNodes > BuiltNodes && Landmarks.Num() < RequestedLandmarks);
+}
+
+// ========== QUERIES ==========
+
+void FRELandmarkOracle::GetBounds(int32 A, int32 B, int32& OutLower, int32& OutUpper) const
+{
+    OutLower = 0;
+    OutUpper = UnknownDistance;
+    if (A < 0 || B < 0)
+    {
+        return;
+    }
+    if (A == B)
+    {
+        OutUpper = 0;
+        return;
+    }
+
+    for (int32 Index = 0; Index < Landmarks.Num(); ++Index)
+    {
+        const int32 DistanceA = GetDistance(A, Index);
+        const int32 DistanceB = GetDistance(B, Index);
+        if (DistanceA == Unreached && DistanceB == Unreached)
+        {
+            continue;
+        }
+
+        // An unreached end is at least Unreached hops from the landmark
+        OutLower = FMath::Max(OutLower, FMath::Abs(DistanceA - DistanceB));
+        if (DistanceA != Unreached && DistanceB != Unreached)
+        {
+            OutUpper = FMath::Min(OutUpper, DistanceA + DistanceB);
+        }
+    }
+}
+
+int32 FRELandmarkOracle::GetLowerBound(int32 A, int32 B) const
+{
+    if (A < 0 || B < 0 || A == B)
+    {
+        return 0;
+    }
+
+    int32 Lower = 0;
+    for (int32 Index = 0; Index < Landmarks.Num(); ++Index)
+    {
+        const int32 DistanceA = GetDistance(A, Index);
+        const int32 DistanceB = GetDistance(B, Index);
+        if (DistanceA != Unreached || DistanceB != Unreached)
+        {
+            Lower = FMath::Max(Lower, FMath::Abs(DistanceA - DistanceB));
+        }
+    }
+    return Lower;
+}
+
+// ========== INCREMENTAL UPDATES ==========
+
+void FRELandmarkOracle::OnEdgeAdded(const FREConceptGraph& Graph, int32 From, int32 To)
+{
+    if (!bBuilt || From == To)
+    {
+        return;
+    }
+
+    AddRows(Graph.NumNodes());
+    for (int32 Index = 0; Index < Landmarks.Num(); ++Index)
+    {
+        // Only the far end can get closer; Relax spreads that outwards
+        const int32 DistanceFrom = Distance(From, Index);
+        const int32 DistanceTo = Distance(To, Index);
+        if (DistanceFrom != Unreached && DistanceFrom + 1 < DistanceTo)
+        {
+            Distance(To, Index) = static_cast<uint8>(DistanceFrom + 1);
+            Relax(Graph, Index, To);
+        }
+        else if (DistanceTo != Unreached && DistanceTo + 1 < DistanceFrom)
+        {
+            Distance(From, Index) = static_cast<uint8>(DistanceTo + 1);
+            Relax(Graph, Index, From);
+        }
+    }
+}
+
+void FRELandmarkOracle::OnEdgeRemoved(const FREConceptGraph& Graph, int32 From, int32 To)
+{
+    if (!bBuilt || From == To)
+    {
+        return;
+    }
+
+    AddRows(Graph.NumNodes());
+    for (int32 Index = 0; Index < Landmarks.Num(); ++Index)
+    {
+        if (Dirty[Index])
+        {
+            continue;
+        }
+
+        // Only an edge between consecutive levels lies on shortest paths, and
+        // distances change only if the far end lost its last such neighbour
+        const int32 DistanceFrom = Distance(From, Index);
+        const int32 DistanceTo = Distance(To, Index);
+        const int32 FarDistance = FMath::Max(DistanceFrom, DistanceTo);
+        if (FMath::Abs(DistanceFrom - DistanceTo) != 1 || FarDistance == Unreached)
+        {
+            continue;
+        }
+
+        bool bSupported = false;
+        ForEachNeighbour(Graph, DistanceFrom > DistanceTo ? From : To, [&](int32 Neighbour)
+        {
+            bSupported = Distance(Neighbour, Index) == FarDistance - 1;
+            return !bSupported;
+        });
+        if (!bSupported)
+        {
+            Dirty[Index] = true;
+        }
+    }
+}
+
+void FRELandmarkOracle::Refresh(const FREConceptGraph& Graph)
+{
+    TArray<int32> Stale;
+    for (TConstSetBitIterator<> It(Dirty); It; ++It)
+    {
+        Stale.Add(It.GetIndex());
+    }
+    if (Stale.Num() == 0)
+    {
+        return;
+    }
+
+    AddRows(Graph.NumNodes());
+    ParallelFor(Stale.Num(), [&](int32 Item)
+    {
+        TArray<uint8> Column;
+        TArray<int32> Reached;
+        ComputeColumn(Graph, Landmarks[Stale[Item]], Column, Reached);
+        StoreColumn(Stale[Item], Column);
+    });
+
+    Dirty.Init(false, Landmarks.Num());
+}
+
+// ========== MAINTENANCE ==========
+
+void FRELandmarkOracle::Reset()
+{
+    Landmarks.Empty();
+    Distances.Empty();
+    NumRows = 0;
+    Dirty.Empty();
+    BuiltNodes = 0;
+    RequestedLandmarks = 0;
+    bBuilt = false;
+}
+
+SIZE_T FRELandmarkOracle::GetAllocatedSize() const
+{
+    return Landmarks.GetAllocatedSize() + Distances.GetAllocatedSize() + Dirty.GetAllocatedSize();
+}
+
+// ========== HELPERS ==========
+
+void FRELandmarkOracle::AddRows(int32 NumNodes)
+{
+    if (NumNodes <= NumRows)
+    {
+        return;
+    }
+
+    const int32 OldSize = Distances.Num();
+    Distances.SetNumUninitialized(NumNodes * Landmarks.Num());
+    FMemory::Memset(Distances.GetData() + OldSize, Unreached, Distances.Num() - OldSize);
+    NumRows = NumNodes;
+}
+
+void FRELandmarkOracle::ComputeColumn(const FREConceptGraph& Graph, int32 Source,
+                                      TArray<uint8>& OutColumn, TArray<int32>& OutReached)
+{
+    OutColumn.Init(Unreached, Graph.NumNodes());
+    OutReached.Reset();
+
+    OutColumn[Source] = 0;
+    OutReached.Add(Source);
+    for (int32 Head = 0; Head < OutReached.Num(); ++Head)
+    {
+        const int32 Node = OutReached[Head];
+        const int32 Next = OutColumn[Node] + 1;
+        if (Next > MaxDistance)
+        {
+            continue;
+        }
+
+        ForEachNeighbour(Graph, Node, [&](int32 Neighbour)
+        {
+            if (OutColumn[Neighbour] == Unreached)
+            {
+                OutColumn[Neighbour] = static_cast<uint8>(Next);
+                OutReached.Add(Neighbour);
+            }
+            return true;
+        });
+    }
+}
+
+void FRELandmarkOracle::StoreColumn(int32 Index, const TArray<uint8>& Column)
+{
+    for (int32 Node = 0; Node < NumRows; ++Node)
+    {
+        Distance(Node, Index) = Column[Node];
+    }
+}
+
+void FRELandmarkOracle::Relax(const FREConceptGraph& Graph, int32 Index, int32 Node)
+{
+    TArray<int32> Queue;
+    Queue.Add(Node);
+    for (int32 Head = 0; Head < Queue.Num(); ++Head)
+    {
+        const int32 Current = Queue[Head];
+        const int32 Next = Distance(Current, Index) + 1;
+        if (Next > MaxDistance)
+        {
+            continue;
+        }
+
+        ForEachNeighbour(Graph, Current, [&](int32 Neighbour)
+        {
+            if (Distance(Neighbour, Index) > Next)
+            {
+                Distance(Neighbour, Index) = static_cast<uint8>(Next);
+                Queue.Add(Neighbour);
+            }
+            return true;
+        });
+    }
+}
@@ -0,0 +1,1171 @@
+// Source/ReasoningEngine/Private/Symbolic/RETripleStore.cpp
+#include "Symbolic/RETripleStore.h"
+#include "ReasoningEngine.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/Sort.h"
+#include "Async/ParallelFor.h"
+#include "Misc/ScopeLock.h"
+#include "Misc/ScopeRWLock.h"
+
+namespace
+{
+    /** Bulk loads smaller than this run on the calling thread */
+    constexpr int32 BulkParallelThreshold = 4096;
+
+    /** Smallest run handed to one worker by ParallelSort */
+    constexpr int32 SortRunSize = 16384;
+
+    /**
+     * Sort runs in parallel, then merge pairs of runs in parallel rounds
+     */
+    template<typename ElementType, typename PredicateType>
+    void ParallelSort(TArray<ElementType>& Elements, PredicateType Predicate)
+    {
+        const int32 Num = Elements.Num();
+        const int32 NumRuns = FMath::Min(FMath::DivideAndRoundUp(Num, SortRunSize),
+                                         FMath::Max(FPlatformMisc::NumberOfCoresIncludingHyperthreads(), 1));
+        if (NumRuns <= 1)
+        {
+            Algo::Sort(Elements, Predicate);
+            return;
+        }
+
+        const int32 RunSize = FMath::DivideAndRoundUp(Num, NumRuns);
+        ParallelFor(NumRuns, [&](int32 Run)
+        {
+            const int32 First = Run * RunSize;
+            const int32 Count = FMath::Min(RunSize, Num - First);
+            if (Count > 0)
+            {
+                Algo::Sort(TArrayView<ElementType>(Elements.GetData() + First, Count), Predicate);
+            }
+        });
+
+        TArray<ElementType> Scratch;
+        Scratch.SetNumUninitialized(Num);
+        ElementType* Source = Elements.GetData();
+        ElementType* Dest = Scratch.GetData();
+
+        for (int32 Width = RunSize; Width < Num; Width *= 2)
+        {
+            const int32 NumPairs = FMath::DivideAndRoundUp(Num, Width * 2);
+            ParallelFor(NumPairs, [&](int32 Pair)
+            {
+                int32 Left = Pair * Width * 2;
+                const int32 Mid = FMath::Min(Left + Width, Num);
+                const int32 End = FMath::Min(Left + Width * 2, Num);
+                int32 Right = Mid;
+                int32 Out = Left;
+                while (Left < Mid && Right < End)
+                {
+                    Dest[Out++] = Predicate(Source[Right], Source[Left]) ? Source[Right++] : Source[Left++];
+                }
+                while (Left < Mid)
+                {
+                    Dest[Out++] = Source[Left++];
+                }
+                while (Right < End)
+                {
+                    Dest[Out++] = Source[Right++];
+                }
+            });
+            Swap(Source, Dest);
+        }
+
+        if (Source != Elements.GetData())
+        {
+            FMemory::Memcpy(Elements.GetData(), Source, Num * sizeof(ElementType));
+        }
+    }
+
+    /** Identity of a fact for bulk deduplication */
+    struct FBulkFactKey
+    {
+        FRETriple Triple;
+        FName Namespace;
+
+        bool operator==(const FBulkFactKey& Other) const
+        {
+            return Triple.Subject == Other.Triple.Subject
+                && Triple.Predicate == Other.Triple.Predicate
+                && Triple.Object == Other.Triple.Object
+                && Namespace == Other.Namespace;
+        }
+
+        friend uint32 GetTypeHash(const FBulkFactKey& Key)
+        {
+            uint32 Hash = HashCombine(Key.Triple.Subject, Key.Triple.Predicate);
+            Hash = HashCombine(Hash, Key.Triple.Object);
+            return HashCombine(Hash, GetTypeHash(Key.Namespace));
+        }
+    };
+
+    /** Three-way compare of the first PrefixLen keys of an entry against a prefix */
+    FORCEINLINE int32 ComparePrefix(const uint32* Key, const uint32* Prefix, int32 PrefixLen)
+    {
+        for (int32 Index = 0; Index < PrefixLen; ++Index)
+        {
+            if (Key[Index] != Prefix[Index])
+            {
+                return Key[Index] < Prefix[Index] ? -1 : 1;
+            }
+        }
+        return 0;
+    }
+}
+
+// ========== SNAPSHOT LOOKUP ==========
+
+void FRETripleSnapshot::Query(FStringView Subject, FStringView Predicate, FStringView Object,
+                              TFunctionRef<bool(uint32 FactId)> Visitor) const
+{
+    FRETriple Pattern;
+    const FStringView Fields[3] = { Subject, Predicate, Object };
+
+    for (int32 Position = 0; Position < 3; ++Position)
+    {
+        if (!Fields[Position].IsEmpty())
+        {
+            Pattern[Position] = Terms->Find(Fields[Position]);
+            if (Pattern[Position] == InvalidId)
+            {
+                // A term that was never stored cannot match
+                return;
+            }
+        }
+    }
+
+    QueryIds(Pattern, Visitor);
+}
+
+void FRETripleSnapshot::QueryIds(const FRETriple& Pattern, TFunctionRef<bool(uint32 FactId)> Visitor) const
+{
+    uint32 Prefix[3];
+    int32 PrefixLen = 0;
+    const EOrder Order = SelectOrder(Pattern, Prefix, PrefixLen);
+
+    Indexes[Order].ForEachWithPrefix(Prefix, PrefixLen, [&Visitor](const FIndexEntry& Entry)
+    {
+        return Visitor(Entry.FactId);
+    });
+}
+
+int32 FRETripleSnapshot::CountMatches(const FRETriple& Pattern) const
+{
+    uint32 Prefix[3];
+    int32 PrefixLen = 0;
+    const EOrder Order = SelectOrder(Pattern, Prefix, PrefixLen);
+    return Indexes[Order].CountWithPrefix(Prefix, PrefixLen);
+}
+
+bool FRETripleSnapshot::Contains(FStringView Subject, FStringView Predicate, FStringView Object) const
+{
+    if (Subject.IsEmpty() || Predicate.IsEmpty() || Object.IsEmpty())
+    {
+        return false;
+    }
+
+    bool bFound = false;
+    Query(Subject, Predicate, Object, [&bFound](uint32)
+    {
+        bFound = true;
+        return false;
+    });
+    return bFound;
+}
+
+FREFact FRETripleSnapshot::GetFact(uint32 FactId) const
+{
+    const FRETriple& Triple = GetTriple(FactId);
+    const FAttributes& Attr = GetAttributes(FactId);
+
+    FREFact Fact;
+    Fact.Subject = Terms->Resolve(Triple.Subject);
+    Fact.Predicate = Terms->Resolve(Triple.Predicate);
+    Fact.Object = Terms->Resolve(Triple.Object);
+    Fact.Confidence = Attr.Confidence;
+    Fact.Namespace = Attr.Namespace;
+    Fact.Timestamp = Attr.Timestamp;
+    Fact.Source = Attr.Source;
+    Fact.Metadata = Attr.Metadata;
+    return Fact;
+}
+
+FREFactHandle FRETripleSnapshot::MakeHandle(uint32 FactId) const
+{
+    FREFactHandle Handle;
+    Handle.Index = FactId;
+    Handle.Generation = Storage->GetSlot(FactId).Generation.load(std::memory_order_acquire);
+    return Handle;
+}
+
+SIZE_T FRETripleSnapshot::GetAllocatedSize() const
+{
+    SIZE_T Size = sizeof(FStorage) + Terms->GetAllocatedSize();
+    for (const FIndex& Index : Indexes)
+    {
+        Size += Index.GetAllocatedSize();
+    }
+    Size += Storage->NumChunks.load(std::memory_order_relaxed) * FStorage::ChunkSize * sizeof(FSlot);
+
+    for (int32 Position = 0; Position < 3; ++Position)
+    {
+        for (uint32 Chunk = 0; Chunk < FStorage::MaxTermChunks; ++Chunk)
+        {
+            if (Storage->Frequency[Position][Chunk].load(std::memory_order_relaxed))
+            {
+                Size += FStorage::TermChunkSize * sizeof(std::atomic<uint32>);
+            }
+        }
+    }
+
+    Indexes[SPO].ForEachWithPrefix(nullptr, 0, [this, &Size](const FIndexEntry& Entry)
+    {
+        const FAttributes& Attr = GetAttributes(Entry.FactId);
+        Size += Attr.Source.GetAllocatedSize() + Attr.Metadata.GetAllocatedSize();
+        return true;
+    });
+    return Size;
+}
+
+FRETripleSnapshot::EOrder FRETripleSnapshot::SelectOrder(const FRETriple& Pattern, uint32* OutPrefix, int32& OutPrefixLen)
+{
+    const bool bS = Pattern.Subject != InvalidId;
+    const bool bP = Pattern.Predicate != InvalidId;
+    const bool bO = Pattern.Object != InvalidId;
+
+    // Pick the permutation whose leading keys are exactly the bound fields
+    EOrder Order = SPO;
+    uint32* Prefix = OutPrefix;
+    int32 PrefixLen = 0;
+
+    if (bS && bP)
+    {
+        Order = SPO;
+        Prefix[PrefixLen++] = Pattern.Subject;
+        Prefix[PrefixLen++] = Pattern.Predicate;
+        if (bO)
+        {
+            Prefix[PrefixLen++] = Pattern.Object;
+        }
+    }
+    else if (bS && bO)
+    {
+        Order = OSP;
+        Prefix[PrefixLen++] = Pattern.Object;
+        Prefix[PrefixLen++] = Pattern.Subject;
+    }
+    else if (bP && bO)
+    {
+        Order = POS;
+        Prefix[PrefixLen++] = Pattern.Predicate;
+        Prefix[PrefixLen++] = Pattern.Object;
+    }
+    else if (bS)
+    {
+        Order = SPO;
+        Prefix[PrefixLen++] = Pattern.Subject;
+    }
+    else if (bP)
+    {
+        Order = POS;
+        Prefix[PrefixLen++] = Pattern.Predicate;
+    }
+    else if (bO)
+    {
+        Order = OSP;
+        Prefix[PrefixLen++] = Pattern.Object;
+    }
+
+    OutPrefixLen = PrefixLen;
+    return Order;
+}
+
+uint32 FRETripleSnapshot::FindFact(const FRETriple& Triple, FName Namespace) const
+{
+    uint32 Found = InvalidId;
+    QueryIds(Triple, [this, Namespace, &Found](uint32 FactId)
+    {
+        if (GetAttributes(FactId).Namespace == Namespace)
+        {
+            Found = FactId;
+            return false;
+        }
+        return true;
+    });
+    return Found;
+}
+
+// ========== INDEX MAINTENANCE ==========
+
+FRETripleSnapshot::FIndexEntry FRETripleSnapshot::MakeEntry(EOrder Order, const FRETriple& Triple, uint32 FactId)
+{
+    FIndexEntry Entry;
+    switch (Order)
+    {
+    case POS:
+        Entry.Key[0] = Triple.Predicate;
+        Entry.Key[1] = Triple.Object;
+        Entry.Key[2] = Triple.Subject;
+        break;
+    case OSP:
+        Entry.Key[0] = Triple.Object;
+        Entry.Key[1] = Triple.Subject;
+        Entry.Key[2] = Triple.Predicate;
+        break;
+    default:
+        Entry.Key[0] = Triple.Subject;
+        Entry.Key[1] = Triple.Predicate;
+        Entry.Key[2] = Triple.Object;
+        break;
+    }
+    Entry.FactId = FactId;
+    return Entry;
+}
+
+bool FRETripleSnapshot::EntryLess(const FIndexEntry& A, const FIndexEntry& B)
+{
+    const int32 Cmp = ComparePrefix(A.Key, B.Key, 3);
+    return Cmp != 0 ? Cmp < 0 : A.FactId < B.FactId;
+}
+
+void FRETripleSnapshot::InsertEntries(uint32 FactId)
+{
+    const FRETriple& Triple = GetTriple(FactId);
+    for (int32 Order = 0; Order < NumOrders; ++Order)
+    {
+        Indexes[Order].Insert(MakeEntry(static_cast<EOrder>(Order), Triple, FactId));
+    }
+}
+
+void FRETripleSnapshot::RemoveEntries(uint32 FactId)
+{
+    const FRETriple& Triple = GetTriple(FactId);
+    for (int32 Order = 0; Order < NumOrders; ++Order)
+    {
+        Indexes[Order].Remove(MakeEntry(static_cast<EOrder>(Order), Triple, FactId));
+    }
+}
+
+// ========== SHARED STORAGE ==========
+
+FRETripleSnapshot::FStorage::FStorage()
+{
+    for (std::atomic<FSlot*>& Chunk : Chunks)
+    {
+        Chunk.store(nullptr, std::memory_order_relaxed);
+    }
+    for (int32 Position = 0; Position < 3; ++Position)
+    {
+        for (std::atomic<std::atomic<uint32>*>& Chunk : Frequency[Position])
+        {
+            Chunk.store(nullptr, std::memory_order_relaxed);
+        }
+        NumDistinctTerms[Position].store(0, std::memory_order_relaxed);
+    }
+}
+
+FRETripleSnapshot::FStorage::~FStorage()
+{
+    for (std::atomic<FSlot*>& Chunk : Chunks)
+    {
+        delete[] Chunk.load(std::memory_order_relaxed);
+    }
+    for (int32 Position = 0; Position < 3; ++Position)
+    {
+        for (std::atomic<std::atomic<uint32>*>& Chunk : Frequency[Position])
+        {
+            delete[] Chunk.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+uint32 FRETripleSnapshot::FStorage::GetFrequency(int32 Position, uint32 TermId) const
+{
+    check(Position >= 0 && Position < 3);
+    if ((TermId >> TermChunkBits) >= MaxTermChunks)
+    {
+        return 0;
+    }
+
+    const std::atomic<uint32>* Chunk = Frequency[Position][TermId >> TermChunkBits].load(std::memory_order_acquire);
+    return Chunk ? Chunk[TermId & TermChunkMask].load(std::memory_order_relaxed) : 0;
+}
+
+// ========== BLOCKED INDEX ==========
+
+void FRETripleSnapshot::FIndex::FindBlock(const FIndexEntry& Entry, int32& OutSegment, int32& OutBlock) const
+{
+    OutSegment = FMath::Min(Algo::LowerBoundBy(Segments, Entry,
+        [](const TSharedPtr<FSegment>& Candidate) -> const FIndexEntry& { return Candidate->Last()->Last(); },
+        &FRETripleSnapshot::EntryLess), Segments.Num() - 1);
+
+    const FSegment& Segment = *Segments[OutSegment];
+    OutBlock = FMath::Min(Algo::LowerBoundBy(Segment, Entry,
+        [](const TSharedPtr<FBlock>& Candidate) -> const FIndexEntry& { return Candidate->Last(); },
+        &FRETripleSnapshot::EntryLess), Segment.Num() - 1);
+}
+
+bool FRETripleSnapshot::FIndex::FindPrefixBlock(const uint32* Prefix, int32 PrefixLen,
+                                                int32& OutSegment, int32& OutBlock) const
+{
+    OutSegment = Algo::LowerBoundBy(Segments, 0,
+        [Prefix, PrefixLen](const TSharedPtr<FSegment>& Candidate)
+        {
+            return ComparePrefix(Candidate->Last()->Last().Key, Prefix, PrefixLen);
+        });
+    if (OutSegment == Segments.Num())
+    {
+        return false;
+    }
+
+    // The segment's last block reaches the prefix, so this stays in range
+    OutBlock = Algo::LowerBoundBy(*Segments[OutSegment], 0,
+        [Prefix, PrefixLen](const TSharedPtr<FBlock>& Candidate)
+        {
+            return ComparePrefix(Candidate->Last().Key, Prefix, PrefixLen);
+        });
+    return true;
+}
+
+FRETripleSnapshot::FIndex::FSegment& FRETripleSnapshot::FIndex::MutableSegment(int32 SegmentIndex)
+{
+    TSharedPtr<FSegment>& Segment = Segments[SegmentIndex];
+    if (!Segment.IsUnique())
+    {
+        // Copies the block pointers; the blocks stay shared until written
+        TSharedPtr<FSegment> Copy = MakeShared<FSegment>();
+        Copy->Reserve(MaxSegmentSize + 1);
+        Copy->Append(*Segment);
+        Segment = MoveTemp(Copy);
+    }
+    return *Segment;
+}
+
+FRETripleSnapshot::FIndex::FBlock& FRETripleSnapshot::FIndex::MutableBlock(FSegment& Segment, int32 BlockIndex)
+{
+    TSharedPtr<FBlock>& Block = Segment[BlockIndex];
+    if (!Block.IsUnique())
+    {
+        TSharedPtr<FBlock> Copy = MakeShared<FBlock>();
+        Copy->Reserve(MaxBlockSize);
+        Copy->Append(*Block);
+        Block = MoveTemp(Copy);
+    }
+    return *Block;
+}
+
+void FRETripleSnapshot::FIndex::Insert(const FIndexEntry& Entry)
+{
+    // FindBlock needs non-empty segments and blocks, so the first entry starts its own
+    if (Segments.Num() == 0)
+    {
+        TSharedPtr<FBlock> First = MakeShared<FBlock>();
+        First->Reserve(MaxBlockSize);
+        First->Add(Entry);
+
+        TSharedPtr<FSegment> Segment = MakeShared<FSegment>();
+        Segment->Reserve(MaxSegmentSize + 1);
+        Segment->Add(MoveTemp(First));
+        Segments.Add(MoveTemp(Segment));
+        ++NumEntries;
+        return;
+    }
+
+    int32 SegmentIndex = 0;
+    int32 BlockIndex = 0;
+    FindBlock(Entry, SegmentIndex, BlockIndex);
+
+    FSegment& Segment = MutableSegment(SegmentIndex);
+    FBlock& Block = MutableBlock(Segment, BlockIndex);
+    Block.Insert(Entry, Algo::LowerBound(Block, Entry, &FRETripleSnapshot::EntryLess));
+    ++NumEntries;
+
+    if (Block.Num() <= MaxBlockSize)
+    {
+        return;
+    }
+
+    // Split in half so both blocks have room for further inserts
+    const int32 Half = Block.Num() / 2;
+    TSharedPtr<FBlock> Upper = MakeShared<FBlock>();
+    Upper->Reserve(MaxBlockSize);
+    Upper->Append(Block.GetData() + Half, Block.Num() - Half);
+    Block.SetNum(Half, EAllowShrinking::No);
+    Segment.Insert(MoveTemp(Upper), BlockIndex + 1);
+
+    if (Segment.Num() > MaxSegmentSize)
+    {
+        const int32 HalfSegment = Segment.Num() / 2;
+        TSharedPtr<FSegment> UpperSegment = MakeShared<FSegment>();
+        UpperSegment->Reserve(MaxSegmentSize + 1);
+        UpperSegment->Append(Segment.GetData() + HalfSegment, Segment.Num() - HalfSegment);
+        Segment.SetNum(HalfSegment, EAllowShrinking::No);
+        Segments.Insert(MoveTemp(UpperSegment), SegmentIndex + 1);
+    }
+}
+
+bool FRETripleSnapshot::FIndex::Remove(const FIndexEntry& Entry)
+{
+    if (Segments.Num() == 0)
+    {
+        return false;
+    }
+
+    // Locate the entry before copying a shared segment or block
+    int32 SegmentIndex = 0;
+    int32 BlockIndex = 0;
+    FindBlock(Entry, SegmentIndex, BlockIndex);
+
+    const FBlock& Shared = *(*Segments[SegmentIndex])[BlockIndex];
+    const int32 Position = Algo::LowerBound(Shared, Entry, &FRETripleSnapshot::EntryLess);
+    if (!Shared.IsValidIndex(Position) || Shared[Position].FactId != Entry.FactId)
+    {
+        return false;
+    }
+
+    FSegment& Segment = MutableSegment(SegmentIndex);
+    FBlock& Block = MutableBlock(Segment, BlockIndex);
+    Block.RemoveAt(Position, 1, EAllowShrinking::No);
+    --NumEntries;
+
+    if (Block.Num() == 0)
+    {
+        Segment.RemoveAt(BlockIndex);
+        if (Segment.Num() == 0)
+        {
+            Segments.RemoveAt(SegmentIndex);
+        }
+    }
+    return true;
+}
+
+void FRETripleSnapshot::FIndex::Build(TArrayView<const FIndexEntry> Sorted)
+{
+    Segments.Reset();
+    NumEntries = Sorted.Num();
+
+    // Leave a quarter of each block and segment free for incremental inserts
+    constexpr int32 FillSize = MaxBlockSize * 3 / 4;
+    constexpr int32 SegmentFillSize = MaxSegmentSize * 3 / 4;
+    for (int32 Start = 0; Start < Sorted.Num(); Start += FillSize)
+    {
+        if (Segments.Num() == 0 || Segments.Last()->Num() == SegmentFillSize)
+        {
+            TSharedPtr<FSegment> Segment = MakeShared<FSegment>();
+            Segment->Reserve(MaxSegmentSize + 1);
+            Segments.Add(MoveTemp(Segment));
+        }
+
+        TSharedPtr<FBlock> Block = MakeShared<FBlock>();
+        Block->Reserve(MaxBlockSize);
+        Block->Append(Sorted.GetData() + Start, FMath::Min(FillSize, Sorted.Num() - Start));
+        Segments.Last()->Add(MoveTemp(Block));
+    }
+}
+
+void FRETripleSnapshot::FIndex::Merge(TArrayView<const FIndexEntry> Sorted, const TBitArray<>* Dropped)
+{
+    if (NumEntries == 0)
+    {
+        Build(Sorted);
+        return;
+    }
+
+    TArray<FIndexEntry> Merged;
+    Merged.Reserve(NumEntries + Sorted.Num());
+
+    int32 Next = 0;
+    for (const TSharedPtr<FSegment>& Segment : Segments)
+    {
+        for (const TSharedPtr<FBlock>& Block : *Segment)
+        {
+            for (const FIndexEntry& Entry : *Block)
+            {
+                const int32 FactIndex = static_cast<int32>(Entry.FactId);
+                if (Dropped && Dropped->IsValidIndex(FactIndex) && (*Dropped)[FactIndex])
+                {
+                    continue;
+                }
+
+                while (Next < Sorted.Num() && FRETripleSnapshot::EntryLess(Sorted[Next], Entry))
+                {
+                    Merged.Add(Sorted[Next++]);
+                }
+                Merged.Add(Entry);
+            }
+        }
+    }
+    Merged.Append(Sorted.GetData() + Next, Sorted.Num() - Next);
+
+    Build(Merged);
+}
+
+void FRETripleSnapshot::FIndex::ForEachWithPrefix(const uint32* Prefix, int32 PrefixLen,
+                                                  TFunctionRef<bool(const FIndexEntry&)> Visitor) const
+{
+    int32 SegmentIndex = 0;
+    int32 BlockIndex = 0;
+    if (!FindPrefixBlock(Prefix, PrefixLen, SegmentIndex, BlockIndex))
+    {
+        return;
+    }
+
+    for (; SegmentIndex < Segments.Num(); ++SegmentIndex, BlockIndex = 0)
+    {
+        const FSegment& Segment = *Segments[SegmentIndex];
+        for (; BlockIndex < Segment.Num(); ++BlockIndex)
+        {
+            const FBlock& Block = *Segment[BlockIndex];
+            const int32 First = Algo::LowerBoundBy(Block, 0,
+                [Prefix, PrefixLen](const FIndexEntry& Candidate)
+                {
+                    return ComparePrefix(Candidate.Key, Prefix, PrefixLen);
+                });
+
+            for (int32 Position = First; Position < Block.Num(); ++Position)
+            {
+                const FIndexEntry& Entry = Block[Position];
+                if (ComparePrefix(Entry.Key, Prefix, PrefixLen) != 0 || !Visitor(Entry))
+                {
+                    return;
+                }
+            }
+        }
+    }
+}
+
+int32 FRETripleSnapshot::FIndex::CountWithPrefix(const uint32* Prefix, int32 PrefixLen) const
+{
+    int32 SegmentIndex = 0;
+    int32 BlockIndex = 0;
+    if (!FindPrefixBlock(Prefix, PrefixLen, SegmentIndex, BlockIndex))
+    {
+        return 0;
+    }
+
+    auto Project = [Prefix, PrefixLen](const FIndexEntry& Candidate)
+    {
+        return ComparePrefix(Candidate.Key, Prefix, PrefixLen);
+    };
+
+    int32 Count = 0;
+    for (; SegmentIndex < Segments.Num(); ++SegmentIndex, BlockIndex = 0)
+    {
+        const FSegment& Segment = *Segments[SegmentIndex];
+        for (; BlockIndex < Segment.Num(); ++BlockIndex)
+        {
+            const FBlock& Block = *Segment[BlockIndex];
+            const int32 First = Algo::LowerBoundBy(Block, 0, Project);
+            const int32 Last = Algo::UpperBoundBy(Block, 0, Project);
+            Count += Last - First;
+
+            // The range continues only if it runs to the end of this block
+            if (Last < Block.Num())
+            {
+                return Count;
+            }
+        }
+    }
+    return Count;
+}
+
+SIZE_T FRETripleSnapshot::FIndex::GetAllocatedSize() const
+{
+    // Segments and blocks shared with other snapshots are counted in each of them
+    SIZE_T Size = Segments.GetAllocatedSize();
+    for (const TSharedPtr<FSegment>& Segment : Segments)
+    {
+        Size += Segment->GetAllocatedSize();
+        for (const TSharedPtr<FBlock>& Block : *Segment)
+        {
+            Size += Block->GetAllocatedSize();
+        }
+    }
+    return Size;
+}
+
+// ========== STORE ==========
+
+FRETripleStore::FRETripleStore()
+    : Current(MakeEmptySnapshot(0))
+{
+    Published.Add(Current);
+}
+
+FRETripleStore::~FRETripleStore() = default;
+
+TSharedRef<const FRETripleSnapshot> FRETripleStore::GetSnapshot() const
+{
+    FReadScopeLock Lock(SnapshotLock);
+    return Current;
+}
+
+bool FRETripleStore::IsValid(FREFactHandle Handle) const
+{
+    // Live slots have odd generations, so a default handle never matches
+    if ((Handle.Generation & 1) == 0 || (Handle.Index >> FRETripleSnapshot::FStorage::ChunkBits) >= FRETripleSnapshot::FStorage::MaxChunks)
+    {
+        return false;
+    }
+
+    const TSharedRef<const FRETripleSnapshot> Snapshot = GetSnapshot();
+    const FRETripleSnapshot::FSlot* Chunk = Snapshot->Storage->Chunks[Handle.Index >> FRETripleSnapshot::FStorage::ChunkBits].load(std::memory_order_acquire);
+    return Chunk
+        && Chunk[Handle.Index & FRETripleSnapshot::FStorage::ChunkMask].Generation.load(std::memory_order_acquire) == Handle.Generation;
+}
+
+// ========== MUTATION ==========
+
+FREFactHandle FRETripleStore::Add(const FREFact& Fact, FName Namespace)
+{
+    check(Fact.IsValid());
+
+    FScopeLock Lock(&WriteMutex);
+    ReclaimRetiredSlots();
+
+    const TSharedRef<FRETripleSnapshot> Next = BeginWrite();
+    FRETripleSnapshot::FStorage& Storage = *Next->Storage;
+
+    FRETriple Triple;
+    Triple.Subject = Next->Terms->Intern(Fact.Subject);
+    Triple.Predicate = Next->Terms->Intern(Fact.Predicate);
+    Triple.Object = Next->Terms->Intern(Fact.Object);
+    if (Triple.Subject == InvalidId || Triple.Predicate == InvalidId || Triple.Object == InvalidId)
+    {
+        UE_LOG(LogReasoningEngine, Warning, TEXT("FRETripleStore: term pool is full, fact '%s' not stored"), *Fact.ToString());
+        return FREFactHandle();
+    }
+
+    // Updates write a fresh slot: older snapshots keep reading the old one
+    const uint32 Existing = Next->FindFact(Triple, Namespace);
+    const uint32 FactId = AllocateSlot(Storage);
+    if (FactId == InvalidId)
+    {
+        return FREFactHandle();
+    }
+
+    FRETripleSnapshot::FSlot& Slot = Storage.GetSlot(FactId);
+    Slot.Triple = Triple;
+    Slot.Attributes.Confidence = Fact.Confidence;
+    Slot.Attributes.Namespace = Namespace;
+    Slot.Attributes.Timestamp = Fact.Timestamp;
+    Slot.Attributes.Source = Fact.Source;
+    Slot.Attributes.Metadata = Fact.Metadata;
+
+    if (Existing != InvalidId)
+    {
+        Next->RemoveEntries(Existing);
+        RetireSlot(Storage, Existing);
+    }
+    else
+    {
+        UpdateTermFrequency(Storage, Triple, 1);
+        ++Next->NumFacts;
+    }
+    Next->InsertEntries(FactId);
+
+    const FREFactHandle Handle = Next->MakeHandle(FactId);
+    Publish(Next);
+    return Handle;
+}
+
+int32 FRETripleStore::AddBulk(TArrayView<const FREFact> Facts, FName Namespace)
+{
+    const int32 NumFacts = Facts.Num();
+    const bool bSingleThread = NumFacts < BulkParallelThreshold;
+
+    FScopeLock Lock(&WriteMutex);
+    ReclaimRetiredSlots();
+
+    const TSharedRef<FRETripleSnapshot> Next = BeginWrite();
+    FRETripleSnapshot::FStorage& Storage = *Next->Storage;
+    FREStringPool& Terms = *Next->Terms;
+
+    // Interning is thread-safe and probing only reads the indexes
+    TArray<FRETriple> Triples;
+    TArray<uint32> Existing;
+    Triples.SetNumUninitialized(NumFacts);
+    Existing.SetNumUninitialized(NumFacts);
+
+    ParallelFor(NumFacts, [&](int32 Index)
+    {
+        const FREFact& Fact = Facts[Index];
+        FRETriple& Triple = Triples[Index];
+        Existing[Index] = InvalidId;
+
+        if (!Fact.IsValid())
+        {
+            Triple = FRETriple();
+            return;
+        }
+
+        Triple.Subject = Terms.Intern(Fact.Subject);
+        Triple.Predicate = Terms.Intern(Fact.Predicate);
+        Triple.Object = Terms.Intern(Fact.Object);
+        if (Triple.Subject == InvalidId || Triple.Predicate == InvalidId || Triple.Object == InvalidId)
+        {
+            // Term pool is full (logged by the pool); skipped like an invalid fact
+            Triple = FRETriple();
+            return;
+        }
+        Existing[Index] = Next->FindFact(Triple, Namespace.IsNone() ? Fact.Namespace : Namespace);
+    }, bSingleThread);
+
+    // Collapse duplicates; value is (new slot, index of the last copy).
+    // Every stored fact gets a fresh slot so held snapshots are unaffected
+    TMap<FBulkFactKey, TPair<uint32, int32>> Targets;
+    Targets.Reserve(NumFacts);
+    TArray<uint32> NewFactIds;
+    TArray<uint32> ReplacedFactIds;
+    int32 NumAdded = 0;
+
+    for (int32 Index = 0; Index < NumFacts; ++Index)
+    {
+        if (Triples[Index].Subject == InvalidId)
+        {
+            continue;
+        }
+
+        const FBulkFactKey Key{ Triples[Index], Namespace.IsNone() ? Facts[Index].Namespace : Namespace };
+        if (TPair<uint32, int32>* Target = Targets.Find(Key))
+        {
+            Target->Value = Index;
+            continue;
+        }
+
+        const uint32 FactId = AllocateSlot(Storage);
+        if (FactId == InvalidId)
+        {
+            // Arena is full; store what fits and report it
+            UE_LOG(LogReasoningEngine, Warning, TEXT("FRETripleStore: bulk add stopped after %d of %d facts (%d new)"),
+                   Index, NumFacts, NumAdded);
+            break;
+        }
+        Storage.GetSlot(FactId).Triple = Triples[Index];
+        NewFactIds.Add(FactId);
+        Targets.Add(Key, TPair<uint32, int32>(FactId, Index));
+
+        if (Existing[Index] != InvalidId)
+        {
+            ReplacedFactIds.Add(Existing[Index]);
+        }
+        else
+        {
+            UpdateTermFrequency(Storage, Triples[Index], 1);
+            ++NumAdded;
+        }
+    }
+
+    if (NewFactIds.Num() == 0)
+    {
+        return 0;
+    }
+
+    // Side-table fields, one writer per slot
+    TArray<TPair<uint32, int32>> Writes;
+    Targets.GenerateValueArray(Writes);
+
+    ParallelFor(Writes.Num(), [&](int32 Write)
+    {
+        const FREFact& Fact = Facts[Writes[Write].Value];
+        FRETripleSnapshot::FAttributes& Attr = Storage.GetSlot(Writes[Write].Key).Attributes;
+        Attr.Confidence = Fact.Confidence;
+        Attr.Namespace = Namespace.IsNone() ? Fact.Namespace : Namespace;
+        Attr.Timestamp = Fact.Timestamp;
+        Attr.Source = Fact.Source;
+        Attr.Metadata = Fact.Metadata;
+    }, bSingleThread);
+
+    TBitArray<> Dropped(false, static_cast<int32>(NumSlots));
+    for (uint32 FactId : ReplacedFactIds)
+    {
+        Dropped[static_cast<int32>(FactId)] = true;
+        RetireSlot(Storage, FactId);
+    }
+
+    // Small batches go through the incremental path; large ones are sorted
+    // per index in parallel and merged in a single pass
+    ParallelFor(FRETripleSnapshot::NumOrders, [&](int32 Order)
+    {
+        const FRETripleSnapshot::EOrder IndexOrder = static_cast<FRETripleSnapshot::EOrder>(Order);
+        FRETripleSnapshot::FIndex& Index = Next->Indexes[Order];
+
+        if (NewFactIds.Num() * 8 < Index.Num())
+        {
+            for (uint32 FactId : ReplacedFactIds)
+            {
+                Index.Remove(FRETripleSnapshot::MakeEntry(IndexOrder, Storage.GetSlot(FactId).Triple, FactId));
+            }
+            for (uint32 FactId : NewFactIds)
+            {
+                Index.Insert(FRETripleSnapshot::MakeEntry(IndexOrder, Storage.GetSlot(FactId).Triple, FactId));
+            }
+            return;
+        }
+
+        TArray<FRETripleSnapshot::FIndexEntry> Sorted;
+        Sorted.SetNumUninitialized(NewFactIds.Num());
+        for (int32 New = 0; New < NewFactIds.Num(); ++New)
+        {
+            Sorted[New] = FRETripleSnapshot::MakeEntry(IndexOrder, Storage.GetSlot(NewFactIds[New]).Triple, NewFactIds[New]);
+        }
+
+        ParallelSort(Sorted, &FRETripleSnapshot::EntryLess);
+        Index.Merge(Sorted, ReplacedFactIds.Num() > 0 ? &Dropped : nullptr);
+    }, bSingleThread);
+
+    Next->NumFacts += NumAdded;
+    Publish(Next);
+    return NumAdded;
+}
+
+bool FRETripleStore::Remove(FStringView Subject, FStringView Predicate, FStringView Object, FName Namespace)
+{
+    FScopeLock Lock(&WriteMutex);
+    ReclaimRetiredSlots();
+
+    FRETriple Triple;
+    Triple.Subject = Current->FindTerm(Subject);
+    Triple.Predicate = Current->FindTerm(Predicate);
+    Triple.Object = Current->FindTerm(Object);
+
+    if (Triple.Subject == InvalidId || Triple.Predicate == InvalidId || Triple.Object == InvalidId)
+    {
+        return false;
+    }
+
+    const uint32 FactId = Current->FindFact(Triple, Namespace);
+    if (FactId == InvalidId)
+    {
+        return false;
+    }
+
+    RemoveLocked(FactId);
+    return true;
+}
+
+bool FRETripleStore::Remove(FREFactHandle Handle)
+{
+    FScopeLock Lock(&WriteMutex);
+    ReclaimRetiredSlots();
+
+    if (Handle.Index >= NumSlots
+        || !LiveFacts[Handle.Index]
+        || Current->Storage->GetSlot(Handle.Index).Generation.load(std::memory_order_relaxed) != Handle.Generation)
+    {
+        return false;
+    }
+
+    RemoveLocked(Handle.Index);
+    return true;
+}
+
+void FRETripleStore::RebuildIndexes()
+{
+    FScopeLock Lock(&WriteMutex);
+
+    const TSharedRef<FRETripleSnapshot> Next = BeginWrite();
+    const FRETripleSnapshot::FStorage& Storage = *Next->Storage;
+
+    TArray<FRETripleSnapshot::FIndexEntry> Sorted;
+    Sorted.Reserve(Next->NumFacts);
+
+    for (int32 Order = 0; Order < FRETripleSnapshot::NumOrders; ++Order)
+    {
+        Sorted.Reset();
+        for (TConstSetBitIterator<> It(LiveFacts); It; ++It)
+        {
+            const uint32 FactId = static_cast<uint32>(It.GetIndex());
+            Sorted.Add(FRETripleSnapshot::MakeEntry(static_cast<FRETripleSnapshot::EOrder>(Order), Storage.GetSlot(FactId).Triple, FactId));
+        }
+
+        Algo::Sort(Sorted, &FRETripleSnapshot::EntryLess);
+        Next->Indexes[Order].Build(Sorted);
+    }
+
+    Publish(Next);
+}
+
+void FRETripleStore::Reset()
+{
+    FScopeLock Lock(&WriteMutex);
+
+    // Held snapshots keep the old arena and term pool alive
+    const TSharedRef<const FRETripleSnapshot> Empty = MakeEmptySnapshot(Current->Version + 1);
+
+    LiveFacts.Empty();
+    FreeFactIds.Empty();
+    NumSlots = 0;
+    Retiring.Empty();
+    RetireQueue.Empty();
+    Published.Reset();
+    Published.Add(Empty);
+
+    const TSharedRef<const FRETripleSnapshot> Previous = Current;
+    FWriteScopeLock SnapshotWrite(SnapshotLock);
+    Current = Empty;
+}
+
+// ========== SNAPSHOT PUBLICATION ==========
+
+TSharedRef<FRETripleSnapshot> FRETripleStore::MakeEmptySnapshot(uint64 Version)
+{
+    TSharedRef<FRETripleSnapshot> Snapshot = MakeShareable(new FRETripleSnapshot());
+    Snapshot->Storage = MakeShared<FRETripleSnapshot::FStorage>();
+    Snapshot->Terms = MakeShared<FREStringPool>();
+    Snapshot->Version = Version;
+    return Snapshot;
+}
+
+TSharedRef<FRETripleSnapshot> FRETripleStore::BeginWrite() const
+{
+    // Copies the three segment lists; segments and blocks stay shared until written
+    TSharedRef<FRETripleSnapshot> Next = MakeShareable(new FRETripleSnapshot(*Current));
+    ++Next->Version;
+    return Next;
+}
+
+void FRETripleStore::Publish(const TSharedRef<FRETripleSnapshot>& Next)
+{
+    // Released outside the lock so readers never wait on a snapshot's destruction
+    const TSharedRef<const FRETripleSnapshot> Previous = Current;
+    {
+        FWriteScopeLock Lock(SnapshotLock);
+        Current = Next;
+    }
+    Published.Add(TWeakPtr<const FRETripleSnapshot>(Next));
+
+    if (Retiring.Num() > 0)
+    {
+        FRetiredSlots& Retired = RetireQueue.AddDefaulted_GetRef();
+        Retired.RetiredIn = Next->Version;
+        Retired.FactIds = MoveTemp(Retiring);
+        Retiring.Reset();
+    }
+}
+
+void FRETripleStore::RemoveLocked(uint32 FactId)
+{
+    const TSharedRef<FRETripleSnapshot> Next = BeginWrite();
+    FRETripleSnapshot::FStorage& Storage = *Next->Storage;
+
+    Next->RemoveEntries(FactId);
+    UpdateTermFrequency(Storage, Storage.GetSlot(FactId).Triple, -1);
+    RetireSlot(Storage, FactId);
+    --Next->NumFacts;
+
+    Publish(Next);
+}
+
+// ========== FACT ARENA ==========
+
+uint32 FRETripleStore::AllocateSlot(FRETripleSnapshot::FStorage& Storage)
+{
+    uint32 FactId;
+    if (FreeFactIds.Num() > 0)
+    {
+        FactId = FreeFactIds.Pop(EAllowShrinking::No);
+        LiveFacts[FactId] = true;
+    }
+    else
+    {
+        const uint32 ChunkIndex = NumSlots >> FRETripleSnapshot::FStorage::ChunkBits;
+        if (ChunkIndex >= FRETripleSnapshot::FStorage::MaxChunks)
+        {
+            UE_LOG(LogReasoningEngine, Warning, TEXT("FRETripleStore: fact arena is full (%u slots)"), NumSlots);
+            return InvalidId;
+        }
+
+        FactId = NumSlots++;
+
+        if (!Storage.Chunks[ChunkIndex].load(std::memory_order_relaxed))
+        {
+            Storage.Chunks[ChunkIndex].store(new FRETripleSnapshot::FSlot[FRETripleSnapshot::FStorage::ChunkSize], std::memory_order_release);
+            Storage.NumChunks.fetch_add(1, std::memory_order_relaxed);
+        }
+        LiveFacts.Add(true);
+    }
+
+    // Odd generation marks the slot live
+    Storage.GetSlot(FactId).Generation.fetch_add(1, std::memory_order_release);
+    return FactId;
+}
+
+void FRETripleStore::RetireSlot(FRETripleSnapshot::FStorage& Storage, uint32 FactId)
+{
+    // Handles go stale now; the row stays readable for older snapshots
+    Storage.GetSlot(FactId).Generation.fetch_add(1, std::memory_order_release);
+    LiveFacts[FactId] = false;
+    Retiring.Add(FactId);
+}
+
+void FRETripleStore::ReclaimRetiredSlots()
+{
+    // Snapshots are released in any order; a slot retired by version N is
+    // free once no snapshot older than N is held
+    Published.RemoveAll([](const TWeakPtr<const FRETripleSnapshot>& Snapshot)
+    {
+        return !Snapshot.IsValid();
+    });
+
+    uint64 OldestVersion = Current->Version;
+    for (const TWeakPtr<const FRETripleSnapshot>& Snapshot : Published)
+    {
+        if (const TSharedPtr<const FRETripleSnapshot> Held = Snapshot.Pin())
+        {
+            OldestVersion = Held->Version;
+            break;
+        }
+    }
+
+    FRETripleSnapshot::FStorage& Storage = *Current->Storage;
+
+    int32 NumReclaimed = 0;
+    while (NumReclaimed < RetireQueue.Num() && RetireQueue[NumReclaimed].RetiredIn <= OldestVersion)
+    {
+        for (uint32 FactId : RetireQueue[NumReclaimed].FactIds)
+        {
+            Storage.GetSlot(FactId).Attributes = FRETripleSnapshot::FAttributes();
+            FreeFactIds.Add(FactId);
+        }
+        ++NumReclaimed;
+    }
+    RetireQueue.RemoveAt(0, NumReclaimed);
+}
+
+void FRETripleStore::UpdateTermFrequency(FRETripleSnapshot::FStorage& Storage, const FRETriple& Triple, int32 Delta)
+{
+    using FStorage = FRETripleSnapshot::FStorage;
+
+    for (int32 Position = 0; Position < 3; ++Position)
+    {
+        const uint32 TermId = Triple[Position];
+        const uint32 ChunkIndex = TermId >> FStorage::TermChunkBits;
+        if (ChunkIndex >= FStorage::MaxTermChunks)
+        {
+            // Adds and removes skip the same terms, so the counts stay balanced
+            static std::atomic<bool> bReported(false);
+            if (!bReported.exchange(true, std::memory_order_relaxed))
+            {
+                UE_LOG(LogReasoningEngine, Warning, TEXT("FRETripleStore: term statistics are full; term %u and later are not counted"), TermId);
+            }
+            continue;
+        }
+
+        std::atomic<uint32>* Chunk = Storage.Frequency[Position][ChunkIndex].load(std::memory_order_relaxed);
+        if (!Chunk)
+        {
+            Chunk = new std::atomic<uint32>[FStorage::TermChunkSize];
+            for (uint32 Index = 0; Index < FStorage::TermChunkSize; ++Index)
+            {
+                Chunk[Index].store(0, std::memory_order_relaxed);
+            }
+            Storage.Frequency[Position][ChunkIndex].store(Chunk, std::memory_order_release);
+        }
+
+        const uint32 Before = Chunk[TermId & FStorage::TermChunkMask].fetch_add(static_cast<uint32>(Delta), std::memory_order_relaxed);
+        const uint32 After = Before + static_cast<uint32>(Delta);
+        Storage.NumDistinctTerms[Position].fetch_add((Before == 0) - (After == 0), std::memory_order_relaxed);
+    }
+}
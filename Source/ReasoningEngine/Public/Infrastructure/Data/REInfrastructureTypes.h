@@ -368,7 +368,11 @@ struct REASONINGENGINE_API FREToken
     UPROPERTY(BlueprintReadWrite, Category="Scoring")
     float Confidence = 1.0f;
     
+    /** Id of NormalizedText in FRETokenDictionary (MAX_uint32 unless the tokenizer emitted ids) */
+    uint32 TokenId = MAX_uint32;
+    
     int32 Length() const { return EndIndex - StartIndex; }
+    bool HasTokenId() const { return TokenId != MAX_uint32; }
     bool IsEmpty() const { return Text.IsEmpty(); }
 };
 
@@ -479,6 +483,10 @@ struct REASONINGENGINE_API FRETokenizerConfig
     UPROPERTY(BlueprintReadWrite, Category="Config")
     bool bGenerateVariants = false;
     
+    /** With bGenerateVariants, leave FREToken::Variants empty and generate on demand via RETokenizer::GetVariants */
+    UPROPERTY(BlueprintReadWrite, Category="Config")
+    bool bDeferVariants = false;
+    
     UPROPERTY(BlueprintReadWrite, Category="Config")
     bool bNormalizeCase = true;
     
@@ -499,6 +507,18 @@ struct REASONINGENGINE_API FRETokenizerConfig
     
     UPROPERTY(BlueprintReadWrite, Category="Config")
     bool bExpandAbbreviations = false;
+    
+    /** Split delimiter-free names ("walkforwardloop") with FREWordSegmenter::GetDefault */
+    UPROPERTY(BlueprintReadWrite, Category="Config")
+    bool bSegmentWords = false;
+    
+    /** Shortest all-letter token that word segmentation is tried on */
+    UPROPERTY(BlueprintReadWrite, Category="Config")
+    int32 MinSegmentLength = 6;
+    
+    /** Fill FREToken::TokenId from the shared FRETokenDictionary */
+    UPROPERTY(BlueprintReadWrite, Category="Config")
+    bool bEmitTokenIds = false;
 };
 
 /**
@@ -0,0 +1,84 @@
+// Source/ReasoningEngine/Public/Infrastructure/REAssetNameIndex.h
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Inverted index of animation asset names by token
+ * Tokenizes many asset names at once with RETokenizer::TokenizeAnimationName
+ * and maps each token to the assets whose names contain it
+ * 
+ * Design Philosophy:
+ * - Names are tokenized in parallel; postings are built in one pass
+ * - Tokens are FRETokenDictionary ids, postings are sorted asset indices
+ * - An optional disk cache stores each name's tokens keyed by a hash of
+ *   the name, so later builds only tokenize names that are new or changed;
+ *   the whole cache is dropped when the tokenizer settings or the default
+ *   word segmenter vocabulary differ from when it was written
+ */
+class REASONINGENGINE_API FREAssetNameIndex
+{
+public:
+    /** What a Build call did */
+    struct FBuildStats
+    {
+        int32 NumAssets = 0;
+        int32 NumTokenized = 0;
+        int32 NumFromCache = 0;
+        bool bCacheWritten = false;
+    };
+    
+    /**
+     * Rebuild the index from asset names or object paths
+     * @param AssetPaths - e.g. "/Game/Anims/MM_Walk_Fwd.MM_Walk_Fwd" or "MM_Walk_Fwd"
+     * @param CacheFilePath - Optional cache file to read and refresh
+     * @return Build statistics
+     */
+    FBuildStats Build(const TArray<FString>& AssetPaths, const FString& CacheFilePath = FString());
+    
+    /**
+     * Assets whose names contain a token
+     * @param Token - Token in any case
+     * @return Sorted asset indices (empty if the token is unknown)
+     */
+    TArrayView<const int32> FindAssets(const FString& Token) const;
+    
+    /**
+     * Assets whose names contain every token
+     * @param Tokens - Tokens in any case
+     * @return Sorted asset indices
+     */
+    TArray<int32> FindAssetsWithAll(const TArray<FString>& Tokens) const;
+    
+    /** Path of an asset as passed to Build */
+    const FString& GetAssetPath(int32 AssetIndex) const { return AssetPaths[AssetIndex]; }
+    
+    /** Token ids of an asset's name, in order */
+    const TArray<uint32>& GetAssetTokenIds(int32 AssetIndex) const { return AssetTokenIds[AssetIndex]; }
+    
+    /** Number of indexed assets */
+    int32 Num() const { return AssetPaths.Num(); }
+    
+    /** Number of distinct tokens */
+    int32 NumTokens() const { return Postings.Num(); }
+    
+    /**
+     * Asset name used for tokenization ("/Game/A/MM_Walk.MM_Walk" -> "MM_Walk")
+     * @param AssetPath - Object path, package path or bare name
+     */
+    static FString GetAssetName(const FString& AssetPath);
+    
+private:
+    /** Bump when the file layout or TokenizeAnimationName code changes to invalidate caches */
+    static constexpr int32 CacheVersion = 2;
+    
+    using FCachedTokens = TMap<uint64, TPair<FString, TArray<FString>>>;
+    
+    /** Read a cache file; fails if it was written with a different TokenizerHash */
+    static bool LoadCache(const FString& FilePath, uint64 TokenizerHash, FCachedTokens& OutEntries);
+    static bool SaveCache(const FString& FilePath, uint64 TokenizerHash, const FCachedTokens& Entries);
+    
+    TArray<FString> AssetPaths;
+    TArray<TArray<uint32>> AssetTokenIds;
+    TMap<uint32, TArray<int32>> Postings;
+};
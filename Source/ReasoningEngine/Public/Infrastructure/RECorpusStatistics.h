@@ -0,0 +1,120 @@
+// Source/ReasoningEngine/Public/Infrastructure/RECorpusStatistics.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Infrastructure/Data/REInfrastructureTypes.h"
+#include <atomic>
+
+/**
+ * Incremental document-frequency statistics over a token corpus
+ * Feeds IDF to RETokenizer::CalculateTokenWeights / CalculateTermWeights
+ * 
+ * Design Philosophy:
+ * - Counters are indexed by FRETokenDictionary id and live in fixed-size
+ *   chunks, so ingesting from many threads is a relaxed atomic increment
+ *   per distinct token with no locks
+ * - IDF is computed on demand from the live counts
+ * - Persisted by token text, since ids are only stable within a process
+ */
+class REASONINGENGINE_API FRECorpusStatistics
+{
+public:
+    FRECorpusStatistics();
+    ~FRECorpusStatistics();
+    
+    FRECorpusStatistics(const FRECorpusStatistics&) = delete;
+    FRECorpusStatistics& operator=(const FRECorpusStatistics&) = delete;
+    
+    /**
+     * Corpus shared by the tokenizer and vectorizer
+     */
+    static FRECorpusStatistics& GetShared();
+    
+    // ========== INGESTION ==========
+    
+    /**
+     * Count one document
+     * @param Ids - Token ids of the document (repeats count once)
+     */
+    void AddDocument(TArrayView<const uint32> Ids);
+    
+    /**
+     * Count one tokenized document
+     * @param Stream - Token stream (tokens without ids are interned)
+     */
+    void AddDocument(const FRETokenStream& Stream);
+    
+    /**
+     * Remove a document previously added with the same ids
+     * @param Ids - Token ids of the document
+     */
+    void RemoveDocument(TArrayView<const uint32> Ids);
+    
+    // ========== QUERIES ==========
+    
+    /** Number of documents containing a token */
+    uint32 GetDocumentFrequency(uint32 Id) const;
+    
+    /** Number of documents ingested */
+    uint64 GetNumDocuments() const { return NumDocuments.load(std::memory_order_relaxed); }
+    
+    /**
+     * Smoothed inverse document frequency: ln((1 + N) / (1 + df)) + 1
+     * Unseen tokens get the highest IDF of the corpus
+     * @param Id - Token id
+     */
+    float GetIdf(uint32 Id) const;
+    
+    /**
+     * IDF for every id currently published by FRETokenDictionary
+     * Ids still being interned by other threads are left out
+     * @param OutIdf - Indexed by token id
+     */
+    void BuildIdfTable(TArray<float>& OutIdf) const;
+    
+    // ========== PERSISTENCE ==========
+    
+    /**
+     * Write the statistics to disk
+     * @param FilePath - Destination file
+     * @return true on success
+     */
+    bool SaveToFile(const FString& FilePath) const;
+    
+    /**
+     * Replace the statistics with a file written by SaveToFile
+     * Not safe to call while other threads ingest
+     * @param FilePath - Source file
+     * @return true on success (statistics are unchanged on failure)
+     */
+    bool LoadFromFile(const FString& FilePath);
+    
+    /**
+     * Forget every document
+     * Not safe to call while other threads ingest
+     */
+    void Reset();
+    
+private:
+    static constexpr uint32 ChunkBits = 12;
+    static constexpr uint32 ChunkSize = 1u << ChunkBits;
+    static constexpr uint32 ChunkMask = ChunkSize - 1;
+    static constexpr uint32 MaxChunks = 4096;
+    
+    /** Counter for an id, allocating its chunk if needed; null (and logged) past MaxChunks */
+    std::atomic<uint32>* GetCounter(uint32 Id);
+    
+    /** Counter for an id, or null if its chunk was never allocated */
+    const std::atomic<uint32>* FindCounter(uint32 Id) const;
+    
+    std::atomic<uint32>* FindCounter(uint32 Id)
+    {
+        return const_cast<std::atomic<uint32>*>(static_cast<const FRECorpusStatistics*>(this)->FindCounter(Id));
+    }
+    
+    /** Distinct ids of a document */
+    static void GetUniqueIds(TArrayView<const uint32> Ids, TArray<uint32>& OutUnique);
+    
+    std::atomic<std::atomic<uint32>*> Chunks[MaxChunks];
+    std::atomic<uint64> NumDocuments;
+};
@@ -0,0 +1,94 @@
+// Source/ReasoningEngine/Public/Infrastructure/RENormalizedFormTable.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Infrastructure/RENormalizer.h"
+#include "Infrastructure/REStringPool.h"
+
+/**
+ * Handle to an interned normalized form
+ * Two raw strings with the same normalized form get equal handles,
+ * so equality of prepared strings is an integer compare
+ */
+struct FRENormalizedHandle
+{
+    uint32 Id = FREStringPool::InvalidId;
+    
+    bool IsValid() const { return Id != FREStringPool::InvalidId; }
+    
+    bool operator==(const FRENormalizedHandle& Other) const { return Id == Other.Id; }
+    bool operator!=(const FRENormalizedHandle& Other) const { return Id != Other.Id; }
+    
+    friend uint32 GetTypeHash(const FRENormalizedHandle& Handle) { return Handle.Id; }
+};
+
+/**
+ * Concurrent memo of raw string -> normalized form
+ * Each distinct raw string is normalized once; later lookups are a
+ * hash probe under a shard read lock
+ * 
+ * Intended for stable candidate sets (asset names, vocabularies).
+ * Entries are never evicted - call Reset to reclaim memory.
+ */
+class REASONINGENGINE_API FRENormalizedFormTable
+{
+public:
+    explicit FRENormalizedFormTable(const FRENormalizationPlan& InPlan);
+    
+    FRENormalizedFormTable(const FRENormalizedFormTable&) = delete;
+    FRENormalizedFormTable& operator=(const FRENormalizedFormTable&) = delete;
+    
+    /**
+     * Get the handle of a string's normalized form, normalizing on first sight
+     * @param Raw - Raw input text
+     * @return Handle of the normalized form (invalid once the form pool is full)
+     */
+    FRENormalizedHandle Intern(FStringView Raw);
+    
+    /**
+     * Look up a string without normalizing or adding it
+     * @param Raw - Raw input text
+     * @return Handle, or an invalid handle if the string was never interned
+     */
+    FRENormalizedHandle Find(FStringView Raw) const;
+    
+    /**
+     * Get the normalized text of a handle
+     * @param Handle - Handle returned by Intern
+     * @return Pooled normalized string (valid until Reset)
+     */
+    const FString& Resolve(FRENormalizedHandle Handle) const
+    {
+        return Forms.Resolve(Handle.Id);
+    }
+    
+    /** Number of distinct raw strings seen */
+    int32 NumRaw() const;
+    
+    /** Number of distinct normalized forms (handle ids are 0..NumForms-1) */
+    int32 NumForms() const { return Forms.Num(); }
+    
+    /** Plan used to produce the forms */
+    const FRENormalizationPlan& GetPlan() const { return Plan; }
+    
+    /**
+     * Drop every entry - invalidates all handles
+     * Not safe to call while other threads use the table
+     */
+    void Reset();
+    
+private:
+    static constexpr int32 NumShards = 16;
+    
+    using FRawMap = TMap<FString, uint32, FDefaultSetAllocator, TRECaseSensitiveKeyFuncs<FString, uint32>>;
+    
+    struct FShard
+    {
+        FRawMap RawToForm;
+        mutable FRWLock Lock;
+    };
+    
+    FRENormalizationPlan Plan;
+    FREStringPool Forms;
+    FShard Shards[NumShards];
+};
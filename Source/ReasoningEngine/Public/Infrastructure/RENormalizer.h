@@ -2,8 +2,91 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Misc/StringBuilder.h"
 #include "Infrastructure/Data/REInfrastructureTypes.h"
 
+// Forward declarations
+class FRENormalizedFormTable;
+struct FRENormalizedHandle;
+
+/**
+ * Compiled form of an FRENormalizationConfig
+ * Folds every per-character stage of NormalizeTextWithConfig into one
+ * transform so the text is produced in a single pass
+ * 
+ * Compile once with RENormalizer::CompilePlan and reuse across calls
+ */
+struct REASONINGENGINE_API FRENormalizationPlan
+{
+    /** AsciiActions bit: character is dropped (custom, number or punctuation removal) */
+    static constexpr uint16 Action_Remove = 0x100;
+    
+    /** AsciiActions bit: mapped character is whitespace */
+    static constexpr uint16 Action_Whitespace = 0x200;
+    
+    /** Per-ASCII-character action - low byte is the mapped character */
+    uint16 AsciiActions[128];
+    
+    /** Lowercased CustomRemoveChars (removal is case-insensitive) */
+    TArray<TCHAR> RemoveCharsLower;
+    
+    /** Replacement for non-ASCII characters when converting to ASCII */
+    FString AsciiReplacement;
+    
+    EREUnicodeNormalizationForm UnicodeForm = EREUnicodeNormalizationForm::NFC;
+    
+    int32 MinLength = 0;
+    int32 MaxLength = 0;
+    
+    bool bLowercase = false;
+    bool bUppercase = false;
+    bool bRemoveAccents = false;
+    bool bRemoveNumbers = false;
+    bool bRemovePunctuation = false;
+    bool bCollapseWhitespace = false;
+    bool bTrimWhitespace = false;
+    bool bConvertToAscii = false;
+    
+    /** Upper bound on output characters per input character */
+    int32 GetMaxExpansion() const
+    {
+        return bConvertToAscii ? FMath::Max(1, AsciiReplacement.Len()) : 1;
+    }
+};
+
+/**
+ * Output of RENormalizer::NormalizeBatch
+ * All normalized strings share one contiguous character arena
+ * String I occupies Chars[Offsets[I] .. Offsets[I + 1])
+ */
+struct REASONINGENGINE_API FRENormalizedBatch
+{
+    /** Concatenated normalized text (not null-terminated) */
+    TArray<TCHAR> Chars;
+    
+    /** Start offset of each string, plus a trailing end offset */
+    TArray<int32> Offsets;
+    
+    /** Number of strings in the batch */
+    int32 Num() const
+    {
+        return FMath::Max(0, Offsets.Num() - 1);
+    }
+    
+    /** View of one normalized string - valid while the batch is alive */
+    FStringView Get(int32 Index) const
+    {
+        check(Index >= 0 && Index < Num());
+        return FStringView(Chars.GetData() + Offsets[Index], Offsets[Index + 1] - Offsets[Index]);
+    }
+    
+    /** Copy of one normalized string */
+    FString GetString(int32 Index) const
+    {
+        return FString(Get(Index));
+    }
+};
+
 /**
  * Static utility class for text normalization
  * First step in the processing pipeline - no dependencies
@@ -39,6 +122,84 @@ public:
         const FRENormalizationConfig& Config
     );
     
+    /**
+     * Compile a configuration into a fused single-pass transform
+     * @param Config - Normalization configuration
+     * @return Reusable plan
+     */
+    static FRENormalizationPlan CompilePlan(const FRENormalizationConfig& Config);
+    
+    /**
+     * Normalize text with a precompiled plan
+     * Output is identical to NormalizeTextWithConfig with the source config
+     * @param Text - Input text to normalize
+     * @param Plan - Compiled normalization plan
+     * @return Normalized text
+     */
+    static FString NormalizeTextWithPlan(
+        const FString& Text,
+        const FRENormalizationPlan& Plan
+    );
+    
+    // ========== BUFFER AND BATCH NORMALIZATION ==========
+    
+    /**
+     * Normalize text with default configuration, appending to a caller-owned builder
+     * @param Text - Input text to normalize
+     * @param Out - Builder to append the normalized text to
+     * @return Number of characters appended
+     */
+    static int32 NormalizeInto(FStringView Text, FStringBuilderBase& Out);
+    
+    /**
+     * Normalize text with specific configuration, appending to a caller-owned builder
+     * @param Text - Input text to normalize
+     * @param Config - Normalization configuration
+     * @param Out - Builder to append the normalized text to
+     * @return Number of characters appended
+     */
+    static int32 NormalizeInto(
+        FStringView Text,
+        const FRENormalizationConfig& Config,
+        FStringBuilderBase& Out
+    );
+    
+    /**
+     * Normalize text with a precompiled plan, appending to a caller-owned builder
+     * @param Text - Input text to normalize
+     * @param Plan - Compiled normalization plan
+     * @param Out - Builder to append the normalized text to
+     * @return Number of characters appended
+     */
+    static int32 NormalizeInto(
+        FStringView Text,
+        const FRENormalizationPlan& Plan,
+        FStringBuilderBase& Out
+    );
+    
+    /**
+     * Normalize many strings into one contiguous arena
+     * Large batches are split across worker threads
+     * @param Texts - Input texts
+     * @param Config - Normalization configuration
+     * @return Arena and offsets of the normalized strings, in input order
+     */
+    static FRENormalizedBatch NormalizeBatch(
+        TArrayView<const FString> Texts,
+        const FRENormalizationConfig& Config
+    );
+    
+    /**
+     * Normalize many strings into one contiguous arena with a precompiled plan
+     * @param Texts - Input texts
+     * @param Plan - Compiled normalization plan
+     * @return Arena and offsets of the normalized strings, in input order
+     */
+    static FRENormalizedBatch NormalizeBatch(
+        TArrayView<const FString> Texts,
+        const FRENormalizationPlan& Plan
+    );
+    
     // ========== SPECIFIC NORMALIZATIONS ==========
     
     /**
@@ -147,6 +308,26 @@ public:
         EREUnicodeNormalizationForm Form = EREUnicodeNormalizationForm::NFC
     );
     
+    /**
+     * Check whether text is already in a Unicode normalization form
+     * Uses the quick-check tables, falling back to a full pass only when ambiguous
+     * @param Text - Input text
+     * @param Form - Unicode normalization form
+     * @return true if NormalizeUnicode would not change the text
+     */
+    static bool IsUnicodeNormalized(
+        const FString& Text,
+        EREUnicodeNormalizationForm Form = EREUnicodeNormalizationForm::NFC
+    );
+    
+    /**
+     * Apply full Unicode case folding for caseless comparison
+     * Unlike ToLowercase, may change length (e.g. "Straße" -> "strasse")
+     * @param Text - Input text
+     * @return Case-folded text
+     */
+    static FString CaseFold(const FString& Text);
+    
     /**
      * Convert to ASCII by removing or replacing non-ASCII characters
      * @param Text - Input text
@@ -221,12 +402,78 @@ public:
     /**
      * Get a normalized version suitable for comparison
      * Applies aggressive normalization for matching
+     * Text already in GetComparisonFormTable is looked up, not normalized
      * @param Text - Input text
      * @return Aggressively normalized text
      */
     static FString GetComparisonForm(const FString& Text);
     
+    // ========== INTERNED FORMS ==========
+    
+    /**
+     * Shared memo of raw text -> GetComparisonForm result
+     * @return Process-wide comparison form table
+     */
+    static FRENormalizedFormTable& GetComparisonFormTable();
+    
+    /**
+     * Shared memo of raw text -> NormalizeText result
+     * @return Process-wide default normalization table
+     */
+    static FRENormalizedFormTable& GetNormalizedFormTable();
+    
+    /**
+     * Intern the comparison form of text
+     * Equal handles mean equal comparison forms
+     * @param Text - Input text
+     * @return Handle resolvable through GetComparisonFormTable
+     */
+    static FRENormalizedHandle InternComparisonForm(const FString& Text);
+    
+    /**
+     * Intern the default normalized form of text
+     * @param Text - Input text
+     * @return Handle resolvable through GetNormalizedFormTable
+     */
+    static FRENormalizedHandle InternNormalizedForm(const FString& Text);
+    
 private:
+    // ========== INTERNAL HELPERS ==========
+    
+    /**
+     * Run the fused transform over a buffer (length constraints excluded)
+     * @param Src - Input characters
+     * @param Len - Number of input characters
+     * @param Plan - Compiled plan
+     * @param Dst - Output buffer, at least Len * Plan.GetMaxExpansion() characters
+     * @return Number of characters written
+     */
+    static int32 ApplyPlan(const TCHAR* Src, int32 Len, const FRENormalizationPlan& Plan, TCHAR* Dst);
+    
+    /**
+     * Apply MinLength/MaxLength to a transformed length
+     * @return Final length, or INDEX_NONE if the text is rejected as too short
+     */
+    static int32 ApplyLengthConstraints(int32 Len, const FRENormalizationPlan& Plan);
+    
+    /**
+     * Run the Unicode pre-pass of a plan if it has one
+     * @param Text - Input text
+     * @param Plan - Compiled plan
+     * @param Storage - Holds the pre-pass result when one is produced
+     * @return View of the text the fused transform should consume
+     */
+    static FStringView PrepareSource(FStringView Text, const FRENormalizationPlan& Plan, FString& Storage);
+    
+    /**
+     * Normalize into a caller-provided buffer (pre-pass, transform and length constraints)
+     * @param Text - Text returned by PrepareSource
+     * @param Plan - Compiled plan
+     * @param Dst - Output buffer, at least Text.Len() * Plan.GetMaxExpansion() characters
+     * @return Number of characters written
+     */
+    static int32 NormalizeBuffer(FStringView Text, const FRENormalizationPlan& Plan, TCHAR* Dst);
+    
     // ========== DELETED CONSTRUCTORS ==========
     
     RENormalizer() = delete;
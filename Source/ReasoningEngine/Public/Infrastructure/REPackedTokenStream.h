@@ -0,0 +1,94 @@
+// Source/ReasoningEngine/Public/Infrastructure/REPackedTokenStream.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Infrastructure/Data/REInfrastructureTypes.h"
+
+/**
+ * Structure-of-arrays form of FRETokenStream
+ * Hot per-token fields live in parallel arrays (about 25 bytes per token
+ * plus its characters); rarely used fields go to side tables that stay
+ * empty for typical tokenizer output
+ * 
+ * Usage:
+ *   FREPackedTokenStream Packed = FREPackedTokenStream::FromStream(Stream);
+ *   for (int32 i = 0; i < Packed.Num(); ++i)
+ *   {
+ *       if (Packed.Ids[i] == WalkId) { ... }   // No string touched
+ *   }
+ */
+struct REASONINGENGINE_API FREPackedTokenStream
+{
+    // ========== HOT ARRAYS (one entry per token) ==========
+    
+    /** Offset of each token's text in Chars */
+    TArray<int32> Offsets;
+    
+    /** Length of each token's text */
+    TArray<int32> Lengths;
+    
+    /** FREToken::StartIndex / EndIndex */
+    TArray<int32> StartIndices;
+    TArray<int32> EndIndices;
+    
+    TArray<ERETokenType> Types;
+    TArray<float> Weights;
+    
+    /** FRETokenDictionary id of each token's NormalizedText */
+    TArray<uint32> Ids;
+    
+    /** Token texts back to back (not null-terminated) */
+    TArray<TCHAR> Chars;
+    
+    // ========== SIDE TABLES (sparse, keyed by token index) ==========
+    
+    /** Line/column, filled only when some token has them (e.g. streamed input) */
+    TArray<int32> LineNumbers;
+    TArray<int32> ColumnNumbers;
+    
+    /** Confidence where it is not 1 */
+    TMap<int32, float> Confidences;
+    
+    TMap<int32, TArray<FString>> Variants;
+    TMap<int32, TMap<FString, FString>> Metadata;
+    
+    // ========== STREAM ==========
+    
+    FString OriginalText;
+    ERENamingConvention DetectedConvention = ERENamingConvention::Unknown;
+    TMap<FString, FString> StreamMetadata;
+    
+    int32 Num() const { return Ids.Num(); }
+    
+    /** Text of a token */
+    FStringView GetText(int32 Index) const
+    {
+        return FStringView(Chars.GetData() + Offsets[Index], Lengths[Index]);
+    }
+    
+    /** Normalized text of a token (pooled in FRETokenDictionary) */
+    const FString& GetNormalizedText(int32 Index) const;
+    
+    /**
+     * Append a token
+     * @param Token - Token to pack (a packed stream is an id stream, so it is
+     *                interned in FRETokenDictionary if it has no TokenId)
+     * @return Index of the packed token
+     */
+    int32 Add(const FREToken& Token);
+    
+    /** Unpack one token */
+    FREToken GetToken(int32 Index) const;
+    
+    void Reserve(int32 NumTokens, int32 NumChars);
+    void Reset();
+    
+    /** Approximate heap memory used */
+    SIZE_T GetAllocatedSize() const;
+    
+    /** Pack a token stream */
+    static FREPackedTokenStream FromStream(const FRETokenStream& Stream);
+    
+    /** Unpack into a token stream */
+    FRETokenStream ToStream() const;
+};
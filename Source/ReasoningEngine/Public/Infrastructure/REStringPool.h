@@ -0,0 +1,152 @@
+// Source/ReasoningEngine/Public/Infrastructure/REStringPool.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/ScopeRWLock.h"
+#include "Hash/CityHash.h"
+#include <atomic>
+
+/**
+ * Case-sensitive hashing and matching for string-keyed pool maps
+ * (FString/FStringView default key funcs are case-insensitive)
+ */
+template<typename KeyType, typename ValueType>
+struct TRECaseSensitiveKeyFuncs : TDefaultMapKeyFuncs<KeyType, ValueType, false>
+{
+    static FORCEINLINE bool Matches(FStringView A, FStringView B)
+    {
+        return A.Equals(B, ESearchCase::CaseSensitive);
+    }
+    
+    static FORCEINLINE uint32 GetKeyHash(FStringView Key)
+    {
+        return static_cast<uint32>(CityHash64(reinterpret_cast<const char*>(Key.GetData()), Key.Len() * sizeof(TCHAR)));
+    }
+};
+
+/**
+ * Concurrent string intern pool
+ * Maps each distinct string to a dense uint32 id and back
+ * 
+ * Design Philosophy:
+ * - Ids are dense (0..Num-1) so callers can index side arrays by id
+ * - Strings live in fixed-size chunks that never move, so resolved
+ *   references stay valid for the lifetime of the pool
+ * - Lookups are sharded by hash; hits take only a shard read lock
+ * - Case-sensitive: "Walk" and "walk" get different ids
+ */
+class REASONINGENGINE_API FREStringPool
+{
+public:
+    /** Returned by Find for strings that are not in the pool */
+    static constexpr uint32 InvalidId = MAX_uint32;
+    
+    FREStringPool();
+    ~FREStringPool();
+    
+    FREStringPool(const FREStringPool&) = delete;
+    FREStringPool& operator=(const FREStringPool&) = delete;
+    
+    /**
+     * Get the id of a string, adding it if needed
+     * @param Text - String to intern
+     * @return Stable id, or InvalidId (logged) once the pool is full
+     */
+    uint32 Intern(FStringView Text);
+    
+    /**
+     * Intern with a hash already computed by HashString
+     * @param Hash - HashString(Text)
+     * @param Text - String to intern
+     * @return Stable id, or InvalidId (logged) once the pool is full
+     */
+    uint32 InternByHash(uint32 Hash, FStringView Text);
+    
+    /**
+     * Look up a string without adding it
+     * @param Text - String to find
+     * @return Id, or InvalidId if not interned
+     */
+    uint32 Find(FStringView Text) const;
+    
+    /**
+     * Get the string for an id
+     * @param Id - Id returned by Intern
+     * @return Pooled string (valid until Reset or destruction)
+     */
+    const FString& Resolve(uint32 Id) const
+    {
+        checkSlow(Id < NextId.load(std::memory_order_relaxed));
+        return Chunks[Id >> ChunkBits].load(std::memory_order_acquire)[Id & ChunkMask];
+    }
+    
+    /**
+     * Number of ids handed out
+     * Only an upper bound while other threads are interning: an id is
+     * counted before its string is stored, so do not resolve ids up to
+     * Num() unless every writer has finished
+     */
+    int32 Num() const
+    {
+        return static_cast<int32>(NextId.load(std::memory_order_acquire));
+    }
+    
+    /**
+     * Number of leading ids whose strings are stored
+     * Every id below it resolves, even while other threads are interning,
+     * so use it as the bound when iterating ids
+     */
+    int32 NumPublished() const
+    {
+        return static_cast<int32>(PublishedId.load(std::memory_order_acquire));
+    }
+    
+    /**
+     * Remove every string - invalidates all ids and resolved references
+     * Not safe to call while other threads use the pool
+     */
+    void Reset();
+    
+    /**
+     * Approximate memory used by the pool
+     */
+    SIZE_T GetAllocatedSize() const;
+    
+    /**
+     * Hash used for pool lookups (case-sensitive)
+     */
+    static FORCEINLINE uint32 HashString(FStringView Text)
+    {
+        return TRECaseSensitiveKeyFuncs<FStringView, uint32>::GetKeyHash(Text);
+    }
+    
+private:
+    static constexpr int32 NumShards = 16;
+    static constexpr uint32 ChunkBits = 12;
+    static constexpr uint32 ChunkSize = 1u << ChunkBits;
+    static constexpr uint32 ChunkMask = ChunkSize - 1;
+    static constexpr uint32 MaxChunks = 4096;
+    
+    using FShardMap = TMap<FStringView, uint32, FDefaultSetAllocator, TRECaseSensitiveKeyFuncs<FStringView, uint32>>;
+    
+    struct FShard
+    {
+        /** Keys view strings stored in the chunks */
+        FShardMap Map;
+        mutable FRWLock Lock;
+    };
+    
+    /** Allocate the slot for a new id */
+    FString& AllocateSlot(uint32 Id);
+    
+    FShard Shards[NumShards];
+    
+    /** Fixed top-level table so readers never see it reallocate */
+    std::atomic<FString*> Chunks[MaxChunks];
+    FCriticalSection ChunkMutex;
+    
+    std::atomic<uint32> NextId;
+    
+    /** Advances in id order, only after the slot below it is stored */
+    std::atomic<uint32> PublishedId;
+};
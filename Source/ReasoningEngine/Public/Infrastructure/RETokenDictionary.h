@@ -0,0 +1,91 @@
+// Source/ReasoningEngine/Public/Infrastructure/RETokenDictionary.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Infrastructure/REStringPool.h"
+
+/**
+ * Process-wide dictionary of normalized token text -> dense uint32 id
+ * Shared by the tokenizer and everything that consumes its tokens, so
+ * stop-word filtering, term frequencies, n-grams and compound lookup
+ * can work on integer arrays instead of strings
+ * 
+ * Design Philosophy:
+ * - Keys are FREToken::NormalizedText (lowercased token text)
+ * - Ids are dense (0..Num-1) and stable for the lifetime of the process,
+ *   so callers can keep per-id side arrays (masks, counts, IDF tables)
+ * - Thread-safe; lookups of known tokens take only a shard read lock
+ */
+class REASONINGENGINE_API FRETokenDictionary
+{
+public:
+    /** Id of tokens that were never interned */
+    static constexpr uint32 InvalidId = FREStringPool::InvalidId;
+    
+    /**
+     * Get the shared dictionary
+     */
+    static FRETokenDictionary& Get();
+    
+    FRETokenDictionary(const FRETokenDictionary&) = delete;
+    FRETokenDictionary& operator=(const FRETokenDictionary&) = delete;
+    
+    /**
+     * Get the id of normalized token text, adding it if needed
+     * @param NormalizedText - Lowercased token text
+     * @return Stable id, or InvalidId once the dictionary is full
+     */
+    uint32 Intern(FStringView NormalizedText)
+    {
+        return Pool.Intern(NormalizedText);
+    }
+    
+    /**
+     * Look up normalized token text without adding it
+     * @param NormalizedText - Lowercased token text
+     * @return Id, or InvalidId if unknown
+     */
+    uint32 Find(FStringView NormalizedText) const
+    {
+        return Pool.Find(NormalizedText);
+    }
+    
+    /**
+     * Get the normalized text of an id
+     * @param Id - Id returned by Intern
+     * @return Pooled text (valid for the lifetime of the process)
+     */
+    const FString& Resolve(uint32 Id) const
+    {
+        return Pool.Resolve(Id);
+    }
+    
+    /**
+     * Intern a list of words, lowercasing them first
+     * @param Words - Words in any case
+     * @param OutIds - Receives one id per word
+     */
+    void InternWords(const TArray<FString>& Words, TArray<uint32>& OutIds);
+    
+    /**
+     * Build a membership mask indexed by id
+     * Ids interned after the mask was built read as absent
+     * @param Words - Words in any case (interned so their ids exist)
+     * @return Bit set for each word's id
+     */
+    TBitArray<> MakeMask(const TSet<FString>& Words);
+    
+    /** Number of ids handed out; an upper bound while other threads intern */
+    int32 Num() const { return Pool.Num(); }
+    
+    /** Number of leading ids that resolve; the bound for iterating ids */
+    int32 NumPublished() const { return Pool.NumPublished(); }
+    
+    /** Approximate memory used by the dictionary */
+    SIZE_T GetAllocatedSize() const { return Pool.GetAllocatedSize(); }
+    
+private:
+    FRETokenDictionary() = default;
+    
+    FREStringPool Pool;
+};
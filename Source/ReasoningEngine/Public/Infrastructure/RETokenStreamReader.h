@@ -0,0 +1,113 @@
+// Source/ReasoningEngine/Public/Infrastructure/RETokenStreamReader.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Infrastructure/Data/REInfrastructureTypes.h"
+
+// Forward declarations
+namespace RETextSimd { struct FDelimiterSet; }
+
+/**
+ * Streaming tokenizer over an FArchive
+ * Reads fixed-size chunks and yields tokens one at a time, so memory
+ * stays bounded by the chunk size regardless of input size
+ * 
+ * Design Philosophy:
+ * - Same per-token rules as RETokenizer::TokenizeWithConfig
+ * - Tokens straddling chunk boundaries are carried into the next chunk
+ * - UTF-8 input (BOM optional); UTF-16LE when a BOM says so
+ * - StartIndex/EndIndex are absolute character offsets in the decoded
+ *   stream, with LineNumber/ColumnNumber (1-based) filled in
+ * - Offsets past MAX_int32 are clamped, and such tokens carry the exact
+ *   64-bit offset in Metadata["StreamOffset"]
+ * 
+ * Differences from TokenizeWithConfig:
+ * - Line breaks and tabs always delimit, in addition to Config.Delimiters
+ * - Naming convention is detected per delimited word, not per text
+ * - A single word longer than MaxPendingChars is split at that length
+ * 
+ * Usage:
+ *   FRETokenStreamReader Reader(Archive, Config);
+ *   FREToken Token;
+ *   while (Reader.Next(Token)) { ... }
+ */
+class REASONINGENGINE_API FRETokenStreamReader
+{
+public:
+    /** Default bytes read from the archive per refill */
+    static constexpr int32 DefaultChunkBytes = 64 * 1024;
+    
+    /**
+     * @param InArchive - Source archive (must be a loading archive, not owned)
+     * @param InConfig - Tokenization configuration
+     * @param InChunkBytes - Bytes read per refill
+     */
+    FRETokenStreamReader(FArchive& InArchive, const FRETokenizerConfig& InConfig, int32 InChunkBytes = DefaultChunkBytes);
+    ~FRETokenStreamReader();
+    
+    FRETokenStreamReader(const FRETokenStreamReader&) = delete;
+    FRETokenStreamReader& operator=(const FRETokenStreamReader&) = delete;
+    
+    /**
+     * Pull the next token
+     * @param OutToken - Receives the token
+     * @return false once the stream is exhausted
+     */
+    bool Next(FREToken& OutToken);
+    
+    /**
+     * Push every remaining token to a callback
+     * @param OnToken - Return false to stop early
+     * @return Number of tokens delivered
+     */
+    int64 ForEach(TFunctionRef<bool(const FREToken&)> OnToken);
+    
+    /** Characters decoded so far */
+    int64 GetCharsRead() const { return BufferBase + Buffer.Num(); }
+    
+    /** Whether the archive reported an error */
+    bool IsError() const { return Archive.IsError(); }
+    
+private:
+    /** Read and decode one chunk; returns false at end of input */
+    bool Refill();
+    
+    /** Decode buffered bytes into Buffer, keeping any incomplete trailing sequence */
+    void DecodePending(bool bFinal);
+    
+    /** Tokenize Buffer[Start, End) and queue the results */
+    void EmitRawToken(int32 Start, int32 End);
+    
+    /** Advance line/column tracking to an absolute offset */
+    void AdvanceLineTracking(int64 AbsoluteOffset);
+    
+    enum class EEncoding : uint8
+    {
+        Unknown,
+        Utf8,
+        Utf16LE
+    };
+    
+    FArchive& Archive;
+    FRETokenizerConfig Config;
+    TUniquePtr<RETextSimd::FDelimiterSet> Delimiters;
+    int32 ChunkBytes;
+    
+    /** Longest word kept pending across refills before it is force-split */
+    int32 MaxPendingChars;
+    
+    EEncoding Encoding = EEncoding::Unknown;
+    TArray<uint8> Bytes;            // Undecoded input (partial sequences carried)
+    TArray<TCHAR> Buffer;           // Decoded characters not yet consumed
+    int64 BufferBase = 0;           // Absolute offset of Buffer[0]
+    int32 ScanPos = 0;              // Next unscanned index in Buffer
+    bool bEndOfInput = false;
+    
+    TArray<FREToken> Ready;         // Tokens produced but not yet returned
+    int32 ReadyIndex = 0;
+    TArray<int32> RawOffsets;       // Start of each new token within the word being emitted
+    
+    int64 LineCursor = 0;           // Absolute offset line tracking has reached
+    int32 Line = 1;
+    int64 LineStart = 0;            // Absolute offset of the current line's first char
+};
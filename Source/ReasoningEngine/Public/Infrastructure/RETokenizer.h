@@ -6,6 +6,153 @@
 
 // Forward declarations
 class FREKnowledgeBase;  // From Symbolic layer
+class FREVocabularyMatcher;
+class FRECorpusStatistics;
+struct FREPackedTokenStream;
+
+/**
+ * Output of RETokenizer::TokenizeBatch
+ * Tokens of every input share one array; input I owns
+ * Tokens[Offsets[I] .. Offsets[I + 1])
+ */
+struct REASONINGENGINE_API FRETokenBatch
+{
+    /** Tokens of all inputs, in input order */
+    TArray<FREToken> Tokens;
+    
+    /** Start offset of each input's tokens, plus a trailing end offset */
+    TArray<int32> Offsets;
+    
+    /** Naming convention detected per input */
+    TArray<ERENamingConvention> Conventions;
+    
+    /** Number of inputs in the batch */
+    int32 Num() const
+    {
+        return FMath::Max(0, Offsets.Num() - 1);
+    }
+    
+    /** Tokens of one input - valid while the batch is alive */
+    TArrayView<const FREToken> GetTokens(int32 Index) const
+    {
+        check(Index >= 0 && Index < Num());
+        return TArrayView<const FREToken>(Tokens.GetData() + Offsets[Index], Offsets[Index + 1] - Offsets[Index]);
+    }
+    
+    /** Copy one input's tokens into a standalone stream */
+    FRETokenStream ToStream(int32 Index, const FString& OriginalText) const
+    {
+        FRETokenStream Stream;
+        Stream.Tokens = GetTokens(Index);
+        Stream.OriginalText = OriginalText;
+        Stream.DetectedConvention = Conventions[Index];
+        return Stream;
+    }
+};
+
+/**
+ * Lazily generated variants of one token
+ * Produces the same sequence as RETokenizer::GenerateVariants (typos,
+ * then abbreviations, then expansions, deduplicated in that order), but
+ * only as far as the caller iterates
+ * 
+ * Fully enumerated lists are kept in a bounded process-wide cache, so
+ * repeated tokens do not regenerate their variants
+ * 
+ * Usage:
+ *   for (const FString& Variant : RETokenizer::GetVariants(Token, Config))
+ *   {
+ *       if (Matches(Variant)) { break; }   // Remaining variants never built
+ *   }
+ */
+class REASONINGENGINE_API FRETokenVariants
+{
+public:
+    /** End-of-sequence marker for range-for */
+    struct FSentinel {};
+    
+    /** Forward iterator generating one variant per step */
+    class REASONINGENGINE_API FIterator
+    {
+    public:
+        const FString& operator*() const { return Current; }
+        const FString* operator->() const { return &Current; }
+        FIterator& operator++() { Advance(); return *this; }
+        bool operator!=(FSentinel) const { return !bDone; }
+        explicit operator bool() const { return !bDone; }
+        
+    private:
+        friend class FRETokenVariants;
+        
+        enum class EStage : uint8
+        {
+            Deletion,
+            Transposition,
+            Substitution,
+            Abbreviation,
+            Expansion,
+            Done
+        };
+        
+        explicit FIterator(const FRETokenVariants& InOwner);
+        
+        /** Produce the next candidate (duplicates included); false when exhausted */
+        bool NextCandidate(FString& OutCandidate);
+        
+        /** Move to the next unique variant, caching the list on completion */
+        void Advance();
+        
+        const FRETokenVariants* Owner;
+        
+        /** Set when the full list came from the cache */
+        TSharedPtr<const TArray<FString>, ESPMode::ThreadSafe> Cached;
+        int32 CachedIndex = 0;
+        
+        EStage Stage = EStage::Deletion;
+        int32 Position = 0;
+        int32 SubIndex = 0;
+        TArray<FString> StageItems;
+        
+        TSet<FString> Seen;
+        TArray<FString> Emitted;
+        FString Current;
+        bool bDone = false;
+    };
+    
+    /**
+     * @param InToken - Token text
+     * @param bInTypos - Include single-edit typos
+     * @param bInAbbreviations - Include abbreviations
+     * @param bInExpansions - Include known expansions
+     */
+    FRETokenVariants(const FString& InToken, bool bInTypos = true, bool bInAbbreviations = true, bool bInExpansions = true);
+    
+    FIterator begin() const { return FIterator(*this); }
+    FSentinel end() const { return FSentinel(); }
+    
+    /**
+     * Visit variants in order until the visitor returns false
+     * @return Number of variants visited
+     */
+    int32 ForEach(TFunctionRef<bool(const FString&)> Visitor) const;
+    
+    /** All variants (served from the cache when possible) */
+    TArray<FString> ToArray() const;
+    
+    /** The first Count variants */
+    TArray<FString> Take(int32 Count) const;
+    
+    const FString& GetToken() const { return Token; }
+    
+    /** Drop every cached variant list */
+    static void ClearCache();
+    
+private:
+    FString Token;
+    bool bTypos;
+    bool bAbbreviations;
+    bool bExpansions;
+};
 
 /**
  * Static utility class for text tokenization
@@ -60,6 +207,51 @@ public:
         const FREKnowledgeBase& Knowledge
     );
     
+    /**
+     * Tokenize many texts in parallel into one shared token array
+     * Each result matches TokenizeWithConfig on the same input
+     * @param Texts - Input texts
+     * @param Config - Tokenization configuration
+     * @return Token arena with per-input ranges
+     */
+    static FRETokenBatch TokenizeBatch(
+        TArrayView<const FString> Texts,
+        const FRETokenizerConfig& Config
+    );
+    
+    // ========== STREAMING TOKENIZATION ==========
+    
+    /**
+     * Tokenize an archive in fixed-size chunks without loading it fully
+     * See FRETokenStreamReader for the pull-style equivalent
+     * @param Archive - Loading archive positioned at the text
+     * @param Config - Tokenization configuration
+     * @param OnToken - Called per token; return false to stop
+     * @param ChunkBytes - Bytes read per refill
+     * @return Number of tokens delivered
+     */
+    static int64 TokenizeArchive(
+        FArchive& Archive,
+        const FRETokenizerConfig& Config,
+        TFunctionRef<bool(const FREToken&)> OnToken,
+        int32 ChunkBytes = 64 * 1024
+    );
+    
+    /**
+     * Tokenize a text file in fixed-size chunks without loading it fully
+     * @param FilePath - UTF-8 (or UTF-16LE with BOM) text file
+     * @param Config - Tokenization configuration
+     * @param OnToken - Called per token; return false to stop
+     * @param ChunkBytes - Bytes read per refill
+     * @return Number of tokens delivered, or INDEX_NONE if the file could not be opened
+     */
+    static int64 TokenizeFile(
+        const FString& FilePath,
+        const FRETokenizerConfig& Config,
+        TFunctionRef<bool(const FREToken&)> OnToken,
+        int32 ChunkBytes = 64 * 1024
+    );
+    
     // ========== TEXT SPLITTING ==========
     
     /**
@@ -133,6 +325,12 @@ public:
      */
     static FRETokenStream TokenizeAnimationName(const FString& AnimationName);
     
+    /**
+     * Configuration TokenizeAnimationName tokenizes with
+     * @return Animation name tokenizer settings
+     */
+    static FRETokenizerConfig GetAnimationNameConfig();
+    
     // ========== TOKEN CREATION ==========
     
     /**
@@ -174,6 +372,15 @@ public:
         bool bIncludeExpansions = true
     );
     
+    /**
+     * Lazily generate variants of a token using a tokenizer configuration
+     * (typos always, abbreviations/expansions when bExpandAbbreviations)
+     * @param Token - Token to vary
+     * @param Config - Tokenization configuration
+     * @return Lazy variant view
+     */
+    static FRETokenVariants GetVariants(const FREToken& Token, const FRETokenizerConfig& Config);
+    
     /**
      * Generate common typos for a word
      * Uses keyboard distance and common mistakes
@@ -215,15 +422,28 @@ public:
     
     /**
      * Find compound words in token stream
+     * Compiles the vocabulary on every call - keep an FREVocabularyMatcher
+     * and use the overload below when scanning many streams
      * @param Stream - Token stream
      * @param Vocabularies - Known compound words
-     * @return Array of identified compounds
+     * @return Terms spelled by two or more adjacent tokens, in stream order
      */
     static TArray<FString> FindCompoundWords(
         const FRETokenStream& Stream,
         const TArray<FREVocabularyEntry>& Vocabularies
     );
     
+    /**
+     * Find compound words with a precompiled vocabulary
+     * @param Stream - Token stream
+     * @param Matcher - Compiled vocabulary
+     * @return Terms spelled by two or more adjacent tokens, in stream order
+     */
+    static TArray<FString> FindCompoundWords(
+        const FRETokenStream& Stream,
+        const FREVocabularyMatcher& Matcher
+    );
+    
     /**
      * Calculate token weights (TF-IDF style)
      * @param Stream - Token stream
@@ -235,6 +455,17 @@ public:
         const TMap<FString, float>* DocumentFrequencies = nullptr
     );
     
+    /**
+     * Calculate token weights (TF-IDF) against corpus statistics
+     * @param Stream - Token stream
+     * @param Corpus - Document frequencies, e.g. FRECorpusStatistics::GetShared()
+     * @return Stream with updated weights
+     */
+    static FRETokenStream CalculateTokenWeights(
+        const FRETokenStream& Stream,
+        const FRECorpusStatistics& Corpus
+    );
+    
     // ========== STOP WORDS ==========
     
     /**
@@ -285,6 +516,101 @@ public:
         int32 N = 2
     );
     
+    // ========== TOKEN IDS ==========
+    
+    /**
+     * Tokenize straight to FRETokenDictionary ids
+     * @param Text - Text to tokenize
+     * @param Config - Tokenization configuration
+     * @return One id per token
+     */
+    static TArray<uint32> TokenizeToIds(
+        const FString& Text,
+        const FRETokenizerConfig& Config
+    );
+    
+    /**
+     * Get dictionary ids for tokens, interning any without one
+     * Grows the shared FRETokenDictionary; for id streams only (e.g. corpus ingestion)
+     * @param Tokens - Input tokens
+     * @return One id per token
+     */
+    static TArray<uint32> GetTokenIds(const TArray<FREToken>& Tokens);
+    
+    /**
+     * Default stop words as a mask indexed by token id
+     * @return Shared mask (see FRETokenDictionary::MakeMask)
+     */
+    static const TBitArray<>& GetDefaultStopWordMask();
+    
+    /**
+     * Filter stop words from an id stream
+     * @param Ids - Token ids
+     * @param StopWordMask - Mask from FRETokenDictionary::MakeMask
+     * @return Ids that are not stop words
+     */
+    static TArray<uint32> FilterStopWordIds(
+        TArrayView<const uint32> Ids,
+        const TBitArray<>& StopWordMask
+    );
+    
+    /**
+     * Calculate term weights (TF-IDF style) for an id stream
+     * @param Ids - Token ids
+     * @param InverseDocumentFrequencies - Optional IDF indexed by token id
+     * @return One weight per id
+     */
+    static TArray<float> CalculateTermWeights(
+        TArrayView<const uint32> Ids,
+        const TArray<float>* InverseDocumentFrequencies = nullptr
+    );
+    
+    /**
+     * Generate word n-gram keys from an id stream
+     * Keys are exact for N <= 2 and a 64-bit hash of the ids for larger N
+     * @param Ids - Token ids
+     * @param N - Size of grams
+     * @return One key per n-gram
+     */
+    static TArray<uint64> GenerateWordNGramIds(
+        TArrayView<const uint32> Ids,
+        int32 N = 2
+    );
+    
+    // ========== PACKED STREAMS ==========
+    
+    /**
+     * Tokenize into the structure-of-arrays form
+     * @param Text - Text to tokenize
+     * @param Config - Tokenization configuration (ids are always emitted)
+     * @return Packed token stream
+     */
+    static FREPackedTokenStream TokenizePacked(
+        const FString& Text,
+        const FRETokenizerConfig& Config
+    );
+    
+    /**
+     * Calculate token weights (TF or TF-IDF) in place
+     * @param Stream - Packed stream; only Ids are read and Weights written
+     * @param Corpus - Optional document frequencies for IDF
+     */
+    static void CalculateTokenWeights(
+        FREPackedTokenStream& Stream,
+        const FRECorpusStatistics* Corpus = nullptr
+    );
+    
+    /**
+     * Find every occurrence of a token id sequence
+     * @param Stream - Packed stream
+     * @param Sequence - Ids to look for, in order
+     * @return Start index of each occurrence
+     */
+    static TArray<int32> FindTokenSequence(
+        const FREPackedTokenStream& Stream,
+        TArrayView<const uint32> Sequence
+    );
+    
     // ========== UTILITY FUNCTIONS ==========
     
     /**
@@ -335,14 +661,75 @@ public:
     static FRETokenStream CreateTokenStream(const TArray<FString>& Strings);
     
 private:
+    friend class FRETokenStreamReader;
+    
     // ========== INTERNAL HELPERS ==========
     
+    /**
+     * Set each token's weight to its term frequency times GetIdf of the term
+     * @param Stream - Stream to weigh in place
+     * @param GetIdf - IDF of a term, given its first token
+     */
+    static void ApplyTermWeights(FRETokenStream& Stream, TFunctionRef<float(const FREToken& Token)> GetIdf);
+    
+    /**
+     * Number tokens by distinct NormalizedText without touching FRETokenDictionary,
+     * for transient work that must not grow the shared dictionary
+     * @param Tokens - Input tokens
+     * @param OutFirstTokens - First token of each local term
+     * @return Local term id (0..OutFirstTokens.Num()-1) of each token
+     */
+    static TArray<uint32> GetLocalTermIds(const TArray<FREToken>& Tokens, TArray<int32>& OutFirstTokens);
+    
+    /**
+     * Term frequency of each id times GetIdf, one distinct term at a time
+     * @param Ids - Token ids
+     * @param GetIdf - IDF of a token id
+     * @param OutWeights - Receives one weight per id
+     */
+    static void ComputeTermWeights(
+        TArrayView<const uint32> Ids,
+        TFunctionRef<float(uint32 Id)> GetIdf,
+        TArrayView<float> OutWeights
+    );
+    
+    /**
+     * Tokenize one text, appending to a caller-owned token array
+     * Shared core of TokenizeWithConfig and TokenizeBatch
+     */
+    static void TokenizeInto(
+        const FString& Text,
+        const FRETokenizerConfig& Config,
+        TArray<FREToken>& OutTokens,
+        ERENamingConvention& OutConvention
+    );
+    
+    /**
+     * Split one delimiter-free raw token into final tokens
+     * @param RawToken - Text between two delimiters
+     * @param Config - Tokenization configuration
+     * @param Convention - Convention that selects camelCase vs alphanumeric splitting
+     * @param InOutPosition - Running token position, advanced past each emitted token
+     * @param OutTokens - Receives the tokens
+     * @param OutRawOffsets - Optional; receives each emitted token's start within RawToken,
+     *                        before truncation and case normalization
+     */
+    static void ProcessRawToken(
+        const FString& RawToken,
+        const FRETokenizerConfig& Config,
+        ERENamingConvention Convention,
+        int32& InOutPosition,
+        TArray<FREToken>& OutTokens,
+        TArray<int32>* OutRawOffsets = nullptr
+    );
+    
     /**
      * Check if character is a delimiter
      */
     static FORCEINLINE bool IsDelimiter(TCHAR Char, const FString& Delimiters)
     {
-        return Delimiters.Contains(FString::Chr(Char));
+        int32 Index;
+        return Delimiters.FindChar(Char, Index);
     }
     
     /**
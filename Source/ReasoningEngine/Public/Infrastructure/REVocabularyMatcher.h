@@ -0,0 +1,124 @@
+// Source/ReasoningEngine/Public/Infrastructure/REVocabularyMatcher.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Infrastructure/Data/REInfrastructureTypes.h"
+
+struct FREPackedTokenStream;
+
+/**
+ * Compiled vocabulary automaton (Aho-Corasick over characters)
+ * Finds every vocabulary term spelled by a run of consecutive tokens
+ * in one pass over the token stream, for runs of any length
+ * 
+ * Terms and tokens are compared lowercased with separators (whitespace,
+ * '_' and '-') removed, so "Walk Forward", "walk_forward" and
+ * "WalkForward" all match the tokens "walk" + "forward".
+ * A match must start and end on token boundaries.
+ * 
+ * Compile once and reuse; matching is read-only and thread-safe.
+ */
+class REASONINGENGINE_API FREVocabularyMatcher
+{
+public:
+    /** One term found in a token stream */
+    struct FMatch
+    {
+        /** Index into the compiled vocabulary */
+        int32 EntryIndex = INDEX_NONE;
+        
+        /** First token of the run */
+        int32 FirstToken = 0;
+        
+        /** Number of tokens spelling the term */
+        int32 NumTokens = 0;
+    };
+    
+    FREVocabularyMatcher() = default;
+    explicit FREVocabularyMatcher(const TArray<FREVocabularyEntry>& Entries);
+    
+    /**
+     * Build the automaton, replacing any previous vocabulary
+     * Terms that reduce to the same key keep the earliest entry
+     * @param Entries - Vocabulary entries (matched by Term)
+     */
+    void Compile(const TArray<FREVocabularyEntry>& Entries);
+    
+    /**
+     * Find all terms in a token sequence
+     * @param Tokens - Tokens to scan (matched by NormalizedText)
+     * @param MinTokens - Ignore terms spelled by fewer tokens
+     * @param OutMatches - Receives matches sorted by first token, then length
+     */
+    void FindMatches(
+        TArrayView<const FREToken> Tokens,
+        int32 MinTokens,
+        TArray<FMatch>& OutMatches
+    ) const;
+    
+    /**
+     * Find all terms in a packed token stream
+     * @param Stream - Packed tokens (matched by normalized text)
+     * @param MinTokens - Ignore terms spelled by fewer tokens
+     * @param OutMatches - Receives matches sorted by first token, then length
+     */
+    void FindMatches(
+        const FREPackedTokenStream& Stream,
+        int32 MinTokens,
+        TArray<FMatch>& OutMatches
+    ) const;
+    
+    /**
+     * Get the term of a match
+     * @param EntryIndex - FMatch::EntryIndex
+     * @return Term as given to Compile
+     */
+    const FString& GetTerm(int32 EntryIndex) const { return Terms[EntryIndex]; }
+    
+    /** Number of vocabulary entries compiled */
+    int32 Num() const { return Terms.Num(); }
+    
+    bool IsEmpty() const { return Nodes.Num() <= 1; }
+    
+private:
+    struct FNode
+    {
+        /** Longest proper suffix that is also a trie prefix */
+        int32 Fail = 0;
+        
+        /** Entry whose key ends here */
+        int32 Output = INDEX_NONE;
+        
+        /** Nearest node on the fail chain with an output */
+        int32 OutputLink = INDEX_NONE;
+        
+        /** Key length in characters */
+        int32 Depth = 0;
+    };
+    
+    /** Characters dropped from terms and tokens before matching */
+    static FORCEINLINE bool IsSeparator(TCHAR Char)
+    {
+        return Char == TEXT('_') || Char == TEXT('-') || FChar::IsWhitespace(Char);
+    }
+    
+    static FORCEINLINE uint64 EdgeKey(int32 Node, TCHAR Char)
+    {
+        return (static_cast<uint64>(Node) << 16) | static_cast<uint16>(Char);
+    }
+    
+    /** Shared scan over NumTokens tokens whose normalized text GetText returns */
+    void FindMatches(
+        int32 NumTokens,
+        TFunctionRef<FStringView(int32 TokenIndex)> GetText,
+        int32 MinTokens,
+        TArray<FMatch>& OutMatches
+    ) const;
+    
+    /** Follow the goto/fail transitions for one character */
+    int32 Step(int32 Node, TCHAR Char) const;
+    
+    TArray<FNode> Nodes;
+    TMap<uint64, int32> Edges;
+    TArray<FString> Terms;
+};
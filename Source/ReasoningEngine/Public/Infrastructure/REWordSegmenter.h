@@ -0,0 +1,102 @@
+// Source/ReasoningEngine/Public/Infrastructure/REWordSegmenter.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Infrastructure/Data/REInfrastructureTypes.h"
+
+/**
+ * Dictionary-driven word segmentation
+ * Splits names with no case or delimiter boundaries ("walkforwardloop",
+ * "MMRUNFAST") into their most probable word sequence
+ * 
+ * Design Philosophy:
+ * - Unigram model: a segmentation scores the sum of log word frequencies
+ * - One Viterbi pass over a vocabulary trie - O(Len * longest word)
+ * - Characters no word covers become unknown segments (merged when adjacent)
+ * - Case-insensitive; segments keep the input's original case
+ * - Thread-safe; words can be added while other threads segment
+ */
+class REASONINGENGINE_API FREWordSegmenter
+{
+public:
+    /** One piece of a segmented name */
+    struct FSegment
+    {
+        int32 Start = 0;
+        int32 Len = 0;
+        
+        /** False for runs of characters no vocabulary word covers */
+        bool bKnown = false;
+    };
+    
+    FREWordSegmenter();
+    
+    FREWordSegmenter(const FREWordSegmenter&) = delete;
+    FREWordSegmenter& operator=(const FREWordSegmenter&) = delete;
+    
+    /**
+     * Shared segmenter seeded with common animation and programming words
+     */
+    static FREWordSegmenter& GetDefault();
+    
+    /**
+     * Add occurrences of a word
+     * @param Word - Word in any case
+     * @param Count - Occurrences to add to its frequency
+     */
+    void AddWord(FStringView Word, uint32 Count = 1);
+    
+    /**
+     * Add every term of a vocabulary (multi-word terms are added per word)
+     * @param Entries - Vocabulary entries
+     * @param Count - Occurrences to add per word
+     */
+    void AddVocabulary(const TArray<FREVocabularyEntry>& Entries, uint32 Count = 1);
+    
+    /**
+     * Find the most probable segmentation
+     * @param Text - Name without delimiters
+     * @param OutSegments - Receives segments covering Text in order
+     * @return true if Text splits into more than one segment
+     */
+    bool Segment(FStringView Text, TArray<FSegment>& OutSegments) const;
+    
+    /**
+     * Segment into strings, splitting only when every segment is a known word
+     * @param Text - Name without delimiters
+     * @return Segments in the input's case (just Text if it does not split)
+     */
+    TArray<FString> SegmentToStrings(const FString& Text) const;
+    
+    /** Number of distinct words */
+    int32 Num() const;
+    
+    /**
+     * Hash of every word and its frequency, independent of insertion order
+     * Changes whenever AddWord changes what Segment can return
+     */
+    uint64 GetVocabularyHash() const;
+    
+private:
+    struct FNode
+    {
+        /** Frequency of the word ending here (0 = prefix only) */
+        uint32 Count = 0;
+    };
+    
+    static FORCEINLINE uint64 EdgeKey(int32 Node, TCHAR Char)
+    {
+        return (static_cast<uint64>(Node) << 16) | static_cast<uint16>(Char);
+    }
+    
+    TArray<FNode> Nodes;
+    TMap<uint64, int32> Edges;
+    uint64 TotalCount = 0;
+    
+    /** Wrapping sum of one hash per (word, count) */
+    uint64 VocabularyHash = 0;
+    int32 NumWords = 0;
+    int32 MaxWordLength = 0;
+    
+    mutable FRWLock Lock;
+};
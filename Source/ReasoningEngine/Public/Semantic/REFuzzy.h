@@ -4,6 +4,10 @@
 #include "CoreMinimal.h"
 #include "Semantic/Data/RESemanticTypes.h"
 
+// Forward declarations
+struct FRENormalizedHandle;
+class FRENormalizedFormTable;
+
 /**
  * Static utility class for fuzzy string matching algorithms
  * Replaces UREFuzzy with pure static methods (no UObject overhead)
@@ -66,6 +70,35 @@ public:
         bool bNormalize = true
     );
     
+    /**
+     * Compare two prepared strings without normalizing them again
+     * Equal handles are a full match by integer compare
+     * @param A - Handle from PrepareHandle
+     * @param B - Handle from PrepareHandle
+     * @param Forms - Table both handles were interned in
+     * @return Complete match result; StringA/StringB hold the prepared forms
+     */
+    static FREStringMatch CompareStrings(
+        FRENormalizedHandle A,
+        FRENormalizedHandle B,
+        const FRENormalizedFormTable& Forms
+    );
+    
+    /**
+     * Similarity score of two prepared strings without normalizing them again
+     * @param A - Handle from PrepareHandle
+     * @param B - Handle from PrepareHandle
+     * @param Forms - Table both handles were interned in
+     * @param Algorithm - Algorithm to use (Auto selects best)
+     * @return Similarity score (0-1)
+     */
+    static float GetSimilarity(
+        FRENormalizedHandle A,
+        FRENormalizedHandle B,
+        const FRENormalizedFormTable& Forms,
+        EREFuzzyAlgorithm Algorithm = EREFuzzyAlgorithm::Auto
+    );
+    
     /**
      * Get edit distance between strings
      * @param A - First string
@@ -281,6 +314,16 @@ public:
      */
     static FString PrepareString(const FString& Input, bool bNormalize);
     
+    /**
+     * Intern the normalized form of a string in a caller-owned table
+     * Equal handles mean equal normalized forms; the table keeps every
+     * distinct input until it is Reset, so use one per candidate set
+     * @param Input - Raw text
+     * @param Forms - Table to intern into; its plan decides the form
+     * @return Handle resolvable through Forms
+     */
+    static FRENormalizedHandle PrepareHandle(const FString& Input, FRENormalizedFormTable& Forms);
+    
 private:
     // ========== STATIC DATA ==========
     
@@ -307,6 +350,29 @@ private:
     /** Initialize visual confusables */
     static void InitializeVisualConfusables();
     
+    /** Prepared text of a handle; empty for invalid handles */
+    static const FString& ResolvePrepared(FRENormalizedHandle Handle, const FRENormalizedFormTable& Forms);
+    
+    /** CompareStrings on prepared text; bEqual skips every metric */
+    static void ComparePrepared(
+        const FString& PreparedA,
+        const FString& PreparedB,
+        bool bEqual,
+        double StartTime,
+        FREStringMatch& Result
+    );
+    
+    /** GetSimilarity on prepared text; bEqual skips the algorithm */
+    static float GetPreparedSimilarity(
+        const FString& PreparedA,
+        const FString& PreparedB,
+        bool bEqual,
+        EREFuzzyAlgorithm Algorithm
+    );
+    
+    /** Prepared string without copying Input - normalized into Storage when bNormalize, else Input */
+    static const FString& PrepareStringRef(const FString& Input, bool bNormalize, FString& Storage);
+    
     /** Three-way minimum for dynamic programming */
     static FORCEINLINE int32 Min3(int32 A, int32 B, int32 C)
     {
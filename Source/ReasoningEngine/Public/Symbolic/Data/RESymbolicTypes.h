@@ -571,6 +571,82 @@ struct REASONINGENGINE_API FREKnowledgeQuery
     bool bIncludeInferred = true;
 };
 
+/**
+ * One triple pattern of a graph query
+ * Terms starting with '?' are variables shared across patterns;
+ * an empty term matches anything without binding
+ */
+USTRUCT(BlueprintType)
+struct REASONINGENGINE_API FRETriplePattern
+{
+    GENERATED_BODY()
+    
+    UPROPERTY(BlueprintReadWrite, Category="Query")
+    FString Subject;
+    
+    UPROPERTY(BlueprintReadWrite, Category="Query")
+    FString Predicate;
+    
+    UPROPERTY(BlueprintReadWrite, Category="Query")
+    FString Object;
+    
+    FRETriplePattern() = default;
+    
+    FRETriplePattern(const FString& InSubject, const FString& InPredicate, const FString& InObject)
+        : Subject(InSubject)
+        , Predicate(InPredicate)
+        , Object(InObject)
+    {
+    }
+    
+    static bool IsVariable(const FString& Term)
+    {
+        return Term.Len() > 1 && Term[0] == TEXT('?');
+    }
+};
+
+/**
+ * Conjunctive query over several triple patterns (basic graph pattern)
+ */
+USTRUCT(BlueprintType)
+struct REASONINGENGINE_API FREGraphPatternQuery
+{
+    GENERATED_BODY()
+    
+    /** Patterns that must all match, joined on shared variables */
+    UPROPERTY(BlueprintReadWrite, Category="Query")
+    TArray<FRETriplePattern> Patterns;
+    
+    /** Only match facts in this namespace (None = any) */
+    UPROPERTY(BlueprintReadWrite, Category="Query")
+    FName Namespace;
+    
+    /** Minimum confidence of every matched fact */
+    UPROPERTY(BlueprintReadWrite, Category="Query")
+    float MinConfidence = 0.5f;
+    
+    /** Stop after this many solutions (0 = no limit) */
+    UPROPERTY(BlueprintReadWrite, Category="Query")
+    int32 MaxResults = 100;
+};
+
+/**
+ * One solution of a graph pattern query
+ */
+USTRUCT(BlueprintType)
+struct REASONINGENGINE_API FREGraphPatternResult
+{
+    GENERATED_BODY()
+    
+    /** Variable name (without '?') -> bound term */
+    UPROPERTY(BlueprintReadOnly, Category="Query")
+    TMap<FString, FString> Bindings;
+    
+    /** Lowest confidence among the matched facts */
+    UPROPERTY(BlueprintReadOnly, Category="Query")
+    float Confidence = 1.0f;
+};
+
 /**
  * Knowledge graph node
  */
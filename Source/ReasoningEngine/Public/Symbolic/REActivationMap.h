@@ -0,0 +1,124 @@
+// Source/ReasoningEngine/Public/Symbolic/REActivationMap.h
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FREConceptGraph;
+
+/**
+ * Spreading activation state over the nodes of an FREConceptGraph
+ * Activation is a dense per-node vector, but every operation only visits
+ * the nodes it touches, so repeated small activations stay cheap on a
+ * large graph
+ *
+ * Design Philosophy:
+ * - Each hop is a sparse frontier vector (node, activation); the next
+ *   frontier is computed in parallel, by pushing along outgoing edges
+ *   while the frontier is small, or by pulling over incoming edges once
+ *   it covers a sizeable part of the graph
+ * - Activation passed along an edge is scaled by the edge strength and
+ *   by (1 - DecayRate); amounts below a threshold are dropped, so a
+ *   spread dies out on its own
+ * - Nodes with non-zero activation are kept in an active list, so the
+ *   most active nodes are selected with a bounded heap over that list
+ *   instead of a scan of the whole graph
+ * - Not synchronized; the owner guards it with the graph's lock
+ */
+class REASONINGENGINE_API FREActivationMap
+{
+public:
+    /** Activation passed along an edge below this is dropped */
+    static constexpr float Threshold = 0.01f;
+
+    // ========== CONFIGURATION ==========
+
+    /**
+     * Set the fraction of activation lost on each hop
+     * @param InDecayRate - 0 (no loss) to 1 (nothing spreads)
+     */
+    void SetDecayRate(float InDecayRate) { DecayRate = FMath::Clamp(InDecayRate, 0.0f, 1.0f); }
+
+    float GetDecayRate() const { return DecayRate; }
+
+    // ========== ACTIVATION ==========
+
+    /**
+     * Activate a node and spread along outgoing edges
+     * Every node reached at some hop gains the activation arriving there,
+     * capped at 1; of several edges reaching a node in the same hop, the
+     * strongest counts
+     * @param Graph - Graph to spread over
+     * @param Start - Activated node
+     * @param Strength - Activation injected at Start
+     * @param MaxHops - Furthest hop to spread to
+     * @param OnChanged - Called once per hop for each node whose activation changed, with its new level
+     */
+    void Spread(const FREConceptGraph& Graph, int32 Start, float Strength, int32 MaxHops,
+                TFunctionRef<void(int32 Node, float Activation)> OnChanged);
+
+    /** Activation of a node; 0 for nodes never activated */
+    float Get(int32 Node) const { return Activation.IsValidIndex(Node) ? Activation[Node] : 0.0f; }
+
+    /** Overwrite the activation of a node (e.g. when its concept is replaced or removed) */
+    void Set(int32 Node, float Level);
+
+    /**
+     * Most active nodes, highest first
+     * @param Count - Number of nodes to return
+     * @param Filter - Nodes for which this returns false are skipped
+     * @param OutNodes - Selected nodes
+     */
+    void GetMostActive(int32 Count, TFunctionRef<bool(int32 Node)> Filter, TArray<int32>& OutNodes) const;
+
+    int32 NumActive() const { return ActiveNodes.Num(); }
+
+    // ========== MAINTENANCE ==========
+
+    /** Clear all activation */
+    void Reset();
+
+    SIZE_T GetAllocatedSize() const;
+
+private:
+    /** Entry of a sparse frontier vector */
+    struct FEntry
+    {
+        int32 Node;
+        float Value;
+    };
+
+    /** Grow the dense arrays to the graph's node count */
+    void Reserve(int32 NumNodes);
+
+    /** Add a frontier's activation to the nodes it covers */
+    void Apply(TFunctionRef<void(int32 Node, float Activation)> OnChanged);
+
+    /** Next frontier from outgoing edges of the current one */
+    void Push(const FREConceptGraph& Graph, float Transfer);
+
+    /** Next frontier from incoming edges of every node */
+    void Pull(const FREConceptGraph& Graph, float Transfer);
+
+    float DecayRate = 0.3f;
+
+    /** Activation per node */
+    TArray<float> Activation;
+
+    /** Nodes with non-zero activation, unordered */
+    TArray<int32> ActiveNodes;
+
+    // Per-spread scratch, kept to avoid reallocating; dense arrays are
+    // all zero between hops
+
+    TArray<FEntry> Frontier;
+    TArray<FEntry> Next;
+
+    /** Frontier activation per node, for pulls */
+    TArray<float> FrontierValue;
+
+    /** Strongest incoming activation per node while merging pushes */
+    TArray<float> NextValue;
+
+    /** Per-task output of the parallel expansion */
+    TArray<TArray<FEntry>> TaskOutputs;
+};
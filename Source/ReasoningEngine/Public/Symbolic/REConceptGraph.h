@@ -0,0 +1,224 @@
+// Source/ReasoningEngine/Public/Symbolic/REConceptGraph.h
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Compressed sparse row (CSR) view of the concept graph
+ * Concepts get dense node ids and relation types dense type ids, so
+ * traversals index flat arrays instead of hashing names
+ *
+ * Design Philosophy:
+ * - Outgoing and incoming edges are each one contiguous array, sliced
+ *   per node by an offset table; a node's edges are sorted by type, so
+ *   a typed neighbour list is a sub-range found by binary search
+ * - Edits are incremental: new edges wait in a small sorted delta and
+ *   removed edges are tombstoned; both are folded into the CSR arrays
+ *   once they grow past a fraction of the graph
+ * - Node and type ids are never reused until Reset
+ * - Not synchronized; the owner guards it with its own lock
+ */
+class REASONINGENGINE_API FREConceptGraph
+{
+public:
+    /** Returned by lookups for names that are not in the graph */
+    static constexpr int32 InvalidNode = INDEX_NONE;
+
+    /** Type filter that matches every relation type */
+    static constexpr int32 AnyType = INDEX_NONE;
+
+    /** Returned by FindType for unknown types; as a filter it matches nothing */
+    static constexpr int32 InvalidType = INDEX_NONE - 1;
+
+    /** One directed edge as stored in a node's row */
+    struct FEdge
+    {
+        /** Node at the other end */
+        int32 Node;
+        int32 Type;
+        float Strength;
+
+        /** Caller's id for the relation this edge came from */
+        int32 Relation;
+    };
+
+    // ========== NODES AND TYPES ==========
+
+    /**
+     * Get the dense id of a node, adding it if needed
+     * @param Name - Concept name
+     * @return Node id
+     */
+    int32 AddNode(FName Name);
+
+    /** Node id, or InvalidNode if the name was never added */
+    int32 FindNode(FName Name) const;
+
+    FName GetNodeName(int32 Node) const { return NodeNames[Node]; }
+
+    int32 NumNodes() const { return NodeNames.Num(); }
+
+    /**
+     * Get the dense id of a relation type, adding it if needed
+     * Types match case-insensitively, like the relation type strings they replace
+     */
+    int32 AddType(const FString& TypeName);
+
+    /** Type id, or InvalidType if the type was never added */
+    int32 FindType(const FString& TypeName) const;
+
+    const FString& GetTypeName(int32 Type) const { return TypeNames[Type]; }
+
+    // ========== EDGES ==========
+
+    /**
+     * Add a directed edge
+     * @param From - Source node
+     * @param To - Target node
+     * @param Type - Relation type id
+     * @param Strength - Edge weight
+     * @param Relation - Caller's relation id, returned with the edge
+     */
+    void AddEdge(int32 From, int32 To, int32 Type, float Strength, int32 Relation);
+
+    /**
+     * Remove the edge added for a relation
+     * @return true if the edge existed
+     */
+    bool RemoveEdge(int32 From, int32 To, int32 Type, int32 Relation);
+
+    /**
+     * Change the relation id stored on an edge (e.g. after the caller compacts its relations)
+     * @return true if the edge existed
+     */
+    bool RemapEdge(int32 From, int32 To, int32 Type, int32 OldRelation, int32 NewRelation);
+
+    /**
+     * Visit the outgoing edges of a node
+     * @param Node - Source node
+     * @param Type - Type id, or AnyType
+     * @param Visitor - Called with each edge; return false to stop
+     */
+    void ForEachOutEdge(int32 Node, int32 Type, TFunctionRef<bool(const FEdge&)> Visitor) const;
+
+    /**
+     * Visit the incoming edges of a node; FEdge::Node is the source
+     */
+    void ForEachInEdge(int32 Node, int32 Type, TFunctionRef<bool(const FEdge&)> Visitor) const;
+
+    int32 NumEdges() const { return NumLiveEdges; }
+
+    // ========== TRAVERSAL ==========
+
+    /**
+     * Breadth-first search along outgoing edges
+     * @param Start - First node (visited at depth 0)
+     * @param MaxDepth - Deepest level to visit
+     * @param Type - Type id to follow, or AnyType
+     * @param Visitor - Called once per reached node with (Node, Depth, Parent);
+     *                  Parent is InvalidNode for Start. Return false to stop
+     */
+    void BreadthFirst(int32 Start, int32 MaxDepth, int32 Type,
+                      TFunctionRef<bool(int32 Node, int32 Depth, int32 Parent)> Visitor) const;
+
+    /**
+     * Fewest-hop path by bidirectional breadth-first search
+     * Grows a forward frontier from From and a backward one from To,
+     * always expanding the smaller, so hubs are crossed from one side only
+     * @param From - Start node
+     * @param To - Goal node
+     * @param MaxDepth - Longest path in edges
+     * @param Type - Type id to follow, or AnyType
+     * @param OutPath - Nodes from From to To inclusive
+     * @return true if a path within MaxDepth exists
+     */
+    bool FindShortestPath(int32 From, int32 To, int32 MaxDepth, int32 Type, TArray<int32>& OutPath) const;
+
+    /**
+     * Cheapest path by A* (Dijkstra without a heuristic), edge cost from EdgeCost
+     * @param From - Start node
+     * @param To - Goal node
+     * @param Type - Type id to follow, or AnyType
+     * @param MaxCost - Paths costing more are not explored
+     * @param Heuristic - Lower bound on the cost from a node to To; must be
+     *                    consistent (e.g. a hop-count lower bound)
+     * @param OutPath - Nodes from From to To inclusive
+     * @param OutCost - Cost of the path
+     * @return true if a path within MaxCost exists
+     */
+    bool FindWeightedPath(int32 From, int32 To, int32 Type, float MaxCost,
+                          TFunctionRef<float(int32 Node)> Heuristic,
+                          TArray<int32>& OutPath, float& OutCost) const;
+
+    bool FindWeightedPath(int32 From, int32 To, int32 Type, float MaxCost,
+                          TArray<int32>& OutPath, float& OutCost) const;
+
+    /**
+     * Cost of following an edge in weighted searches
+     * 1 at full strength up to 2 at zero; never below one hop, so hop-count
+     * lower bounds stay admissible. Edges with Strength <= 0 are not followed
+     */
+    static float EdgeCost(float Strength)
+    {
+        return 2.0f - FMath::Min(Strength, 1.0f);
+    }
+
+    // ========== MAINTENANCE ==========
+
+    /** Fold pending edges and tombstones into the CSR arrays */
+    void Compact();
+
+    /** Remove every node, type and edge */
+    void Reset();
+
+    SIZE_T GetAllocatedSize() const;
+
+private:
+    /** Edge waiting to be folded into the CSR arrays */
+    struct FPendingEdge
+    {
+        int32 Source;
+        FEdge Edge;
+    };
+
+    /** One direction of adjacency */
+    struct FAdjacency
+    {
+        /** Row start per node; rows of nodes added since the last compaction are empty */
+        TArray<int32> Offsets;
+        TArray<FEdge> Edges;
+
+        /** Tombstones over Edges */
+        TBitArray<> Removed;
+        int32 NumRemoved = 0;
+
+        /** Sorted by source, then like a row */
+        TArray<FPendingEdge> Pending;
+
+        void Add(int32 Source, const FEdge& Edge);
+        FEdge* Find(int32 Source, int32 Node, int32 Type, int32 Relation);
+        bool Remove(int32 Source, int32 Node, int32 Type, int32 Relation);
+
+        /** Position in Edges or Pending of a live edge, or INDEX_NONE */
+        int32 FindInRows(int32 Source, int32 Node, int32 Type, int32 Relation) const;
+        int32 FindInPending(int32 Source, int32 Node, int32 Type, int32 Relation) const;
+
+        void ForEach(int32 Source, int32 Type, TFunctionRef<bool(const FEdge&)> Visitor) const;
+        bool NeedsCompaction() const;
+        void Compact(int32 NumNodes);
+        void Reset();
+        SIZE_T GetAllocatedSize() const;
+    };
+
+    void CompactIfNeeded();
+
+    FAdjacency Out;
+    FAdjacency In;
+    int32 NumLiveEdges = 0;
+
+    TMap<FName, int32> NodeIds;
+    TArray<FName> NodeNames;
+
+    TMap<FString, int32> TypeIds;
+    TArray<FString> TypeNames;
+};
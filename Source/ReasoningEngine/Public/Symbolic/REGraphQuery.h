@@ -0,0 +1,60 @@
+// Source/ReasoningEngine/Public/Symbolic/REGraphQuery.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Symbolic/Data/RESymbolicTypes.h"
+
+class FRETripleSnapshot;
+class FRETripleStore;
+
+/**
+ * Conjunctive (basic graph pattern) queries over FRETripleStore
+ * Several triple patterns share '?variables' and are answered in one
+ * call instead of client-side joins of single-pattern queries
+ *
+ * Design Philosophy:
+ * - Patterns are compiled to term ids once; a constant that was never
+ *   stored means the query cannot match and nothing is scanned
+ * - Join order is greedy by estimated cardinality: exact range counts
+ *   for patterns with two constants, per-term frequencies for one,
+ *   scaled down by the distinct-term count of positions already bound
+ * - Patterns with two constants and the same single variable produce
+ *   that variable in sorted order, so they are merge-joined first;
+ *   every other pattern is an index nested loop on the bound positions
+ * - MaxResults stops the search as soon as enough solutions exist
+ */
+class REASONINGENGINE_API REGraphQuery
+{
+public:
+    /**
+     * Evaluate a graph pattern query
+     * @param Snapshot - Facts to query; every pattern sees the same state
+     * @param Query - Patterns, filters and result limit
+     * @return One solution per combination of matching facts, whichever
+     *         join runs; a triple stored in two namespaces matches twice
+     */
+    static TArray<FREGraphPatternResult> Execute(const FRETripleSnapshot& Snapshot, const FREGraphPatternQuery& Query);
+
+    /** Evaluate a graph pattern query against the store's latest snapshot */
+    static TArray<FREGraphPatternResult> Execute(const FRETripleStore& Store, const FREGraphPatternQuery& Query);
+
+    /**
+     * Order in which Execute evaluates the patterns
+     * @param Snapshot - Facts whose statistics drive the plan
+     * @param Query - Patterns to plan
+     * @return Indices into Query.Patterns; empty if the query cannot match
+     */
+    static TArray<int32> PlanJoinOrder(const FRETripleSnapshot& Snapshot, const FREGraphPatternQuery& Query);
+
+    /** Plan against the store's latest snapshot */
+    static TArray<int32> PlanJoinOrder(const FRETripleStore& Store, const FREGraphPatternQuery& Query);
+
+    // ========== DELETED CONSTRUCTORS ==========
+
+    REGraphQuery() = delete;
+    ~REGraphQuery() = delete;
+    REGraphQuery(const REGraphQuery&) = delete;
+    REGraphQuery& operator=(const REGraphQuery&) = delete;
+    REGraphQuery(REGraphQuery&&) = delete;
+    REGraphQuery& operator=(REGraphQuery&&) = delete;
+};
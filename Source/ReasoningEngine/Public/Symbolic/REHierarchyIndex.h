@@ -0,0 +1,78 @@
+// Source/ReasoningEngine/Public/Symbolic/REHierarchyIndex.h
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Interval labels over a concept hierarchy (child -> parent links)
+ * Answers "is X a kind of Y" and "all kinds of Y" without walking links
+ *
+ * Design Philosophy:
+ * - Concepts are numbered in depth-first pre-order from the roots, so the
+ *   concepts below Y in the spanning forest are the contiguous id range
+ *   [Y, Y + subtree size)
+ * - Concepts with several parents make the hierarchy a DAG; descendants
+ *   reached through such extra links add further intervals, merged per
+ *   concept. Tree-shaped parts keep exactly one interval, so their tests
+ *   are two comparisons; DAG parts binary-search a short interval list
+ * - Descendant listing is one range scan per interval
+ * - Built in one pass after edits; the hierarchy must be acyclic
+ *   (links closing a cycle are only reached through the first of them)
+ */
+class REASONINGENGINE_API FREHierarchyIndex
+{
+public:
+    /**
+     * Label a hierarchy
+     * @param ChildToParents - Each concept's parents
+     */
+    void Build(const TMultiMap<FName, FName>& ChildToParents);
+
+    bool IsBuilt() const { return bBuilt; }
+
+    /**
+     * Test subsumption
+     * @param Concept - Possible descendant
+     * @param Ancestor - Possible ancestor
+     * @return true if Concept is Ancestor or lies below it
+     */
+    bool IsDescendant(FName Concept, FName Ancestor) const;
+
+    /**
+     * Collect the concepts below a concept
+     * @param Ancestor - Concept to start from
+     * @param OutDescendants - Concepts below Ancestor, each once, excluding Ancestor
+     */
+    void GetDescendants(FName Ancestor, TArray<FName>& OutDescendants) const;
+
+    /** Number of concepts in the hierarchy */
+    int32 Num() const { return Names.Num(); }
+
+    /** Whether a concept is a child or parent in any link */
+    bool Contains(FName Concept) const { return Ids.Contains(Concept); }
+
+    /** Clear the labels; IsBuilt is false until the next Build */
+    void Reset();
+
+    SIZE_T GetAllocatedSize() const;
+
+private:
+    /** Closed range of pre-order ids */
+    struct FInterval
+    {
+        int32 First;
+        int32 Last;
+    };
+
+    /** Pre-order id per concept */
+    TMap<FName, int32> Ids;
+
+    /** Concept per pre-order id */
+    TArray<FName> Names;
+
+    /** Intervals of concept Id are Intervals[IntervalOffsets[Id]] up to IntervalOffsets[Id + 1]; sorted and disjoint */
+    TArray<int32> IntervalOffsets;
+    TArray<FInterval> Intervals;
+
+    bool bBuilt = false;
+};
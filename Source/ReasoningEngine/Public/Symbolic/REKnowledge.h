@@ -3,6 +3,11 @@
 #include "CoreMinimal.h"
 #include "UObject/NoExportTypes.h"
 #include "Symbolic/Data/RESymbolicTypes.h"  // UPDATED: Was "Data/REPatternTypes.h"
+#include "Symbolic/REActivationMap.h"
+#include "Symbolic/REConceptGraph.h"
+#include "Symbolic/REHierarchyIndex.h"
+#include "Symbolic/RELandmarkOracle.h"
+#include "Symbolic/RETripleStore.h"
 #include "REKnowledge.generated.h"
 
 // Forward declarations
@@ -25,11 +30,10 @@ private:
     
     // ========== KNOWLEDGE STORAGE ==========
     
-	/** Facts organized by namespace */
-	UPROPERTY()
-	TMap<FName, FREFactCollection> FactsByNamespace;  // Changed to use wrapper
+    /** Facts as dictionary-encoded triples with SPO/POS/OSP indexes; one writer, lock-free snapshot readers */
+    FRETripleStore FactStore;
     
-    /** Concepts in the knowledge graph */
+    /** Concepts in the knowledge graph; adjacency lives in ConceptGraph */
     UPROPERTY()
     TMap<FName, FREKnowledgeNode> KnowledgeGraph;
     
@@ -37,22 +41,25 @@ private:
     UPROPERTY()
     TArray<FRERelation> Relations;
     
-    /** Concept hierarchies */
+    /** Concept hierarchies: concept -> its parents; acyclic */
     TMultiMap<FName, FName> ConceptHierarchy;
     
     // ========== INDEXING ==========
     
-    /** Subject index for fast lookup */
-    TMultiMap<FString, FREFact*> SubjectIndex;
+    /** CSR adjacency over Relations with dense node and type ids; edges carry relation indices */
+    FREConceptGraph ConceptGraph;
     
-    /** Predicate index */
-    TMultiMap<FString, FREFact*> PredicateIndex;
+    /** Interval labels over ConceptHierarchy; reset on hierarchy edits and rebuilt on the next query */
+    mutable FREHierarchyIndex HierarchyIndex;
     
-    /** Object index */
-    TMultiMap<FString, FREFact*> ObjectIndex;
+    /** Landmark distances over ConceptGraph; built on first use, then kept up to date by relation edits */
+    mutable FRELandmarkOracle DistanceOracle;
     
-    /** Relation index by type */
-    TMultiMap<FString, FRERelation*> RelationTypeIndex;
+    /** Activation per ConceptGraph node; mirrored into the ActivationLevel of concept nodes */
+    FREActivationMap ConceptActivation;
+    
+    /** Guards KnowledgeGraph, Relations, ConceptHierarchy and the indexes over them (facts have their own snapshots) */
+    mutable FRWLock GraphLock;
     
     // ========== STATISTICS ==========
     
@@ -66,12 +73,29 @@ private:
     /** Rebuild indices after bulk changes */
     void RebuildIndices();
     
-    /** Find path between concepts */
-    TArray<FName> FindConceptPath(FName FromConcept, FName ToConcept, int32 MaxDepth = 5) const;
-    
-    /** Spread activation through graph */
+    /** Spread activation through graph; only the reached neighbourhood is visited */
     void SpreadActivation(FName StartNode, float ActivationStrength, int32 MaxHops = 3);
     
+    /** Build HierarchyIndex if a hierarchy edit reset it; takes GraphLock */
+    void EnsureHierarchyIndex() const;
+    
+    /** (Re)build DistanceOracle if it is missing or out of proportion with the graph; takes GraphLock */
+    void EnsureDistanceOracle() const;
+    
+    // Relation bookkeeping; GraphLock must be held for writing
+    
+    /** Add the graph edges of Relations[RelationIndex] */
+    void LinkRelation(int32 RelationIndex);
+    
+    /** Remove the graph edges of Relations[RelationIndex] */
+    void UnlinkRelation(int32 RelationIndex);
+    
+    /** Remove a relation, moving the last one into its slot */
+    void RemoveRelationAt(int32 RelationIndex);
+    
+    /** Index of the stored relation with the same ends and type, or INDEX_NONE */
+    int32 FindRelationIndex(const FRERelation& Relation) const;
+    
 public:
     // ========== LIFECYCLE ==========
     
@@ -94,6 +118,15 @@ public:
               meta=(DisplayName="Add Fact"))
     void AddFact(const FREFact& Fact, FName Namespace = NAME_None);
     
+    /**
+     * Add many facts with a single index build
+     * Use for knowledge dumps; duplicates are collapsed and the last copy wins
+     * @param Facts - Facts to add; incomplete facts are skipped
+     * @param Namespace - Namespace for all facts (None = each fact's own)
+     * @return Number of facts that were not already stored
+     */
+    int32 AddFactsBulk(TArrayView<const FREFact> Facts, FName Namespace = NAME_None);
+    
     /**
      * Remove a fact
      * @param Fact - Fact to remove
@@ -126,6 +159,23 @@ public:
                 const FString& Predicate,
                 const FString& Object) const;
     
+    /**
+     * Query several triple patterns joined on shared '?variables'
+     * e.g. (?clip, is_a, Locomotion) + (?clip, has_tag, ?tag)
+     * @param Query - Patterns, filters and result limit
+     * @return One binding set per solution
+     */
+    UFUNCTION(BlueprintCallable, Category="MM|Knowledge|Facts",
+              meta=(DisplayName="Query Graph Pattern"))
+    TArray<FREGraphPatternResult> QueryPattern(const FREGraphPatternQuery& Query);
+    
+    /**
+     * Consistent read-only view of all facts
+     * Safe to hold on any thread; later writes do not change it
+     * @return Snapshot of the latest published fact state
+     */
+    TSharedRef<const FRETripleSnapshot> GetFactSnapshot() const { return FactStore.GetSnapshot(); }
+    
     // ========== CONCEPT MANAGEMENT ==========
     
     /**
@@ -166,6 +216,48 @@ public:
     TArray<FREConcept> FindConcepts(const FString& SearchText,
                                     int32 MaxResults = 10);
     
+    // ========== CONCEPT HIERARCHY ==========
+    
+    /**
+     * Make a concept a kind of another
+     * @param ConceptID - More specific concept
+     * @param ParentID - More general concept
+     * @return false if the link would make the hierarchy cyclic
+     */
+    UFUNCTION(BlueprintCallable, Category="MM|Knowledge|Hierarchy",
+              meta=(DisplayName="Add Concept Parent"))
+    bool AddConceptParent(FName ConceptID, FName ParentID);
+    
+    /**
+     * Remove a link added by AddConceptParent
+     * @param ConceptID - More specific concept
+     * @param ParentID - More general concept
+     * @return true if the link existed
+     */
+    UFUNCTION(BlueprintCallable, Category="MM|Knowledge|Hierarchy",
+              meta=(DisplayName="Remove Concept Parent"))
+    bool RemoveConceptParent(FName ConceptID, FName ParentID);
+    
+    /**
+     * Check whether a concept is a kind of another, directly or transitively
+     * Constant time on tree-shaped parts of the hierarchy
+     * @param ConceptID - More specific concept
+     * @param AncestorID - More general concept
+     * @return true if ConceptID is AncestorID or lies below it
+     */
+    UFUNCTION(BlueprintPure, Category="MM|Knowledge|Hierarchy",
+              meta=(DisplayName="Is A"))
+    bool IsA(FName ConceptID, FName AncestorID) const;
+    
+    /**
+     * Get every concept below a concept in the hierarchy
+     * @param ConceptID - General concept
+     * @return More specific concepts, each once
+     */
+    UFUNCTION(BlueprintCallable, Category="MM|Knowledge|Hierarchy",
+              meta=(DisplayName="Get Descendants"))
+    TArray<FName> GetDescendants(FName ConceptID) const;
+    
     // ========== RELATION MANAGEMENT ==========
     
     /**
@@ -213,6 +305,32 @@ public:
     
     // ========== GRAPH OPERATIONS ==========
     
+    /**
+     * Find a path with the fewest relations between concepts
+     * Bidirectional breadth-first search, so cost grows with the
+     * neighbourhoods of both ends rather than with hub fan-out
+     * @param FromConcept - Start concept
+     * @param ToConcept - Goal concept
+     * @param MaxDepth - Longest path in relations
+     * @return Concepts from start to goal inclusive; empty if none within MaxDepth
+     */
+    UFUNCTION(BlueprintCallable, Category="MM|Knowledge|Graph",
+              meta=(DisplayName="Find Concept Path"))
+    TArray<FName> FindConceptPath(FName FromConcept, FName ToConcept, int32 MaxDepth = 5) const;
+    
+    /**
+     * Find the path through the strongest relations between concepts
+     * A* over relation strengths: each relation costs 1 at full strength up to 2 at zero
+     * @param FromConcept - Start concept
+     * @param ToConcept - Goal concept
+     * @param OutCost - Cost of the returned path
+     * @param MaxCost - Paths costing more are not explored
+     * @return Concepts from start to goal inclusive; empty if none within MaxCost
+     */
+    UFUNCTION(BlueprintCallable, Category="MM|Knowledge|Graph",
+              meta=(DisplayName="Find Weighted Concept Path"))
+    TArray<FName> FindWeightedConceptPath(FName FromConcept, FName ToConcept, float& OutCost, float MaxCost = 10.0f) const;
+    
     /**
      * Find related concepts
      * @param ConceptID - Starting concept
@@ -228,14 +346,33 @@ public:
     
     /**
      * Calculate semantic distance between concepts
+     * Estimated from precomputed landmark distances in O(landmarks), without a graph search;
+     * relation direction is ignored and the estimate is the length of a real connecting path
      * @param ConceptA - First concept
      * @param ConceptB - Second concept
-     * @return Semantic distance (lower = more similar)
+     * @return Semantic distance in relations (lower = more similar); float max if unknown or unconnected
      */
     UFUNCTION(BlueprintPure, Category="MM|Knowledge|Graph",
               meta=(DisplayName="Calculate Semantic Distance"))
     float CalculateSemanticDistance(FName ConceptA, FName ConceptB) const;
     
+    /**
+     * Bound the number of relations between concepts, ignoring direction
+     * @param ConceptA - First concept
+     * @param ConceptB - Second concept
+     * @param OutLower - Distance is at least this
+     * @param OutUpper - Distance is at most this; FRELandmarkOracle::UnknownDistance if no bound is known
+     * @return false if either concept is unknown
+     */
+    bool GetSemanticDistanceBounds(FName ConceptA, FName ConceptB, int32& OutLower, int32& OutUpper) const;
+    
+    /**
+     * Pick landmark concepts and precompute their distances
+     * Done automatically on first use; call after bulk loading to pay the cost up front
+     * @param NumLandmarks - Landmarks to pick; more give tighter bounds at one byte per concept each
+     */
+    void BuildDistanceIndex(int32 NumLandmarks = 256);
+    
     /**
      * Activate concept and spread activation
      * @param ConceptID - Concept to activate
@@ -250,13 +387,20 @@ public:
     
     /**
      * Get most activated concepts
+     * Selected with a bounded heap over the activated concepts only
      * @param Count - Number of concepts to return
-     * @return Array of activated concepts
+     * @return Array of activated concepts, most active first
      */
     UFUNCTION(BlueprintCallable, Category="MM|Knowledge|Graph",
               meta=(DisplayName="Get Activated Concepts"))
     TArray<FREConcept> GetActivatedConcepts(int32 Count = 10) const;
     
+    /**
+     * Set how much activation is lost per hop while spreading
+     * @param DecayRate - Fraction lost per hop, 0 to 1 (see FKnowledgeBaseConfig::ActivationDecayRate)
+     */
+    void SetActivationDecayRate(float DecayRate);
+    
     // ========== IMPORT/EXPORT ==========
     
     /**
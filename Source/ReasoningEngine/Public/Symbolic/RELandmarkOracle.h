@@ -0,0 +1,141 @@
+// Source/ReasoningEngine/Public/Symbolic/RELandmarkOracle.h
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FREConceptGraph;
+
+/**
+ * Landmark (ALT) distance oracle over an FREConceptGraph
+ * Stores breadth-first distances from a set of landmark nodes and bounds
+ * the hop distance between any two nodes by the triangle inequality:
+ * |d(L,A) - d(L,B)| <= d(A,B) <= d(L,A) + d(L,B) for every landmark L
+ *
+ * Design Philosophy:
+ * - Distances ignore edge direction and type, so bounds are symmetric and
+ *   a lower bound also bounds any directed or typed path
+ * - One byte per node and landmark, node-major, so a query reads two
+ *   contiguous rows: O(landmarks) with no graph access
+ * - Landmarks are picked by degree, first one per connected component,
+ *   then the remaining highest-degree nodes
+ * - Edits are incremental: an added edge relaxes only the distances it
+ *   shortens; a removed edge recomputes only the landmarks whose
+ *   shortest-path trees it actually cut
+ * - Not synchronized; the owner guards it with the graph's lock
+ */
+class REASONINGENGINE_API FRELandmarkOracle
+{
+public:
+    /** Stored for nodes a landmark does not reach within MaxDistance */
+    static constexpr uint8 Unreached = MAX_uint8;
+
+    /** Deepest breadth-first level stored */
+    static constexpr int32 MaxDistance = MAX_uint8 - 1;
+
+    /** Upper bound reported when no landmark reaches both nodes */
+    static constexpr int32 UnknownDistance = MAX_int32;
+
+    // ========== BUILD ==========
+
+    /**
+     * Pick landmarks and compute their distances
+     * @param Graph - Graph to index
+     * @param NumLandmarks - Landmarks to pick at most
+     */
+    void Build(const FREConceptGraph& Graph, int32 NumLandmarks);
+
+    /** true once Build ran, even if the graph had no edges to pick landmarks from */
+    bool IsBuilt() const { return bBuilt; }
+
+    /**
+     * true if landmarks are worth picking again: never built, the graph has
+     * doubled, or nodes were added while fewer landmarks than requested exist
+     */
+    bool IsStale(const FREConceptGraph& Graph) const;
+
+    int32 NumLandmarks() const { return Landmarks.Num(); }
+
+    /** Landmark count requested by the last Build */
+    int32 GetLandmarkBudget() const { return RequestedLandmarks; }
+
+    int32 GetLandmark(int32 Index) const { return Landmarks[Index]; }
+
+    // ========== QUERIES ==========
+
+    /**
+     * Bound the hop distance between two nodes, ignoring edge direction
+     * @param A - First node
+     * @param B - Second node
+     * @param OutLower - Largest landmark lower bound (0 if nothing is known)
+     * @param OutUpper - Smallest landmark upper bound, or UnknownDistance
+     */
+    void GetBounds(int32 A, int32 B, int32& OutLower, int32& OutUpper) const;
+
+    /**
+     * Lower bound on the hop distance between two nodes
+     * Consistent, so usable as an A* heuristic for edge costs of at least one hop
+     */
+    int32 GetLowerBound(int32 A, int32 B) const;
+
+    // ========== INCREMENTAL UPDATES ==========
+
+    /** Update distances after an edge between From and To was added */
+    void OnEdgeAdded(const FREConceptGraph& Graph, int32 From, int32 To);
+
+    /**
+     * Note that the edge between From and To was removed from Graph
+     * Landmarks whose distances it changed are recomputed by Refresh
+     */
+    void OnEdgeRemoved(const FREConceptGraph& Graph, int32 From, int32 To);
+
+    /** Recompute the landmarks invalidated by removed edges */
+    void Refresh(const FREConceptGraph& Graph);
+
+    // ========== MAINTENANCE ==========
+
+    void Reset();
+
+    SIZE_T GetAllocatedSize() const;
+
+private:
+    /** Distance from landmark Index to Node */
+    uint8 GetDistance(int32 Node, int32 Index) const
+    {
+        return Node < NumRows ? Distances[static_cast<SIZE_T>(Node) * Landmarks.Num() + Index] : Unreached;
+    }
+
+    uint8& Distance(int32 Node, int32 Index)
+    {
+        return Distances[static_cast<SIZE_T>(Node) * Landmarks.Num() + Index];
+    }
+
+    /** Add unreached rows for nodes added to the graph since the last update */
+    void AddRows(int32 NumNodes);
+
+    /**
+     * Undirected breadth-first distances from a node
+     * @param OutColumn - Distance per node
+     * @param OutReached - Reached nodes in visiting order
+     */
+    static void ComputeColumn(const FREConceptGraph& Graph, int32 Source, TArray<uint8>& OutColumn, TArray<int32>& OutReached);
+
+    /** Write a landmark's distances into the node-major table */
+    void StoreColumn(int32 Index, const TArray<uint8>& Column);
+
+    /** Propagate a shortened distance of Node from landmark Index */
+    void Relax(const FREConceptGraph& Graph, int32 Index, int32 Node);
+
+    TArray<int32> Landmarks;
+
+    /** Distances[Node * NumLandmarks + Landmark] */
+    TArray<uint8> Distances;
+    int32 NumRows = 0;
+
+    /** Landmarks to recompute on the next Refresh */
+    TBitArray<> Dirty;
+
+    /** Graph size and landmark budget at the last Build */
+    int32 BuiltNodes = 0;
+    int32 RequestedLandmarks = 0;
+    bool bBuilt = false;
+};
@@ -0,0 +1,511 @@
+// Source/ReasoningEngine/Public/Symbolic/RETripleStore.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Infrastructure/REStringPool.h"
+#include "Symbolic/Data/RESymbolicTypes.h"
+#include <atomic>
+
+class FRETripleStore;
+
+/**
+ * Dictionary-encoded subject-predicate-object triple
+ */
+struct FRETriple
+{
+    uint32 Subject = MAX_uint32;
+    uint32 Predicate = MAX_uint32;
+    uint32 Object = MAX_uint32;
+
+    /** Term id by position: 0 = subject, 1 = predicate, 2 = object */
+    uint32& operator[](int32 Position)
+    {
+        check(Position >= 0 && Position < 3);
+        return Position == 0 ? Subject : (Position == 1 ? Predicate : Object);
+    }
+
+    uint32 operator[](int32 Position) const
+    {
+        check(Position >= 0 && Position < 3);
+        return Position == 0 ? Subject : (Position == 1 ? Predicate : Object);
+    }
+};
+
+/**
+ * Generational handle to a stored fact
+ * Goes stale when the fact is removed or updated, even if its slot is reused
+ */
+struct FREFactHandle
+{
+    uint32 Index = MAX_uint32;
+    uint32 Generation = 0;
+
+    bool operator==(const FREFactHandle& Other) const
+    {
+        return Index == Other.Index && Generation == Other.Generation;
+    }
+
+    bool operator!=(const FREFactHandle& Other) const
+    {
+        return !(*this == Other);
+    }
+};
+
+/**
+ * Immutable, consistent view of a FRETripleStore
+ * Obtained from FRETripleStore::GetSnapshot; never changes while held,
+ * however many facts the writer adds or removes meanwhile
+ *
+ * Design Philosophy:
+ * - Index entries are 16 bytes (three term ids + fact id) and hold
+ *   everything a lookup needs, so scans never touch the rich fields
+ * - Indexes are sorted runs of bounded blocks, grouped into segments and
+ *   shared between snapshots; a write copies the segment list and only
+ *   the segment and block it changes
+ * - Fact slots are never modified while a snapshot can reach them:
+ *   updates write a new slot, and removed slots are recycled only
+ *   after every snapshot that could see them is released
+ */
+class REASONINGENGINE_API FRETripleSnapshot
+{
+public:
+    /** Term id of unknown strings; also the wildcard in id-based lookups */
+    static constexpr uint32 InvalidId = FREStringPool::InvalidId;
+
+    /** Fields of a fact that are not part of the triple */
+    struct FAttributes
+    {
+        float Confidence = 1.0f;
+        FName Namespace;
+        FDateTime Timestamp;
+        FString Source;
+        TMap<FString, FString> Metadata;
+    };
+
+    // ========== LOOKUP ==========
+
+    /**
+     * Visit facts matching a pattern
+     * @param Subject - Subject term (empty = any)
+     * @param Predicate - Predicate term (empty = any)
+     * @param Object - Object term (empty = any)
+     * @param Visitor - Called with each fact id; return false to stop
+     */
+    void Query(FStringView Subject, FStringView Predicate, FStringView Object,
+               TFunctionRef<bool(uint32 FactId)> Visitor) const;
+
+    /**
+     * Visit facts matching a pattern of term ids
+     * @param Pattern - Term ids; InvalidId leaves a position unbound
+     * @param Visitor - Called with each fact id; return false to stop
+     */
+    void QueryIds(const FRETriple& Pattern, TFunctionRef<bool(uint32 FactId)> Visitor) const;
+
+    /**
+     * Check whether a triple is stored in any namespace
+     */
+    bool Contains(FStringView Subject, FStringView Predicate, FStringView Object) const;
+
+    /** Term ids of a fact */
+    const FRETriple& GetTriple(uint32 FactId) const { return Storage->GetSlot(FactId).Triple; }
+
+    /** Side-table fields of a fact */
+    const FAttributes& GetAttributes(uint32 FactId) const { return Storage->GetSlot(FactId).Attributes; }
+
+    /**
+     * Rebuild the full fact
+     * @param FactId - Fact id passed to a lookup visitor
+     */
+    FREFact GetFact(uint32 FactId) const;
+
+    /** Handle for a fact id passed to a lookup visitor */
+    FREFactHandle MakeHandle(uint32 FactId) const;
+
+    /**
+     * Look up a term id without adding it
+     * @return Id, or InvalidId if the term was never stored
+     */
+    uint32 FindTerm(FStringView Term) const { return Terms->Find(Term); }
+
+    /** Get the string for a term id */
+    const FString& ResolveTerm(uint32 TermId) const { return Terms->Resolve(TermId); }
+
+    /** Number of facts in this snapshot */
+    int32 Num() const { return NumFacts; }
+
+    /** Increases with every published write */
+    uint64 GetVersion() const { return Version; }
+
+    // ========== STATISTICS ==========
+
+    /**
+     * Exact number of facts matching a pattern of term ids
+     * Costs a range search, so it is cheap enough for query planning
+     * @param Pattern - Term ids; InvalidId leaves a position unbound
+     */
+    int32 CountMatches(const FRETriple& Pattern) const;
+
+    /**
+     * Number of facts using a term at a position
+     * Tracks the latest write rather than this snapshot; for planning only
+     * @param Position - 0 = subject, 1 = predicate, 2 = object
+     * @param TermId - Term id
+     */
+    int32 GetTermFrequency(int32 Position, uint32 TermId) const
+    {
+        return static_cast<int32>(Storage->GetFrequency(Position, TermId));
+    }
+
+    /**
+     * Number of distinct terms used at a position (latest write)
+     * @param Position - 0 = subject, 1 = predicate, 2 = object
+     */
+    int32 GetNumDistinctTerms(int32 Position) const
+    {
+        return Storage->NumDistinctTerms[Position].load(std::memory_order_relaxed);
+    }
+
+    /** Approximate memory used by this snapshot, its fact arena and terms */
+    SIZE_T GetAllocatedSize() const;
+
+private:
+    friend class FRETripleStore;
+
+    /** Index permutations */
+    enum EOrder : int32
+    {
+        SPO = 0,
+        POS = 1,
+        OSP = 2,
+        NumOrders = 3
+    };
+
+    /** Triple in index order, tagged with its fact id */
+    struct FIndexEntry
+    {
+        uint32 Key[3];
+        uint32 FactId;
+    };
+
+    /**
+     * Sorted sequence of index entries split into blocks of at most
+     * MaxBlockSize, grouped into segments of at most MaxSegmentSize blocks
+     * and located by binary search over the segments' and blocks' last keys
+     * Segments and blocks are shared with older snapshots and copied on
+     * first write, so copying an index copies only the segment list and
+     * Insert/Remove copy one segment and one block:
+     * O(n / (MaxBlockSize * MaxSegmentSize) + MaxSegmentSize + MaxBlockSize)
+     */
+    class FIndex
+    {
+    public:
+        static constexpr int32 MaxBlockSize = 512;
+        static constexpr int32 MaxSegmentSize = 64;
+
+        using FBlock = TArray<FIndexEntry>;
+        using FSegment = TArray<TSharedPtr<FBlock>>;
+
+        void Insert(const FIndexEntry& Entry);
+        bool Remove(const FIndexEntry& Entry);
+
+        /** Replace the contents with already sorted entries */
+        void Build(TArrayView<const FIndexEntry> Sorted);
+
+        /**
+         * Merge already sorted entries into the index in one pass
+         * @param Sorted - Entries to add
+         * @param Dropped - Fact ids whose existing entries are left out (optional)
+         */
+        void Merge(TArrayView<const FIndexEntry> Sorted, const TBitArray<>* Dropped);
+
+        /**
+         * Visit entries whose first PrefixLen keys equal Prefix, in order
+         * Visitor returns false to stop
+         */
+        void ForEachWithPrefix(const uint32* Prefix, int32 PrefixLen,
+                               TFunctionRef<bool(const FIndexEntry&)> Visitor) const;
+
+        /** Number of entries whose first PrefixLen keys equal Prefix */
+        int32 CountWithPrefix(const uint32* Prefix, int32 PrefixLen) const;
+
+        int32 Num() const { return NumEntries; }
+        SIZE_T GetAllocatedSize() const;
+
+    private:
+        /**
+         * First block whose last entry is not below Entry, clamped to the last block
+         * Segments must be non-empty
+         */
+        void FindBlock(const FIndexEntry& Entry, int32& OutSegment, int32& OutBlock) const;
+
+        /**
+         * First block whose last entry reaches Prefix
+         * @return False if every entry is below Prefix
+         */
+        bool FindPrefixBlock(const uint32* Prefix, int32 PrefixLen, int32& OutSegment, int32& OutBlock) const;
+
+        /** Segment for writing; copied first if an older snapshot shares it */
+        FSegment& MutableSegment(int32 SegmentIndex);
+
+        /** Block for writing; Segment must come from MutableSegment */
+        FBlock& MutableBlock(FSegment& Segment, int32 BlockIndex);
+
+        TArray<TSharedPtr<FSegment>> Segments;
+        int32 NumEntries = 0;
+    };
+
+    /** Row plus side-table fields of one fact */
+    struct FSlot
+    {
+        FRETriple Triple;
+        FAttributes Attributes;
+
+        /** Odd while the slot holds a live fact */
+        std::atomic<uint32> Generation{ 0 };
+    };
+
+    /**
+     * Fact arena and planner statistics shared by every snapshot of a store
+     * Fixed top-level tables so readers never see them reallocate
+     */
+    struct FStorage
+    {
+        static constexpr uint32 ChunkBits = 10;
+        static constexpr uint32 ChunkSize = 1u << ChunkBits;
+        static constexpr uint32 ChunkMask = ChunkSize - 1;
+        static constexpr uint32 MaxChunks = 16384;
+
+        static constexpr uint32 TermChunkBits = 12;
+        static constexpr uint32 TermChunkSize = 1u << TermChunkBits;
+        static constexpr uint32 TermChunkMask = TermChunkSize - 1;
+        static constexpr uint32 MaxTermChunks = 4096;
+
+        FStorage();
+        ~FStorage();
+
+        FSlot& GetSlot(uint32 FactId) const
+        {
+            return Chunks[FactId >> ChunkBits].load(std::memory_order_acquire)[FactId & ChunkMask];
+        }
+
+        /** Facts per term id at a position */
+        uint32 GetFrequency(int32 Position, uint32 TermId) const;
+
+        std::atomic<FSlot*> Chunks[MaxChunks];
+        std::atomic<int32> NumChunks{ 0 };
+
+        std::atomic<std::atomic<uint32>*> Frequency[3][MaxTermChunks];
+        std::atomic<int32> NumDistinctTerms[3];
+    };
+
+    FRETripleSnapshot() = default;
+    FRETripleSnapshot(const FRETripleSnapshot&) = default;
+    FRETripleSnapshot& operator=(const FRETripleSnapshot&) = delete;
+
+    static EOrder SelectOrder(const FRETriple& Pattern, uint32* OutPrefix, int32& OutPrefixLen);
+    static FIndexEntry MakeEntry(EOrder Order, const FRETriple& Triple, uint32 FactId);
+    static bool EntryLess(const FIndexEntry& A, const FIndexEntry& B);
+
+    /** Add or remove a fact's entries in all three indexes (unpublished snapshots only) */
+    void InsertEntries(uint32 FactId);
+    void RemoveEntries(uint32 FactId);
+
+    /** Fact id of a triple in a namespace, or InvalidId */
+    uint32 FindFact(const FRETriple& Triple, FName Namespace) const;
+
+    /** Permuted triples */
+    FIndex Indexes[NumOrders];
+
+    TSharedPtr<FStorage> Storage;
+    TSharedPtr<FREStringPool> Terms;
+    int32 NumFacts = 0;
+    uint64 Version = 0;
+};
+
+/**
+ * Fact storage for UREKnowledge
+ * Terms are interned to dense ids and every fact is a 3×uint32 row,
+ * indexed by three sorted permutations (SPO, POS, OSP) so any
+ * combination of bound fields is a binary-searched range
+ *
+ * Design Philosophy:
+ * - Confidence, namespace, source, timestamp and metadata live in a
+ *   side table indexed by fact id, read only for returned facts
+ * - Rows and side table live in fixed-size chunks that never move;
+ *   slots are recycled under a new generation
+ * - Many readers, one writer: writes are serialized and each publishes
+ *   a new FRETripleSnapshot; readers take the current snapshot with a
+ *   pointer copy and never wait for a write in progress
+ * - Terms are case-sensitive: "Walk" and "walk" are different terms
+ * - A fact is identified by its triple plus namespace; adding it again
+ *   replaces the stored fields
+ */
+class REASONINGENGINE_API FRETripleStore
+{
+public:
+    /** Term id of unknown strings; also the wildcard in id-based lookups */
+    static constexpr uint32 InvalidId = FRETripleSnapshot::InvalidId;
+
+    using FAttributes = FRETripleSnapshot::FAttributes;
+
+    FRETripleStore();
+    ~FRETripleStore();
+
+    FRETripleStore(const FRETripleStore&) = delete;
+    FRETripleStore& operator=(const FRETripleStore&) = delete;
+
+    // ========== SNAPSHOTS ==========
+
+    /**
+     * Latest published state
+     * Use one snapshot for several reads that must agree with each other
+     */
+    TSharedRef<const FRETripleSnapshot> GetSnapshot() const;
+
+    // ========== MUTATION ==========
+
+    /**
+     * Add a fact, or replace the fields of an existing one
+     * @param Fact - Fact to store (must be valid)
+     * @param Namespace - Namespace to store it under
+     * @return Handle of the stored fact (updates get a new handle), or an
+     *         invalid handle (logged) if the term pool or fact arena is full
+     */
+    FREFactHandle Add(const FREFact& Fact, FName Namespace);
+
+    /**
+     * Add many facts at once
+     * Terms are interned and existing facts probed in parallel, duplicates
+     * are collapsed by hash (the last copy's fields win), and each index
+     * is sorted and merged once instead of per fact
+     * @param Facts - Facts to store; invalid facts are skipped
+     * @param Namespace - Namespace for all facts (None = each fact's own)
+     * @return Number of facts that were not already stored; if the fact
+     *         arena fills up, the add stops there (logged) and counts only
+     *         what was inserted
+     */
+    int32 AddBulk(TArrayView<const FREFact> Facts, FName Namespace);
+
+    /**
+     * Remove a fact
+     * @param Subject - Fact subject
+     * @param Predicate - Fact predicate
+     * @param Object - Fact object
+     * @param Namespace - Namespace the fact was stored under
+     * @return true if the fact was removed
+     */
+    bool Remove(FStringView Subject, FStringView Predicate, FStringView Object, FName Namespace);
+
+    /**
+     * Remove a fact by handle
+     * @param Handle - Handle returned by Add or MakeHandle
+     * @return true if the handle was live and the fact was removed
+     */
+    bool Remove(FREFactHandle Handle);
+
+    /**
+     * Rebuild all three indexes from the fact rows
+     */
+    void RebuildIndexes();
+
+    /**
+     * Remove every fact and term
+     * Snapshots taken earlier keep their own data alive
+     */
+    void Reset();
+
+    // ========== LOOKUP ==========
+    // Each call reads the latest snapshot
+
+    void Query(FStringView Subject, FStringView Predicate, FStringView Object,
+               TFunctionRef<bool(uint32 FactId)> Visitor) const
+    {
+        GetSnapshot()->Query(Subject, Predicate, Object, Visitor);
+    }
+
+    void QueryIds(const FRETriple& Pattern, TFunctionRef<bool(uint32 FactId)> Visitor) const
+    {
+        GetSnapshot()->QueryIds(Pattern, Visitor);
+    }
+
+    bool Contains(FStringView Subject, FStringView Predicate, FStringView Object) const
+    {
+        return GetSnapshot()->Contains(Subject, Predicate, Object);
+    }
+
+    /** Valid until the fact is removed or updated */
+    const FRETriple& GetTriple(uint32 FactId) const { return GetSnapshot()->GetTriple(FactId); }
+
+    /** Valid until the fact is removed or updated */
+    const FAttributes& GetAttributes(uint32 FactId) const { return GetSnapshot()->GetAttributes(FactId); }
+
+    FREFact GetFact(uint32 FactId) const { return GetSnapshot()->GetFact(FactId); }
+
+    FREFactHandle MakeHandle(uint32 FactId) const { return GetSnapshot()->MakeHandle(FactId); }
+
+    /** Check that a handle still refers to a stored fact */
+    bool IsValid(FREFactHandle Handle) const;
+
+    uint32 FindTerm(FStringView Term) const { return GetSnapshot()->FindTerm(Term); }
+
+    int32 CountMatches(const FRETriple& Pattern) const { return GetSnapshot()->CountMatches(Pattern); }
+
+    /** Number of stored facts */
+    int32 Num() const { return GetSnapshot()->Num(); }
+
+    /** Approximate memory used by rows, indexes, side table and terms */
+    SIZE_T GetAllocatedSize() const { return GetSnapshot()->GetAllocatedSize(); }
+
+private:
+    /** Snapshot with a fresh arena and term pool */
+    static TSharedRef<FRETripleSnapshot> MakeEmptySnapshot(uint64 Version);
+
+    /** Mutable copy of the current snapshot for the write in progress */
+    TSharedRef<FRETripleSnapshot> BeginWrite() const;
+
+    /** Make a written snapshot current; queues the slots it retired */
+    void Publish(const TSharedRef<FRETripleSnapshot>& Next);
+
+    /** Take a free slot or grow the arena by one, marked live; InvalidId (logged) when full */
+    uint32 AllocateSlot(FRETripleSnapshot::FStorage& Storage);
+
+    /** Mark a slot dead; it is reused once no snapshot can see it */
+    void RetireSlot(FRETripleSnapshot::FStorage& Storage, uint32 FactId);
+
+    /** Move retired slots that no snapshot can reach to the free list */
+    void ReclaimRetiredSlots();
+
+    /** Remove a live fact and publish the result (WriteMutex held) */
+    void RemoveLocked(uint32 FactId);
+
+    void UpdateTermFrequency(FRETripleSnapshot::FStorage& Storage, const FRETriple& Triple, int32 Delta);
+
+    /** Serializes writers */
+    FCriticalSection WriteMutex;
+
+    /** Guards only the Current pointer */
+    mutable FRWLock SnapshotLock;
+    TSharedRef<const FRETripleSnapshot> Current;
+
+    // Writer state, guarded by WriteMutex
+
+    struct FRetiredSlots
+    {
+        /** Version of the first snapshot that no longer sees the slots */
+        uint64 RetiredIn = 0;
+        TArray<uint32> FactIds;
+    };
+
+    TBitArray<> LiveFacts;
+    TArray<uint32> FreeFactIds;
+    uint32 NumSlots = 0;
+
+    /** Slots retired by the write in progress */
+    TArray<uint32> Retiring;
+
+    /** Oldest first */
+    TArray<FRetiredSlots> RetireQueue;
+
+    /** Published snapshots that may still be held, oldest first */
+    TArray<TWeakPtr<const FRETripleSnapshot>> Published;
+};
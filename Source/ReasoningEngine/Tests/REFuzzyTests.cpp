@@ -1,6 +1,8 @@
 ﻿#include "Misc/AutomationTest.h"
 #include "Semantic/REFuzzy.h"
 #include "Semantic/Data/REStringTypes.h"
+#include "Infrastructure/RENormalizer.h"
+#include "Infrastructure/RENormalizedFormTable.h"
 
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(FREFuzzyHarnessTest,
 	"ReasoningEngine.Fuzzy.Harness",
@@ -37,3 +39,39 @@ bool FREFuzzyHarnessTest::RunTest(const FString& Parameters)
 
 	return true;
 }
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FREFuzzyPrepareTest,
+	"ReasoningEngine.Fuzzy.Prepare",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FREFuzzyPrepareTest::RunTest(const FString& Parameters)
+{
+	// Comparing normalized strings must not grow the shared form table
+	const int32 SharedBefore = RENormalizer::GetNormalizedFormTable().NumRaw();
+	const FREStringMatch Same = REFuzzy::CompareStrings(TEXT("Walk Forward"), TEXT("walk forward"), true);
+	REFuzzy::GetSimilarity(TEXT("Run_Fast"), TEXT("run fast"), EREFuzzyAlgorithm::Levenshtein, true);
+	TestEqual(TEXT("Same normalized form"), Same.NormalizedLevenshtein, 1.0f);
+	TestEqual(TEXT("Shared table untouched"), RENormalizer::GetNormalizedFormTable().NumRaw(), SharedBefore);
+
+	// Interning is opt-in, into a table the caller owns
+	FRENormalizedFormTable Forms(RENormalizer::CompilePlan(FRENormalizationConfig()));
+	const FRENormalizedHandle A = REFuzzy::PrepareHandle(TEXT("Walk Forward"), Forms);
+	const FRENormalizedHandle B = REFuzzy::PrepareHandle(TEXT("walk forward"), Forms);
+	TestTrue(TEXT("Equal forms, equal handles"), A == B);
+	TestEqual(TEXT("Handle resolves to the prepared form"), Forms.Resolve(A), REFuzzy::PrepareString(TEXT("Walk Forward"), true));
+	TestEqual(TEXT("Raw strings kept"), Forms.NumRaw(), 2);
+
+	// Handle overloads read the prepared forms instead of normalizing again
+	const FRENormalizedHandle C = REFuzzy::PrepareHandle(TEXT("Walk Backward"), Forms);
+	TestEqual(TEXT("Equal handles match fully"), REFuzzy::GetSimilarity(A, B, Forms), 1.0f);
+	TestEqual(TEXT("Handle similarity agrees with strings"),
+		REFuzzy::GetSimilarity(A, C, Forms, EREFuzzyAlgorithm::Levenshtein),
+		REFuzzy::GetSimilarity(TEXT("Walk Forward"), TEXT("Walk Backward"), EREFuzzyAlgorithm::Levenshtein, true));
+	const FREStringMatch HandleMatch = REFuzzy::CompareStrings(A, C, Forms);
+	TestEqual(TEXT("Handle comparison agrees with strings"), HandleMatch.LevenshteinDistance,
+		REFuzzy::CompareStrings(TEXT("Walk Forward"), TEXT("Walk Backward"), true).LevenshteinDistance);
+	TestEqual(TEXT("Invalid handles never match"), REFuzzy::GetSimilarity(FRENormalizedHandle(), FRENormalizedHandle(), Forms), 0.0f);
+	TestEqual(TEXT("No new raw strings"), Forms.NumRaw(), 3);
+
+	return true;
+}
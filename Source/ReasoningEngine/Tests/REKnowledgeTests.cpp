@@ -0,0 +1,1236 @@
+﻿#include "Misc/AutomationTest.h"
+#include "Algo/Sort.h"
+#include "Async/ParallelFor.h"
+#include "Symbolic/REActivationMap.h"
+#include "Symbolic/REConceptGraph.h"
+#include "Symbolic/REGraphQuery.h"
+#include "Symbolic/REHierarchyIndex.h"
+#include "Symbolic/RELandmarkOracle.h"
+#include "Symbolic/REKnowledge.h"
+#include "Symbolic/RETripleStore.h"
+#include <atomic>
+
+namespace
+{
+	FREFact MakeFact(const TCHAR* Subject, const TCHAR* Predicate, const TCHAR* Object, float Confidence = 1.0f)
+	{
+		FREFact Fact;
+		Fact.Subject = Subject;
+		Fact.Predicate = Predicate;
+		Fact.Object = Object;
+		Fact.Confidence = Confidence;
+		return Fact;
+	}
+
+	FRERelation MakeRelation(const TCHAR* From, const TCHAR* To, const TCHAR* Type, float Strength = 1.0f, bool bBidirectional = false)
+	{
+		FRERelation Relation;
+		Relation.FromConcept = From;
+		Relation.ToConcept = To;
+		Relation.RelationType = Type;
+		Relation.Strength = Strength;
+		Relation.bBidirectional = bBidirectional;
+		return Relation;
+	}
+
+	void AddRelation(UREKnowledge* Knowledge, const TCHAR* From, const TCHAR* To, const TCHAR* Type,
+		float Strength = 1.0f, bool bBidirectional = false)
+	{
+		Knowledge->AddRelation(MakeRelation(From, To, Type, Strength, bBidirectional));
+	}
+
+	/** Concepts named by their ids */
+	void AddConcepts(UREKnowledge* Knowledge, std::initializer_list<const TCHAR*> Ids)
+	{
+		for (const TCHAR* Id : Ids)
+		{
+			FREConcept Concept;
+			Concept.ConceptID = Id;
+			Concept.Name = Id;
+			Knowledge->AddConcept(Concept);
+		}
+	}
+
+	/** Nodes N0..N(NumNodes-1), so node index and name agree */
+	void AddNumberedNodes(FREConceptGraph& Graph, int32 NumNodes)
+	{
+		for (int32 Node = 0; Node < NumNodes; ++Node)
+		{
+			Graph.AddNode(*FString::Printf(TEXT("N%d"), Node));
+		}
+	}
+
+	/** Edge of a random graph, kept for the brute-force reference */
+	struct FArc
+	{
+		int32 From;
+		int32 To;
+		float Strength;
+		int32 Relation;
+	};
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FREKnowledgeTripleStoreTest,
+	"ReasoningEngine.Knowledge.TripleStore",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FREKnowledgeTripleStoreTest::RunTest(const FString& Parameters)
+{
+	FRETripleStore Store;
+	Store.Add(MakeFact(TEXT("Walk"), TEXT("is_a"), TEXT("Locomotion")), NAME_None);
+	Store.Add(MakeFact(TEXT("Run"), TEXT("is_a"), TEXT("Locomotion")), NAME_None);
+	Store.Add(MakeFact(TEXT("Run"), TEXT("faster_than"), TEXT("Walk")), NAME_None);
+	Store.Add(MakeFact(TEXT("Jump"), TEXT("is_a"), TEXT("Action")), FName(TEXT("Anim")));
+
+	TestEqual(TEXT("Four facts"), Store.Num(), 4);
+
+	auto Count = [&Store](const TCHAR* S, const TCHAR* P, const TCHAR* O)
+	{
+		int32 Matches = 0;
+		Store.Query(S, P, O, [&Matches](uint32) { ++Matches; return true; });
+		return Matches;
+	};
+
+	TestEqual(TEXT("Bound subject"), Count(TEXT("Run"), TEXT(""), TEXT("")), 2);
+	TestEqual(TEXT("Bound predicate"), Count(TEXT(""), TEXT("is_a"), TEXT("")), 3);
+	TestEqual(TEXT("Bound object"), Count(TEXT(""), TEXT(""), TEXT("Locomotion")), 2);
+	TestEqual(TEXT("Subject and object"), Count(TEXT("Run"), TEXT(""), TEXT("Walk")), 1);
+	TestEqual(TEXT("Predicate and object"), Count(TEXT(""), TEXT("is_a"), TEXT("Action")), 1);
+	TestEqual(TEXT("Fully bound"), Count(TEXT("Walk"), TEXT("is_a"), TEXT("Locomotion")), 1);
+	TestEqual(TEXT("Unbound"), Count(TEXT(""), TEXT(""), TEXT("")), 4);
+	TestEqual(TEXT("Unknown term"), Count(TEXT("Crawl"), TEXT(""), TEXT("")), 0);
+	TestEqual(TEXT("Terms are case-sensitive"), Count(TEXT("walk"), TEXT(""), TEXT("")), 0);
+
+	// Same triple in the same namespace updates instead of duplicating
+	const FREFactHandle Updated = Store.Add(MakeFact(TEXT("Walk"), TEXT("is_a"), TEXT("Locomotion"), 0.5f), NAME_None);
+	TestEqual(TEXT("Re-add keeps count"), Store.Num(), 4);
+	TestEqual(TEXT("Re-add updates fields"), Store.GetAttributes(Updated.Index).Confidence, 0.5f);
+
+	Store.Add(MakeFact(TEXT("Walk"), TEXT("is_a"), TEXT("Locomotion")), FName(TEXT("Anim")));
+	TestEqual(TEXT("Other namespace is a separate fact"), Store.Num(), 5);
+
+	TestTrue(TEXT("Remove"), Store.Remove(TEXT("Walk"), TEXT("is_a"), TEXT("Locomotion"), NAME_None));
+	TestFalse(TEXT("Remove twice"), Store.Remove(TEXT("Walk"), TEXT("is_a"), TEXT("Locomotion"), NAME_None));
+	TestTrue(TEXT("Still stored in Anim"), Store.Contains(TEXT("Walk"), TEXT("is_a"), TEXT("Locomotion")));
+
+	uint32 FasterId = FRETripleStore::InvalidId;
+	Store.Query(TEXT(""), TEXT("faster_than"), TEXT(""), [&FasterId](uint32 Id) { FasterId = Id; return false; });
+	const FREFact Roundtrip = Store.GetFact(FasterId);
+	TestEqual(TEXT("GetFact rebuilds the triple"), Roundtrip.ToString(), FString(TEXT("Run faster_than Walk")));
+
+	// Incremental inserts must leave the same indexes as a full rebuild
+	TArray<uint32> Before;
+	Store.Query(TEXT(""), TEXT("is_a"), TEXT(""), [&Before](uint32 Id) { Before.Add(Id); return true; });
+	Store.RebuildIndexes();
+	TArray<uint32> After;
+	Store.Query(TEXT(""), TEXT("is_a"), TEXT(""), [&After](uint32 Id) { After.Add(Id); return true; });
+	TestTrue(TEXT("Rebuild is stable"), After == Before);
+
+	UREKnowledge* Knowledge = NewObject<UREKnowledge>();
+	Knowledge->AddFact(MakeFact(TEXT("Idle"), TEXT("is_a"), TEXT("Pose"), 0.9f));
+	Knowledge->AddFact(MakeFact(TEXT("TPose"), TEXT("is_a"), TEXT("Pose"), 0.2f));
+	AddExpectedError(TEXT("ignoring incomplete fact"), EAutomationExpectedErrorFlags::Contains, 1);
+	Knowledge->AddFact(MakeFact(TEXT(""), TEXT("is_a"), TEXT("Pose")));
+
+	FREKnowledgeQuery Query;
+	Query.Predicate = TEXT("is_a");
+	Query.Object = TEXT("Pose");
+	Query.MinConfidence = 0.5f;
+	TestEqual(TEXT("Confidence filter"), Knowledge->QueryFacts(Query).Num(), 1);
+
+	Query.MinConfidence = 0.0f;
+	Query.MaxResults = 1;
+	TestEqual(TEXT("MaxResults"), Knowledge->QueryFacts(Query).Num(), 1);
+
+	TestTrue(TEXT("HasFact"), Knowledge->HasFact(TEXT("Idle"), TEXT("is_a"), TEXT("Pose")));
+	TestFalse(TEXT("HasFact needs all fields"), Knowledge->HasFact(TEXT("Idle"), TEXT(""), TEXT("Pose")));
+
+	int32 FactCount = 0;
+	int32 ConceptCount = 0;
+	int32 RelationCount = 0;
+	Knowledge->GetStatistics(FactCount, ConceptCount, RelationCount);
+	TestEqual(TEXT("Invalid fact rejected"), FactCount, 2);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FREKnowledgeFirstInsertTest,
+	"ReasoningEngine.Knowledge.FirstInsert",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FREKnowledgeFirstInsertTest::RunTest(const FString& Parameters)
+{
+	// The first entry of every index goes into a fresh block
+	FRETripleStore Store;
+	Store.Add(MakeFact(TEXT("Walk"), TEXT("is_a"), TEXT("Locomotion")), NAME_None);
+	TestEqual(TEXT("One fact stored"), Store.Num(), 1);
+	TestTrue(TEXT("Fact found"), Store.Contains(TEXT("Walk"), TEXT("is_a"), TEXT("Locomotion")));
+
+	// Emptied indexes accept a first entry again
+	TestTrue(TEXT("Remove only fact"), Store.Remove(TEXT("Walk"), TEXT("is_a"), TEXT("Locomotion"), NAME_None));
+	Store.Add(MakeFact(TEXT("Run"), TEXT("is_a"), TEXT("Locomotion")), NAME_None);
+	TestEqual(TEXT("Insert after emptying"), Store.Num(), 1);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FREKnowledgeFactHandlesTest,
+	"ReasoningEngine.Knowledge.FactHandles",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FREKnowledgeFactHandlesTest::RunTest(const FString& Parameters)
+{
+	FRETripleStore Store;
+
+	const FREFactHandle Walk = Store.Add(MakeFact(TEXT("Walk"), TEXT("is_a"), TEXT("Locomotion")), NAME_None);
+	const FRETripleStore::FAttributes* WalkFields = &Store.GetAttributes(Walk.Index);
+
+	// Enough facts to spill over several arena chunks and index blocks
+	constexpr int32 NumFacts = 5000;
+	TArray<FREFactHandle> Handles;
+	for (int32 Index = 0; Index < NumFacts; ++Index)
+	{
+		Handles.Add(Store.Add(MakeFact(
+			*FString::Printf(TEXT("Clip_%d"), Index),
+			Index % 2 ? TEXT("has_tag") : TEXT("is_a"),
+			*FString::Printf(TEXT("Group_%d"), Index % 7)), NAME_None));
+	}
+
+	TestTrue(TEXT("Side table does not move as the arena grows"), WalkFields == &Store.GetAttributes(Walk.Index));
+	TestTrue(TEXT("Handle is live"), Store.IsValid(Walk));
+
+	// Remove every third fact by handle
+	int32 Removed = 0;
+	for (int32 Index = 0; Index < NumFacts; Index += 3)
+	{
+		Removed += Store.Remove(Handles[Index]) ? 1 : 0;
+	}
+	TestEqual(TEXT("Removed by handle"), Removed, (NumFacts + 2) / 3);
+	TestFalse(TEXT("Removed handle is stale"), Store.IsValid(Handles[0]));
+	TestFalse(TEXT("Stale handle cannot remove twice"), Store.Remove(Handles[0]));
+
+	// The freed slot is reused under a new generation
+	const FREFactHandle Reused = Store.Add(MakeFact(TEXT("Run"), TEXT("is_a"), TEXT("Locomotion")), NAME_None);
+	TestTrue(TEXT("Reused handle is live"), Store.IsValid(Reused));
+	TestFalse(TEXT("Old handle stays stale after reuse"), Store.IsValid(Handles[NumFacts - 1 - (NumFacts - 1) % 3]));
+
+	// Incrementally maintained indexes agree with a brute-force count
+	int32 ExpectedIsA = 2;
+	int32 ExpectedGroup3 = 0;
+	for (int32 Index = 0; Index < NumFacts; ++Index)
+	{
+		if (Index % 3 != 0)
+		{
+			ExpectedIsA += Index % 2 ? 0 : 1;
+			ExpectedGroup3 += Index % 7 == 3 ? 1 : 0;
+		}
+	}
+
+	auto Count = [&Store](const TCHAR* S, const TCHAR* P, const TCHAR* O)
+	{
+		int32 Matches = 0;
+		Store.Query(S, P, O, [&Matches](uint32) { ++Matches; return true; });
+		return Matches;
+	};
+
+	TestEqual(TEXT("Fact count"), Store.Num(), NumFacts - Removed + 2);
+	TestEqual(TEXT("Predicate range"), Count(TEXT(""), TEXT("is_a"), TEXT("")), ExpectedIsA);
+	TestEqual(TEXT("Object range"), Count(TEXT(""), TEXT(""), TEXT("Group_3")), ExpectedGroup3);
+	TestEqual(TEXT("Removed fact is gone"), Count(TEXT("Clip_0"), TEXT(""), TEXT("")), 0);
+	TestEqual(TEXT("Kept fact is found"), Count(TEXT("Clip_1"), TEXT("has_tag"), TEXT("Group_1")), 1);
+
+	Store.RebuildIndexes();
+	TestEqual(TEXT("Rebuild agrees"), Count(TEXT(""), TEXT("is_a"), TEXT("")), ExpectedIsA);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FREKnowledgeBulkLoadTest,
+	"ReasoningEngine.Knowledge.BulkLoad",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FREKnowledgeBulkLoadTest::RunTest(const FString& Parameters)
+{
+	// Large enough to take the parallel sort and merge paths
+	constexpr int32 NumFacts = 60000;
+	TArray<FREFact> Facts;
+	Facts.Reserve(NumFacts + 2);
+	for (int32 Index = 0; Index < NumFacts; ++Index)
+	{
+		// Every 10th fact repeats an earlier one with a new confidence
+		const int32 Id = Index % 10 == 9 ? Index - 9 : Index;
+		Facts.Add(MakeFact(
+			*FString::Printf(TEXT("Clip_%d"), Id),
+			Id % 3 ? TEXT("has_tag") : TEXT("is_a"),
+			*FString::Printf(TEXT("Group_%d"), Id % 11),
+			Index % 10 == 9 ? 0.25f : 1.0f));
+	}
+	Facts.Add(MakeFact(TEXT(""), TEXT("is_a"), TEXT("Group_0")));
+
+	FRETripleStore Bulk;
+	FRETripleStore Incremental;
+	Bulk.Add(MakeFact(TEXT("Clip_0"), TEXT("is_a"), TEXT("Group_0")), NAME_None);
+	Incremental.Add(MakeFact(TEXT("Clip_0"), TEXT("is_a"), TEXT("Group_0")), NAME_None);
+
+	const int32 NumAdded = Bulk.AddBulk(Facts, NAME_None);
+	for (const FREFact& Fact : Facts)
+	{
+		if (Fact.IsValid())
+		{
+			Incremental.Add(Fact, NAME_None);
+		}
+	}
+
+	const int32 Distinct = NumFacts - NumFacts / 10;
+	TestEqual(TEXT("Duplicates and existing facts are not re-added"), NumAdded, Distinct - 1);
+	TestEqual(TEXT("Same count as incremental adds"), Bulk.Num(), Incremental.Num());
+
+	auto Collect = [](const FRETripleStore& Store, const TCHAR* S, const TCHAR* P, const TCHAR* O)
+	{
+		TArray<FString> Found;
+		Store.Query(S, P, O, [&Store, &Found](uint32 FactId)
+		{
+			const FREFact Fact = Store.GetFact(FactId);
+			Found.Add(FString::Printf(TEXT("%s|%.2f"), *Fact.ToString(), Fact.Confidence));
+			return true;
+		});
+		Found.Sort();
+		return Found;
+	};
+
+	TestTrue(TEXT("Predicate range matches"), Collect(Bulk, TEXT(""), TEXT("is_a"), TEXT("")) == Collect(Incremental, TEXT(""), TEXT("is_a"), TEXT("")));
+	TestTrue(TEXT("Object range matches"), Collect(Bulk, TEXT(""), TEXT(""), TEXT("Group_5")) == Collect(Incremental, TEXT(""), TEXT(""), TEXT("Group_5")));
+	TestTrue(TEXT("Last duplicate wins"), Collect(Bulk, TEXT("Clip_0"), TEXT(""), TEXT("")) == TArray<FString>{ TEXT("Clip_0 is_a Group_0|0.25") });
+
+	// A small batch into a large store takes the incremental path
+	TArray<FREFact> Small = { MakeFact(TEXT("Walk"), TEXT("is_a"), TEXT("Group_0")), MakeFact(TEXT("Run"), TEXT("is_a"), TEXT("Group_0")) };
+	TestEqual(TEXT("Small batch"), Bulk.AddBulk(Small, FName(TEXT("Anim"))), 2);
+	TestEqual(TEXT("Small batch is queryable"), Collect(Bulk, TEXT(""), TEXT("is_a"), TEXT("Group_0")).Num(),
+		Collect(Incremental, TEXT(""), TEXT("is_a"), TEXT("Group_0")).Num() + 2);
+
+	UREKnowledge* Knowledge = NewObject<UREKnowledge>();
+	TestEqual(TEXT("Knowledge bulk load"), Knowledge->AddFactsBulk(Facts), Distinct);
+	TestTrue(TEXT("Bulk facts are visible"), Knowledge->HasFact(TEXT("Clip_42"), TEXT("is_a"), TEXT("Group_9")));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FREKnowledgeGraphPatternTest,
+	"ReasoningEngine.Knowledge.GraphPattern",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FREKnowledgeGraphPatternTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumClips = 300;
+	TArray<FREFact> Facts;
+	for (int32 Index = 0; Index < NumClips; ++Index)
+	{
+		const FString Clip = FString::Printf(TEXT("Clip_%d"), Index);
+		Facts.Add(MakeFact(*Clip, TEXT("is_a"), Index % 3 == 0 ? TEXT("Locomotion") : TEXT("Idle")));
+		Facts.Add(MakeFact(*Clip, TEXT("has_tag"), Index % 5 == 0 ? TEXT("Loop") : TEXT("OneShot")));
+		Facts.Add(MakeFact(*Clip, TEXT("uses"), *FString::Printf(TEXT("Skel_%d"), Index % 4)));
+	}
+	Facts.Add(MakeFact(TEXT("Skel_0"), TEXT("rig_of"), TEXT("Mannequin")));
+	Facts.Add(MakeFact(TEXT("Skel_1"), TEXT("rig_of"), TEXT("Mannequin")));
+	Facts.Add(MakeFact(TEXT("Clip_1"), TEXT("similar_to"), TEXT("Clip_1")));
+	Facts.Add(MakeFact(TEXT("Clip_2"), TEXT("similar_to"), TEXT("Clip_3")));
+
+	FRETripleStore Store;
+	Store.AddBulk(Facts, NAME_None);
+
+	FREGraphPatternQuery Query;
+	Query.Patterns.Add(FRETriplePattern(TEXT("?clip"), TEXT("uses"), TEXT("?skel")));
+	Query.Patterns.Add(FRETriplePattern(TEXT("?skel"), TEXT("rig_of"), TEXT("Mannequin")));
+	Query.Patterns.Add(FRETriplePattern(TEXT("?clip"), TEXT("is_a"), TEXT("Locomotion")));
+	Query.Patterns.Add(FRETriplePattern(TEXT("?clip"), TEXT("has_tag"), TEXT("Loop")));
+	Query.MaxResults = 0;
+
+	TSet<FString> Expected;
+	for (int32 Index = 0; Index < NumClips; ++Index)
+	{
+		if (Index % 15 == 0 && Index % 4 < 2)
+		{
+			Expected.Add(FString::Printf(TEXT("Clip_%d/Skel_%d"), Index, Index % 4));
+		}
+	}
+
+	const TArray<FREGraphPatternResult> Results = REGraphQuery::Execute(Store, Query);
+	TSet<FString> Found;
+	for (const FREGraphPatternResult& Result : Results)
+	{
+		Found.Add(Result.Bindings.FindRef(TEXT("clip")) + TEXT("/") + Result.Bindings.FindRef(TEXT("skel")));
+	}
+	TestEqual(TEXT("Solution count"), Results.Num(), Expected.Num());
+	TestTrue(TEXT("Solutions match brute force"), Found.Num() == Expected.Num() && Found.Includes(Expected));
+
+	// Two matching facts: the rig pattern is the cheapest start, and the
+	// wide 'uses' scan follows only once ?skel is bound
+	const TArray<int32> Plan = REGraphQuery::PlanJoinOrder(Store, Query);
+	if (TestEqual(TEXT("Plan covers all patterns"), Plan.Num(), 4))
+	{
+		TestEqual(TEXT("Most selective pattern first"), Plan[0], 1);
+		TestEqual(TEXT("Connected pattern next"), Plan[1], 0);
+	}
+
+	// Without the rig pattern, the two-constant patterns on ?clip are merge-joined up front
+	FREGraphPatternQuery Star;
+	Star.Patterns.Add(Query.Patterns[0]);
+	Star.Patterns.Add(Query.Patterns[2]);
+	Star.Patterns.Add(Query.Patterns[3]);
+	Star.MaxResults = 0;
+	const TArray<int32> StarPlan = REGraphQuery::PlanJoinOrder(Store, Star);
+	TestTrue(TEXT("Star plan"), StarPlan == TArray<int32>{ 2, 1, 0 });
+	TestEqual(TEXT("Star solutions"), REGraphQuery::Execute(Store, Star).Num(), NumClips / 15);
+
+	// The same triples in a second namespace: the merge join (Star) and the
+	// nested loop (Query, which starts from the rig pattern) must both emit
+	// one row per combination of facts
+	Store.Add(MakeFact(TEXT("Clip_0"), TEXT("is_a"), TEXT("Locomotion"), 0.5f), FName(TEXT("Mirror")));
+	Store.Add(MakeFact(TEXT("Clip_0"), TEXT("has_tag"), TEXT("Loop"), 0.25f), FName(TEXT("Mirror")));
+	Query.MaxResults = 0;
+
+	auto CountRows = [](const TArray<FREGraphPatternResult>& Rows, bool bRiggedOnly)
+	{
+		TMap<FString, int32> Counts;
+		for (const FREGraphPatternResult& Row : Rows)
+		{
+			const FString Skel = Row.Bindings.FindRef(TEXT("skel"));
+			if (!bRiggedOnly || Skel == TEXT("Skel_0") || Skel == TEXT("Skel_1"))
+			{
+				++Counts.FindOrAdd(FString::Printf(TEXT("%s/%s/%.2f"), *Row.Bindings.FindRef(TEXT("clip")), *Skel, Row.Confidence));
+			}
+		}
+		return Counts;
+	};
+
+	const TMap<FString, int32> MergeRows = CountRows(REGraphQuery::Execute(Store, Star), true);
+	const TMap<FString, int32> LoopRows = CountRows(REGraphQuery::Execute(Store, Query), false);
+	TestEqual(TEXT("Merge join keeps one row per fact"), MergeRows.FindRef(TEXT("Clip_0/Skel_0/0.25")), 2);
+	TestEqual(TEXT("Merge join keeps the fully confident row"), MergeRows.FindRef(TEXT("Clip_0/Skel_0/1.00")), 1);
+	TestTrue(TEXT("Both joins agree"), MergeRows.OrderIndependentCompareEqual(LoopRows));
+
+	Query.MaxResults = 2;
+	TestEqual(TEXT("MaxResults pushdown"), REGraphQuery::Execute(Store, Query).Num(), 2);
+
+	FREGraphPatternQuery SelfLoop;
+	SelfLoop.Patterns.Add(FRETriplePattern(TEXT("?x"), TEXT("similar_to"), TEXT("?x")));
+	TestEqual(TEXT("Repeated variable"), REGraphQuery::Execute(Store, SelfLoop).Num(), 1);
+
+	FREGraphPatternQuery Unknown;
+	Unknown.Patterns.Add(FRETriplePattern(TEXT("?x"), TEXT("is_a"), TEXT("Swim")));
+	TestEqual(TEXT("Unknown constant"), REGraphQuery::Execute(Store, Unknown).Num(), 0);
+	TestEqual(TEXT("Unknown constant has no plan"), REGraphQuery::PlanJoinOrder(Store, Unknown).Num(), 0);
+
+	UREKnowledge* Knowledge = NewObject<UREKnowledge>();
+	Knowledge->AddFactsBulk(Facts);
+	Query.MaxResults = 0;
+	TestEqual(TEXT("Knowledge QueryPattern"), Knowledge->QueryPattern(Query).Num(), Expected.Num());
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FREKnowledgeSnapshotsTest,
+	"ReasoningEngine.Knowledge.Snapshots",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FREKnowledgeSnapshotsTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumFacts = 100;
+	FRETripleStore Store;
+	TArray<FREFactHandle> Handles;
+	for (int32 Index = 0; Index < NumFacts; ++Index)
+	{
+		Handles.Add(Store.Add(MakeFact(*FString::Printf(TEXT("Clip_%d"), Index), TEXT("is_a"),
+			*FString::Printf(TEXT("Group_%d"), Index % 5)), NAME_None));
+	}
+
+	auto CountAll = [](const FRETripleSnapshot& Snapshot)
+	{
+		int32 Count = 0;
+		Snapshot.Query(TEXT(""), TEXT(""), TEXT(""), [&Count](uint32) { ++Count; return true; });
+		return Count;
+	};
+
+	auto FindConfidence = [](const FRETripleSnapshot& Snapshot, const TCHAR* Subject)
+	{
+		float Confidence = -1.0f;
+		Snapshot.Query(Subject, TEXT("is_a"), TEXT(""), [&Snapshot, &Confidence](uint32 FactId)
+		{
+			Confidence = Snapshot.GetAttributes(FactId).Confidence;
+			return false;
+		});
+		return Confidence;
+	};
+
+	TSharedPtr<const FRETripleSnapshot> Before = Store.GetSnapshot();
+	uint32 RemovedId = FRETripleStore::InvalidId;
+	Before->Query(TEXT("Clip_1"), TEXT(""), TEXT(""), [&RemovedId](uint32 FactId) { RemovedId = FactId; return false; });
+
+	// Update, remove and add while the snapshot is held
+	const FREFactHandle Updated = Store.Add(MakeFact(TEXT("Clip_0"), TEXT("is_a"), TEXT("Group_0"), 0.5f), NAME_None);
+	TestTrue(TEXT("Remove"), Store.Remove(TEXT("Clip_1"), TEXT("is_a"), TEXT("Group_1"), NAME_None));
+	for (int32 Index = NumFacts; Index < NumFacts + 50; ++Index)
+	{
+		Store.Add(MakeFact(*FString::Printf(TEXT("Clip_%d"), Index), TEXT("is_a"), TEXT("Group_0")), NAME_None);
+	}
+
+	TestEqual(TEXT("Held snapshot keeps its count"), Before->Num(), NumFacts);
+	TestEqual(TEXT("Held snapshot keeps its facts"), CountAll(*Before), NumFacts);
+	TestEqual(TEXT("Held snapshot keeps old fields"), FindConfidence(*Before, TEXT("Clip_0")), 1.0f);
+	TestTrue(TEXT("Removed fact still readable in held snapshot"), Before->Contains(TEXT("Clip_1"), TEXT("is_a"), TEXT("Group_1")));
+	TestEqual(TEXT("Removed slot is not reused while visible"), Before->GetFact(RemovedId).Subject, FString(TEXT("Clip_1")));
+
+	const TSharedRef<const FRETripleSnapshot> After = Store.GetSnapshot();
+	TestEqual(TEXT("Latest count"), After->Num(), NumFacts + 49);
+	TestEqual(TEXT("Latest facts"), CountAll(*After), NumFacts + 49);
+	TestEqual(TEXT("Latest fields"), FindConfidence(*After, TEXT("Clip_0")), 0.5f);
+	TestTrue(TEXT("Versions advance"), After->GetVersion() > Before->GetVersion());
+	TestFalse(TEXT("Update makes the old handle stale"), Store.IsValid(Handles[0]));
+	TestTrue(TEXT("Updated handle is live"), Store.IsValid(Updated));
+
+	Before.Reset();
+	Store.Add(MakeFact(TEXT("Clip_1"), TEXT("is_a"), TEXT("Group_1")), NAME_None);
+	TestEqual(TEXT("Writes continue after release"), Store.Num(), NumFacts + 50);
+
+	// One writer streams facts while readers check that every snapshot
+	// they take agrees with itself and never goes backwards
+	constexpr int32 NumStreamed = 2000;
+	constexpr int32 NumReaders = 4;
+	constexpr int32 ReadsPerReader = 200;
+	std::atomic<int32> Inconsistent{ 0 };
+
+	ParallelFor(NumReaders + 1, [&](int32 Task)
+	{
+		if (Task == 0)
+		{
+			for (int32 Index = 0; Index < NumStreamed; ++Index)
+			{
+				Store.Add(MakeFact(*FString::Printf(TEXT("Stream_%d"), Index), TEXT("streams"), TEXT("Live")), NAME_None);
+			}
+			return;
+		}
+
+		uint64 LastVersion = 0;
+		for (int32 Read = 0; Read < ReadsPerReader; ++Read)
+		{
+			const TSharedRef<const FRETripleSnapshot> Snapshot = Store.GetSnapshot();
+			int32 Streamed = 0;
+			Snapshot->Query(TEXT(""), TEXT("streams"), TEXT("Live"), [&Streamed](uint32) { ++Streamed; return true; });
+
+			if (Snapshot->GetVersion() < LastVersion || CountAll(*Snapshot) != Snapshot->Num()
+				|| Streamed != Snapshot->Num() - (NumFacts + 50))
+			{
+				Inconsistent.fetch_add(1);
+			}
+			LastVersion = Snapshot->GetVersion();
+		}
+	});
+
+	TestEqual(TEXT("Readers saw consistent snapshots"), Inconsistent.load(), 0);
+	TestEqual(TEXT("Writer finished"), Store.Num(), NumFacts + 50 + NumStreamed);
+
+	// Enough appends after a bulk build to split blocks and segments,
+	// then remove them again while an older snapshot is held
+	constexpr int32 NumPooled = 20000;
+	constexpr int32 NumHot = 6000;
+	FRETripleStore Segmented;
+	TArray<FREFact> Pooled;
+	Pooled.Reserve(NumPooled);
+	for (int32 Index = 0; Index < NumPooled; ++Index)
+	{
+		Pooled.Add(MakeFact(*FString::Printf(TEXT("Pooled_%d"), Index), TEXT("in"), TEXT("Pool")));
+	}
+	Segmented.AddBulk(Pooled, NAME_None);
+	const TSharedRef<const FRETripleSnapshot> Built = Segmented.GetSnapshot();
+
+	for (int32 Index = 0; Index < NumHot; ++Index)
+	{
+		Segmented.Add(MakeFact(*FString::Printf(TEXT("Hot_%d"), Index), TEXT("hot"), TEXT("Pool")), NAME_None);
+	}
+	const TSharedRef<const FRETripleSnapshot> Grown = Segmented.GetSnapshot();
+	TestEqual(TEXT("Grown index holds every fact"), CountAll(*Grown), NumPooled + NumHot);
+	int32 NumGrownHot = 0;
+	Grown->Query(TEXT(""), TEXT("hot"), TEXT(""), [&NumGrownHot](uint32) { ++NumGrownHot; return true; });
+	TestEqual(TEXT("Grown index finds appended facts"), NumGrownHot, NumHot);
+	TestTrue(TEXT("Grown index finds an appended fact"), Grown->Contains(TEXT("Hot_4321"), TEXT("hot"), TEXT("Pool")));
+
+	for (int32 Index = 0; Index < NumHot; ++Index)
+	{
+		Segmented.Remove(*FString::Printf(TEXT("Hot_%d"), Index), TEXT("hot"), TEXT("Pool"), NAME_None);
+	}
+	TestEqual(TEXT("Removing empties the appended blocks"), CountAll(*Segmented.GetSnapshot()), NumPooled);
+	TestEqual(TEXT("Built snapshot is untouched"), CountAll(*Built), NumPooled);
+	TestEqual(TEXT("Grown snapshot is untouched"), CountAll(*Grown), NumPooled + NumHot);
+	TestTrue(TEXT("Grown snapshot keeps a removed fact"), Grown->Contains(TEXT("Hot_0"), TEXT("hot"), TEXT("Pool")));
+
+	UREKnowledge* Knowledge = NewObject<UREKnowledge>();
+	Knowledge->AddFact(MakeFact(TEXT("Walk"), TEXT("is_a"), TEXT("Locomotion")));
+	const TSharedRef<const FRETripleSnapshot> KnowledgeSnapshot = Knowledge->GetFactSnapshot();
+	Knowledge->AddFact(MakeFact(TEXT("Run"), TEXT("is_a"), TEXT("Locomotion")));
+	TestEqual(TEXT("Knowledge snapshot is stable"), KnowledgeSnapshot->Num(), 1);
+	TestEqual(TEXT("Knowledge sees the write"), Knowledge->GetFactSnapshot()->Num(), 2);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FREKnowledgeConceptGraphTest,
+	"ReasoningEngine.Knowledge.ConceptGraph",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FREKnowledgeConceptGraphTest::RunTest(const FString& Parameters)
+{
+	// Enough edits to cross the compaction thresholds several times
+	constexpr int32 NumNodes = 200;
+	constexpr int32 NumEdges = 6000;
+	FREConceptGraph Graph;
+	for (int32 Node = 0; Node < NumNodes; ++Node)
+	{
+		Graph.AddNode(FName(*FString::Printf(TEXT("Concept_%d"), Node)));
+	}
+	const int32 IsA = Graph.AddType(TEXT("is_a"));
+	const int32 PartOf = Graph.AddType(TEXT("part_of"));
+	TestEqual(TEXT("Types match case-insensitively"), Graph.FindType(TEXT("IS_A")), IsA);
+	TestEqual(TEXT("Unknown type"), Graph.FindType(TEXT("uses")), FREConceptGraph::InvalidType);
+
+	FRandomStream Random(1234);
+	TArray<FIntVector> Expected;
+	for (int32 Relation = 0; Relation < NumEdges; ++Relation)
+	{
+		const FIntVector Edge(Random.RandHelper(NumNodes), Random.RandHelper(NumNodes), Relation % 3 ? IsA : PartOf);
+		Graph.AddEdge(Edge.X, Edge.Y, Edge.Z, 1.0f, Relation);
+		Expected.Add(Edge);
+	}
+	for (int32 Relation = 0; Relation < NumEdges; Relation += 4)
+	{
+		TestTrue(TEXT("Remove edge"), Graph.RemoveEdge(Expected[Relation].X, Expected[Relation].Y, Expected[Relation].Z, Relation));
+	}
+	TestFalse(TEXT("Remove twice"), Graph.RemoveEdge(Expected[0].X, Expected[0].Y, Expected[0].Z, 0));
+	TestTrue(TEXT("Remap edge"), Graph.RemapEdge(Expected[1].X, Expected[1].Y, Expected[1].Z, 1, NumEdges));
+	TestEqual(TEXT("Edge count"), Graph.NumEdges(), NumEdges - NumEdges / 4);
+
+	// Rows, typed sub-ranges and incoming lists agree with the edge list
+	int32 Mismatches = 0;
+	for (int32 Node = 0; Node < NumNodes; ++Node)
+	{
+		TArray<int32> Out;
+		TArray<int32> OutIsA;
+		TArray<int32> In;
+		TArray<int32> ExpectedOut;
+		TArray<int32> ExpectedOutIsA;
+		TArray<int32> ExpectedIn;
+		Graph.ForEachOutEdge(Node, FREConceptGraph::AnyType, [&Out](const FREConceptGraph::FEdge& Edge) { Out.Add(Edge.Relation); return true; });
+		Graph.ForEachOutEdge(Node, IsA, [&OutIsA](const FREConceptGraph::FEdge& Edge) { OutIsA.Add(Edge.Relation); return true; });
+		Graph.ForEachInEdge(Node, FREConceptGraph::AnyType, [&In](const FREConceptGraph::FEdge& Edge) { In.Add(Edge.Relation); return true; });
+
+		for (int32 Relation = 0; Relation < NumEdges; ++Relation)
+		{
+			const int32 Id = Relation == 1 ? NumEdges : Relation;
+			if (Relation % 4 == 0)
+			{
+				continue;
+			}
+			if (Expected[Relation].X == Node)
+			{
+				ExpectedOut.Add(Id);
+				if (Expected[Relation].Z == IsA)
+				{
+					ExpectedOutIsA.Add(Id);
+				}
+			}
+			if (Expected[Relation].Y == Node)
+			{
+				ExpectedIn.Add(Id);
+			}
+		}
+
+		Out.Sort();
+		OutIsA.Sort();
+		In.Sort();
+		ExpectedOut.Sort();
+		ExpectedOutIsA.Sort();
+		ExpectedIn.Sort();
+		Mismatches += (Out != ExpectedOut) + (OutIsA != ExpectedOutIsA) + (In != ExpectedIn);
+	}
+	TestEqual(TEXT("Adjacency matches the edge list"), Mismatches, 0);
+
+	// Breadth-first levels along a typed chain
+	FREConceptGraph Chain;
+	const int32 Next = Chain.AddType(TEXT("next"));
+	const int32 Skip = Chain.AddType(TEXT("skip"));
+	for (int32 Node = 0; Node < 6; ++Node)
+	{
+		Chain.AddNode(FName(*FString::Printf(TEXT("Step_%d"), Node)));
+	}
+	for (int32 Node = 0; Node < 5; ++Node)
+	{
+		Chain.AddEdge(Node, Node + 1, Next, 1.0f, Node);
+	}
+	Chain.AddEdge(0, 5, Skip, 1.0f, 5);
+
+	TArray<int32> Depths;
+	Depths.Init(INDEX_NONE, 6);
+	Chain.BreadthFirst(0, 3, Next, [&Depths](int32 Node, int32 Depth, int32) { Depths[Node] = Depth; return true; });
+	TestTrue(TEXT("Typed BFS stops at MaxDepth"), Depths == TArray<int32>{ 0, 1, 2, 3, INDEX_NONE, INDEX_NONE });
+	Chain.BreadthFirst(0, 3, FREConceptGraph::AnyType, [&Depths](int32 Node, int32 Depth, int32) { Depths[Node] = Depth; return true; });
+	TestEqual(TEXT("Untyped BFS takes the shortcut"), Depths[5], 1);
+
+	// Knowledge base relations go through the graph
+	UREKnowledge* Knowledge = NewObject<UREKnowledge>();
+	AddConcepts(Knowledge, { TEXT("Walk"), TEXT("Locomotion"), TEXT("Movement"), TEXT("Legs"), TEXT("Stroll") });
+	AddRelation(Knowledge, TEXT("Walk"), TEXT("Locomotion"), TEXT("is_a"));
+	AddRelation(Knowledge, TEXT("Locomotion"), TEXT("Movement"), TEXT("is_a"));
+	AddRelation(Knowledge, TEXT("Movement"), TEXT("Legs"), TEXT("uses"));
+	AddRelation(Knowledge, TEXT("Stroll"), TEXT("Walk"), TEXT("similar_to"), 0.8f, true);
+	AddRelation(Knowledge, TEXT("Walk"), TEXT("Locomotion"), TEXT("is_a"), 0.5f);
+
+	int32 NumFacts = 0;
+	int32 NumConcepts = 0;
+	int32 NumRelations = 0;
+	Knowledge->GetStatistics(NumFacts, NumConcepts, NumRelations);
+	TestEqual(TEXT("Re-added relation is updated, not duplicated"), NumRelations, 4);
+
+	const TArray<FRERelation> FromWalk = Knowledge->GetRelationsFrom(TEXT("Walk"), TEXT("is_a"));
+	if (TestEqual(TEXT("Typed relations from"), FromWalk.Num(), 1))
+	{
+		TestEqual(TEXT("Updated strength"), FromWalk[0].Strength, 0.5f);
+	}
+	TestEqual(TEXT("Bidirectional relation listed from both ends"), Knowledge->GetRelationsFrom(TEXT("Walk"), TEXT("similar_to")).Num(), 1);
+	TestEqual(TEXT("Relations to"), Knowledge->GetRelationsTo(TEXT("Walk")).Num(), 1);
+
+	TestEqual(TEXT("Related within two hops"), Knowledge->FindRelatedConcepts(TEXT("Walk"), 2).Num(), 3);
+	TestEqual(TEXT("Related by type"), Knowledge->FindRelatedConcepts(TEXT("Walk"), 3, TEXT("is_a")).Num(), 2);
+	TestEqual(TEXT("Unknown type relates nothing"), Knowledge->FindRelatedConcepts(TEXT("Walk"), 3, TEXT("owns")).Num(), 0);
+
+	TestTrue(TEXT("Remove concept"), Knowledge->RemoveConcept(TEXT("Movement")));
+	Knowledge->GetStatistics(NumFacts, NumConcepts, NumRelations);
+	TestEqual(TEXT("Concept relations removed"), NumRelations, 2);
+	TestEqual(TEXT("Remove relation"), Knowledge->RemoveRelation(TEXT("Walk"), TEXT("Locomotion")), 1);
+	TestEqual(TEXT("Remaining relation survives the swap"), Knowledge->GetRelationsFrom(TEXT("Stroll")).Num(), 1);
+	TestEqual(TEXT("Removed relation is gone"), Knowledge->FindRelatedConcepts(TEXT("Walk"), 3, TEXT("is_a")).Num(), 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FREKnowledgePathSearchTest,
+	"ReasoningEngine.Knowledge.PathSearch",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FREKnowledgePathSearchTest::RunTest(const FString& Parameters)
+{
+	// Random graph: bidirectional BFS must agree with plain BFS, weighted search with Bellman-Ford
+	constexpr int32 NumNodes = 200;
+	FRandomStream Random(47);
+	FREConceptGraph Graph;
+	AddNumberedNodes(Graph, NumNodes);
+	const int32 Link = Graph.AddType(TEXT("link"));
+	const int32 Skip = Graph.AddType(TEXT("skip"));
+
+	TArray<FArc> Arcs;
+	for (int32 Index = 0; Index < NumNodes * 3; ++Index)
+	{
+		const FArc Arc{ Random.RandHelper(NumNodes), Random.RandHelper(NumNodes), Random.FRandRange(-0.2f, 1.2f), Index };
+		Graph.AddEdge(Arc.From, Arc.To, Random.RandHelper(4) == 0 ? Skip : Link, Arc.Strength, Arc.Relation);
+		Arcs.Add(Arc);
+	}
+
+	bool bHopsMatch = true;
+	bool bPathsValid = true;
+	bool bCostsMatch = true;
+	for (int32 Query = 0; Query < 40; ++Query)
+	{
+		const int32 From = Random.RandHelper(NumNodes);
+		const int32 To = Random.RandHelper(NumNodes);
+		const int32 MaxDepth = 1 + Random.RandHelper(6);
+
+		int32 ExpectedHops = INDEX_NONE;
+		Graph.BreadthFirst(From, MaxDepth, FREConceptGraph::AnyType, [&](int32 Node, int32 Depth, int32)
+		{
+			if (Node == To)
+			{
+				ExpectedHops = Depth;
+				return false;
+			}
+			return true;
+		});
+
+		TArray<int32> Path;
+		const bool bFound = Graph.FindShortestPath(From, To, MaxDepth, FREConceptGraph::AnyType, Path);
+		bHopsMatch &= bFound == (ExpectedHops != INDEX_NONE) && (!bFound || Path.Num() == ExpectedHops + 1);
+		for (int32 Index = 1; Index < Path.Num(); ++Index)
+		{
+			bool bEdge = false;
+			Graph.ForEachOutEdge(Path[Index - 1], FREConceptGraph::AnyType, [&](const FREConceptGraph::FEdge& Edge)
+			{
+				bEdge |= Edge.Node == Path[Index];
+				return !bEdge;
+			});
+			bPathsValid &= bEdge;
+		}
+
+		TArray<float> Costs;
+		Costs.Init(TNumericLimits<float>::Max(), NumNodes);
+		Costs[From] = 0.0f;
+		for (int32 Round = 0; Round < NumNodes; ++Round)
+		{
+			for (const FArc& Arc : Arcs)
+			{
+				if (Arc.Strength > 0.0f && Costs[Arc.From] != TNumericLimits<float>::Max())
+				{
+					Costs[Arc.To] = FMath::Min(Costs[Arc.To], Costs[Arc.From] + FREConceptGraph::EdgeCost(Arc.Strength));
+				}
+			}
+		}
+
+		float Cost = 0.0f;
+		const float MaxCost = 8.0f;
+		const bool bReached = Graph.FindWeightedPath(From, To, FREConceptGraph::AnyType, MaxCost, Path, Cost);
+		const bool bExpected = Costs[To] <= MaxCost;
+		bCostsMatch &= bReached == bExpected && (!bReached || FMath::IsNearlyEqual(Cost, Costs[To], 1e-3f));
+	}
+	TestTrue(TEXT("Bidirectional BFS finds the fewest hops within MaxDepth"), bHopsMatch);
+	TestTrue(TEXT("Returned paths follow edges"), bPathsValid);
+	TestTrue(TEXT("Weighted search finds the cheapest path within MaxCost"), bCostsMatch);
+
+	TArray<int32> Path;
+	TestFalse(TEXT("Type filter limits the search"),
+		Graph.FindShortestPath(0, 1, 10, FREConceptGraph::InvalidType, Path));
+
+	// A* with a hop lower bound agrees with Dijkstra
+	TArray<int32> HopsToGoal;
+	HopsToGoal.Init(MAX_int32, NumNodes);
+	const int32 Goal = Arcs[0].To;
+	{
+		TArray<int32> Queue{ Goal };
+		HopsToGoal[Goal] = 0;
+		for (int32 Head = 0; Head < Queue.Num(); ++Head)
+		{
+			Graph.ForEachInEdge(Queue[Head], FREConceptGraph::AnyType, [&](const FREConceptGraph::FEdge& Edge)
+			{
+				if (HopsToGoal[Edge.Node] == MAX_int32)
+				{
+					HopsToGoal[Edge.Node] = HopsToGoal[Queue[Head]] + 1;
+					Queue.Add(Edge.Node);
+				}
+				return true;
+			});
+		}
+	}
+	bool bAStarMatches = true;
+	for (int32 From = 0; From < NumNodes; From += 7)
+	{
+		float Dijkstra = 0.0f;
+		float AStar = 0.0f;
+		const bool bDijkstra = Graph.FindWeightedPath(From, Goal, FREConceptGraph::AnyType, 20.0f, Path, Dijkstra);
+		const bool bAStar = Graph.FindWeightedPath(From, Goal, FREConceptGraph::AnyType, 20.0f,
+			[&HopsToGoal](int32 Node) { return HopsToGoal[Node] == MAX_int32 ? 0.0f : float(HopsToGoal[Node]); }, Path, AStar);
+		bAStarMatches &= bDijkstra == bAStar && (!bAStar || FMath::IsNearlyEqual(Dijkstra, AStar, 1e-3f));
+	}
+	TestTrue(TEXT("A* with hop bound matches Dijkstra"), bAStarMatches);
+
+	// Knowledge base: strong long path beats weak short one
+	UREKnowledge* Knowledge = NewObject<UREKnowledge>();
+	AddConcepts(Knowledge, { TEXT("A"), TEXT("B"), TEXT("C"), TEXT("D"), TEXT("E") });
+	AddRelation(Knowledge, TEXT("A"), TEXT("B"), TEXT("related_to"), 0.2f);
+	AddRelation(Knowledge, TEXT("B"), TEXT("D"), TEXT("related_to"), 0.2f);
+	AddRelation(Knowledge, TEXT("A"), TEXT("C"), TEXT("related_to"));
+	AddRelation(Knowledge, TEXT("C"), TEXT("E"), TEXT("related_to"));
+	AddRelation(Knowledge, TEXT("E"), TEXT("D"), TEXT("related_to"));
+
+	TestTrue(TEXT("Fewest hops"), Knowledge->FindConceptPath(TEXT("A"), TEXT("D")) == TArray<FName>{ TEXT("A"), TEXT("B"), TEXT("D") });
+	TestEqual(TEXT("Path beyond MaxDepth"), Knowledge->FindConceptPath(TEXT("A"), TEXT("D"), 1).Num(), 0);
+	TestEqual(TEXT("Path to itself"), Knowledge->FindConceptPath(TEXT("A"), TEXT("A")).Num(), 1);
+	TestEqual(TEXT("Unknown concept"), Knowledge->FindConceptPath(TEXT("A"), TEXT("Z")).Num(), 0);
+
+	float Cost = 0.0f;
+	TestTrue(TEXT("Strongest path"), Knowledge->FindWeightedConceptPath(TEXT("A"), TEXT("D"), Cost)
+		== TArray<FName>{ TEXT("A"), TEXT("C"), TEXT("E"), TEXT("D") });
+	TestEqual(TEXT("Strongest path cost"), Cost, 3.0f);
+	TestEqual(TEXT("Path beyond MaxCost"), Knowledge->FindWeightedConceptPath(TEXT("A"), TEXT("D"), Cost, 2.5f).Num(), 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FREKnowledgeSpreadingActivationTest,
+	"ReasoningEngine.Knowledge.SpreadingActivation",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FREKnowledgeSpreadingActivationTest::RunTest(const FString& Parameters)
+{
+	// Random graph with a hub, so spreads take both the push and the pull path
+	constexpr int32 NumNodes = 4000;
+	FRandomStream Random(48);
+	FREConceptGraph Graph;
+	AddNumberedNodes(Graph, NumNodes);
+	const int32 Link = Graph.AddType(TEXT("link"));
+
+	TArray<FArc> Arcs;
+	for (int32 Index = 0; Index < NumNodes * 4; ++Index)
+	{
+		Arcs.Add(FArc{ Random.RandHelper(NumNodes), Random.RandHelper(NumNodes), Random.FRandRange(0.0f, 1.0f), Arcs.Num() });
+	}
+	for (int32 Index = 0; Index < NumNodes / 2; ++Index)
+	{
+		Arcs.Add(FArc{ 0, Random.RandHelper(NumNodes), 0.9f, Arcs.Num() });
+	}
+	for (const FArc& Arc : Arcs)
+	{
+		Graph.AddEdge(Arc.From, Arc.To, Link, Arc.Strength, Arc.Relation);
+	}
+
+	// Reference: hop-by-hop maps, strongest arrival per hop, capped sum per node
+	constexpr float DecayRate = 0.3f;
+	TArray<float> Expected;
+	Expected.Init(0.0f, NumNodes);
+	auto SpreadReference = [&](int32 Start, float Strength, int32 MaxHops)
+	{
+		TMap<int32, float> Frontier{ { Start, Strength } };
+		for (int32 Hop = 0; Hop <= MaxHops && Frontier.Num() > 0; ++Hop)
+		{
+			TMap<int32, float> Next;
+			for (const TPair<int32, float>& Active : Frontier)
+			{
+				Expected[Active.Key] = FMath::Min(1.0f, Expected[Active.Key] + Active.Value);
+				if (Hop == MaxHops)
+				{
+					continue;
+				}
+				for (const FArc& Arc : Arcs)
+				{
+					const float Passed = Active.Value * Arc.Strength * (1.0f - DecayRate);
+					if (Arc.From == Active.Key && Passed >= FREActivationMap::Threshold)
+					{
+						float& Incoming = Next.FindOrAdd(Arc.To, 0.0f);
+						Incoming = FMath::Max(Incoming, Passed);
+					}
+				}
+			}
+			Frontier = MoveTemp(Next);
+		}
+	};
+
+	FREActivationMap Activation;
+	Activation.SetDecayRate(DecayRate);
+	int32 NumChanges = 0;
+	const int32 Starts[] = { 17, 0, 17, 2500 };
+	for (int32 Start : Starts)
+	{
+		Activation.Spread(Graph, Start, 0.8f, 3, [&NumChanges](int32, float) { ++NumChanges; });
+		SpreadReference(Start, 0.8f, 3);
+	}
+
+	bool bMatches = true;
+	int32 NumExpectedActive = 0;
+	for (int32 Node = 0; Node < NumNodes; ++Node)
+	{
+		bMatches &= FMath::IsNearlyEqual(Activation.Get(Node), Expected[Node], 1e-5f);
+		NumExpectedActive += Expected[Node] > 0.0f ? 1 : 0;
+	}
+	TestTrue(TEXT("Parallel push/pull spread matches the reference"), bMatches);
+	TestEqual(TEXT("Active list holds exactly the activated nodes"), Activation.NumActive(), NumExpectedActive);
+	TestTrue(TEXT("Changes are reported"), NumChanges >= NumExpectedActive);
+
+	TArray<int32> Top;
+	Activation.GetMostActive(25, [](int32 Node) { return Node % 2 == 0; }, Top);
+	TArray<int32> Sorted;
+	for (int32 Node = 0; Node < NumNodes; Node += 2)
+	{
+		if (Expected[Node] > 0.0f)
+		{
+			Sorted.Add(Node);
+		}
+	}
+	Algo::Sort(Sorted, [&Activation](int32 A, int32 B)
+	{
+		return Activation.Get(A) != Activation.Get(B) ? Activation.Get(A) > Activation.Get(B) : A < B;
+	});
+	Sorted.SetNum(FMath::Min(25, Sorted.Num()));
+	TestTrue(TEXT("Top-k heap matches a full sort"), Top == Sorted);
+
+	Activation.Set(Top[0], 0.0f);
+	TestEqual(TEXT("Cleared node leaves the active list"), Activation.NumActive(), NumExpectedActive - 1);
+
+	// Decay per hop
+	FREConceptGraph Chain;
+	Chain.AddEdge(Chain.AddNode(TEXT("A")), Chain.AddNode(TEXT("B")), Chain.AddType(TEXT("next")), 1.0f, 0);
+	FREActivationMap Decayed;
+	Decayed.SetDecayRate(0.5f);
+	Decayed.Spread(Chain, 0, 1.0f, 2, [](int32, float) {});
+	TestEqual(TEXT("Decay applied per hop"), Decayed.Get(1), 0.5f);
+	Decayed.SetDecayRate(1.0f);
+	Decayed.Spread(Chain, 0, 1.0f, 2, [](int32, float) {});
+	TestEqual(TEXT("Full decay spreads nothing"), Decayed.Get(1), 0.5f);
+
+	// Knowledge base: concepts mirror their activation; relation ends without a concept are skipped
+	UREKnowledge* Knowledge = NewObject<UREKnowledge>();
+	Knowledge->SetActivationDecayRate(0.0f);
+	AddConcepts(Knowledge, { TEXT("Danger"), TEXT("Flee"), TEXT("Run") });
+	AddRelation(Knowledge, TEXT("Danger"), TEXT("Flee"), TEXT("evokes"), 0.5f);
+	AddRelation(Knowledge, TEXT("Flee"), TEXT("Run"), TEXT("evokes"), 0.5f);
+	AddRelation(Knowledge, TEXT("Danger"), TEXT("Unknown"), TEXT("evokes"));
+
+	Knowledge->ActivateConcept(TEXT("Danger"), 1.0f, 2);
+	const TArray<FREConcept> Active = Knowledge->GetActivatedConcepts(10);
+	if (TestEqual(TEXT("Activated concepts"), Active.Num(), 3))
+	{
+		TestEqual(TEXT("Most active first"), Active[0].ConceptID, FName(TEXT("Danger")));
+		TestEqual(TEXT("Then one hop"), Active[1].ConceptID, FName(TEXT("Flee")));
+		TestEqual(TEXT("Activation carried on the concept"), Active[2].ActivationLevel, 0.25f);
+	}
+
+	FREConcept Flee;
+	Knowledge->GetConcept(TEXT("Flee"), Flee);
+	TestEqual(TEXT("Concept activation mirrored"), Flee.ActivationLevel, 0.5f);
+
+	Knowledge->RemoveConcept(TEXT("Danger"));
+	TestEqual(TEXT("Removed concept is no longer active"), Knowledge->GetActivatedConcepts(10).Num(), 2);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FREKnowledgeLandmarkOracleTest,
+	"ReasoningEngine.Knowledge.LandmarkOracle",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FREKnowledgeLandmarkOracleTest::RunTest(const FString& Parameters)
+{
+	// Two connected random components plus isolated nodes; direction is ignored by the oracle
+	constexpr int32 NumNodes = 600;
+	FRandomStream Random(49);
+	FREConceptGraph Graph;
+	AddNumberedNodes(Graph, NumNodes);
+	const int32 Link = Graph.AddType(TEXT("link"));
+
+	TArray<FArc> Arcs;
+	int32 NextRelation = 0;
+	auto RandomArc = [&Random, &NextRelation]()
+	{
+		const int32 Half = Random.RandHelper(2) * 290;
+		return FArc{ Half + Random.RandHelper(290), Half + Random.RandHelper(290), 1.0f, NextRelation++ };
+	};
+	for (int32 Node = 0; Node < 579; ++Node)
+	{
+		if (Node != 289)
+		{
+			Arcs.Add(FArc{ Node, Node + 1, 1.0f, NextRelation++ });
+		}
+	}
+	for (int32 Index = 0; Index < 600; ++Index)
+	{
+		Arcs.Add(RandomArc());
+	}
+	for (const FArc& Arc : Arcs)
+	{
+		Graph.AddEdge(Arc.From, Arc.To, Link, Arc.Strength, Arc.Relation);
+	}
+
+	auto ExactDistances = [&Arcs](int32 Source)
+	{
+		TArray<int32> Distances;
+		Distances.Init(INDEX_NONE, NumNodes);
+		TArray<int32> Queue{ Source };
+		Distances[Source] = 0;
+		for (int32 Head = 0; Head < Queue.Num(); ++Head)
+		{
+			for (const FArc& Arc : Arcs)
+			{
+				const int32 Other = Arc.From == Queue[Head] ? Arc.To : Arc.To == Queue[Head] ? Arc.From : INDEX_NONE;
+				if (Other != INDEX_NONE && Distances[Other] == INDEX_NONE)
+				{
+					Distances[Other] = Distances[Queue[Head]] + 1;
+					Queue.Add(Other);
+				}
+			}
+		}
+		return Distances;
+	};
+
+	FRELandmarkOracle Oracle;
+	Oracle.Build(Graph, 16);
+	TestEqual(TEXT("Landmark budget used"), Oracle.NumLandmarks(), 16);
+
+	bool bBounded = true;
+	bool bConnectedKnown = true;
+	for (int32 Query = 0; Query < 60; ++Query)
+	{
+		const int32 A = Random.RandHelper(NumNodes);
+		const TArray<int32> Exact = ExactDistances(A);
+		for (int32 Sample = 0; Sample < 20; ++Sample)
+		{
+			const int32 B = Random.RandHelper(NumNodes);
+			int32 Lower = 0;
+			int32 Upper = 0;
+			Oracle.GetBounds(A, B, Lower, Upper);
+			if (Exact[B] == INDEX_NONE)
+			{
+				bBounded &= Upper == FRELandmarkOracle::UnknownDistance;
+			}
+			else
+			{
+				bBounded &= Lower <= Exact[B] && Exact[B] <= Upper && Oracle.GetLowerBound(A, B) == Lower;
+				bConnectedKnown &= Upper != FRELandmarkOracle::UnknownDistance;
+			}
+		}
+	}
+	TestTrue(TEXT("Bounds enclose the exact distance"), bBounded);
+	TestTrue(TEXT("Every component has a landmark"), bConnectedKnown);
+
+	// Incremental edits keep every landmark's distances exact
+	for (int32 Edit = 0; Edit < 300; ++Edit)
+	{
+		if (Random.RandHelper(2) == 0 && Arcs.Num() > 0)
+		{
+			const FArc Arc = Arcs[Random.RandHelper(Arcs.Num())];
+			Arcs.RemoveAllSwap([&Arc](const FArc& Other) { return Other.Relation == Arc.Relation; });
+			Graph.RemoveEdge(Arc.From, Arc.To, Link, Arc.Relation);
+			Oracle.OnEdgeRemoved(Graph, Arc.From, Arc.To);
+			if (Random.RandHelper(4) == 0)
+			{
+				Oracle.Refresh(Graph);
+			}
+		}
+		else
+		{
+			const FArc Arc = Random.RandHelper(8) == 0 ? FArc{ Random.RandHelper(NumNodes), Random.RandHelper(NumNodes), 1.0f, NextRelation++ } : RandomArc();
+			Graph.AddEdge(Arc.From, Arc.To, Link, Arc.Strength, Arc.Relation);
+			Oracle.OnEdgeAdded(Graph, Arc.From, Arc.To);
+			Arcs.Add(Arc);
+		}
+	}
+	Oracle.Refresh(Graph);
+
+	bool bExact = true;
+	for (int32 Index = 0; Index < Oracle.NumLandmarks(); ++Index)
+	{
+		const int32 Landmark = Oracle.GetLandmark(Index);
+		const TArray<int32> Exact = ExactDistances(Landmark);
+		for (int32 Node = 0; Node < NumNodes; ++Node)
+		{
+			int32 Lower = 0;
+			int32 Upper = 0;
+			Oracle.GetBounds(Landmark, Node, Lower, Upper);
+			bExact &= Exact[Node] == INDEX_NONE ? Upper == FRELandmarkOracle::UnknownDistance : Lower == Exact[Node] && Upper == Exact[Node];
+		}
+	}
+	TestTrue(TEXT("Incremental updates match a fresh search"), bExact);
+
+	// Knowledge base distances come from the oracle and follow relation edits
+	UREKnowledge* Knowledge = NewObject<UREKnowledge>();
+	AddConcepts(Knowledge, { TEXT("Walk"), TEXT("Locomotion"), TEXT("Movement"), TEXT("Action") });
+	AddRelation(Knowledge, TEXT("Walk"), TEXT("Locomotion"), TEXT("is_a"));
+	AddRelation(Knowledge, TEXT("Locomotion"), TEXT("Movement"), TEXT("is_a"));
+	AddRelation(Knowledge, TEXT("Movement"), TEXT("Action"), TEXT("is_a"));
+
+	TestEqual(TEXT("Distance along the chain"), Knowledge->CalculateSemanticDistance(TEXT("Walk"), TEXT("Action")), 3.0f);
+	TestEqual(TEXT("Direction is ignored"), Knowledge->CalculateSemanticDistance(TEXT("Action"), TEXT("Walk")), 3.0f);
+	TestEqual(TEXT("Same concept"), Knowledge->CalculateSemanticDistance(TEXT("Walk"), TEXT("Walk")), 0.0f);
+	TestEqual(TEXT("Unknown concept"), Knowledge->CalculateSemanticDistance(TEXT("Walk"), TEXT("Swim")), TNumericLimits<float>::Max());
+
+	AddRelation(Knowledge, TEXT("Walk"), TEXT("Action"), TEXT("is_a"));
+	TestEqual(TEXT("Added relation shortens the distance"), Knowledge->CalculateSemanticDistance(TEXT("Walk"), TEXT("Action")), 1.0f);
+
+	Knowledge->RemoveRelation(TEXT("Walk"), TEXT("Action"));
+	Knowledge->RemoveRelation(TEXT("Locomotion"), TEXT("Movement"));
+	TestEqual(TEXT("Removed relations disconnect"), Knowledge->CalculateSemanticDistance(TEXT("Walk"), TEXT("Action")), TNumericLimits<float>::Max());
+
+	int32 Lower = 0;
+	int32 Upper = 0;
+	TestTrue(TEXT("Bounds for known concepts"), Knowledge->GetSemanticDistanceBounds(TEXT("Walk"), TEXT("Locomotion"), Lower, Upper));
+	TestTrue(TEXT("Exact bounds with every concept a landmark"), Lower == 1 && Upper == 1);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FREKnowledgeHierarchyTest,
+	"ReasoningEngine.Knowledge.Hierarchy",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FREKnowledgeHierarchyTest::RunTest(const FString& Parameters)
+{
+	// Random DAG, mostly a tree: parents always come earlier in creation order
+	constexpr int32 NumConcepts = 300;
+	FRandomStream Random(50);
+	TArray<FName> Names;
+	TArray<TArray<int32>> Children;
+	Children.SetNum(NumConcepts);
+	TMultiMap<FName, FName> ChildToParents;
+	for (int32 Concept = 0; Concept < NumConcepts; ++Concept)
+	{
+		Names.Add(*FString::Printf(TEXT("C%d"), Concept));
+		const int32 NumParents = Concept == 0 ? 0 : Random.RandHelper(8) == 0 ? 2 : 1;
+		for (int32 Link = 0; Link < NumParents; ++Link)
+		{
+			const int32 Parent = Random.RandHelper(Concept);
+			ChildToParents.Add(Names[Concept], Names[Parent]);
+			Children[Parent].Add(Concept);
+		}
+	}
+
+	FREHierarchyIndex Index;
+	Index.Build(ChildToParents);
+	TestEqual(TEXT("Every concept labelled"), Index.Num(), NumConcepts);
+	TestTrue(TEXT("Linked concept is contained"), Index.Contains(Names[NumConcepts - 1]));
+	TestFalse(TEXT("Unlinked concept is not contained"), Index.Contains(TEXT("Unlinked")));
+
+	bool bSubsumptionMatches = true;
+	bool bDescendantsMatch = true;
+	for (int32 Ancestor = 0; Ancestor < NumConcepts; ++Ancestor)
+	{
+		TBitArray<> Below(false, NumConcepts);
+		TArray<int32> Pending = Children[Ancestor];
+		while (Pending.Num() > 0)
+		{
+			const int32 Concept = Pending.Pop();
+			if (!Below[Concept])
+			{
+				Below[Concept] = true;
+				Pending.Append(Children[Concept]);
+			}
+		}
+
+		for (int32 Concept = 0; Concept < NumConcepts; ++Concept)
+		{
+			bSubsumptionMatches &= Index.IsDescendant(Names[Concept], Names[Ancestor]) == (Concept == Ancestor || Below[Concept]);
+		}
+
+		TArray<FName> Descendants;
+		Index.GetDescendants(Names[Ancestor], Descendants);
+		TSet<FName> Unique(Descendants);
+		bDescendantsMatch &= Unique.Num() == Descendants.Num() && Descendants.Num() == Below.CountSetBits();
+		for (const FName& Name : Descendants)
+		{
+			int32 Concept = INDEX_NONE;
+			Names.Find(Name, Concept);
+			bDescendantsMatch &= Below[Concept];
+		}
+	}
+	TestTrue(TEXT("Interval labels match reachability"), bSubsumptionMatches);
+	TestTrue(TEXT("Descendant ranges list each descendant once"), bDescendantsMatch);
+
+	// Knowledge base hierarchy
+	UREKnowledge* Knowledge = NewObject<UREKnowledge>();
+	TestTrue(TEXT("Walk is locomotion"), Knowledge->AddConceptParent(TEXT("Walk"), TEXT("Locomotion")));
+	TestTrue(TEXT("Locomotion is movement"), Knowledge->AddConceptParent(TEXT("Locomotion"), TEXT("Movement")));
+	TestTrue(TEXT("Run is locomotion"), Knowledge->AddConceptParent(TEXT("Run"), TEXT("Locomotion")));
+	TestTrue(TEXT("Walk is also a gait"), Knowledge->AddConceptParent(TEXT("Walk"), TEXT("Gait")));
+	TestFalse(TEXT("Cycle rejected"), Knowledge->AddConceptParent(TEXT("Movement"), TEXT("Walk")));
+
+	TestTrue(TEXT("Transitive"), Knowledge->IsA(TEXT("Walk"), TEXT("Movement")));
+	TestTrue(TEXT("Second parent"), Knowledge->IsA(TEXT("Walk"), TEXT("Gait")));
+	TestTrue(TEXT("Reflexive"), Knowledge->IsA(TEXT("Gait"), TEXT("Gait")));
+	TestFalse(TEXT("Not upwards"), Knowledge->IsA(TEXT("Movement"), TEXT("Walk")));
+	TestFalse(TEXT("Not sideways"), Knowledge->IsA(TEXT("Run"), TEXT("Gait")));
+	TestEqual(TEXT("Descendants of Movement"), Knowledge->GetDescendants(TEXT("Movement")).Num(), 3);
+
+	TestTrue(TEXT("Remove link"), Knowledge->RemoveConceptParent(TEXT("Locomotion"), TEXT("Movement")));
+	TestFalse(TEXT("Removed link is not followed"), Knowledge->IsA(TEXT("Walk"), TEXT("Movement")));
+	TestFalse(TEXT("Remove missing link"), Knowledge->RemoveConceptParent(TEXT("Locomotion"), TEXT("Movement")));
+
+	FREConcept Locomotion;
+	Locomotion.ConceptID = TEXT("Locomotion");
+	Knowledge->AddConcept(Locomotion);
+	Knowledge->RemoveConcept(TEXT("Locomotion"));
+	TestFalse(TEXT("Removed concept leaves the hierarchy"), Knowledge->IsA(TEXT("Walk"), TEXT("Locomotion")));
+	TestTrue(TEXT("Other links survive"), Knowledge->IsA(TEXT("Walk"), TEXT("Gait")));
+
+	return true;
+}
@@ -0,0 +1,123 @@
+﻿#include "Misc/AutomationTest.h"
+#include "Infrastructure/RENormalizer.h"
+#include "Infrastructure/RENormalizedFormTable.h"
+#include "Async/ParallelFor.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRENormalizerHarnessTest,
+	"ReasoningEngine.Normalizer.Harness",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRENormalizerHarnessTest::RunTest(const FString& Parameters)
+{
+	const TArray<FString> Inputs = {
+		TEXT("  MM_Walk_Forward_01  "),
+		TEXT("Caf\u00E9   au\tLAIT!!"),
+		TEXT("jump,, land;  idle"),
+		TEXT(""),
+		TEXT("   "),
+	};
+
+	FRENormalizationConfig Config;
+	Config.Modes = static_cast<uint8>(ERENormalizationMode::Full);
+	Config.bConvertToAscii = true;
+
+	// Fused plan must match the step-by-step pipeline
+	for (const FString& Input : Inputs)
+	{
+		FString Staged = RENormalizer::ToLowercase(Input);
+		Staged = RENormalizer::RemoveAccents(Staged);
+		Staged = RENormalizer::RemoveNumbers(Staged);
+		Staged = RENormalizer::RemovePunctuation(Staged);
+		Staged = RENormalizer::CollapseWhitespace(Staged);
+		Staged = RENormalizer::TrimWhitespace(Staged);
+		Staged = RENormalizer::ToAscii(Staged, Config.AsciiReplacementChar);
+
+		const FString Fused = RENormalizer::NormalizeTextWithConfig(Input, Config);
+		TestEqual(FString::Printf(TEXT("Fused matches staged for '%s'"), *Input), Fused, Staged);
+
+		TStringBuilder<64> Builder;
+		Builder << TEXT("[");
+		const int32 Appended = RENormalizer::NormalizeInto(Input, Config, Builder);
+		TestEqual(TEXT("NormalizeInto appends"), FString(Builder.ToView()), TEXT("[") + Fused);
+		TestEqual(TEXT("NormalizeInto count"), Appended, Fused.Len());
+	}
+
+	// Batch output is identical and in input order, on both the serial and parallel paths
+	TArray<FString> Many;
+	for (int32 Index = 0; Index < 4096; ++Index)
+	{
+		Many.Add(Inputs[Index % Inputs.Num()] + FString::Printf(TEXT(" Item%d"), Index));
+	}
+
+	for (const TArray<FString>* Batch : TArray<const TArray<FString>*>{ &Inputs, &Many })
+	{
+		const FRENormalizedBatch Result = RENormalizer::NormalizeBatch(*Batch, Config);
+		TestEqual(TEXT("Batch size"), Result.Num(), Batch->Num());
+		for (int32 Index = 0; Index < Batch->Num(); ++Index)
+		{
+			if (!TestEqual(TEXT("Batch entry"), Result.GetString(Index), RENormalizer::NormalizeTextWithConfig((*Batch)[Index], Config)))
+			{
+				break;
+			}
+		}
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRENormalizerUnicodeTest,
+	"ReasoningEngine.Normalizer.Unicode",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRENormalizerUnicodeTest::RunTest(const FString& Parameters)
+{
+	const FString Composed = TEXT("Caf\u00E9");
+	const FString Decomposed = TEXT("Cafe\u0301");
+
+	TestEqual(TEXT("NFC composes"), RENormalizer::NormalizeUnicode(Decomposed, EREUnicodeNormalizationForm::NFC), Composed);
+	TestEqual(TEXT("NFD decomposes"), RENormalizer::NormalizeUnicode(Composed, EREUnicodeNormalizationForm::NFD), Decomposed);
+	TestEqual(TEXT("NFKC folds compatibility forms"), RENormalizer::NormalizeUnicode(TEXT("\uFB01le\u00BD"), EREUnicodeNormalizationForm::NFKC), FString(TEXT("file1\u20442")));
+	TestEqual(TEXT("Hangul round trip"), RENormalizer::NormalizeUnicode(RENormalizer::NormalizeUnicode(TEXT("\uD55C"), EREUnicodeNormalizationForm::NFD), EREUnicodeNormalizationForm::NFC), FString(TEXT("\uD55C")));
+
+	TestTrue(TEXT("ASCII is NFC"), RENormalizer::IsUnicodeNormalized(TEXT("MM_Walk_Fwd"), EREUnicodeNormalizationForm::NFC));
+	TestFalse(TEXT("Combining sequence is not NFC"), RENormalizer::IsUnicodeNormalized(Decomposed, EREUnicodeNormalizationForm::NFC));
+
+	TestEqual(TEXT("Full case folding"), RENormalizer::CaseFold(TEXT("Stra\u00DFe")), FString(TEXT("strasse")));
+	TestEqual(TEXT("Accents from tables"), RENormalizer::RemoveAccents(TEXT("\u0160koda \u01CE \u00F8")), FString(TEXT("Skoda a o")));
+
+	// Both spellings meet in the comparison form
+	TestEqual(TEXT("Comparison form is normalization-invariant"), RENormalizer::GetComparisonForm(Composed), RENormalizer::GetComparisonForm(Decomposed));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRENormalizerInternTest,
+	"ReasoningEngine.Normalizer.Intern",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRENormalizerInternTest::RunTest(const FString& Parameters)
+{
+	FREStringPool Pool;
+	const uint32 WalkId = Pool.Intern(TEXT("Walk"));
+	TestEqual(TEXT("Interning is idempotent"), Pool.Intern(TEXT("Walk")), WalkId);
+	TestNotEqual(TEXT("Interning is case-sensitive"), Pool.Intern(TEXT("walk")), WalkId);
+	TestEqual(TEXT("Resolve returns the string"), Pool.Resolve(WalkId), FString(TEXT("Walk")));
+	TestEqual(TEXT("Find misses unknown strings"), Pool.Find(TEXT("Run")), FREStringPool::InvalidId);
+
+	const FRENormalizedHandle A = RENormalizer::InternComparisonForm(TEXT("Walk_Forward_01"));
+	const FRENormalizedHandle B = RENormalizer::InternComparisonForm(TEXT("WALK-FORWARD"));
+	TestTrue(TEXT("Same comparison form, same handle"), A == B);
+	TestEqual(TEXT("Handle resolves to the comparison form"),
+		RENormalizer::GetComparisonFormTable().Resolve(A),
+		RENormalizer::GetComparisonForm(TEXT("Walk_Forward_01")));
+
+	// Concurrent interning hands out one id per distinct string
+	ParallelFor(64, [&Pool](int32 Index)
+	{
+		Pool.Intern(FString::Printf(TEXT("Item%d"), Index % 16));
+	});
+	TestEqual(TEXT("Concurrent interning dedupes"), Pool.Num(), 2 + 16);
+	TestEqual(TEXT("Every id published once writers finish"), Pool.NumPublished(), Pool.Num());
+
+	return true;
+}
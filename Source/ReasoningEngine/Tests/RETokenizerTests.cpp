@@ -0,0 +1,513 @@
+﻿#include "Misc/AutomationTest.h"
+#include "Infrastructure/RETokenizer.h"
+#include "Infrastructure/REAssetNameIndex.h"
+#include "Infrastructure/RECorpusStatistics.h"
+#include "Infrastructure/REPackedTokenStream.h"
+#include "Infrastructure/RETokenDictionary.h"
+#include "Infrastructure/REVocabularyMatcher.h"
+#include "Infrastructure/REWordSegmenter.h"
+#include "Serialization/MemoryReader.h"
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRETokenizerBatchTest,
+	"ReasoningEngine.Tokenizer.Batch",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRETokenizerBatchTest::RunTest(const FString& Parameters)
+{
+	const TArray<FString> Names = {
+		TEXT("MM_Walk_Forward_01"),
+		TEXT("RunJumpLand"),
+		TEXT("idle-breathing.v2"),
+		TEXT(""),
+	};
+
+	TArray<FString> Catalog;
+	for (int32 Index = 0; Index < 2000; ++Index)
+	{
+		Catalog.Add(Names[Index % Names.Num()] + FString::Printf(TEXT("_%d"), Index));
+	}
+
+	FRETokenizerConfig Config;
+	Config.bGenerateVariants = false;
+
+	// Serial and parallel paths must match per-input tokenization
+	for (const TArray<FString>* Inputs : TArray<const TArray<FString>*>{ &Names, &Catalog })
+	{
+		const FRETokenBatch Batch = RETokenizer::TokenizeBatch(*Inputs, Config);
+		TestEqual(TEXT("Batch size"), Batch.Num(), Inputs->Num());
+
+		for (int32 Index = 0; Index < Inputs->Num(); ++Index)
+		{
+			const FRETokenStream Expected = RETokenizer::TokenizeWithConfig((*Inputs)[Index], Config);
+			const TArrayView<const FREToken> Tokens = Batch.GetTokens(Index);
+
+			if (!TestEqual(TEXT("Token count"), Tokens.Num(), Expected.Tokens.Num()))
+			{
+				break;
+			}
+			for (int32 TokenIndex = 0; TokenIndex < Tokens.Num(); ++TokenIndex)
+			{
+				TestEqual(TEXT("Token text"), Tokens[TokenIndex].Text, Expected.Tokens[TokenIndex].Text);
+				TestEqual(TEXT("Token start"), Tokens[TokenIndex].StartIndex, Expected.Tokens[TokenIndex].StartIndex);
+			}
+			TestEqual(TEXT("Convention"), Batch.Conventions[Index], Expected.DetectedConvention);
+		}
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRETokenizerStreamTest,
+	"ReasoningEngine.Tokenizer.Stream",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRETokenizerStreamTest::RunTest(const FString& Parameters)
+{
+	FString Text;
+	for (int32 Index = 0; Index < 500; ++Index)
+	{
+		Text += FString::Printf(TEXT("walk_forward%d run-fast café jump. "), Index);
+	}
+
+	FTCHARToUTF8 Utf8(*Text);
+	TArray<uint8> Bytes;
+	Bytes.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+
+	FRETokenizerConfig Config;
+	const FRETokenStream Expected = RETokenizer::TokenizeWithConfig(Text, Config);
+
+	// Tiny chunks force words and multi-byte characters across boundaries
+	FMemoryReader Archive(Bytes);
+	TArray<FREToken> Streamed;
+	RETokenizer::TokenizeArchive(Archive, Config, [&Streamed](const FREToken& Token)
+	{
+		Streamed.Add(Token);
+		return true;
+	}, 16);
+
+	TestEqual(TEXT("Token count"), Streamed.Num(), Expected.Tokens.Num());
+	for (int32 Index = 0; Index < FMath::Min(Streamed.Num(), Expected.Tokens.Num()); ++Index)
+	{
+		const FREToken& Token = Streamed[Index];
+		if (!TestEqual(TEXT("Token text"), Token.Text, Expected.Tokens[Index].Text))
+		{
+			break;
+		}
+		TestTrue(TEXT("Absolute offsets point at the token"),
+			Text.Mid(Token.StartIndex, Token.Text.Len()).Equals(Token.Text, ESearchCase::IgnoreCase));
+	}
+
+	// A truncated sub-token's tail can repeat the next sub-token's text;
+	// offsets come from the split, not from searching the word
+	FRETokenizerConfig Truncating;
+	Truncating.MaxTokenLength = 4;
+	FTCHARToUTF8 Repeated(TEXT("idle WalkwalkWalk"));
+	TArray<uint8> RepeatedBytes(reinterpret_cast<const uint8*>(Repeated.Get()), Repeated.Length());
+	FMemoryReader RepeatedArchive(RepeatedBytes);
+	TArray<int32> Starts;
+	RETokenizer::TokenizeArchive(RepeatedArchive, Truncating, [&Starts](const FREToken& Token)
+	{
+		Starts.Add(Token.StartIndex);
+		return true;
+	});
+	TestTrue(TEXT("Sub-token offsets survive truncation"), Starts == TArray<int32>{ 0, 5, 13 });
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRETokenizerLazyVariantsTest,
+	"ReasoningEngine.Tokenizer.LazyVariants",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRETokenizerLazyVariantsTest::RunTest(const FString& Parameters)
+{
+	FRETokenVariants::ClearCache();
+
+	// Reference: eager generation in the original order with first-occurrence dedup
+	auto Reference = [](const FString& Word)
+	{
+		TArray<FString> All = RETokenizer::GenerateTypos(Word, 1);
+		All.Append(RETokenizer::GenerateAbbreviations(Word));
+		All.Append(RETokenizer::GenerateExpansions(Word));
+		return TSet<FString>(All).Array();
+	};
+
+	for (const TCHAR* Word : { TEXT("Walk"), TEXT("idle"), TEXT("anim"), TEXT("a"), TEXT("") })
+	{
+		const TArray<FString> Expected = Reference(Word);
+
+		// Cold (generated) and warm (cached) passes must agree
+		TestEqual(TEXT("Lazy order"), FRETokenVariants(Word).ToArray(), Expected);
+		TestEqual(TEXT("Cached order"), FRETokenVariants(Word).ToArray(), Expected);
+		TestEqual(TEXT("GenerateVariants"), RETokenizer::GenerateVariants(Word), Expected);
+	}
+
+	// Early stop visits only what was asked for
+	FRETokenVariants::ClearCache();
+	const TArray<FString> First = FRETokenVariants(TEXT("Forward")).Take(2);
+	TestEqual(TEXT("Take count"), First.Num(), 2);
+	int32 Visited = FRETokenVariants(TEXT("Forward")).ForEach([](const FString&) { return false; });
+	TestEqual(TEXT("ForEach stops"), Visited, 1);
+
+	// Variants are filled in by default and only deferred on request
+	FRETokenizerConfig Config;
+	Config.bGenerateVariants = true;
+	const FRETokenStream Eager = RETokenizer::TokenizeWithConfig(TEXT("WalkForward"), Config);
+	if (TestTrue(TEXT("Has tokens"), Eager.Tokens.Num() > 0))
+	{
+		TestEqual(TEXT("Eager"), Eager.Tokens[0].Variants, RETokenizer::GetVariants(Eager.Tokens[0], Config).ToArray());
+	}
+
+	// Deferred tokens carry no variants until asked
+	Config.bDeferVariants = true;
+	const FRETokenStream Stream = RETokenizer::TokenizeWithConfig(TEXT("WalkForward"), Config);
+	if (TestTrue(TEXT("Has tokens"), Stream.Tokens.Num() > 0))
+	{
+		TestEqual(TEXT("Deferred"), Stream.Tokens[0].Variants.Num(), 0);
+		TestTrue(TEXT("On demand"), RETokenizer::GetVariants(Stream.Tokens[0], Config).ToArray().Num() > 0);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRETokenizerTokenIdsTest,
+	"ReasoningEngine.Tokenizer.TokenIds",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRETokenizerTokenIdsTest::RunTest(const FString& Parameters)
+{
+	FRETokenDictionary& Dictionary = FRETokenDictionary::Get();
+
+	FRETokenizerConfig Config;
+	Config.bEmitTokenIds = true;
+	const FRETokenStream Stream = RETokenizer::TokenizeWithConfig(TEXT("the_Walk_forward_the_walk"), Config);
+	const TArray<uint32> Ids = RETokenizer::TokenizeToIds(TEXT("the_Walk_forward_the_walk"), Config);
+
+	if (!TestEqual(TEXT("Id count"), Ids.Num(), Stream.Tokens.Num()))
+	{
+		return false;
+	}
+	for (int32 Index = 0; Index < Ids.Num(); ++Index)
+	{
+		TestEqual(TEXT("Stream id"), Stream.Tokens[Index].TokenId, Ids[Index]);
+		TestEqual(TEXT("Resolve"), Dictionary.Resolve(Ids[Index]), Stream.Tokens[Index].NormalizedText);
+	}
+	TestEqual(TEXT("Case folded"), Ids[1], Ids[4]);
+
+	// Stop words
+	const TArray<uint32> Filtered = RETokenizer::FilterStopWordIds(Ids, RETokenizer::GetDefaultStopWordMask());
+	TestEqual(TEXT("Filtered ids"), Filtered.Num(), RETokenizer::FilterStopWords(Stream, RETokenizer::GetDefaultStopWords()).Tokens.Num());
+
+	// Weights match the string path
+	const TArray<float> Weights = RETokenizer::CalculateTermWeights(Ids);
+	const FRETokenStream Weighted = RETokenizer::CalculateTokenWeights(Stream);
+	for (int32 Index = 0; Index < Ids.Num(); ++Index)
+	{
+		TestEqual(TEXT("Weight"), Weights[Index], Weighted.Tokens[Index].Weight);
+	}
+
+	// N-grams: equal pairs give equal keys
+	const TArray<uint64> Bigrams = RETokenizer::GenerateWordNGramIds(Ids, 2);
+	TestEqual(TEXT("Bigram count"), Bigrams.Num(), Ids.Num() - 1);
+	TestEqual(TEXT("Repeated bigram"), Bigrams[0], Bigrams[3]);
+
+	// Compounds in both spellings, first entry wins
+	TArray<FREVocabularyEntry> Vocabulary;
+	Vocabulary.AddDefaulted(3);
+	Vocabulary[0].Term = TEXT("Jump");
+	Vocabulary[1].Term = TEXT("walk forward");
+	Vocabulary[2].Term = TEXT("walkforward");
+	const TArray<FString> Compounds = RETokenizer::FindCompoundWords(Stream, Vocabulary);
+	TestEqual(TEXT("Compounds"), Compounds, TArray<FString>{ TEXT("walk forward") });
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRETokenizerVocabularyMatcherTest,
+	"ReasoningEngine.Tokenizer.VocabularyMatcher",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRETokenizerVocabularyMatcherTest::RunTest(const FString& Parameters)
+{
+	TArray<FREVocabularyEntry> Vocabulary;
+	for (const TCHAR* Term : { TEXT("Walk Forward"), TEXT("walk_forward_loop"), TEXT("ForwardLoop"), TEXT("loop"), TEXT("kforw") })
+	{
+		Vocabulary.AddDefaulted_GetRef().Term = Term;
+	}
+
+	const FREVocabularyMatcher Matcher(Vocabulary);
+	const FRETokenStream Stream = RETokenizer::Tokenize(TEXT("MM_Walk_Forward_Loop_01"));
+
+	// Every multi-token term, any length, in stream order; "kforw" crosses a token boundary
+	const TArray<FString> Compounds = RETokenizer::FindCompoundWords(Stream, Matcher);
+	TestEqual(TEXT("Compounds"), Compounds,
+		TArray<FString>{ TEXT("Walk Forward"), TEXT("walk_forward_loop"), TEXT("ForwardLoop") });
+	TestEqual(TEXT("Uncompiled overload"), RETokenizer::FindCompoundWords(Stream, Vocabulary), Compounds);
+
+	// Single-token terms are found when allowed
+	TArray<FREVocabularyMatcher::FMatch> Matches;
+	Matcher.FindMatches(Stream.Tokens, 1, Matches);
+	TestEqual(TEXT("All matches"), Matches.Num(), 4);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRETokenizerSegmentationTest,
+	"ReasoningEngine.Tokenizer.Segmentation",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRETokenizerSegmentationTest::RunTest(const FString& Parameters)
+{
+	const FREWordSegmenter& Segmenter = FREWordSegmenter::GetDefault();
+
+	TestEqual(TEXT("Lowercase"), Segmenter.SegmentToStrings(TEXT("walkforwardloop")),
+		TArray<FString>{ TEXT("walk"), TEXT("forward"), TEXT("loop") });
+	TestEqual(TEXT("Uppercase keeps case"), Segmenter.SegmentToStrings(TEXT("MMRUNFAST")),
+		TArray<FString>{ TEXT("MM"), TEXT("RUN"), TEXT("FAST") });
+	TestEqual(TEXT("Unknown word left whole"), Segmenter.SegmentToStrings(TEXT("banana")),
+		TArray<FString>{ TEXT("banana") });
+
+	// Unknown runs are reported by Segment
+	TArray<FREWordSegmenter::FSegment> Segments;
+	TestTrue(TEXT("Splits"), Segmenter.Segment(TEXT("xqzwalk"), Segments));
+	if (TestEqual(TEXT("Segment count"), Segments.Num(), 2))
+	{
+		TestFalse(TEXT("Unknown prefix"), Segments[0].bKnown);
+		TestEqual(TEXT("Unknown length"), Segments[0].Len, 3);
+		TestTrue(TEXT("Known word"), Segments[1].bKnown);
+	}
+
+	// Wired into animation name tokenization
+	const FRETokenStream Stream = RETokenizer::TokenizeAnimationName(TEXT("MM_walkforwardloop_01"));
+	TArray<FString> Texts;
+	for (const FREToken& Token : Stream.Tokens)
+	{
+		Texts.Add(Token.Text);
+	}
+	TestEqual(TEXT("Animation name"), Texts,
+		TArray<FString>{ TEXT("MM"), TEXT("walk"), TEXT("forward"), TEXT("loop"), TEXT("01") });
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRETokenizerCorpusTest,
+	"ReasoningEngine.Tokenizer.Corpus",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRETokenizerCorpusTest::RunTest(const FString& Parameters)
+{
+	FRETokenizerConfig Config;
+	Config.bEmitTokenIds = true;
+
+	FRECorpusStatistics Corpus;
+	Corpus.AddDocument(RETokenizer::TokenizeToIds(TEXT("walk_forward_walk"), Config));
+	Corpus.AddDocument(RETokenizer::TokenizeToIds(TEXT("walk_left"), Config));
+	Corpus.AddDocument(RETokenizer::TokenizeWithConfig(TEXT("run_forward"), Config));
+
+	FRETokenDictionary& Dictionary = FRETokenDictionary::Get();
+	const uint32 Walk = Dictionary.Find(TEXT("walk"));
+	const uint32 Left = Dictionary.Find(TEXT("left"));
+	const uint32 Unseen = Dictionary.Intern(TEXT("corpustestunseenword"));
+
+	TestEqual(TEXT("Documents"), Corpus.GetNumDocuments(), static_cast<uint64>(3));
+	TestEqual(TEXT("Repeats count once"), Corpus.GetDocumentFrequency(Walk), 2u);
+	TestTrue(TEXT("Rarer is higher"), Corpus.GetIdf(Left) > Corpus.GetIdf(Walk));
+	TestTrue(TEXT("Unseen is highest"), Corpus.GetIdf(Unseen) > Corpus.GetIdf(Left));
+
+	// Table and per-id queries agree
+	TArray<float> Idf;
+	Corpus.BuildIdfTable(Idf);
+	TestEqual(TEXT("Table"), Idf[Walk], Corpus.GetIdf(Walk));
+
+	// Round trip through disk
+	const FString FilePath = FPaths::CreateTempFilename(*FPaths::ProjectIntermediateDir(), TEXT("CorpusTest"), TEXT(".bin"));
+	TestTrue(TEXT("Save"), Corpus.SaveToFile(FilePath));
+
+	FRECorpusStatistics Loaded;
+	TestTrue(TEXT("Load"), Loaded.LoadFromFile(FilePath));
+	TestEqual(TEXT("Loaded documents"), Loaded.GetNumDocuments(), Corpus.GetNumDocuments());
+	TestEqual(TEXT("Loaded frequency"), Loaded.GetDocumentFrequency(Walk), 2u);
+	IFileManager::Get().Delete(*FilePath);
+
+	// Removal undoes ingestion
+	Corpus.RemoveDocument(RETokenizer::TokenizeToIds(TEXT("walk_left"), Config));
+	TestEqual(TEXT("After remove"), Corpus.GetDocumentFrequency(Left), 0u);
+
+	// Tokenizer weighting uses the corpus IDF
+	const FRETokenStream Weighted = RETokenizer::CalculateTokenWeights(
+		RETokenizer::TokenizeWithConfig(TEXT("walk_forward"), Config), Corpus);
+	TestEqual(TEXT("Weight"), Weighted.Tokens[0].Weight, 0.5f * Corpus.GetIdf(Walk));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRETokenizerGroupingTest,
+	"ReasoningEngine.Tokenizer.Grouping",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRETokenizerGroupingTest::RunTest(const FString& Parameters)
+{
+	const FRETokenStream Stream = RETokenizer::CreateTokenStream(
+		{ TEXT("walk"), TEXT("Walk"), TEXT("wlak"), TEXT("run"), TEXT("jump"), TEXT("runn"), TEXT("walk") });
+
+	// Exact grouping only
+	const TArray<FRETokenGroup> Exact = RETokenizer::GroupTokensBySimilarity(Stream.Tokens, 1.0f);
+	TestEqual(TEXT("Exact groups"), Exact.Num(), 5);
+	TestEqual(TEXT("Case-folded duplicates"), Exact[0].Frequency, 3);
+
+	// Fuzzy grouping merges typos into the most frequent spelling
+	const TArray<FRETokenGroup> Fuzzy = RETokenizer::GroupTokensBySimilarity(Stream.Tokens, 0.85f);
+	if (TestEqual(TEXT("Fuzzy groups"), Fuzzy.Num(), 3))
+	{
+		TestEqual(TEXT("Walk canonical"), Fuzzy[0].CanonicalForm, FString(TEXT("walk")));
+		TestEqual(TEXT("Walk members"), Fuzzy[0].Frequency, 4);
+		TestTrue(TEXT("Walk similarity"), Fuzzy[0].AverageSimilarity < 1.0f && Fuzzy[0].AverageSimilarity > 0.85f);
+		TestEqual(TEXT("Run members"), Fuzzy[1].Frequency, 2);
+		TestEqual(TEXT("Jump alone"), Fuzzy[2].Frequency, 1);
+	}
+
+	// Large sets go through blocking and must still find near-duplicates
+	TArray<FString> Names;
+	for (int32 Index = 0; Index < 500; ++Index)
+	{
+		Names.Add(FString::Printf(TEXT("name%dx"), Index));
+		Names.Add(FString::Printf(TEXT("name%dxx"), Index));
+	}
+	const TArray<FRETokenGroup> Blocked = RETokenizer::GroupTokensBySimilarity(RETokenizer::CreateTokenStream(Names).Tokens, 0.97f);
+	TMap<FString, int32> GroupOfName;
+	for (int32 Group = 0; Group < Blocked.Num(); ++Group)
+	{
+		for (const FREToken& Token : Blocked[Group].Tokens)
+		{
+			GroupOfName.Add(Token.Text, Group);
+		}
+	}
+	TestEqual(TEXT("Every token grouped"), GroupOfName.Num(), Names.Num());
+	for (int32 Index = 0; Index < Names.Num(); Index += 2)
+	{
+		if (!TestEqual(TEXT("Near-duplicates grouped"), GroupOfName.FindRef(Names[Index]), GroupOfName.FindRef(Names[Index + 1])))
+		{
+			break;
+		}
+	}
+
+	// Grouping and weighting streams without ids leave the shared dictionary alone
+	const FRETokenStream Transient = RETokenizer::CreateTokenStream({ TEXT("groupingtestonly"), TEXT("groupingtestonly"), TEXT("groupingtestonce") });
+	RETokenizer::GroupTokensBySimilarity(Transient.Tokens, 0.85f);
+	const FRETokenStream Weighted = RETokenizer::CalculateTokenWeights(Transient, FRECorpusStatistics::GetShared());
+	TestEqual(TEXT("Term frequency kept per term"), Weighted.Tokens[0].Weight, 2.0f * Weighted.Tokens[2].Weight);
+	TestEqual(TEXT("Not interned"), FRETokenDictionary::Get().Find(TEXT("groupingtestonly")), FRETokenDictionary::InvalidId);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRETokenizerAssetIndexTest,
+	"ReasoningEngine.Tokenizer.AssetIndex",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRETokenizerAssetIndexTest::RunTest(const FString& Parameters)
+{
+	TestEqual(TEXT("Object path"), FREAssetNameIndex::GetAssetName(TEXT("/Game/Anims/MM_Walk_Fwd.MM_Walk_Fwd")), FString(TEXT("MM_Walk_Fwd")));
+	TestEqual(TEXT("Bare name"), FREAssetNameIndex::GetAssetName(TEXT("MM_Run_Loop")), FString(TEXT("MM_Run_Loop")));
+
+	TArray<FString> Assets = {
+		TEXT("/Game/Anims/MM_Walk_Fwd.MM_Walk_Fwd"),
+		TEXT("/Game/Anims/MM_Run_Fwd.MM_Run_Fwd"),
+		TEXT("/Game/Anims/MM_Walk_Left.MM_Walk_Left"),
+		TEXT("MM_walkforwardloop"),
+	};
+
+	const FString CachePath = FPaths::CreateTempFilename(*FPaths::ProjectIntermediateDir(), TEXT("AssetIndexTest"), TEXT(".bin"));
+
+	FREAssetNameIndex Index;
+	FREAssetNameIndex::FBuildStats Stats = Index.Build(Assets, CachePath);
+	TestEqual(TEXT("Cold build tokenizes all"), Stats.NumTokenized, Assets.Num());
+	TestTrue(TEXT("Cache written"), Stats.bCacheWritten);
+
+	TestEqual(TEXT("Walk"), TArray<int32>(Index.FindAssets(TEXT("Walk"))), TArray<int32>{ 0, 2, 3 });
+	TestEqual(TEXT("Walk + Fwd"), Index.FindAssetsWithAll({ TEXT("walk"), TEXT("fwd") }), TArray<int32>{ 0 });
+	TestEqual(TEXT("Unknown"), Index.FindAssets(TEXT("assetindextestunknown")).Num(), 0);
+
+	// Warm build only tokenizes the new asset
+	Assets.Add(TEXT("/Game/Anims/MM_Jump_Start.MM_Jump_Start"));
+	FREAssetNameIndex Warm;
+	Stats = Warm.Build(Assets, CachePath);
+	TestEqual(TEXT("Warm tokenized"), Stats.NumTokenized, 1);
+	TestEqual(TEXT("Warm cached"), Stats.NumFromCache, 4);
+	TestEqual(TEXT("Same postings"), TArray<int32>(Warm.FindAssets(TEXT("walk"))), TArray<int32>{ 0, 2, 3 });
+	TestEqual(TEXT("New asset"), TArray<int32>(Warm.FindAssets(TEXT("jump"))), TArray<int32>{ 4 });
+
+	// Unchanged input leaves the cache alone
+	Stats = Warm.Build(Assets, CachePath);
+	TestEqual(TEXT("Nothing tokenized"), Stats.NumTokenized, 0);
+	TestFalse(TEXT("Cache untouched"), Stats.bCacheWritten);
+
+	// Repeated names share one cache entry and do not force a rewrite
+	Assets.Add(TEXT("/Game/Other/MM_Walk_Fwd.MM_Walk_Fwd"));
+	Stats = Warm.Build(Assets, CachePath);
+	Stats = Warm.Build(Assets, CachePath);
+	TestEqual(TEXT("Duplicate cached"), Stats.NumFromCache, Assets.Num());
+	TestFalse(TEXT("Duplicates leave the cache alone"), Stats.bCacheWritten);
+
+	// New segmenter words change tokenization, so the cache is dropped
+	FREWordSegmenter::GetDefault().AddWord(TEXT("assetindextestword"));
+	Stats = Warm.Build(Assets, CachePath);
+	TestEqual(TEXT("Vocabulary change retokenizes"), Stats.NumTokenized, Assets.Num());
+	TestTrue(TEXT("Cache rewritten"), Stats.bCacheWritten);
+
+	IFileManager::Get().Delete(*CachePath);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRETokenizerPackedTest,
+	"ReasoningEngine.Tokenizer.Packed",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRETokenizerPackedTest::RunTest(const FString& Parameters)
+{
+	FRETokenizerConfig Config;
+	Config.bEmitTokenIds = true;
+	const FString Text = TEXT("MM_Walk_Forward_Loop_Walk_Forward_01");
+
+	const FRETokenStream Stream = RETokenizer::TokenizeWithConfig(Text, Config);
+	FREPackedTokenStream Packed = RETokenizer::TokenizePacked(Text, Config);
+
+	if (!TestEqual(TEXT("Token count"), Packed.Num(), Stream.Tokens.Num()))
+	{
+		return false;
+	}
+
+	// Round trip
+	const FRETokenStream Unpacked = Packed.ToStream();
+	for (int32 Index = 0; Index < Packed.Num(); ++Index)
+	{
+		TestEqual(TEXT("Text"), FString(Packed.GetText(Index)), Stream.Tokens[Index].Text);
+		TestEqual(TEXT("Normalized"), Unpacked.Tokens[Index].NormalizedText, Stream.Tokens[Index].NormalizedText);
+		TestEqual(TEXT("Start"), Unpacked.Tokens[Index].StartIndex, Stream.Tokens[Index].StartIndex);
+		TestEqual(TEXT("Type"), Unpacked.Tokens[Index].Type, Stream.Tokens[Index].Type);
+	}
+	TestEqual(TEXT("No side tables"), Packed.Variants.Num() + Packed.Metadata.Num() + Packed.LineNumbers.Num(), 0);
+
+	// Weighting matches the token stream path
+	RETokenizer::CalculateTokenWeights(Packed);
+	const FRETokenStream Weighted = RETokenizer::CalculateTokenWeights(Stream);
+	for (int32 Index = 0; Index < Packed.Num(); ++Index)
+	{
+		TestEqual(TEXT("Weight"), Packed.Weights[Index], Weighted.Tokens[Index].Weight);
+	}
+
+	// Id sequence search and compound matching on the packed form
+	const uint32 Sequence[] = { Packed.Ids[1], Packed.Ids[2] };
+	TestEqual(TEXT("Sequence"), RETokenizer::FindTokenSequence(Packed, Sequence), TArray<int32>{ 1, 4 });
+
+	TArray<FREVocabularyEntry> Vocabulary;
+	Vocabulary.AddDefaulted_GetRef().Term = TEXT("Walk Forward");
+	const FREVocabularyMatcher Matcher(Vocabulary);
+	TArray<FREVocabularyMatcher::FMatch> Matches;
+	Matcher.FindMatches(Packed, 2, Matches);
+	TestEqual(TEXT("Packed compounds"), Matches.Num(), 2);
+
+	return true;
+}
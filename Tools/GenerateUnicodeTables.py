@@ -0,0 +1,257 @@
+#!/usr/bin/env python3
+"""
+Generates Source/ReasoningEngine/Private/Infrastructure/REUnicodeTables.inl
+
+Builds the two-stage Basic Multilingual Plane lookup tables used by REUnicode
+(decomposition, composition, case folding, accent stripping and normalization
+quick-check) from the Unicode Character Database bundled with Python's
+unicodedata module.
+
+Usage:
+    python Tools/GenerateUnicodeTables.py
+
+Re-run after upgrading Python to pick up a newer Unicode version. Hangul
+syllables are handled algorithmically at runtime and are not tabulated.
+"""
+
+import os
+import sys
+import unicodedata
+
+BLOCK_BITS = 8
+BLOCK_SIZE = 1 << BLOCK_BITS
+BMP_LIMIT = 0x10000
+
+HANGUL_S_BASE = 0xAC00
+HANGUL_S_COUNT = 11172
+
+# Quick-check bits (mirror REUnicode::EQuickCheckBits)
+QC_NFD_NO = 0x01
+QC_NFKD_NO = 0x02
+QC_NFC_NO = 0x04
+QC_NFC_MAYBE = 0x08
+QC_NFKC_NO = 0x10
+QC_NFKC_MAYBE = 0x20
+
+# Letters whose stroke/slash is not a combining mark but should still strip
+EXTRA_ACCENT_BASES = {
+    'ø': 'o', 'Ø': 'O', 'đ': 'd', 'Đ': 'D', 'ł': 'l', 'Ł': 'L',
+    'ħ': 'h', 'Ħ': 'H', 'ŧ': 't', 'Ŧ': 'T', 'ƀ': 'b', 'ɨ': 'i',
+}
+
+OUTPUT_PATH = os.path.join(
+    os.path.dirname(os.path.abspath(__file__)), '..',
+    'Source', 'ReasoningEngine', 'Private', 'Infrastructure', 'REUnicodeTables.inl')
+
+
+def is_hangul_syllable(code):
+    return HANGUL_S_BASE <= code < HANGUL_S_BASE + HANGUL_S_COUNT
+
+
+def utf16_units(text):
+    units = []
+    for ch in text:
+        code = ord(ch)
+        if code < BMP_LIMIT:
+            units.append(code)
+        else:
+            code -= 0x10000
+            units.append(0xD800 + (code >> 10))
+            units.append(0xDC00 + (code & 0x3FF))
+    return units
+
+
+class Pool:
+    """Shared UTF-16 storage with reuse of identical sequences"""
+
+    def __init__(self):
+        self.units = []
+        self.index = {}
+
+    def add(self, units):
+        key = tuple(units)
+        if key not in self.index:
+            self.index[key] = len(self.units)
+            self.units.extend(units)
+        return self.index[key]
+
+
+def accent_base(ch):
+    if ch in EXTRA_ACCENT_BASES:
+        return ord(EXTRA_ACCENT_BASES[ch])
+    decomposed = unicodedata.normalize('NFD', ch)
+    if len(decomposed) < 2:
+        return 0
+    base = ''.join(c for c in decomposed if unicodedata.combining(c) == 0)
+    if len(base) != 1 or base == ch or ord(base) >= BMP_LIMIT:
+        return 0
+    return ord(base)
+
+
+def composition_pairs():
+    """Primary composites: canonical pair decompositions that NFC recomposes"""
+    pairs = {}
+    for code in range(BMP_LIMIT):
+        if is_hangul_syllable(code):
+            continue
+        ch = chr(code)
+        decomposition = unicodedata.decomposition(ch)
+        if not decomposition or decomposition.startswith('<'):
+            continue
+        parts = [int(p, 16) for p in decomposition.split()]
+        if len(parts) != 2 or any(p >= BMP_LIMIT for p in parts):
+            continue
+        if unicodedata.normalize('NFC', chr(parts[0]) + chr(parts[1])) != ch:
+            continue
+        pairs[(parts[0] << 16) | parts[1]] = code
+    return pairs
+
+
+def build():
+    decompositions = Pool()
+    folds = Pool()
+    pairs = composition_pairs()
+    second_of_pair = {key & 0xFFFF for key in pairs}
+
+    records = []
+    record_index = {}
+    code_records = []
+
+    for code in range(BMP_LIMIT):
+        ch = chr(code)
+        record = (0, 0, 0, 0, 0, 0, 0, 0, 0)
+        if not is_hangul_syllable(code) and not (0xD800 <= code < 0xE000):
+            nfd = unicodedata.normalize('NFD', ch)
+            nfkd = unicodedata.normalize('NFKD', ch)
+            folded = ch.casefold()
+
+            canonical_offset = canonical_len = 0
+            if nfd != ch:
+                units = utf16_units(nfd)
+                canonical_offset, canonical_len = decompositions.add(units), len(units)
+
+            compat_offset = compat_len = 0
+            if nfkd != ch:
+                units = utf16_units(nfkd)
+                compat_offset, compat_len = decompositions.add(units), len(units)
+
+            fold_offset = fold_len = 0
+            if folded != ch:
+                units = utf16_units(folded)
+                fold_offset, fold_len = folds.add(units), len(units)
+
+            quick_check = 0
+            if nfd != ch:
+                quick_check |= QC_NFD_NO
+            if nfkd != ch:
+                quick_check |= QC_NFKD_NO
+            if unicodedata.normalize('NFC', ch) != ch:
+                quick_check |= QC_NFC_NO
+            elif code in second_of_pair:
+                quick_check |= QC_NFC_MAYBE
+            if unicodedata.normalize('NFKC', ch) != ch:
+                quick_check |= QC_NFKC_NO
+            elif code in second_of_pair:
+                quick_check |= QC_NFKC_MAYBE
+
+            record = (canonical_offset, compat_offset, canonical_len, compat_len,
+                      fold_offset, fold_len, unicodedata.combining(ch), quick_check,
+                      accent_base(ch))
+
+        if record not in record_index:
+            record_index[record] = len(records)
+            records.append(record)
+        code_records.append(record_index[record])
+
+    # Stage 1 maps the high byte to a deduplicated 256-entry block in stage 2
+    blocks = []
+    block_index = {}
+    stage1 = []
+    for start in range(0, BMP_LIMIT, BLOCK_SIZE):
+        block = tuple(code_records[start:start + BLOCK_SIZE])
+        if block not in block_index:
+            block_index[block] = len(blocks)
+            blocks.append(block)
+        stage1.append(block_index[block])
+
+    assert len(records) < 0x10000, 'record index no longer fits in uint16'
+    assert len(decompositions.units) < 0x10000 and len(folds.units) < 0x10000, 'pool offsets no longer fit in uint16'
+    assert max(r[2] for r in records) < 256 and max(r[3] for r in records) < 256
+
+    return stage1, blocks, records, decompositions.units, folds.units, sorted(pairs.items())
+
+
+def format_array(values, per_line=16, fmt='0x{:04X}'):
+    lines = []
+    for start in range(0, len(values), per_line):
+        lines.append('        ' + ', '.join(fmt.format(v) for v in values[start:start + per_line]) + ',')
+    return '\n'.join(lines)
+
+
+def emit(stage1, blocks, records, decompositions, folds, pairs):
+    out = []
+    out.append('// Source/ReasoningEngine/Private/Infrastructure/REUnicodeTables.inl')
+    out.append('// GENERATED by Tools/GenerateUnicodeTables.py from Unicode %s - do not edit' % unicodedata.unidata_version)
+    out.append('#pragma once')
+    out.append('')
+    out.append('namespace REUnicodeTables')
+    out.append('{')
+    out.append('    inline constexpr int32 BlockBits = %d;' % BLOCK_BITS)
+    out.append('    inline constexpr int32 NumBlocks = %d;' % len(blocks))
+    out.append('    inline constexpr int32 NumRecords = %d;' % len(records))
+    out.append('    inline constexpr int32 NumCompositions = %d;' % len(pairs))
+    out.append('')
+    out.append('    /** High byte of a code unit -> block in Stage2 */')
+    out.append('    inline constexpr uint8 Stage1[%d] = {' % len(stage1))
+    out.append(format_array(stage1, 16, '{:3d}'))
+    out.append('    };')
+    out.append('')
+    out.append('    /** Block * 256 + low byte -> index into Records */')
+    out.append('    inline constexpr uint16 Stage2[%d] = {' % (len(blocks) * BLOCK_SIZE))
+    flat = [value for block in blocks for value in block]
+    out.append(format_array(flat, 16, '{:d}'))
+    out.append('    };')
+    out.append('')
+    out.append('    /** Per-character properties, see REUnicode::FCharRecord */')
+    out.append('    inline constexpr REUnicode::FCharRecord Records[%d] = {' % len(records))
+    for r in records:
+        out.append('        { %d, %d, %d, %d, %d, %d, %d, 0x%02X, 0x%04X },' % r)
+    out.append('    };')
+    out.append('')
+    out.append('    /** Full canonical and compatibility decompositions (UTF-16) */')
+    out.append('    inline constexpr uint16 DecompositionPool[%d] = {' % max(1, len(decompositions)))
+    out.append(format_array(decompositions or [0]))
+    out.append('    };')
+    out.append('')
+    out.append('    /** Full case folding results (UTF-16) */')
+    out.append('    inline constexpr uint16 FoldPool[%d] = {' % max(1, len(folds)))
+    out.append(format_array(folds or [0]))
+    out.append('    };')
+    out.append('')
+    out.append('    /** Sorted (First << 16 | Second) keys of primary composites */')
+    out.append('    inline constexpr uint32 CompositionKeys[%d] = {' % len(pairs))
+    out.append(format_array([k for k, _ in pairs], 8, '0x{:08X}'))
+    out.append('    };')
+    out.append('')
+    out.append('    /** Composite for each entry of CompositionKeys */')
+    out.append('    inline constexpr uint16 CompositionValues[%d] = {' % len(pairs))
+    out.append(format_array([v for _, v in pairs]))
+    out.append('    };')
+    out.append('}')
+    out.append('')
+    return '\n'.join(out)
+
+
+def main():
+    tables = build()
+    text = emit(*tables)
+    with open(OUTPUT_PATH, 'w', encoding='utf-8', newline='\n') as f:
+        f.write(text)
+    stage1, blocks, records, decompositions, folds, pairs = tables
+    print('Unicode %s: %d blocks, %d records, %d decomposition units, %d fold units, %d compositions'
+          % (unicodedata.unidata_version, len(blocks), len(records), len(decompositions), len(folds), len(pairs)))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())